@@ -0,0 +1,298 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Clock follower: a local oscillator phase-locked to an external clock, running
+// at p/q times the clock frequency.
+//
+// The period of the clock is estimated by a median-of-3 filter (rejecting
+// isolated missing or extra pulses), averaged over two successive edges (to
+// cancel out swing), and followed by a one-pole tracker whose
+// innovation is clipped (a poor man's Kalman filter, with a large gain while
+// acquiring and a small gain once locked). On top of this frequency estimate,
+// a second-order loop (proportional + integral on the phase error measured at
+// each clock edge) aligns the phase of the local oscillator. Since the
+// corrections are spread over the next clock period, the phase of the local
+// oscillator is continuous once locked - and swung clocks are followed at
+// their average tempo.
+
+#ifndef COMMON_CLOCK_FOLLOWER_H_
+#define COMMON_CLOCK_FOLLOWER_H_
+
+#include "stmlib/stmlib.h"
+
+namespace common {
+
+class ClockFollower {
+ public:
+  ClockFollower() { }
+  ~ClockFollower() { }
+
+  void Init(uint32_t max_period) {
+    max_period_ = max_period;
+    p_ = 1;
+    q_ = 1;
+    max_increment_ = 0x80000000;
+    Reset();
+  }
+
+  // Forgets everything about the clock. The next edge will be considered as
+  // the first one.
+  void Reset() {
+    counter_ = max_period_;
+    phase_ = 0;
+    phase_increment_ = 0;
+    nominal_increment_ = 0;
+    integral_ = 0;
+    proportional_ = 0;
+    period_ = 0;
+    history_[0] = history_[1] = history_[2] = 0;
+    num_periods_ = 0;
+    edge_index_ = 0;
+    previous_median_ = 0;
+    phase_error_ = 0;
+    previous_phase_error_ = 0;
+    filtered_error_ = 0;
+    lock_counter_ = 0;
+    locked_ = false;
+  }
+
+  inline void set_ratio(uint32_t p, uint32_t q) {
+    if (p != p_ || q != q_) {
+      p_ = p;
+      q_ = q;
+      edge_index_ = 0;
+      locked_ = false;
+      lock_counter_ = 0;
+      UpdateIncrement();
+    }
+  }
+
+  inline void set_max_increment(uint32_t max_increment) {
+    max_increment_ = max_increment;
+  }
+
+  // To be called once per sample.
+  inline void Process(bool clock_rising) {
+    if (clock_rising) {
+      Edge();
+    }
+    Tick();
+  }
+
+  // The same, split for renderers which deal with the edges once per block:
+  // Edge() registers a rising edge of the clock on the sample about to be
+  // processed, and Tick() advances by one sample, or by num_samples.
+  inline void Edge() {
+    Sync();
+  }
+
+  inline void Tick() {
+    ++counter_;
+    phase_ += phase_increment_;
+  }
+
+  inline void Tick(uint32_t num_samples) {
+    counter_ += num_samples;
+    phase_ += phase_increment_ * num_samples;
+  }
+
+  inline uint32_t phase() const { return phase_; }
+  inline uint32_t phase_increment() const { return phase_increment_; }
+  inline bool locked() const { return locked_; }
+  inline bool active() const { return counter_ < max_period_; }
+  inline bool has_period() const { return period_ != 0; }
+
+  // Estimated clock period, in samples.
+  inline uint32_t period() const { return period_ >> kPeriodFractionalBits; }
+
+  // Last measured phase error, in 1/2^32 of a cycle.
+  inline int32_t phase_error() const { return phase_error_; }
+
+ private:
+  // All periods are in samples, with 8 bits of fractional part.
+  static const uint8_t kPeriodFractionalBits = 8;
+
+  // Phase errors are in 1/2^32 of a cycle.
+  static const int32_t kLockThreshold = 1L << 27;
+  static const int32_t kUnlockThreshold = 1L << 29;
+  static const int32_t kSnapThreshold = 1L << 30;
+  static const uint8_t kLockCount = 4;
+
+  void Sync() {
+    uint32_t interval = counter_;
+    counter_ = 0;
+
+    uint32_t expected_phase = static_cast<uint32_t>(
+        (static_cast<uint64_t>(edge_index_ * p_ % q_) << 32) / q_);
+    ++edge_index_;
+    if (edge_index_ >= q_) {
+      edge_index_ = 0;
+    }
+
+    // First edge, or first edge after a long silence: realign, and wait for
+    // the next edge to get a period measurement.
+    if (interval >= max_period_ || interval == 0) {
+      if (interval >= max_period_) {
+        num_periods_ = 0;
+        period_ = 0;
+        integral_ = 0;
+        locked_ = false;
+        lock_counter_ = 0;
+        phase_ = 0;
+        edge_index_ = q_ > 1 ? 1 : 0;
+      }
+      return;
+    }
+
+    // Median-of-3 on the measured intervals.
+    history_[2] = history_[1];
+    history_[1] = history_[0];
+    history_[0] = interval << kPeriodFractionalBits;
+    if (num_periods_ < 3) {
+      ++num_periods_;
+    }
+    uint32_t median = history_[0];
+    if (num_periods_ >= 3) {
+      uint32_t a = history_[0];
+      uint32_t b = history_[1];
+      uint32_t c = history_[2];
+      median = a > b
+          ? (b > c ? b : (a > c ? c : a))
+          : (a > c ? a : (b > c ? c : b));
+    }
+    // Averaging two successive estimates cancels out the long-short pattern
+    // of a swung clock.
+    uint32_t estimate = num_periods_ >= 2
+        ? (median >> 1) + (previous_median_ >> 1)
+        : median;
+    previous_median_ = median;
+
+    // Period tracking. Once locked, the innovation is clipped so that a
+    // stray interval cannot throw the estimate off.
+    if (period_ == 0) {
+      period_ = estimate;
+    } else if (!locked_) {
+      period_ += static_cast<int32_t>(estimate - period_) >> 1;
+    } else {
+      int32_t innovation = estimate - period_;
+      int32_t max_innovation = period_ >> 2;
+      CONSTRAIN(innovation, -max_innovation, max_innovation);
+      period_ += innovation >> 4;
+    }
+
+    // Phase error at the edge. For the same reason as above, the loop is
+    // driven by the average of the errors measured at two successive edges.
+    phase_error_ = expected_phase - phase_;
+    int32_t error = (phase_error_ >> 1) + (previous_phase_error_ >> 1);
+    previous_phase_error_ = phase_error_;
+    filtered_error_ += (error >> 2) - (filtered_error_ >> 2);
+    int32_t abs_filtered_error = filtered_error_ < 0
+        ? -filtered_error_
+        : filtered_error_;
+    if (locked_) {
+      if (abs_filtered_error > kUnlockThreshold) {
+        locked_ = false;
+        lock_counter_ = 0;
+      }
+    } else {
+      if (abs_filtered_error < kLockThreshold) {
+        ++lock_counter_;
+        if (lock_counter_ >= kLockCount) {
+          locked_ = true;
+        }
+      } else {
+        lock_counter_ = 0;
+      }
+    }
+
+    if (!locked_ && (error > kSnapThreshold || error < -kSnapThreshold)) {
+      // Too far away - a jump is better than a long chase.
+      phase_ = expected_phase;
+      integral_ = 0;
+      error = 0;
+      previous_phase_error_ = 0;
+      filtered_error_ = 0;
+    }
+
+    // The phase correction is spread over the next clock period, so the error
+    // (in cycles) is divided by the period (in samples) to yield an increment.
+    // Gains: P = 1/2, I = 1/8 while acquiring; P = 1/4, I = 1/32 when locked.
+    int32_t correction = static_cast<int32_t>(
+        (static_cast<int64_t>(error) << kPeriodFractionalBits) / period_);
+    uint8_t shift = locked_ ? 2 : 1;
+    int32_t max_integral = nominal_increment_ >> 2;
+    integral_ += correction >> (shift + 2);
+    CONSTRAIN(integral_, -max_integral, max_integral);
+    proportional_ = correction >> shift;
+    UpdateIncrement();
+  }
+
+  void UpdateIncrement() {
+    if (!period_) {
+      phase_increment_ = 0;
+      return;
+    }
+    nominal_increment_ = static_cast<uint32_t>(
+        (static_cast<uint64_t>(p_) << (32 + kPeriodFractionalBits)) / \
+            (q_ * static_cast<uint64_t>(period_)));
+    int64_t increment = static_cast<int64_t>(nominal_increment_) + \
+        integral_ + proportional_;
+    if (increment < 0) {
+      increment = 0;
+    } else if (increment > max_increment_) {
+      increment = max_increment_;
+    }
+    phase_increment_ = static_cast<uint32_t>(increment);
+  }
+
+  uint32_t max_period_;
+  uint32_t max_increment_;
+  uint32_t p_;
+  uint32_t q_;
+
+  uint32_t counter_;
+  uint32_t phase_;
+  uint32_t phase_increment_;
+  uint32_t nominal_increment_;
+  int32_t integral_;
+  int32_t proportional_;
+
+  uint32_t period_;
+  uint32_t history_[3];
+  uint32_t previous_median_;
+  uint8_t num_periods_;
+  uint32_t edge_index_;
+
+  int32_t phase_error_;
+  int32_t previous_phase_error_;
+  int32_t filtered_error_;
+  uint8_t lock_counter_;
+  bool locked_;
+
+  DISALLOW_COPY_AND_ASSIGN(ClockFollower);
+};
+
+}  // namespace common
+
+#endif  // COMMON_CLOCK_FOLLOWER_H_
@@ -0,0 +1,196 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Fixed-point state variable filter. The cutoff and damping tables depend on
+// the sample rate, so each project instantiates it with its own tables.
+
+#ifndef COMMON_STATE_VARIABLE_FILTER_H_
+#define COMMON_STATE_VARIABLE_FILTER_H_
+
+#include "stmlib/stmlib.h"
+
+#include "stmlib/utils/dsp.h"
+
+namespace common {
+
+enum SvfMode {
+  SVF_MODE_LP,
+  SVF_MODE_BP,
+  SVF_MODE_HP
+};
+
+template<const uint16_t* cutoff_lut, const uint16_t* damp_lut>
+class StateVariableFilter {
+ public:
+  StateVariableFilter() { }
+  ~StateVariableFilter() { }
+  
+  void Init() {
+    lp_ = 0;
+    bp_ = 0;
+    frequency_ = 33 << 7;
+    resonance_ = 16384;
+    dirty_ = true;
+    punch_ = 0;
+    mode_ = SVF_MODE_BP;
+  }
+  
+  // The coefficients are only recomputed when the frequency or resonance
+  // has actually changed.
+  inline void set_frequency(int16_t frequency) {
+    if (frequency != frequency_) {
+      frequency_ = frequency;
+      dirty_ = true;
+    }
+  }
+  
+  inline void set_resonance(int16_t resonance) {
+    if (resonance != resonance_) {
+      resonance_ = resonance;
+      dirty_ = true;
+    }
+  }
+  
+  inline void set_punch(uint16_t punch) {
+    punch_ = (static_cast<uint32_t>(punch) * punch) >> 24;
+  }
+  
+  inline void set_mode(SvfMode mode) {
+    mode_ = mode;
+  }
+
+  inline int32_t Process(int32_t in) {
+    UpdateCoefficients();
+    int32_t hp;
+    Tick(in, &lp_, &bp_, &hp);
+    return mode_ == SVF_MODE_BP ? bp_ : (mode_ == SVF_MODE_HP ? hp : lp_);
+  }
+  
+  // All three outputs, computed in one pass.
+  inline void Process(int32_t in, int32_t* lp, int32_t* bp, int32_t* hp) {
+    UpdateCoefficients();
+    Tick(in, &lp_, &bp_, hp);
+    *lp = lp_;
+    *bp = bp_;
+  }
+  
+  // Block versions: the coefficients are updated once for the whole block and
+  // the state is kept in registers. in and out can be the same buffer.
+  void ProcessBlock(const int32_t* in, int32_t* out, size_t size) {
+    UpdateCoefficients();
+    int32_t lp = lp_;
+    int32_t bp = bp_;
+    int32_t hp;
+    switch (mode_) {
+      case SVF_MODE_LP:
+        while (size--) {
+          Tick(*in++, &lp, &bp, &hp);
+          *out++ = lp;
+        }
+        break;
+      case SVF_MODE_BP:
+        while (size--) {
+          Tick(*in++, &lp, &bp, &hp);
+          *out++ = bp;
+        }
+        break;
+      case SVF_MODE_HP:
+        while (size--) {
+          Tick(*in++, &lp, &bp, &hp);
+          *out++ = hp;
+        }
+        break;
+    }
+    lp_ = lp;
+    bp_ = bp;
+  }
+  
+  void ProcessBlock(
+      const int32_t* in,
+      int32_t* lp_out,
+      int32_t* bp_out,
+      int32_t* hp_out,
+      size_t size) {
+    UpdateCoefficients();
+    int32_t lp = lp_;
+    int32_t bp = bp_;
+    while (size--) {
+      Tick(*in++, &lp, &bp, hp_out++);
+      *lp_out++ = lp;
+      *bp_out++ = bp;
+    }
+    lp_ = lp;
+    bp_ = bp;
+  }
+  
+ private:
+  inline void UpdateCoefficients() {
+    if (dirty_) {
+      f_ = stmlib::Interpolate824(cutoff_lut, frequency_ << 17);
+      damp_ = stmlib::Interpolate824(damp_lut, resonance_ << 17);
+      dirty_ = false;
+    }
+  }
+  
+  inline void Tick(int32_t in, int32_t* lp, int32_t* bp, int32_t* hp) const {
+    int32_t f = f_;
+    int32_t damp = damp_;
+    if (punch_) {
+      int32_t punch_signal = *lp > 4096 ? *lp : 2048;
+      f += ((punch_signal >> 4) * punch_) >> 9;
+      damp += ((punch_signal - 2048) >> 3);
+    }
+    int32_t notch = in - (*bp * damp >> 15);
+    int32_t l = *lp + (f * *bp >> 15);
+    CLIP(l)
+    int32_t h = notch - l;
+    int32_t b = *bp + (f * h >> 15);
+    CLIP(b)
+    *lp = l;
+    *bp = b;
+    *hp = h;
+  }
+  
+  bool dirty_;
+  
+  int16_t frequency_;
+  int16_t resonance_;
+  
+  int32_t punch_;
+  int32_t f_;
+  int32_t damp_;
+
+  int32_t lp_;
+  int32_t bp_;
+  
+  SvfMode mode_;
+
+  DISALLOW_COPY_AND_ASSIGN(StateVariableFilter);
+};
+
+}  // namespace common
+
+#endif  // COMMON_STATE_VARIABLE_FILTER_H_
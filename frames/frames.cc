@@ -25,6 +25,7 @@
 #include <stm32f10x_conf.h>
 
 #include "stmlib/system/system_clock.h"
+#include "stmlib/utils/ring_buffer.h"
 
 #include "frames/drivers/dac.h"
 #include "frames/drivers/system.h"
@@ -43,6 +44,11 @@ System sys;
 TriggerOutput trigger_output;
 Ui ui;
 
+// In poly LFO mode, frames are rendered by blocks and played back by the DAC
+// interrupt.
+const size_t kPolyLfoBlockSize = 8;
+RingBuffer<uint16_t, kPolyLfoBlockSize * kNumChannels * 2> poly_lfo_buffer;
+
 // Default interrupt handlers.
 extern "C" {
 
@@ -81,6 +87,11 @@ void TIM1_UP_IRQHandler(void) {
   dac.Update();
   if (dac.ready()) {
     ++refresh;
+    if (ui.poly_lfo_mode() && poly_lfo_buffer.readable() >= kNumChannels) {
+      for (uint8_t i = 0; i < kNumChannels; ++i) {
+        dac.Write(i, poly_lfo_buffer.ImmediateRead());
+      }
+    }
   }
   
   int16_t position = keyframer.position();
@@ -124,6 +135,7 @@ void Init() {
   trigger_output.Low();
   keyframer.Init();
   poly_lfo.Init();
+  poly_lfo_buffer.Init();
   ui.Init(&keyframer, &poly_lfo);
   sys.StartTimers();
 }
@@ -138,7 +150,7 @@ int main(void) {
   ui.TryCalibration();
   
   bool trigger_detector_armed = false;
-  uint8_t sequencer_step = 0;
+  uint16_t sequencer_step = 0;
   int32_t dc_offset_frame_modulation = keyframer.dc_offset_frame_modulation();
 
   while (1) {
@@ -151,11 +163,14 @@ int main(void) {
           (ui.frame_modulation() - dc_offset_frame_modulation) << 1;
       frame += frame_modulation;
       if (ui.poly_lfo_mode()) {
-        poly_lfo.Render(frame);
-        dac.Write(0, poly_lfo.dac_code(0));
-        dac.Write(1, poly_lfo.dac_code(1));
-        dac.Write(2, poly_lfo.dac_code(2));
-        dac.Write(3, poly_lfo.dac_code(3));
+        const size_t kBlockBufferSize = kPolyLfoBlockSize * kNumChannels;
+        if (poly_lfo_buffer.writable() >= kBlockBufferSize) {
+          uint16_t block[kBlockBufferSize];
+          poly_lfo.Render(frame, block, kPolyLfoBlockSize);
+          for (size_t i = 0; i < kBlockBufferSize; ++i) {
+            poly_lfo_buffer.Overwrite(block[i]);
+          }
+        }
       } else {
         if (frame < 0) {
           frame = 0;
@@ -175,7 +190,7 @@ int main(void) {
           if (sequencer_step >= keyframer.num_keyframes()) {
             sequencer_step = 0;
           }
-          frame = keyframer.keyframe(sequencer_step).timestamp;
+          frame = keyframer.timestamp(sequencer_step);
         }
         
         keyframer.Evaluate(frame);
@@ -31,7 +31,9 @@
 #include <algorithm>
 
 #ifndef TEST
-#include "stmlib/system/storage.h"
+#include <stm32f10x_conf.h>
+
+#include "stmlib/system/flash_programming.h"
 #endif  // TEST
 
 #include "frames/resources.h"
@@ -41,7 +43,9 @@ namespace frames {
 using namespace std;
 
 /* static */
-const uint8_t Keyframer::palette_[kNumPaletteEntries][3] = {
+template<uint8_t num_channels>
+const uint8_t MultiChannelKeyframer<num_channels>::palette_[
+    kNumPaletteEntries][3] = {
   { 255, 0, 0 },
   { 255, 64, 0 },
   { 255, 255, 0 },
@@ -52,63 +56,344 @@ const uint8_t Keyframer::palette_[kNumPaletteEntries][3] = {
   { 255, 0, 64 },
 };
 
+const uint8_t kStoreFormat = 1;
+
+const uint8_t kLegacyMaxNumKeyframe = 64;
+const uint8_t kLegacyNumChannels = 4;
+const size_t kLegacyKeyframeSize = 12;
+const size_t kLegacyChannelSettingsSize = 8;
+
 #ifndef TEST
-stmlib::Storage<0x8020000, 4> storage;
+
+static uint16_t Checksum(const uint8_t* data, size_t size) {
+  uint16_t s = 0;
+  while (size--) {
+    s += *data++;
+  }
+  return s;
+}
+
+// The keyframes are saved in the last 4 pages of the flash memory, in blocks
+// laid out as stmlib::Storage::ParsimoniousSave does: the data, a 16-bit
+// checksum and a 16-bit version number. There is room for a single block of
+// STORE_SIZE bytes, so each save erases the 4 pages and writes block 0.
+const uint32_t kStorageEnd = 0x8020000;
+const uint32_t kStorageNumPages = 4;
+const uint32_t kStorageBase = kStorageEnd - kStorageNumPages * PAGE_SIZE;
+
+// The data is encoded and written to flash in chunks of this size.
+const size_t kStoreChunkSize = 64;
+
+// Returns the most recent valid block of data_size bytes, like
+// stmlib::Storage::ParsimoniousLoad, but reads it in place rather than copying
+// it to RAM.
+static const uint8_t* FindBlock(size_t data_size) {
+  size_t block_size = data_size + 2 + 2;
+  for (int16_t version = kStorageNumPages * PAGE_SIZE / block_size - 1;
+       version >= 0;
+       --version) {
+    const uint8_t* block = reinterpret_cast<const uint8_t*>(
+        kStorageBase + version * block_size);
+    uint16_t checksum = block[data_size] | (block[data_size + 1] << 8);
+    uint16_t block_version = block[data_size + 2] | (block[data_size + 3] << 8);
+    if (block_version == version && checksum == Checksum(block, data_size)) {
+      return block;
+    }
+  }
+  return NULL;
+}
+
 #endif  // TEST
 
-void Keyframer::Init() {
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::Init() {
 #ifndef TEST
-  if (!storage.ParsimoniousLoad(keyframes_, SETTINGS_SIZE, &version_token_)) {
-    for (uint8_t i = 0; i < kNumChannels; ++i) {
-      settings_[i].easing_curve = EASING_CURVE_LINEAR;
-      settings_[i].response = 0;
+  const uint8_t* block = FindBlock(STORE_SIZE);
+  if (!block || !Deserialize(block)) {
+    block = FindBlock(LEGACY_STORE_SIZE);
+    if (block && DeserializeLegacy(block)) {
+      // Convert the data saved by an older firmware on the first boot.
+      SaveToStorage();
+    } else {
+      for (uint8_t i = 0; i < num_channels; ++i) {
+        settings_[i].easing_curve = EASING_CURVE_LINEAR;
+        settings_[i].response = 0;
+      }
+      extra_settings_ = 0;
+      dc_offset_frame_modulation_ = 32767;
+      Clear();
     }
-    extra_settings_ = 0;
-    dc_offset_frame_modulation_ = 32767;
-    Clear();
   }
 #endif  // TEST
+  fill(&response_curve_setting_[0], &response_curve_setting_[num_channels], -1);
+  InvalidateSegment();
 }
 
-void Keyframer::Save(uint32_t extra_settings) {
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::Save(uint32_t extra_settings) {
   extra_settings_ = extra_settings;
-#ifndef TEST
-  storage.ParsimoniousSave(keyframes_, SETTINGS_SIZE, &version_token_);
-#endif  // TEST
+  SaveToStorage();
 }
 
-void Keyframer::Calibrate(int32_t dc_offset_frame_modulation) {
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::Calibrate(
+    int32_t dc_offset_frame_modulation) {
   dc_offset_frame_modulation_ = dc_offset_frame_modulation;
+  SaveToStorage();
+}
+
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::SaveToStorage() const {
 #ifndef TEST
-  storage.ParsimoniousSave(keyframes_, SETTINGS_SIZE, &version_token_);
+  FLASH_Unlock();
+  for (uint32_t i = 0; i < kStorageNumPages; ++i) {
+    FLASH_ErasePage(kStorageBase + i * PAGE_SIZE);
+  }
+  uint32_t chunk[kStoreChunkSize / sizeof(uint32_t)];
+  uint8_t* bytes = reinterpret_cast<uint8_t*>(&chunk[0]);
+  uint16_t checksum = 0;
+  const size_t store_size = STORE_SIZE;
+  for (size_t start = 0; start < store_size; start += kStoreChunkSize) {
+    size_t size = min(kStoreChunkSize, store_size - start);
+    Serialize(bytes, start, size);
+    checksum += Checksum(bytes, size);
+    for (size_t i = 0; i < size / sizeof(uint32_t); ++i) {
+      FLASH_ProgramWord(kStorageBase + start + i * sizeof(uint32_t), chunk[i]);
+    }
+  }
+  FLASH_ProgramHalfWord(kStorageBase + STORE_SIZE, checksum);
+  FLASH_ProgramHalfWord(kStorageBase + STORE_SIZE + 2, 0);
 #endif  // TEST
 }
 
-void Keyframer::Clear() {
-  Keyframe empty;
-  empty.timestamp = 0;
-  empty.id = 0;
-  fill(&empty.values[0], &empty.values[kNumChannels], 0);
-  fill(&keyframes_[0], &keyframes_[kMaxNumKeyframe], empty);
+// Keeps the bytes of the encoded stream which fall within a window.
+class StoreWriter {
+ public:
+  StoreWriter(uint8_t* data, size_t start, size_t size)
+      : data_(data),
+        start_(start),
+        size_(size),
+        position_(0) { }
+  ~StoreWriter() { }
+
+  inline void Write(uint32_t value, uint8_t size) {
+    while (size--) {
+      Put(value);
+      value >>= 8;
+    }
+  }
+
+  inline void Put(uint8_t byte) {
+    // Wraps around, and fails the test, for positions before the window.
+    if (position_ - start_ < size_) {
+      data_[position_ - start_] = byte;
+    }
+    ++position_;
+  }
+
+  inline size_t position() const { return position_; }
+
+ private:
+  uint8_t* data_;
+  size_t start_;
+  size_t size_;
+  size_t position_;
+
+  DISALLOW_COPY_AND_ASSIGN(StoreWriter);
+};
+
+static inline const uint8_t* Read(const uint8_t* p, uint32_t* value,
+                                  uint8_t size) {
+  *value = 0;
+  for (uint8_t i = 0; i < size; ++i) {
+    *value |= static_cast<uint32_t>(*p++) << (i * 8);
+  }
+  return p;
+}
+
+template<uint8_t num_channels>
+size_t MultiChannelKeyframer<num_channels>::Serialize(
+    uint8_t* data,
+    size_t start,
+    size_t size) const {
+  fill(data, data + size, 0);
+  StoreWriter writer(data, start, size);
+  writer.Put(kStoreFormat);
+  for (uint8_t i = 0; i < num_channels; ++i) {
+    writer.Put(settings_[i].easing_curve);
+    writer.Put(settings_[i].response);
+  }
+  writer.Write(extra_settings_, 4);
+  writer.Write(dc_offset_frame_modulation_, 4);
+  writer.Write(id_counter_, 2);
+  writer.Write(num_keyframes_, 2);
+
+  uint16_t previous_timestamp = 0;
+  for (uint16_t i = 0; i < num_keyframes_; ++i) {
+    // Timestamp delta, 7 bits at a time, least significant group first.
+    uint16_t delta = timestamps_[i] - previous_timestamp;
+    while (delta >= 0x80) {
+      writer.Put(0x80 | (delta & 0x7f));
+      delta >>= 7;
+    }
+    writer.Put(delta);
+    previous_timestamp = timestamps_[i];
+    
+    // Palette index in the lowest 4 bits, followed by the change mask.
+    uint8_t flags[STORE_FLAGS_SIZE];
+    fill(&flags[0], &flags[STORE_FLAGS_SIZE], 0);
+    flags[0] = ids_[i] & (kNumPaletteEntries - 1);
+    for (uint8_t j = 0; j < num_channels; ++j) {
+      uint16_t previous = i ? values_[i - 1][j] : 0;
+      if (values_[i][j] != previous) {
+        flags[(j + 4) >> 3] |= 1 << ((j + 4) & 7);
+      }
+    }
+    for (uint8_t j = 0; j < STORE_FLAGS_SIZE; ++j) {
+      writer.Put(flags[j]);
+    }
+    for (uint8_t j = 0; j < num_channels; ++j) {
+      if (flags[(j + 4) >> 3] & (1 << ((j + 4) & 7))) {
+        writer.Write(values_[i][j], 2);
+      }
+    }
+  }
+  return writer.position();
+}
+
+template<uint8_t num_channels>
+bool MultiChannelKeyframer<num_channels>::Deserialize(const uint8_t* data) {
+  const uint8_t* p = data;
+  const uint8_t* end = data + STORE_SIZE;
+  if (*p++ != kStoreFormat) {
+    return false;
+  }
+  for (uint8_t i = 0; i < num_channels; ++i) {
+    settings_[i].easing_curve = static_cast<EasingCurve>(*p++);
+    settings_[i].response = *p++;
+  }
+  uint32_t value;
+  p = Read(p, &value, 4);
+  extra_settings_ = value;
+  p = Read(p, &value, 4);
+  dc_offset_frame_modulation_ = value;
+  p = Read(p, &value, 2);
+  id_counter_ = value;
+  p = Read(p, &value, 2);
+  if (value > kMaxNumKeyframe) {
+    return false;
+  }
+  num_keyframes_ = value;
+
+  uint32_t timestamp = 0;
+  for (uint16_t i = 0; i < num_keyframes_; ++i) {
+    uint32_t delta = 0;
+    uint8_t shift = 0;
+    do {
+      if (p >= end || shift > 14) {
+        return false;
+      }
+      delta |= static_cast<uint32_t>(*p & 0x7f) << shift;
+      shift += 7;
+    } while (*p++ & 0x80);
+    timestamp += delta;
+    if (timestamp > 65535 || (i && !delta) || p + STORE_FLAGS_SIZE > end) {
+      return false;
+    }
+    timestamps_[i] = timestamp;
+    
+    const uint8_t* flags = p;
+    p += STORE_FLAGS_SIZE;
+    ids_[i] = flags[0] & (kNumPaletteEntries - 1);
+    for (uint8_t j = 0; j < num_channels; ++j) {
+      if (flags[(j + 4) >> 3] & (1 << ((j + 4) & 7))) {
+        if (p + 2 > end) {
+          return false;
+        }
+        p = Read(p, &value, 2);
+        values_[i][j] = value;
+      } else {
+        values_[i][j] = i ? values_[i - 1][j] : 0;
+      }
+    }
+  }
+  return true;
+}
+
+template<uint8_t num_channels>
+bool MultiChannelKeyframer<num_channels>::DeserializeLegacy(
+    const uint8_t* data) {
+  const uint8_t* p = data + kLegacyMaxNumKeyframe * kLegacyKeyframeSize;
+  uint32_t value;
+  for (uint8_t i = 0; i < num_channels; ++i) {
+    settings_[i].easing_curve = EASING_CURVE_LINEAR;
+    settings_[i].response = 0;
+    if (i < kLegacyNumChannels) {
+      Read(p, &value, 4);
+      settings_[i].easing_curve = static_cast<EasingCurve>(value);
+      settings_[i].response = p[4];
+      p += kLegacyChannelSettingsSize;
+    }
+  }
+  p = Read(p, &value, 2);
+  if (value > kLegacyMaxNumKeyframe) {
+    return false;
+  }
+  num_keyframes_ = value;
+  p = Read(p, &value, 2);
+  id_counter_ = value;
+  p = Read(p, &value, 4);
+  extra_settings_ = value;
+  p = Read(p, &value, 4);
+  dc_offset_frame_modulation_ = value;
+  
+  for (uint16_t i = 0; i < num_keyframes_; ++i) {
+    p = data + i * kLegacyKeyframeSize;
+    p = Read(p, &value, 2);
+    if (i && value <= timestamps_[i - 1]) {
+      return false;
+    }
+    timestamps_[i] = value;
+    p = Read(p, &value, 2);
+    ids_[i] = value;
+    for (uint8_t j = 0; j < num_channels; ++j) {
+      values_[i][j] = 0;
+      if (j < kLegacyNumChannels) {
+        p = Read(p, &value, 2);
+        values_[i][j] = value;
+      }
+    }
+  }
+  return true;
+}
+
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::Clear() {
+  fill(&timestamps_[0], &timestamps_[kMaxNumKeyframe], 0);
+  fill(&ids_[0], &ids_[kMaxNumKeyframe], 0);
+  fill(&values_[0][0], &values_[0][0] + kMaxNumKeyframe * num_channels, 0);
   num_keyframes_ = 0;
   id_counter_ = 0;
+  InvalidateSegment();
 }
 
-uint16_t Keyframer::FindKeyframe(uint16_t timestamp) {
+template<uint8_t num_channels>
+uint16_t MultiChannelKeyframer<num_channels>::FindKeyframe(
+    uint16_t timestamp) {
   if (!num_keyframes_) {
     return 0;
   }
-  Keyframe dummy;
-  dummy.timestamp = timestamp;
   return lower_bound(
-      keyframes_,
-      keyframes_ + num_keyframes_,
-      dummy,
-      KeyframeLess()) - keyframes_;
+      timestamps_,
+      timestamps_ + num_keyframes_,
+      timestamp) - timestamps_;
 }
 
 /* static */
-uint16_t Keyframer::ConvertToDacCode(uint16_t gain, uint8_t response) {
+template<uint8_t num_channels>
+int32_t MultiChannelKeyframer<num_channels>::Response(
+    int32_t gain,
+    uint8_t response) {
   // Exponential response is easy, straight to the 2164.
   int32_t exponential = 65535 - gain;
   
@@ -119,12 +404,31 @@ uint16_t Keyframer::ConvertToDacCode(uint16_t gain, uint8_t response) {
   
   // Blend linear and exponential responses.
   uint16_t balance = lut_response_balance[response];
-  return (linear + ((exponential - linear) * balance >> 15)) >> 4;
+  return linear + ((exponential - linear) * balance >> 15);
 }
 
-inline uint16_t Keyframer::Easing(
-    int32_t from,
-    int32_t to,
+/* static */
+template<uint8_t num_channels>
+uint16_t MultiChannelKeyframer<num_channels>::ConvertToDacCode(
+    uint16_t gain,
+    uint8_t response) {
+  return Response(gain, response) >> 4;
+}
+
+/* static */
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::ComputeResponseCurve(
+    uint8_t response,
+    uint16_t* curve) {
+  for (uint16_t i = 0; i < kResponseCurveSize - 1; ++i) {
+    curve[i] = Response(i << 8, response);
+  }
+  curve[kResponseCurveSize - 1] = Response(65535, response);
+}
+
+/* static */
+template<uint8_t num_channels>
+inline int32_t MultiChannelKeyframer<num_channels>::ShapeScale(
     uint32_t scale,
     EasingCurve curve) {
   int32_t shaped_scale = scale;
@@ -138,10 +442,21 @@ inline uint16_t Keyframer::Easing(
     shaped_scale = scale_a + (((scale_b - scale_a) >> 1) * \
       ((scale << 10) & 0xffff) >> 15);
   }
+  return shaped_scale;
+}
+
+template<uint8_t num_channels>
+inline uint16_t MultiChannelKeyframer<num_channels>::Easing(
+    int32_t from,
+    int32_t to,
+    uint32_t scale,
+    EasingCurve curve) {
+  int32_t shaped_scale = ShapeScale(scale, curve);
   return from + ((to - from) * (shaped_scale >> 1) >> 15);
 }
 
-uint16_t Keyframer::SampleAnimation(
+template<uint8_t num_channels>
+uint16_t MultiChannelKeyframer<num_channels>::SampleAnimation(
     uint8_t channel,
     uint16_t tick,
     bool easing) {
@@ -159,7 +474,10 @@ uint16_t Keyframer::SampleAnimation(
   return sample;
 }
 
-int16_t Keyframer::FindNearestKeyframe(uint16_t timestamp, uint16_t tolerance) {
+template<uint8_t num_channels>
+int16_t MultiChannelKeyframer<num_channels>::FindNearestKeyframe(
+    uint16_t timestamp,
+    uint16_t tolerance) {
   if (!num_keyframes_) {
     return -1;
   }
@@ -167,7 +485,7 @@ int16_t Keyframer::FindNearestKeyframe(uint16_t timestamp, uint16_t tolerance) {
   uint16_t search_start = index ? index - 1 : 0;
   uint16_t search_end = index < num_keyframes_ - 1 ? index + 2 : num_keyframes_;
   for (uint16_t i = search_start; i < search_end; ++i) {
-    uint16_t t = keyframes_[i].timestamp;
+    uint16_t t = timestamps_[i];
     int32_t distance = static_cast<int32_t>(t) - static_cast<int32_t>(timestamp);
     if (distance < tolerance && -distance < tolerance) {
       return i;
@@ -176,85 +494,148 @@ int16_t Keyframer::FindNearestKeyframe(uint16_t timestamp, uint16_t tolerance) {
   return -1;
 }
 
-bool Keyframer::AddKeyframe(uint16_t timestamp, uint16_t* values) {
+template<uint8_t num_channels>
+bool MultiChannelKeyframer<num_channels>::AddKeyframe(
+    uint16_t timestamp,
+    uint16_t* values) {
   if (num_keyframes_ == kMaxNumKeyframe) {
     return false;
   }
   
   uint16_t insertion_point = FindKeyframe(timestamp);
   if (insertion_point >= num_keyframes_ ||
-      keyframes_[insertion_point].timestamp != timestamp) {
+      timestamps_[insertion_point] != timestamp) {
     for (int16_t i = num_keyframes_ - 1; i >= insertion_point; --i) {
-      keyframes_[i + 1] = keyframes_[i];
+      timestamps_[i + 1] = timestamps_[i];
+      ids_[i + 1] = ids_[i];
+      copy(values_[i], values_[i] + num_channels, values_[i + 1]);
     }
-    keyframes_[insertion_point].timestamp = timestamp;
-    keyframes_[insertion_point].id = id_counter_++;
+    timestamps_[insertion_point] = timestamp;
+    ids_[insertion_point] = id_counter_++;
     ++num_keyframes_;
   }
-  copy(values, values + kNumChannels, keyframes_[insertion_point].values);
+  copy(values, values + num_channels, values_[insertion_point]);
+  InvalidateSegment();
   return true;
 }
 
-bool Keyframer::RemoveKeyframe(uint16_t timestamp) {
+template<uint8_t num_channels>
+bool MultiChannelKeyframer<num_channels>::RemoveKeyframe(uint16_t timestamp) {
   if (!num_keyframes_) {
     return false;
   }
   uint16_t splice_point = FindKeyframe(timestamp);
-  if (keyframes_[splice_point].timestamp != timestamp) {
+  if (timestamps_[splice_point] != timestamp) {
     return false;
   }
   
   for (uint16_t i = splice_point; i < num_keyframes_ - 1; ++i) {
-    keyframes_[i] = keyframes_[i + 1];
+    timestamps_[i] = timestamps_[i + 1];
+    ids_[i] = ids_[i + 1];
+    copy(values_[i + 1], values_[i + 1] + num_channels, values_[i]);
   }
   --num_keyframes_;
+  InvalidateSegment();
   return true;
 }
 
-void Keyframer::Evaluate(uint16_t timestamp) {
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::FindSegment(uint16_t timestamp) {
+  uint16_t position = FindKeyframe(timestamp);
+  position_ = position;
+  segment_start_ = position == 0 ? -1 : timestamps_[position - 1];
+  segment_end_ = position == num_keyframes_ ? 65535 : timestamps_[position];
+  if (position != 0 && position != num_keyframes_) {
+    // (x << 16) / length == x * ceil(2^48 / length) >> 32 for all
+    // x < length < 65536: the error term is below 2^-16, and the
+    // fractional part of the quotient cannot exceed 1 - 1 / length.
+    uint64_t length = segment_end_ - segment_start_;
+    segment_reciprocal_ = ((static_cast<uint64_t>(1) << 48) + length - 1) / \
+        length;
+  }
+}
+
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::Evaluate(uint16_t timestamp) {
   if (!num_keyframes_) {
-    copy(immediate_, immediate_ + kNumChannels, levels_);
+    copy(immediate_, immediate_ + num_channels, levels_);
     fill(color_, color_ + 3, 0xff);
     position_ = -1;
     nearest_keyframe_ = -1;
   } else {
-    uint16_t position = FindKeyframe(timestamp);
-    position_ = position;
+    if (timestamp <= segment_start_ || timestamp > segment_end_) {
+      FindSegment(timestamp);
+    }
+    uint16_t position = position_;
 
     // Check for the areas before the first keyframe, and after the last
     // keyframe.
     if (position == 0 || position == num_keyframes_) {
-      const Keyframe& source = keyframes_[position == 0 ? 0 : num_keyframes_ - 1];
-      copy(source.values, source.values + kNumChannels, levels_);
-      const uint8_t* palette = palette_[source.id & (kNumPaletteEntries - 1)];
+      uint16_t source = position == 0 ? 0 : num_keyframes_ - 1;
+      copy(values_[source], values_[source] + num_channels, levels_);
+      const uint8_t* palette = palette_[
+          ids_[source] & (kNumPaletteEntries - 1)];
       copy(palette, palette + 3, color_);
     } else {
       // This is where the real interpolation takes place.
-      const Keyframe& a = keyframes_[position - 1];
-      const Keyframe& b = keyframes_[position];
-      uint32_t scale = timestamp - a.timestamp;
-      scale <<= 16;
-      scale /= (b.timestamp - a.timestamp);
-      for (uint8_t i = 0; i < kNumChannels; ++i) {
-        int32_t from = a.values[i];
-        int32_t to = b.values[i];
-        levels_[i] = Easing(from, to, scale, settings_[i].easing_curve);
+      uint16_t a = position - 1;
+      uint16_t b = position;
+      uint32_t scale = static_cast<uint32_t>(
+          (timestamp - timestamps_[a]) * segment_reciprocal_ >> 32);
+      
+      // The easing curve is applied to the interpolation coefficient of each
+      // channel, then all channels are interpolated in one pass.
+      int32_t shaped_scale[num_channels];
+      for (uint8_t i = 0; i < num_channels; ++i) {
+        shaped_scale[i] = ShapeScale(scale, settings_[i].easing_curve) >> 1;
+      }
+      const uint16_t* from = values_[a];
+      const uint16_t* to = values_[b];
+      for (uint8_t i = 0; i < num_channels; ++i) {
+        int32_t delta = static_cast<int32_t>(to[i]) - from[i];
+        levels_[i] = from[i] + (delta * shaped_scale[i] >> 15);
       }
       for (uint8_t i = 0; i < 3; ++i) {
-        uint8_t a_color = palette_[a.id & (kNumPaletteEntries - 1)][i];
-        uint8_t b_color = palette_[b.id & (kNumPaletteEntries - 1)][i];
+        uint8_t a_color = palette_[ids_[a] & (kNumPaletteEntries - 1)][i];
+        uint8_t b_color = palette_[ids_[b] & (kNumPaletteEntries - 1)][i];
         color_[i] = a_color + ((b_color - a_color) * scale >> 16);
       }
     }
     uint16_t t_this = timestamp - \
-        (position == 0 ? 0 : keyframes_[position - 1].timestamp);
-    uint16_t t_next = keyframes_[position].timestamp - timestamp;
+        (position == 0 ? 0 : timestamps_[position - 1]);
+    uint16_t t_next = timestamps_[position] - timestamp;
     nearest_keyframe_ = t_next < t_this ? position + 1 : position;
   }
   
-  for (uint16_t i = 0; i < kNumChannels; ++i) {
-    dac_code_[i] = ConvertToDacCode(levels_[i], settings_[i].response);
+  for (uint8_t i = 0; i < num_channels; ++i) {
+    uint8_t response = settings_[i].response;
+    if (response != response_curve_setting_[i]) {
+      ComputeResponseCurve(response, response_curve_[i]);
+      response_curve_setting_[i] = response;
+    }
+    dac_code_[i] = ConvertToDacCode(levels_[i], response, response_curve_[i]);
   }
 }
 
+template<uint8_t num_channels>
+void MultiChannelKeyframer<num_channels>::EvaluateBlock(
+    const uint16_t* timestamps,
+    uint16_t* dac_codes,
+    size_t size) {
+  while (size--) {
+    Evaluate(*timestamps++);
+    copy(dac_code_, dac_code_ + num_channels, dac_codes);
+    dac_codes += num_channels;
+  }
+}
+
+template class MultiChannelKeyframer<kNumChannels>;
+
+#ifdef TEST
+// Wider configurations, for host tools.
+template class MultiChannelKeyframer<8>;
+template class MultiChannelKeyframer<16>;
+template class MultiChannelKeyframer<32>;
+#endif  // TEST
+
 }  // namespace frames
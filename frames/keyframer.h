@@ -34,10 +34,21 @@
 namespace frames {
   
 const uint8_t kNumChannels = 4;
-const uint8_t kMaxNumKeyframe = 64;
+// Decoded, 256 keyframes take 2.8 KB of RAM (512 bytes of timestamps, 256 of
+// palette indices, 2 KB of values), out of the 20 KB of the STM32F103. Their
+// worst-case encoding, with all values changing at every keyframe, is 2840
+// bytes and fits in the 4 flash pages reserved for the keyframer.
+const uint16_t kMaxNumKeyframe = 256;
 
 const uint8_t kNumPaletteEntries = 8;
 
+// The response of a channel (the blend between the linearized and
+// exponential responses of the 2164) is tabulated at every 256th gain
+// value. The table is too coarse for the steep bottom of the linearization
+// curve, so gains below kResponseCurveMinGain are computed directly.
+const uint16_t kResponseCurveSize = 257;
+const uint16_t kResponseCurveMinGain = 2048;
+
 enum EasingCurve {
   EASING_CURVE_STEP,
   EASING_CURVE_LINEAR,
@@ -52,22 +63,15 @@ struct ChannelSettings {
   uint8_t response;
 };
 
-struct Keyframe {
-  uint16_t timestamp;
-  uint16_t id;
-  uint16_t values[kNumChannels];
-};
-
-struct KeyframeLess {
-  bool operator()(const Keyframe& lhs, const Keyframe& rhs) {
-    return lhs.timestamp < rhs.timestamp;
-  }
-};
-
-class Keyframer {
+// Keyframer for any number of channels. Keyframes are stored as a structure
+// of arrays: the timestamps (the search index), the ids, and one row of
+// num_channels values per keyframe, so that interpolating all channels is a
+// single loop over contiguous values.
+template<uint8_t num_channels>
+class MultiChannelKeyframer {
  public:
-  Keyframer() { }
-  ~Keyframer() { }
+  MultiChannelKeyframer() { }
+  ~MultiChannelKeyframer() { }
   
   void Init();
   void Save(uint32_t extra_settings);
@@ -98,6 +102,11 @@ class Keyframer {
   }
   
   void Evaluate(uint16_t timestamp);
+
+  // Evaluates the keyframer at size successive timestamps, and writes the
+  // num_channels DAC codes of each of them to dac_codes. For host tools.
+  void EvaluateBlock(const uint16_t* timestamps, uint16_t* dac_codes,
+                     size_t size);
   
   inline ChannelSettings* mutable_settings(uint8_t channel) {
     return &settings_[channel];
@@ -107,17 +116,22 @@ class Keyframer {
     return settings_[channel];
   }
   
-  inline Keyframe* mutable_keyframe(uint16_t index) {
-    return &keyframes_[index];
+  inline uint16_t timestamp(uint16_t index) const {
+    return timestamps_[index];
   }
   
-  inline const Keyframe& keyframe(uint16_t index) const {
-    return keyframes_[index];
+  inline uint16_t* mutable_values(uint16_t index) {
+    return values_[index];
+  }
+  
+  inline const uint16_t* values(uint16_t index) const {
+    return values_[index];
   }
   
   inline uint16_t num_keyframes() const { return num_keyframes_; }
   
   uint16_t Easing(int32_t from, int32_t to, uint32_t scale, EasingCurve curve);
+  static int32_t ShapeScale(uint32_t scale, EasingCurve curve);
   
   // This creates a sample animation (between 0 to 65535 and back to 0) used
   // for animating the LED when editing the easing curve or response.
@@ -128,6 +142,19 @@ class Keyframer {
   
   void Clear();
   static uint16_t ConvertToDacCode(uint16_t gain, uint8_t response);
+  static void ComputeResponseCurve(uint8_t response, uint16_t* curve);
+
+  static inline uint16_t ConvertToDacCode(
+      uint16_t gain,
+      uint8_t response,
+      const uint16_t* curve) {
+    if (gain < kResponseCurveMinGain) {
+      return ConvertToDacCode(gain, response);
+    }
+    int32_t a = curve[gain >> 8];
+    int32_t b = curve[(gain >> 8) + 1];
+    return (a + ((b - a) * (gain & 0xff) >> 8)) >> 4;
+  }
 
   // In addition to the keyframer data, this extra word stores in
   // persistent storage things like sequencer mode on/off and
@@ -136,41 +163,85 @@ class Keyframer {
   inline int32_t dc_offset_frame_modulation() const {
     return dc_offset_frame_modulation_;
   }
+
+  // Keyframes and settings are saved in a compact format: timestamps are
+  // delta-encoded as varints, and each keyframe only stores the values which
+  // differ from the previous keyframe, flagged by a change mask stored after
+  // the palette index. Varints take at most 2 bytes, except for at most 3
+  // deltas above 16383.
+  enum StoreSize {
+    STORE_HEADER_SIZE = 1 + num_channels * 2 + sizeof(uint32_t) + \
+        sizeof(int32_t) + sizeof(uint16_t) + sizeof(uint16_t),
+    STORE_FLAGS_SIZE = (4 + num_channels + 7) / 8,
+    STORE_KEYFRAME_SIZE = 2 + STORE_FLAGS_SIZE + \
+        num_channels * sizeof(uint16_t),
+    STORE_SIZE = (STORE_HEADER_SIZE + kMaxNumKeyframe * STORE_KEYFRAME_SIZE + \
+        3 + 3) & ~3,
+    // Data saved by the firmware before the compact format: a raw dump of 64
+    // keyframes (timestamp, id and 4 values), of the 4 channel settings (a
+    // 32-bit easing curve and a response byte, padded to 8 bytes), of the
+    // number of keyframes, id counter, extra settings and frame modulation
+    // offset.
+    LEGACY_STORE_SIZE = 64 * 12 + 4 * 8 + 2 + 2 + 4 + 4
+  };
+
+  // Writes the bytes [start, start + size) of the encoded keyframes and
+  // settings to data - so that they can be written to flash in small chunks.
+  // The encoding is padded with zeros to STORE_SIZE bytes. Returns the size of
+  // the encoding.
+  size_t Serialize(uint8_t* data, size_t start, size_t size) const;
+  bool Deserialize(const uint8_t* data);
+  bool DeserializeLegacy(const uint8_t* data);
   
  private:
   uint16_t FindKeyframe(uint16_t timestamp);
+  void FindSegment(uint16_t timestamp);
+  void SaveToStorage() const;
+  static int32_t Response(int32_t gain, uint8_t response);
+  inline void InvalidateSegment() {
+    segment_start_ = 0;
+    segment_end_ = -1;
+  }
    
-  Keyframe keyframes_[kMaxNumKeyframe];
-  ChannelSettings settings_[kNumChannels];
+  // Decoded keyframes, sorted by timestamp for binary search.
+  uint16_t timestamps_[kMaxNumKeyframe];
+  uint8_t ids_[kMaxNumKeyframe];
+  uint16_t values_[kMaxNumKeyframe][num_channels];
+  ChannelSettings settings_[num_channels];
   uint16_t num_keyframes_;
   uint16_t id_counter_;
   uint32_t extra_settings_;
   int32_t dc_offset_frame_modulation_;
   
-#ifndef TEST
-  enum SettingsSize {
-    SETTINGS_SIZE = sizeof(keyframes_) + sizeof(settings_) + \
-        sizeof(num_keyframes_) + sizeof(id_counter_) + sizeof(extra_settings_) + \
-        sizeof(dc_offset_frame_modulation_)
-  };
-#endif  // TEST
-
-  uint16_t version_token_;
-
   int16_t position_;
   int16_t nearest_keyframe_;
 
-  uint16_t dac_code_[kNumChannels];
-  uint16_t levels_[kNumChannels];
-  uint16_t immediate_[kNumChannels];
+  // All the timestamps in (segment_start_, segment_end_] are at the same
+  // position, between the same two keyframes. The reciprocal of the length
+  // of this interval is cached, so that no search or division is needed
+  // while the frame position stays within it.
+  int32_t segment_start_;
+  int32_t segment_end_;
+  uint64_t segment_reciprocal_;
+
+  uint16_t dac_code_[num_channels];
+  uint16_t levels_[num_channels];
+  uint16_t immediate_[num_channels];
+  
+  // Response curve of each channel, recomputed whenever the response setting
+  // of the channel differs from the one it has been computed for.
+  uint16_t response_curve_[num_channels][kResponseCurveSize];
+  int16_t response_curve_setting_[num_channels];
   
   uint8_t color_[3];
   
   static const uint8_t palette_[kNumPaletteEntries][3];
   
-  DISALLOW_COPY_AND_ASSIGN(Keyframer);
+  DISALLOW_COPY_AND_ASSIGN(MultiChannelKeyframer);
 };
 
+typedef MultiChannelKeyframer<kNumChannels> Keyframer;
+
 }  // namespace frames
 
 #endif  // FRAMES_KEYFRAMER_H_
@@ -41,7 +41,8 @@ using namespace std;
 using namespace stmlib;
 
 /* static */
-const uint8_t PolyLfo::rainbow_[17][3] = {
+template<uint8_t num_channels>
+const uint8_t MultiChannelPolyLfo<num_channels>::rainbow_[17][3] = {
   { 255, 0, 0 },
   { 255, 32, 0 },
   { 255, 192, 0 },
@@ -61,16 +62,20 @@ const uint8_t PolyLfo::rainbow_[17][3] = {
   { 255, 0, 128 },
 };
 
-void PolyLfo::Init() {
+template<uint8_t num_channels>
+void MultiChannelPolyLfo<num_channels>::Init() {
   spread_ = 0;
   shape_ = 0;
   shape_spread_ = 0;
   coupling_ = 0;
-  std::fill(&value_[0], &value_[kNumChannels], 0);
+  std::fill(&value_[0], &value_[num_channels + 2], 0);
+  Keyframer::ComputeResponseCurve(0, response_curve_);
 }
 
 /* static */
-uint32_t PolyLfo::FrequencyToPhaseIncrement(int32_t frequency) {
+template<uint8_t num_channels>
+uint32_t MultiChannelPolyLfo<num_channels>::FrequencyToPhaseIncrement(
+    int32_t frequency) {
   int32_t shifts = frequency / 5040;
   int32_t index = frequency - shifts * 5040;
   uint32_t a = lut_increments[index >> 5];
@@ -78,7 +83,11 @@ uint32_t PolyLfo::FrequencyToPhaseIncrement(int32_t frequency) {
   return (a + ((b - a) * (index & 0x1f) >> 5)) << shifts;
 }
 
-void PolyLfo::Render(int32_t frequency) {
+template<uint8_t num_channels>
+void MultiChannelPolyLfo<num_channels>::Render(
+    int32_t frequency,
+    uint16_t* dac_codes,
+    size_t size) {
   uint16_t rainbow_index = frequency < 0 ? 0 : (frequency > 65535 ? 65535 : frequency);
   for (uint8_t i = 0; i < 3; ++i) {
     int16_t a = rainbow_[rainbow_index >> 12][i];
@@ -86,39 +95,65 @@ void PolyLfo::Render(int32_t frequency) {
     color_[i] = a + ((b - a) * (rainbow_index & 0x0fff) >> 12);
   }
   
-  // Advance phasors.
+  // Phase increments are constant during the block.
+  uint32_t increment[num_channels];
+  uint32_t phase_difference = static_cast<uint32_t>(spread_) << 15;
   if (spread_ >= 0) {
-    phase_[0] += FrequencyToPhaseIncrement(frequency);
-    uint32_t phase_difference = static_cast<uint32_t>(spread_) << 15;
-    phase_[1] = phase_[0] + phase_difference;
-    phase_[2] = phase_[1] + phase_difference;
-    phase_[3] = phase_[2] + phase_difference;
+    increment[0] = FrequencyToPhaseIncrement(frequency);
   } else {
-    for (uint8_t i = 0; i < kNumChannels; ++i) {
-      phase_[i] += FrequencyToPhaseIncrement(frequency);
+    for (uint8_t i = 0; i < num_channels; ++i) {
+      increment[i] = FrequencyToPhaseIncrement(frequency);
       frequency -= 5040 * spread_ >> 15;
     }
   }
   
-  const uint8_t* sine = &wt_lfo_waveforms[17 * 257];
+  // A positive coupling modulates each channel by the next one, a negative
+  // coupling by the previous one.
+  int16_t coupling = coupling_ > 0 ? coupling_ : -coupling_;
+  const int16_t* neighbour = coupling_ > 0 ? &value_[2] : &value_[0];
   
-  uint16_t wavetable_index = shape_;
-  // Wavetable lookup
-  for (uint8_t i = 0; i < kNumChannels; ++i) {
-    uint32_t phase = phase_[i];
-    if (coupling_ > 0) {
-      phase += value_[(i + 1) % kNumChannels] * coupling_;
+  const uint8_t* sine = &wt_lfo_waveforms[17 * 257];
+  while (size--) {
+    // Advance phasors.
+    if (spread_ >= 0) {
+      phase_[0] += increment[0];
+      for (uint8_t i = 1; i < num_channels; ++i) {
+        phase_[i] = phase_[i - 1] + phase_difference;
+      }
     } else {
-      phase += value_[(i + kNumChannels - 1) % kNumChannels] * -coupling_;
+      for (uint8_t i = 0; i < num_channels; ++i) {
+        phase_[i] += increment[i];
+      }
+    }
+    
+    uint16_t wavetable_index = shape_;
+    // Wavetable lookup
+    for (uint8_t i = 0; i < num_channels; ++i) {
+      uint32_t phase = phase_[i] + neighbour[i] * coupling;
+      const uint8_t* a = &wt_lfo_waveforms[(wavetable_index >> 12) * 257];
+      const uint8_t* b = a + 257;
+      int16_t value = Crossfade(a, b, phase, wavetable_index << 4);
+      value_[i + 1] = Interpolate824(sine, phase);
+      if (i == 0) {
+        value_[num_channels + 1] = value_[1];
+      }
+      level_[i] = (value + 32768) >> 8;
+      dac_code_[i] = Keyframer::ConvertToDacCode(
+          value + 32768, 0, response_curve_);
+      *dac_codes++ = dac_code_[i];
+      wavetable_index += shape_spread_;
     }
-    const uint8_t* a = &wt_lfo_waveforms[(wavetable_index >> 12) * 257];
-    const uint8_t* b = a + 257;
-    int16_t value = Crossfade(a, b, phase, wavetable_index << 4);
-    value_[i] = Interpolate824(sine, phase);
-    level_[i] = (value + 32768) >> 8;
-    dac_code_[i] = Keyframer::ConvertToDacCode(value + 32768, 0);
-    wavetable_index += shape_spread_;
+    value_[0] = value_[num_channels];
   }
 }
 
+template class MultiChannelPolyLfo<kNumChannels>;
+
+#ifdef TEST
+// Wider configurations, for host tools.
+template class MultiChannelPolyLfo<8>;
+template class MultiChannelPolyLfo<16>;
+template class MultiChannelPolyLfo<32>;
+#endif  // TEST
+
 }  // namespace frames
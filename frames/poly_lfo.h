@@ -35,13 +35,24 @@
 
 namespace frames {
 
-class PolyLfo {
+// Poly LFO for any number of channels. Each channel has its own phase,
+// shape, and a coupling with its neighbours.
+template<uint8_t num_channels>
+class MultiChannelPolyLfo {
  public:
-  PolyLfo() { }
-  ~PolyLfo() { }
+  MultiChannelPolyLfo() { }
+  ~MultiChannelPolyLfo() { }
   
   void Init();
-  void Render(int32_t frequency);
+  
+  // Renders size successive frames at the same frequency, and writes the
+  // num_channels DAC codes of each of them to dac_codes. The LED color is
+  // only updated once per call.
+  void Render(int32_t frequency, uint16_t* dac_codes, size_t size);
+  
+  inline void Render(int32_t frequency) {
+    Render(frequency, dac_code_, 1);
+  }
 
   inline void set_shape(uint16_t shape) {
     shape_ = shape;
@@ -85,15 +96,25 @@ class PolyLfo {
   int32_t spread_;
   int16_t coupling_;
 
-  int16_t value_[kNumChannels];
-  uint32_t phase_[kNumChannels];
-  uint8_t level_[kNumChannels];
-  uint16_t dac_code_[kNumChannels];
+  // The value of channel i is stored in value_[i + 1]. value_[0] and
+  // value_[num_channels + 1] hold copies of the last and first channels, so
+  // that the neighbour of a channel is always at a constant offset. As in the
+  // original in-place update, the first channel reads the previous value of
+  // the last one, and the last channel reads the current value of the first
+  // one: value_[0] is refreshed after each sample, and value_[num_channels + 1]
+  // as soon as the first channel is computed.
+  int16_t value_[num_channels + 2];
+  uint32_t phase_[num_channels];
+  uint8_t level_[num_channels];
+  uint16_t dac_code_[num_channels];
+  uint16_t response_curve_[kResponseCurveSize];
   uint8_t color_[3];
 
-  DISALLOW_COPY_AND_ASSIGN(PolyLfo);
+  DISALLOW_COPY_AND_ASSIGN(MultiChannelPolyLfo);
 };
 
+typedef MultiChannelPolyLfo<kNumChannels> PolyLfo;
+
 }  // namespace frames
 
 #endif  // FRAMES_POLY_LFO_H_
@@ -0,0 +1,350 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Round trips of the keyframer through its storage formats, and evaluation of
+// blocks of timestamps.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "frames/keyframer.h"
+
+using namespace frames;
+
+const size_t kChunkSize = 64;
+
+template<uint8_t num_channels>
+void Randomize(
+    MultiChannelKeyframer<num_channels>* keyframer,
+    uint16_t num_keyframes,
+    bool all_values_change) {
+  keyframer->Init();
+  keyframer->Clear();
+  for (uint8_t i = 0; i < num_channels; ++i) {
+    keyframer->mutable_settings(i)->easing_curve = static_cast<EasingCurve>(
+        rand() % (EASING_CURVE_BOUNCE + 1));
+    keyframer->mutable_settings(i)->response = rand() & 0xff;
+  }
+  keyframer->Calibrate(rand() - RAND_MAX / 2);
+  keyframer->Save(rand());
+
+  // Spread the keyframes over the whole timeline, with a few large gaps so
+  // that all the varint lengths are used.
+  uint32_t timestamp = 0;
+  uint16_t values[num_channels];
+  for (uint16_t i = 0; i < num_keyframes; ++i) {
+    uint32_t gap = i < 2 ? 20000 : 1 + rand() % (
+        (65535 - timestamp) / (num_keyframes - i + 1));
+    timestamp += gap;
+    for (uint8_t j = 0; j < num_channels; ++j) {
+      if (all_values_change || rand() & 1) {
+        values[j] = rand() & 0xffff;
+      }
+    }
+    if (!keyframer->AddKeyframe(timestamp, values)) {
+      break;
+    }
+  }
+}
+
+template<uint8_t num_channels>
+bool Compare(
+    const char* name,
+    const MultiChannelKeyframer<num_channels>& a,
+    const MultiChannelKeyframer<num_channels>& b) {
+  bool ok = a.num_keyframes() == b.num_keyframes() && \
+      a.extra_settings() == b.extra_settings() && \
+      a.dc_offset_frame_modulation() == b.dc_offset_frame_modulation();
+  for (uint8_t i = 0; i < num_channels; ++i) {
+    ok = ok && \
+        a.mutable_settings(i).easing_curve == \
+            b.mutable_settings(i).easing_curve && \
+        a.mutable_settings(i).response == b.mutable_settings(i).response;
+  }
+  for (uint16_t i = 0; ok && i < a.num_keyframes(); ++i) {
+    ok = a.timestamp(i) == b.timestamp(i) && \
+        !memcmp(a.values(i), b.values(i), num_channels * sizeof(uint16_t));
+  }
+  if (!ok) {
+    printf("%s: the decoded keyframer differs\n", name);
+  }
+  return ok;
+}
+
+template<uint8_t num_channels>
+bool RoundTrip(const char* name, uint16_t num_keyframes, bool all_values_change) {
+  typedef MultiChannelKeyframer<num_channels> K;
+  static K source;
+  static K destination;
+  static uint8_t data[K::STORE_SIZE];
+  static uint8_t chunked[K::STORE_SIZE];
+
+  Randomize(&source, num_keyframes, all_values_change);
+  size_t size = source.Serialize(data, 0, K::STORE_SIZE);
+  printf("%s: %d keyframes, %d bytes\n", name, source.num_keyframes(),
+         static_cast<int>(size));
+  if (source.num_keyframes() != num_keyframes) {
+    printf("%s: only %d keyframes added\n", name, source.num_keyframes());
+    return false;
+  }
+  if (size > K::STORE_SIZE) {
+    printf("%s: %d bytes do not fit in %d\n", name, static_cast<int>(size),
+           K::STORE_SIZE);
+    return false;
+  }
+
+  // Encoding in chunks, as when writing to flash, gives the same data.
+  for (size_t start = 0; start < K::STORE_SIZE; start += kChunkSize) {
+    size_t chunk_size = K::STORE_SIZE - start;
+    if (chunk_size > kChunkSize) {
+      chunk_size = kChunkSize;
+    }
+    source.Serialize(&chunked[start], start, chunk_size);
+  }
+  if (memcmp(data, chunked, K::STORE_SIZE)) {
+    printf("%s: the chunked encoding differs\n", name);
+    return false;
+  }
+
+  destination.Init();
+  destination.Clear();
+  if (!destination.Deserialize(data)) {
+    printf("%s: the encoded data is rejected\n", name);
+    return false;
+  }
+  if (!Compare(name, source, destination)) {
+    return false;
+  }
+
+  // Corrupted data is rejected.
+  data[0] ^= 0xff;
+  if (destination.Deserialize(data)) {
+    printf("%s: a wrong format is accepted\n", name);
+    return false;
+  }
+  return true;
+}
+
+static void Write(uint8_t* p, uint32_t value, uint8_t size) {
+  while (size--) {
+    *p++ = value;
+    value >>= 8;
+  }
+}
+
+// Data saved by the firmware before the compact format is converted.
+bool Legacy() {
+  static Keyframer expected;
+  static Keyframer converted;
+  static uint8_t data[Keyframer::LEGACY_STORE_SIZE];
+
+  Randomize(&expected, 64, false);
+  memset(data, 0, sizeof(data));
+  for (uint16_t i = 0; i < expected.num_keyframes(); ++i) {
+    uint8_t* p = &data[i * 12];
+    Write(p, expected.timestamp(i), 2);
+    Write(p + 2, i + 100, 2);
+    for (uint8_t j = 0; j < kNumChannels; ++j) {
+      Write(p + 4 + j * 2, expected.values(i)[j], 2);
+    }
+  }
+  uint8_t* p = &data[64 * 12];
+  for (uint8_t i = 0; i < kNumChannels; ++i) {
+    Write(p, expected.mutable_settings(i)->easing_curve, 4);
+    p[4] = expected.mutable_settings(i)->response;
+    p += 8;
+  }
+  Write(p, expected.num_keyframes(), 2);
+  Write(p + 2, 164, 2);
+  Write(p + 4, expected.extra_settings(), 4);
+  Write(p + 8, expected.dc_offset_frame_modulation(), 4);
+
+  converted.Init();
+  converted.Clear();
+  if (!converted.DeserializeLegacy(data)) {
+    printf("legacy: the data is rejected\n");
+    return false;
+  }
+  printf("legacy: %d keyframes\n", converted.num_keyframes());
+  if (!Compare("legacy", expected, converted)) {
+    return false;
+  }
+
+  // Keyframes out of order are rejected.
+  Write(&data[12], expected.timestamp(0), 2);
+  if (converted.DeserializeLegacy(data)) {
+    printf("legacy: keyframes out of order are accepted\n");
+    return false;
+  }
+  return true;
+}
+
+// Evaluate() with a cold segment cache: adding a keyframe at the timestamp of
+// an existing one (with the same values) invalidates the cache.
+template<uint8_t num_channels>
+void EvaluateCold(MultiChannelKeyframer<num_channels>* keyframer,
+                  uint16_t timestamp) {
+  if (keyframer->num_keyframes()) {
+    uint16_t values[num_channels];
+    memcpy(values, keyframer->values(0), sizeof(values));
+    keyframer->AddKeyframe(keyframer->timestamp(0), values);
+  }
+  keyframer->Evaluate(timestamp);
+}
+
+// Adds, removes or moves a random keyframe in both keyframers.
+template<uint8_t num_channels>
+void Edit(
+    MultiChannelKeyframer<num_channels>* a,
+    MultiChannelKeyframer<num_channels>* b) {
+  uint16_t values[num_channels];
+  uint8_t operation = rand() % 3;
+  if (!a->num_keyframes()) {
+    operation = 0;
+  }
+  if (operation == 0) {
+    for (uint8_t i = 0; i < num_channels; ++i) {
+      values[i] = rand() & 0xffff;
+    }
+  } else {
+    uint16_t index = rand() % a->num_keyframes();
+    uint16_t timestamp = a->timestamp(index);
+    memcpy(values, a->values(index), sizeof(values));
+    a->RemoveKeyframe(timestamp);
+    b->RemoveKeyframe(timestamp);
+  }
+  if (operation != 1) {
+    uint16_t timestamp = rand() & 0xffff;
+    a->AddKeyframe(timestamp, values);
+    b->AddKeyframe(timestamp, values);
+  }
+}
+
+// EvaluateBlock() gives the same DAC codes as repeated calls to Evaluate() with
+// a cold segment cache. The keyframes are edited between blocks, while the
+// cache of the keyframer evaluated by blocks is still warm. The timestamps
+// mostly move forward by small steps, within and across segments, with a few
+// jumps and hits on keyframes.
+template<uint8_t num_channels>
+bool EvaluateBlock(const char* name, uint16_t num_keyframes) {
+  typedef MultiChannelKeyframer<num_channels> K;
+  const size_t kNumTimestamps = 512;
+  static K keyframer;
+  static K reference;
+  static uint8_t data[K::STORE_SIZE];
+  static uint16_t timestamps[kNumTimestamps];
+  static uint16_t dac_codes[kNumTimestamps * num_channels];
+
+  Randomize(&keyframer, num_keyframes, false);
+  keyframer.Serialize(data, 0, K::STORE_SIZE);
+  reference.Init();
+  reference.Clear();
+  reference.Deserialize(data);
+
+  uint16_t timestamp = 0;
+  uint32_t num_evaluations = 0;
+  for (uint8_t block = 0; block < 16; ++block) {
+    for (size_t i = 0; i < kNumTimestamps; ++i) {
+      uint8_t r = rand() % 32;
+      if (r == 0) {
+        timestamp = rand() & 0xffff;
+      } else if (r == 1 && keyframer.num_keyframes()) {
+        timestamp = keyframer.timestamp(rand() % keyframer.num_keyframes());
+      } else {
+        timestamp += rand() % 256;
+      }
+      timestamps[i] = timestamp;
+    }
+    keyframer.EvaluateBlock(timestamps, dac_codes, kNumTimestamps);
+    for (size_t i = 0; i < kNumTimestamps; ++i) {
+      EvaluateCold(&reference, timestamps[i]);
+      for (uint8_t j = 0; j < num_channels; ++j) {
+        if (dac_codes[i * num_channels + j] != reference.dac_code(j)) {
+          printf("%s: channel %d differs at %d, block %d\n", name, j,
+                 timestamps[i], block);
+          return false;
+        }
+      }
+      ++num_evaluations;
+    }
+    Edit(&keyframer, &reference);
+  }
+  printf("%s: %d evaluations by blocks\n", name, num_evaluations);
+  return true;
+}
+
+// The tabulated response curves are within 1 DAC code of the direct
+// computation, and a channel's curve follows its response setting.
+bool ResponseCurve() {
+  static Keyframer keyframer;
+  uint16_t curve[kResponseCurveSize];
+  uint32_t num_off = 0;
+  for (uint16_t response = 0; response < 256; ++response) {
+    Keyframer::ComputeResponseCurve(response, curve);
+    for (uint32_t gain = 0; gain < 65536; ++gain) {
+      int32_t direct = Keyframer::ConvertToDacCode(gain, response);
+      int32_t tabulated = Keyframer::ConvertToDacCode(gain, response, curve);
+      if (tabulated - direct > 1 || direct - tabulated > 1) {
+        printf("response curve: %d instead of %d, gain %d, response %d\n",
+               tabulated, direct, gain, response);
+        return false;
+      }
+      num_off += tabulated != direct;
+    }
+  }
+  printf("response curve: %d conversions off by 1 code\n", num_off);
+
+  Randomize(&keyframer, 16, true);
+  for (uint16_t i = 0; i < 64; ++i) {
+    uint8_t channel = rand() % kNumChannels;
+    keyframer.mutable_settings(channel)->response = rand() & 0xff;
+    keyframer.Evaluate(rand() & 0xffff);
+    for (uint8_t j = 0; j < kNumChannels; ++j) {
+      uint8_t response = keyframer.mutable_settings(j)->response;
+      Keyframer::ComputeResponseCurve(response, curve);
+      if (keyframer.dac_code(j) != Keyframer::ConvertToDacCode(
+              keyframer.level(j), response, curve)) {
+        printf("response curve: channel %d does not follow its setting\n", j);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main(void) {
+  srand(0x5eed);
+  bool ok = true;
+  ok = RoundTrip<kNumChannels>("empty", 0, false) && ok;
+  ok = RoundTrip<kNumChannels>("64 keyframes", 64, false) && ok;
+  ok = RoundTrip<kNumChannels>("256 keyframes", kMaxNumKeyframe, false) && ok;
+  ok = RoundTrip<kNumChannels>(
+      "256 keyframes, worst case", kMaxNumKeyframe, true) && ok;
+  ok = RoundTrip<8>("8 channels, worst case", kMaxNumKeyframe, true) && ok;
+  ok = Legacy() && ok;
+  ok = ResponseCurve() && ok;
+  ok = EvaluateBlock<kNumChannels>("block, no keyframes", 0) && ok;
+  ok = EvaluateBlock<kNumChannels>("block, 1 keyframe", 1) && ok;
+  ok = EvaluateBlock<kNumChannels>("block, 64 keyframes", 64) && ok;
+  ok = EvaluateBlock<8>("block, 8 channels", 16) && ok;
+  ok = EvaluateBlock<16>("block, 16 channels", 16) && ok;
+  ok = EvaluateBlock<32>("block, 32 channels", 16) && ok;
+  if (!ok) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -39,12 +39,11 @@
 #include "frames/drivers/keyframe_led.h"
 #include "frames/drivers/rgb_led.h"
 #include "frames/drivers/switches.h"
+#include "frames/keyframer.h"
+#include "frames/poly_lfo.h"
 
 namespace frames {
 
-class Keyframer;
-class PolyLfo;
-
 enum SwitchIndex {
   SWITCH_ADD_FRAME,
   SWITCH_DELETE_FRAME
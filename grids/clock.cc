@@ -37,9 +37,6 @@ uint32_t Clock::phase_;
 /* static */
 uint32_t Clock::phase_increment_;
 
-/* static */
-uint8_t Clock::falling_edge_;
-
 /* static */
 void Clock::Update(uint16_t bpm, ClockResolution resolution) {
   bpm_ = bpm;
@@ -48,6 +45,8 @@ void Clock::Update(uint16_t bpm, ClockResolution resolution) {
     phase_increment_ >>= 1;
   } else if (resolution == CLOCK_RESOLUTION_24_PPQN) {
     phase_increment_ = (phase_increment_ << 1) + phase_increment_;
+  } else if (resolution == CLOCK_RESOLUTION_96_PPQN) {
+    phase_increment_ = ((phase_increment_ << 1) + phase_increment_) << 2;
   }
 }
 
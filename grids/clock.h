@@ -15,9 +15,8 @@
 //
 // -----------------------------------------------------------------------------
 //
-// Global clock. This works as a 31-bit phase increment counter. To implement
-// swing, the value at which the counter wraps is (1 << 31) times a swing
-// factor.
+// Global clock. This works as a 31-bit phase increment counter. Swing is not
+// applied here, but by delaying the outputs (see scheduler.h).
 
 #ifndef GRIDS_CLOCK_H_
 #define GRIDS_CLOCK_H_
@@ -43,25 +42,17 @@ class Clock {
     phase_ = 0;
   }
   
-  static inline void Tick() { phase_ += phase_increment_; }
-  static inline void Wrap(int8_t amount) {
-    LongWord* w = (LongWord*)(&phase_);
-    if (amount == 0) {
-      w->bytes[3] &= 0x7f;
-      falling_edge_ = 0x40;
-    } else {
-      if (w->bytes[3] >= 128 + amount) {
-        w->bytes[3] = 0;
-      }
-      falling_edge_ = (128 + amount) >> 1;
-    }
+  static inline void Tick() {
+    phase_ = (phase_ + phase_increment_) & 0x7fffffff;
   }
 
   static inline bool raising_edge() { return phase_ < phase_increment_; }
-  static inline bool past_falling_edge() {
-    LongWord w;
-    w.value = phase_;
-    return w.bytes[3] >= falling_edge_;
+  static inline bool past_falling_edge() { return phase_ >= 0x40000000; }
+  
+  // Time elapsed between the raising edge and the last tick, for ticks of
+  // tick_duration. Valid when raising_edge() is true.
+  static inline uint8_t raising_edge_delay(uint8_t tick_duration) {
+    return (phase_ >> 8) * tick_duration / ((phase_increment_ >> 8) + 1);
   }
   
   static inline void Lock() { locked_ = true; }
@@ -74,7 +65,6 @@ class Clock {
   static uint16_t bpm_;
   static uint32_t phase_;
   static uint32_t phase_increment_;
-  static uint8_t falling_edge_;
   
   DISALLOW_COPY_AND_ASSIGN(Clock);
 };
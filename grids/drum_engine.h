@@ -0,0 +1,246 @@
+// Copyright 2011 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Drum engine: turns the levels of the drum map into triggers and accents,
+// for any number of parts up to 8.
+//
+// Each part reads one of the instruments of the drum map, with its own
+// density, probability and accent level - 4 bytes per part, in tables
+// indexed by part. The perturbation of a part is folded into its thresholds,
+// so evaluating a part at a step is two comparisons of the raw level; the
+// cost still grows linearly with the number of parts. The module uses 3 parts
+// reading the 3 instruments (see pattern_generator.h); a bigger kit reuses
+// the instruments at other densities and accent levels.
+
+#ifndef GRIDS_DRUM_ENGINE_H_
+#define GRIDS_DRUM_ENGINE_H_
+
+#include <string.h>
+
+#include "avrlib/base.h"
+#include "avrlib/op.h"
+
+namespace grids {
+
+const uint8_t kStepsPerPattern = 32;
+const uint8_t kNumDrumMapInstruments = 3;
+const uint8_t kDrumMapSize = kNumDrumMapInstruments * kStepsPerPattern;
+const uint8_t kDefaultAccentLevel = 192;
+
+// Levels of all the instruments at all the steps for (x, y), instrument by
+// instrument, interpolated between the 4 nodes of the drum map surrounding
+// (x, y).
+void InterpolateDrumMap(uint8_t x, uint8_t y, uint8_t* levels);
+
+// Triggers of all the steps of a pattern: bit n of trigger[i] (resp.
+// accent[i]) is set when part i fires (resp. is accented) on step n.
+template<uint8_t num_parts>
+struct DrumLanes {
+  uint32_t trigger[num_parts];
+  uint32_t accent[num_parts];
+};
+
+template<uint8_t num_parts>
+class DrumEngine {
+ public:
+  DrumEngine() { }
+  ~DrumEngine() { }
+
+  // Part i reads instrument i modulo 3, always fires when its level is above
+  // the density threshold, and is accented above kDefaultAccentLevel.
+  void Init() {
+    for (uint8_t i = 0; i < num_parts; ++i) {
+      set_instrument(i, i % kNumDrumMapInstruments);
+      density_[i] = 0;
+      probability_[i] = 255;
+      accent_level_[i] = kDefaultAccentLevel;
+      perturbation_[i] = 0;
+    }
+    probabilistic_parts_ = 0;
+    x_ = 0;
+    y_ = 0;
+    InterpolateDrumMap(x_, y_, drum_map_);
+  }
+
+  // The levels of the drum map at x, y are cached, and are only interpolated
+  // again when x or y have moved.
+  void UpdateDrumMap(uint8_t x, uint8_t y) {
+    if (x != x_ || y != y_) {
+      x_ = x;
+      y_ = y;
+      InterpolateDrumMap(x, y, drum_map_);
+    }
+  }
+
+  // Random offset added to the levels of each part, up to randomness. Drawn
+  // at the beginning of each pattern.
+  template<typename Random>
+  inline void DrawPerturbation(Random* random, uint8_t randomness) {
+    DrawPerturbation(random, randomness, perturbation_);
+  }
+
+  // Bit i of the result is set when part i fires at step; bit i of accents
+  // when it is also accented.
+  template<typename Random>
+  inline uint8_t EvaluateStep(uint8_t step, Random* random, uint8_t* accents) {
+    uint8_t triggers = 0;
+    uint8_t accented = 0;
+    uint8_t part_mask = 1;
+    for (uint8_t i = 0; i < num_parts; ++i) {
+      uint8_t level = drum_map_[instrument_offset_[i] + step];
+      uint8_t perturbation = perturbation_[i];
+      triggers |= level >= Threshold(~density_[i], perturbation) ?
+          part_mask : 0;
+      accented |= level >= Threshold(accent_level_[i], perturbation) ?
+          part_mask : 0;
+      part_mask <<= 1;
+    }
+    if (triggers & probabilistic_parts_) {
+      triggers = Sample(triggers, random);
+    }
+    *accents = accented & triggers;
+    return triggers;
+  }
+
+  // Evaluates the 32 steps of the pattern at once, drawing a new perturbation
+  // as the first step of a pattern does. Random numbers are drawn in the same
+  // order as when the steps are evaluated one by one.
+  template<typename Random>
+  void EvaluatePattern(
+      Random* random,
+      uint8_t randomness,
+      DrumLanes<num_parts>* lanes) {
+    uint8_t perturbation[num_parts];
+    DrawPerturbation(random, randomness, perturbation);
+    for (uint8_t i = 0; i < num_parts; ++i) {
+      // The perturbation is folded into the thresholds, so that the loop
+      // over the steps only compares the levels read from the map.
+      const uint8_t* levels = &drum_map_[instrument_offset_[i]];
+      uint16_t threshold = Threshold(~density_[i], perturbation[i]);
+      uint16_t accent_threshold = Threshold(accent_level_[i], perturbation[i]);
+      uint32_t trigger = 0;
+      uint32_t accent = 0;
+      uint32_t step_mask = 1;
+      for (uint8_t step = 0; step < kStepsPerPattern; ++step) {
+        uint8_t level = levels[step];
+        trigger |= level >= threshold ? step_mask : 0;
+        accent |= level >= accent_threshold ? step_mask : 0;
+        step_mask <<= 1;
+      }
+      lanes->trigger[i] = trigger;
+      lanes->accent[i] = accent;
+    }
+    if (probabilistic_parts_) {
+      for (uint8_t step = 0; step < kStepsPerPattern; ++step) {
+        uint8_t triggers = 0;
+        for (uint8_t i = 0; i < num_parts; ++i) {
+          triggers |= ((lanes->trigger[i] >> step) & 1) << i;
+        }
+        if (!(triggers & probabilistic_parts_)) {
+          continue;
+        }
+        uint8_t dropped = triggers & ~Sample(triggers, random);
+        for (uint8_t i = 0; dropped; ++i, dropped >>= 1) {
+          if (dropped & 1) {
+            lanes->trigger[i] &= ~(static_cast<uint32_t>(1) << step);
+          }
+        }
+      }
+    }
+    for (uint8_t i = 0; i < num_parts; ++i) {
+      lanes->accent[i] &= lanes->trigger[i];
+    }
+  }
+
+  inline void set_instrument(uint8_t part, uint8_t instrument) {
+    instrument_offset_[part] = instrument * kStepsPerPattern;
+  }
+  inline void set_density(uint8_t part, uint8_t density) {
+    density_[part] = density;
+  }
+  // Chance that a part fires when its level is above the density threshold,
+  // in 1/256th. 255 always fires.
+  inline void set_probability(uint8_t part, uint8_t probability) {
+    probability_[part] = probability;
+    if (probability == 255) {
+      probabilistic_parts_ &= ~(1 << part);
+    } else {
+      probabilistic_parts_ |= 1 << part;
+    }
+  }
+  inline void set_accent_level(uint8_t part, uint8_t level) {
+    accent_level_[part] = level;
+  }
+
+  inline uint8_t density(uint8_t part) const { return density_[part]; }
+  inline uint8_t probability(uint8_t part) const { return probability_[part]; }
+  inline uint8_t accent_level(uint8_t part) const {
+    return accent_level_[part];
+  }
+
+ private:
+  // The perturbed level, level + perturbation clipped to 255, is above
+  // threshold when level is at least the returned value: 0 when it always
+  // is, 256 when it never is. The sequencer from Anushri uses a weird
+  // clipping rule here - compare level + perturbation without clipping to
+  // reproduce its behavior.
+  static inline uint16_t Threshold(uint8_t threshold, uint8_t perturbation) {
+    if (threshold == 255) {
+      return 256;
+    }
+    return threshold < perturbation ? 0 : threshold - perturbation + 1;
+  }
+
+  template<typename Random>
+  inline void DrawPerturbation(
+      Random* random,
+      uint8_t randomness,
+      uint8_t* perturbation) {
+    for (uint8_t i = 0; i < num_parts; ++i) {
+      perturbation[i] = avrlib::U8U8MulShift8(random->GetByte(), randomness);
+    }
+  }
+
+  // Drops the triggers of the probabilistic parts at random.
+  template<typename Random>
+  inline uint8_t Sample(uint8_t triggers, Random* random) {
+    uint8_t candidates = triggers & probabilistic_parts_;
+    for (uint8_t i = 0; candidates; ++i, candidates >>= 1) {
+      if ((candidates & 1) && random->GetByte() >= probability_[i]) {
+        triggers &= ~(1 << i);
+      }
+    }
+    return triggers;
+  }
+
+  uint8_t instrument_offset_[num_parts];
+  uint8_t density_[num_parts];
+  uint8_t probability_[num_parts];
+  uint8_t accent_level_[num_parts];
+  uint8_t perturbation_[num_parts];
+  uint8_t probabilistic_parts_;
+
+  uint8_t x_;
+  uint8_t y_;
+  uint8_t drum_map_[kDrumMapSize];
+
+  DISALLOW_COPY_AND_ASSIGN(DrumEngine);
+};
+
+}  // namespace grids
+
+#endif  // GRIDS_DRUM_ENGINE_H_
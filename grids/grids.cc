@@ -23,6 +23,7 @@
 #include "grids/clock.h"
 #include "grids/hardware_config.h"
 #include "grids/pattern_generator.h"
+#include "grids/scheduler.h"
 
 using namespace avrlib;
 using namespace grids;
@@ -32,6 +33,7 @@ Inputs inputs;
 AdcInputScanner adc;
 ShiftRegister shift_register;
 MidiInput midi;
+Scheduler scheduler;
 
 enum Parameter {
   PARAMETER_NONE,
@@ -48,12 +50,36 @@ uint32_t tap_duration = 0;
 uint8_t led_pattern ;
 uint8_t led_off_timer;
 
-int8_t swing_amount;
-
 volatile Parameter parameter = PARAMETER_NONE;
 volatile bool long_press_detected = false;
 const uint8_t kUpdatePeriod = F_CPU / 32 / 8000;
 
+// Outputs are written two periods of the control rate interrupt after the
+// clock pulse which triggered them: a pulse is detected at worst one period
+// after it occurred.
+const uint32_t kOutputLatency = 2 * kUpdatePeriod;
+
+// 96 ppqn pulses at 20 BPM, in counts of timer 2.
+const uint32_t kMaxPulsePeriod = F_CPU / 32 * 60 / (20 * 96);
+
+// Counts of timer 2 (F_CPU / 32) at the beginning of the current period of the
+// control rate interrupt.
+volatile uint32_t tick_time;
+
+// Time of the last raising edge on the clock input.
+volatile uint32_t clock_edge_time;
+
+// Must be called with interrupts disabled.
+inline uint32_t Now() {
+  uint8_t count = TCNT2;
+  uint32_t time = tick_time;
+  if ((TIFR2 & _BV(OCF2A)) && count < (kUpdatePeriod >> 1)) {
+    // The counter has wrapped, but the interrupt has not run yet.
+    time += kUpdatePeriod;
+  }
+  return time + count;
+}
+
 inline void UpdateLeds() {
   uint8_t pattern;
   if (parameter == PARAMETER_NONE) {
@@ -77,7 +103,11 @@ inline void UpdateLeds() {
     pattern = LED_CLOCK;
     switch (parameter) {
       case PARAMETER_CLOCK_RESOLUTION:
-        pattern |= LED_BD >> pattern_generator.clock_resolution();
+        if (pattern_generator.clock_resolution() == CLOCK_RESOLUTION_96_PPQN) {
+          pattern |= LED_ALL;
+        } else {
+          pattern |= LED_BD >> pattern_generator.clock_resolution();
+        }
         break;
         
       case PARAMETER_CLOCK_OUTPUT:
@@ -113,23 +143,65 @@ inline void UpdateLeds() {
   leds.Write(pattern);
 }
 
-inline void UpdateShiftRegister() {
+inline uint8_t LedPattern(uint8_t state) {
+  uint8_t result = 0;
+  if (state & 1) {
+    result |= LED_BD;
+  }
+  if (state & 2) {
+    result |= LED_SD;
+  }
+  if (state & 4) {
+    result |= LED_HH;
+  }
+  return result;
+}
+
+inline void UpdateOutputs(uint32_t time) {
   static uint8_t previous_state = 0;
   if (pattern_generator.state() != previous_state) {
     previous_state = pattern_generator.state();
-    shift_register.Write(previous_state);
+    cli();
+    scheduler.Write(time, previous_state, pattern_generator.output_clock());
+    sei();
     if (!previous_state) {
       // Switch off the LEDs, but not now.
       led_off_timer = 200;
     } else {
       // Switch on the LEDs with a new pattern.
-      led_pattern = pattern_generator.led_pattern();
+      led_pattern = LedPattern(previous_state);
       led_off_timer = 0;
     }
   }
 }
 
-uint8_t ticks_granularity[] = { 6, 3, 1 };
+// Writes the outputs due now, and sets the compare unit of timer 2 to
+// interrupt at the next change of the outputs if it occurs before the end of
+// the period. Must be called with interrupts disabled.
+inline void WriteOutputs() {
+  while (true) {
+    uint32_t now = Now();
+    if (scheduler.Pop(now)) {
+      shift_register.Write(scheduler.outputs());
+    }
+    TIMSK2 &= ~_BV(OCIE2B);
+    if (!scheduler.pending()) {
+      return;
+    }
+    uint32_t delay = scheduler.next_time() - now;
+    if (delay > 2) {
+      uint8_t count = TCNT2;
+      if (delay < kUpdatePeriod - count) {
+        OCR2B = count + delay;
+        TIFR2 = _BV(OCF2B);
+        TIMSK2 |= _BV(OCIE2B);
+      }
+      return;
+    }
+  }
+}
+
+uint8_t ticks_granularity[] = { 24, 12, 4, 1 };
 
 inline void HandleClockResetInputs() {
   static uint8_t previous_inputs;
@@ -137,11 +209,15 @@ inline void HandleClockResetInputs() {
   uint8_t inputs_value = ~inputs.Read();
   uint8_t num_ticks = 0;
   uint8_t increment = ticks_granularity[pattern_generator.clock_resolution()];
+  uint32_t pulse_time = tick_time;
   
   // CLOCK
   if (clock.bpm() < 40 && !clock.locked()) {
     if ((inputs_value & INPUT_CLOCK) && !(previous_inputs & INPUT_CLOCK)) {
       num_ticks = increment;
+      cli();
+      pulse_time = clock_edge_time;
+      sei();
     }
     if (!(inputs_value & INPUT_CLOCK) && (previous_inputs & INPUT_CLOCK)) {
       pattern_generator.ClockFallingEdge();
@@ -149,16 +225,16 @@ inline void HandleClockResetInputs() {
     if (midi.readable()) {
       uint8_t byte = midi.ImmediateRead();
       if (byte == 0xf8) {
-        num_ticks = 1;
+        num_ticks = ticks_granularity[CLOCK_RESOLUTION_24_PPQN];
       } else if (byte == 0xfa) {
         pattern_generator.Reset();
       }
     }
   } else {
     clock.Tick();
-    clock.Wrap(swing_amount);
     if (clock.raising_edge()) {
       num_ticks = increment;
+      pulse_time -= clock.raising_edge_delay(kUpdatePeriod);
     }
     if (clock.past_falling_edge()) {
       pattern_generator.ClockFallingEdge();
@@ -191,8 +267,13 @@ inline void HandleClockResetInputs() {
   previous_inputs = inputs_value;
   
   if (num_ticks) {
-    swing_amount = pattern_generator.swing_amount();
+    scheduler.Pulse(
+        pulse_time,
+        num_ticks,
+        pattern_generator.step(),
+        pattern_generator.swing_amount());
     pattern_generator.TickClock(num_ticks);
+    UpdateOutputs(pulse_time);
   }
 }
 
@@ -242,9 +323,23 @@ inline void HandleTapButton() {
   }
 }
 
-ISR(TIMER2_COMPA_vect, ISR_NOBLOCK) {
+ISR(PCINT2_vect) {
+  if (!(inputs.Read() & INPUT_CLOCK)) {
+    clock_edge_time = Now();
+  }
+}
+
+ISR(TIMER2_COMPB_vect) {
+  WriteOutputs();
+}
+
+ISR(TIMER2_COMPA_vect) {
   static uint8_t switch_debounce_prescaler;
   
+  // Interrupts are only enabled once the time is up to date.
+  tick_time += kUpdatePeriod;
+  sei();
+  
   ++tap_duration;
   ++switch_debounce_prescaler;
   if (switch_debounce_prescaler >= 10) {
@@ -257,8 +352,11 @@ ISR(TIMER2_COMPA_vect, ISR_NOBLOCK) {
   adc.Scan();
   
   pattern_generator.IncrementPulseCounter();
-  UpdateShiftRegister();
+  UpdateOutputs(tick_time);
   UpdateLeds();
+  
+  cli();
+  WriteOutputs();
 }
 
 static int16_t pot_values[8];
@@ -291,6 +389,8 @@ void ScanPots() {
     settings->density[0] = ~adc.Read8(ADC_CHANNEL_BD_DENSITY_CV);
     settings->density[1] = ~adc.Read8(ADC_CHANNEL_SD_DENSITY_CV);
     settings->density[2] = ~adc.Read8(ADC_CHANNEL_HH_DENSITY_CV);
+    pattern_generator.UpdateDrumMap();
+    pattern_generator.UpdateEuclideanPatterns();
   } else {
     for (uint8_t i = 0; i < 8; ++i) {
       int16_t value = adc.Read8(i);
@@ -355,9 +455,14 @@ void Init() {
   Adc::set_reference(ADC_DEFAULT);
   Adc::set_alignment(ADC_LEFT_ALIGNED);
   pattern_generator.Init();
+  scheduler.Init(kOutputLatency, kMaxPulsePeriod);
   shift_register.Init();
   midi.Init();
   
+  // Pin change interrupt on the clock input, to timestamp its edges.
+  PCMSK2 |= _BV(PCINT17);
+  PCICR |= _BV(PCIE2);
+  
   TCCR2A = _BV(WGM21);
   TCCR2B = 3;
   OCR2A = kUpdatePeriod - 1;
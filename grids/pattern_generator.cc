@@ -19,7 +19,6 @@
 
 #include "grids/pattern_generator.h"
 
-#include <avr/eeprom.h>
 #include <avr/pgmspace.h>
 
 #include "avrlib/op.h"
@@ -30,41 +29,10 @@ namespace grids {
   
 using namespace avrlib;
 
-/* static */
-Options PatternGenerator::options_;
-
-/* static */
-uint8_t PatternGenerator::pulse_;
-
-/* static */
-uint8_t PatternGenerator::step_;
-
-/* static */
-bool PatternGenerator::first_beat_;
-
-/* static */
-bool PatternGenerator::beat_;
-
-/* static */
-uint8_t PatternGenerator::euclidean_step_[kNumParts];
-
-/* static */
-uint8_t PatternGenerator::state_;
-
-/* static */
-uint8_t PatternGenerator::pulse_duration_counter_;
-
-/* static */
-uint8_t PatternGenerator::part_perturbation_[kNumParts];
-
-/* static */
-PatternGeneratorSettings PatternGenerator::settings_;
-
-/* static */
-uint8_t PatternGenerator::factory_testing_;
-
+#ifndef TEST
 /* extern */
 PatternGenerator pattern_generator;
+#endif  // TEST
 
 static const prog_uint8_t* drum_map[5][5] = {
   { node_10, node_8, node_0, node_9, node_11 },
@@ -74,152 +42,57 @@ static const prog_uint8_t* drum_map[5][5] = {
   { node_24, node_19, node_17, node_20, node_22 },
 };
 
-/* static */
-uint8_t PatternGenerator::ReadDrumMap(
-    uint8_t step,
-    uint8_t instrument,
-    uint8_t x,
-    uint8_t y) {
+void InterpolateDrumMap(uint8_t x, uint8_t y, uint8_t* levels) {
   uint8_t i = x >> 6;
   uint8_t j = y >> 6;
   const prog_uint8_t* a_map = drum_map[i][j];
   const prog_uint8_t* b_map = drum_map[i + 1][j];
   const prog_uint8_t* c_map = drum_map[i][j + 1];
   const prog_uint8_t* d_map = drum_map[i + 1][j + 1];
-  uint8_t offset = (instrument * kStepsPerPattern) + step;
-  uint8_t a = pgm_read_byte(a_map + offset);
-  uint8_t b = pgm_read_byte(b_map + offset);
-  uint8_t c = pgm_read_byte(c_map + offset);
-  uint8_t d = pgm_read_byte(d_map + offset);
-  return U8Mix(U8Mix(a, b, x << 2), U8Mix(c, d, x << 2), y << 2);
+  x <<= 2;
+  y <<= 2;
+  for (uint8_t offset = 0; offset < kDrumMapSize; ++offset) {
+    uint8_t a = pgm_read_byte(a_map + offset);
+    uint8_t b = pgm_read_byte(b_map + offset);
+    uint8_t c = pgm_read_byte(c_map + offset);
+    uint8_t d = pgm_read_byte(d_map + offset);
+    levels[offset] = U8Mix(U8Mix(a, b, x), U8Mix(c, d, x), y);
+  }
 }
 
-/* static */
-void PatternGenerator::EvaluateDrums() {
-  // At the beginning of a pattern, decide on perturbation levels.
-  if (step_ == 0) {
-    for (uint8_t i = 0; i < kNumParts; ++i) {
-      uint8_t randomness = options_.swing
-          ? 0 : settings_.options.drums.randomness >> 2;
-      part_perturbation_[i] = U8U8MulShift8(Random::GetByte(), randomness);
-    }
-  }
-  
-  uint8_t instrument_mask = 1;
-  uint8_t x = settings_.options.drums.x;
-  uint8_t y = settings_.options.drums.y;
-  uint8_t accent_bits = 0;
-  for (uint8_t i = 0; i < kNumParts; ++i) {
-    uint8_t level = ReadDrumMap(step_, i, x, y);
-    if (level < 255 - part_perturbation_[i]) {
-      level += part_perturbation_[i];
+void ComputeEuclideanPattern(
+    uint8_t length,
+    uint8_t num_notes,
+    uint8_t rotation,
+    uint8_t* pattern) {
+  // Bresenham's algorithm: step n plays when an accumulator, advanced by
+  // num_notes at each step, wraps around length. The notes are spread as
+  // evenly as with Bjorklund's algorithm - the patterns are the same, up to
+  // a rotation, which depends on the initial value of the accumulator. Up to
+  // 32 steps, the initial value is read from a table, so that the patterns
+  // are exactly those of the earlier firmware versions. Longer patterns start
+  // at length - num_notes, which puts a note on the first step. The
+  // accumulator never exceeds 127.
+  memset(pattern, 0, kEuclideanPatternSize);
+  uint8_t accumulator = 0;
+  if (num_notes && num_notes < length) {
+    if (length <= kMaxTabulatedEuclideanLength) {
+      uint16_t index = (U8U8Mul(length - 2, length - 1) >> 1) + num_notes - 1;
+      accumulator = pgm_read_byte(lut_res_euclidean_start + index);
     } else {
-      // The sequencer from Anushri uses a weird clipping rule here. Comment
-      // this line to reproduce its behavior.
-      level = 255;
-    }
-    uint8_t threshold = ~settings_.density[i];
-    if (level > threshold) {
-      if (level > 192) {
-        accent_bits |= instrument_mask;
-      }
-      state_ |= instrument_mask;
+      accumulator = length - num_notes;
     }
-    instrument_mask <<= 1;
   }
-  if (output_clock()) {
-    state_ |= accent_bits ? OUTPUT_BIT_COMMON : 0;
-    state_ |= step_ == 0 ? OUTPUT_BIT_RESET : 0;
-  } else {
-    state_ |= accent_bits << 3;
-  }
-}
-
-/* static */
-void PatternGenerator::EvaluateEuclidean() {
-  // Refresh only on sixteenth notes.
-  if (step_ & 1) {
-    return;
-  }
-  
-  // Euclidean pattern generation
-  uint8_t instrument_mask = 1;
-  uint8_t reset_bits = 0;
-  for (uint8_t i = 0; i < kNumParts; ++i) {
-    uint8_t length = (settings_.options.euclidean_length[i] >> 3) + 1;
-    uint8_t density = settings_.density[i] >> 3;
-    uint16_t address = U8U8Mul(length - 1, 32) + density;
-    while (euclidean_step_[i] >= length) {
-      euclidean_step_[i] -= length;
+  uint8_t step = rotation ? length - rotation : 0;
+  for (uint8_t i = 0; i < length; ++i) {
+    accumulator += num_notes;
+    if (accumulator >= length) {
+      accumulator -= length;
+      pattern[step >> 3] |= 1 << (step & 7);
     }
-    uint32_t step_mask = 1L << static_cast<uint32_t>(euclidean_step_[i]);
-    uint32_t pattern_bits = pgm_read_dword(lut_res_euclidean + address);
-    if (pattern_bits & step_mask) {
-      state_ |= instrument_mask;
+    if (++step >= length) {
+      step = 0;
     }
-    if (euclidean_step_[i] == 0) {
-      reset_bits |= instrument_mask;
-    }
-    instrument_mask <<= 1;
-  }
-  
-  if (output_clock()) {
-    state_ |= reset_bits ? OUTPUT_BIT_COMMON : 0;
-    state_ |= (reset_bits == 0x07) ? OUTPUT_BIT_RESET : 0;
-  } else {
-    state_ |= reset_bits << 3;
-  }
-}
-
-/* static */
-void PatternGenerator::LoadSettings() {
-  options_.unpack(eeprom_read_byte(NULL));
-  factory_testing_ = eeprom_read_byte((uint8_t*)(1)) + 1;
-}
-
-/* static */
-void PatternGenerator::SaveSettings() {
-  eeprom_write_byte(NULL, options_.pack());
-  ++factory_testing_;
-  if (factory_testing_ >= 5) {
-    factory_testing_ = 5;
-  }
-  eeprom_write_byte((uint8_t*)(1), factory_testing_);
-}
-
-/* static */
-void PatternGenerator::Evaluate() {
-  state_ = 0;
-  pulse_duration_counter_ = 0;
-  
-  Random::Update();
-  // Highest bits: clock and random bit.
-  state_ |= 0x40;
-  state_ |= Random::state() & 0x80;
-  
-  if (output_clock()) {
-    state_ |= OUTPUT_BIT_CLOCK;
-  }
-
-  // Refresh only at step changes.
-  if (pulse_ != 0) {
-    return;
-  }
-  
-  if (options_.output_mode == OUTPUT_MODE_EUCLIDEAN) {
-    EvaluateEuclidean();
-  } else {
-    EvaluateDrums();
-  }
-}
-
-/* static */
-int8_t PatternGenerator::swing_amount() {
-  if (options_.swing && output_mode() == OUTPUT_MODE_DRUMS) {
-    int8_t value = U8U8MulShift8(settings_.options.drums.randomness, 42 + 1);
-    return (!(step_ & 2)) ? value : -value;
-  } else {
-    return 0;
   }
 }
 
@@ -29,16 +29,26 @@
 #include <string.h>
 
 #include "avrlib/base.h"
-#include "avrlib/random.h"
+#include "avrlib/op.h"
+
+#include "grids/drum_engine.h"
 
-#include "grids/hardware_config.h"
+#ifndef TEST
+#include <avr/eeprom.h>
+
+#include "avrlib/random.h"
+#endif  // TEST
 
 namespace grids {
 
 const uint8_t kNumParts = 3;
-const uint8_t kPulsesPerStep = 3;  // 24 ppqn ; 8 steps per quarter note.
-const uint8_t kStepsPerPattern = 32;
+const uint8_t kPulsesPerStep = 12;  // 96 ppqn ; 8 steps per quarter note.
 const uint8_t kPulseDuration = 8;  // 8 ticks of the main clock.
+const uint8_t kMaxEuclideanLength = 64;
+// Up to this length, the euclidean patterns are the same as those of the
+// earlier firmware versions, which read them from a table.
+const uint8_t kMaxTabulatedEuclideanLength = 32;
+const uint8_t kEuclideanPatternSize = kMaxEuclideanLength / 8;
 
 struct DrumsSettings {
   uint8_t x;
@@ -52,6 +62,8 @@ struct PatternGeneratorSettings {
     uint8_t euclidean_length[kNumParts];
   } options;
   uint8_t density[kNumParts];
+  // Step of the euclidean pattern played first.
+  uint8_t euclidean_rotation[kNumParts];
 };
 
 enum OutputMode {
@@ -63,6 +75,7 @@ enum ClockResolution {
   CLOCK_RESOLUTION_4_PPQN,
   CLOCK_RESOLUTION_8_PPQN,
   CLOCK_RESOLUTION_24_PPQN,
+  CLOCK_RESOLUTION_96_PPQN,
   CLOCK_RESOLUTION_LAST
 };
 
@@ -107,33 +120,56 @@ struct Options {
     gate_mode = !(byte & 0x80);
     swing = !(byte & 0x08);
     clock_resolution = static_cast<ClockResolution>(byte & 0x7);
-    if (clock_resolution >= CLOCK_RESOLUTION_24_PPQN) {
+    if (clock_resolution >= CLOCK_RESOLUTION_LAST) {
       clock_resolution = CLOCK_RESOLUTION_24_PPQN;
     }
   }
 };
 
-class PatternGenerator {
+typedef DrumLanes<kNumParts> DrumPattern;
+
+// Euclidean pattern of num_notes notes among length steps (1 to 64), rotated
+// by rotation steps. Bit n of pattern[n >> 3] is set when step n plays.
+void ComputeEuclideanPattern(
+    uint8_t length,
+    uint8_t num_notes,
+    uint8_t rotation,
+    uint8_t* pattern);
+
+// The pattern generator does not own any global state: the source of random
+// numbers and the persistent storage of the options are injected.
+//
+// Random is any class with Update(), state() and GetByte() methods, like
+// avrlib::Random. Storage has static Read(address) and Write(address, value)
+// methods for bytes of non-volatile memory. Several instances can thus run
+// side by side, on the module or on a host.
+template<typename Random, typename Storage>
+class BasicPatternGenerator {
  public:
-  PatternGenerator() { }
-  ~PatternGenerator() { }
+  BasicPatternGenerator() { }
+  ~BasicPatternGenerator() { }
   
-  static inline void Init() {
+  inline void Init() {
     LoadSettings();
     Reset();
+    memset(&settings_, 0, sizeof(settings_));
+    drums_.Init();
+    memset(euclidean_length_, 0, sizeof(euclidean_length_));
+    euclidean_buffer_ = 0;
+    UpdateEuclideanPatterns();
   }
 
-  static inline void Reset() {
+  inline void Reset() {
     step_ = 0;
     pulse_ = 0;
     memset(euclidean_step_, 0, sizeof(euclidean_step_));
   }
   
-  static inline void Retrigger() {
+  inline void Retrigger() {
     Evaluate();
   }
   
-  static inline void TickClock(uint8_t num_pulses) {
+  inline void TickClock(uint8_t num_pulses) {
     Evaluate();
     beat_ = (step_ & 0x7) == 0;
     first_beat_ = step_ == 0;
@@ -157,36 +193,93 @@ class PatternGenerator {
     }
   }
   
-  static inline uint8_t state() {
+  // The levels of the drum map at the current x, y are cached, and are only
+  // interpolated again by this function when x or y have moved. Call it after
+  // changing them - on the module, from the main loop, so that the clock
+  // interrupt only has to read the cache. An interrupt during the update may
+  // read a mix of old and new levels, which sounds the same as a knob move.
+  void UpdateDrumMap() {
+    drums_.UpdateDrumMap(
+        settings_.options.drums.x,
+        settings_.options.drums.y);
+  }
+  
+  // Same as UpdateDrumMap, for the euclidean patterns: they are computed
+  // again when the length, number of notes or rotation of a part changes.
+  // A new pattern is built in the buffer the clock interrupt does not read,
+  // and only becomes visible when the part's bit of euclidean_buffer_ is
+  // flipped - so the interrupt never reads a half-written pattern.
+  void UpdateEuclideanPatterns() {
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      uint8_t live = (euclidean_buffer_ >> i) & 1;
+      // The length knob spans 1 to 64 steps. The lengths of the earlier
+      // firmware versions, 1 to 32 steps, are on the first half of its
+      // travel: a setting s which used to select (s >> 3) + 1 steps now
+      // selects (s >> 2) + 1.
+      uint8_t length = (settings_.options.euclidean_length[i] >> 2) + 1;
+      // 32 levels of density, spread over the length of the pattern.
+      uint8_t num_notes = (avrlib::U8U8Mul(
+          settings_.density[i] >> 3, length << 1) + 31) / 62;
+      uint8_t rotation = settings_.euclidean_rotation[i];
+      while (rotation >= length) {
+        rotation -= length;
+      }
+      if (length != euclidean_length_[live][i] ||
+          num_notes != euclidean_num_notes_[i] ||
+          rotation != euclidean_rotation_[i]) {
+        ComputeEuclideanPattern(
+            length, num_notes, rotation, euclidean_pattern_[live ^ 1][i]);
+        euclidean_length_[live ^ 1][i] = length;
+        euclidean_buffer_ ^= 1 << i;
+        euclidean_num_notes_[i] = num_notes;
+        euclidean_rotation_[i] = rotation;
+      }
+    }
+  }
+  
+  // Evaluates the 32 steps of the drum pattern for the current settings at
+  // once, drawing the random perturbation of each part as the first step of
+  // a pattern does.
+  void EvaluateDrumPattern(DrumPattern* pattern) {
+    UpdateDrumMap();
+    UpdateDensities();
+    drums_.EvaluatePattern(&random_, randomness(), pattern);
+  }
+  
+  inline uint8_t state() const {
     return state_;
   }
-  static inline uint8_t step() { return step_; }
+  inline uint8_t step() const { return step_; }
   
-  static inline bool swing() { return options_.swing; }
-  static int8_t swing_amount();
-  static inline bool output_clock() { return options_.output_clock; }
-  static inline bool tap_tempo() { return options_.tap_tempo; }
-  static inline bool gate_mode() { return options_.gate_mode; }
-  static inline OutputMode output_mode() { return options_.output_mode; }
-  static inline ClockResolution clock_resolution() { return options_.clock_resolution; }
+  inline bool swing() const { return options_.swing; }
+  // Delay of the second sixteenth note of each eighth note, in 1/128th of a
+  // sixteenth note.
+  uint8_t swing_amount() const;
+  inline bool output_clock() const { return options_.output_clock; }
+  inline bool tap_tempo() const { return options_.tap_tempo; }
+  inline bool gate_mode() const { return options_.gate_mode; }
+  inline OutputMode output_mode() const { return options_.output_mode; }
+  inline ClockResolution clock_resolution() const {
+    return options_.clock_resolution;
+  }
 
-  static void set_swing(uint8_t value) { options_.swing = value; }  
-  static void set_output_clock(uint8_t value) { options_.output_clock = value; }
-  static void set_tap_tempo(uint8_t value) { options_.tap_tempo = value; }
-  static void set_output_mode(uint8_t value) { 
+  void set_swing(uint8_t value) { options_.swing = value; }  
+  void set_output_clock(uint8_t value) { options_.output_clock = value; }
+  void set_tap_tempo(uint8_t value) { options_.tap_tempo = value; }
+  void set_output_mode(uint8_t value) { 
     options_.output_mode = static_cast<OutputMode>(value);
   }
-  static void set_clock_resolution(uint8_t value) {
-    if (value >= CLOCK_RESOLUTION_24_PPQN) {
-      value = CLOCK_RESOLUTION_24_PPQN;
+  void set_clock_resolution(uint8_t value) {
+    if (value >= CLOCK_RESOLUTION_LAST) {
+      value = CLOCK_RESOLUTION_96_PPQN;
     }
     options_.clock_resolution = static_cast<ClockResolution>(value);
   }
-  static void set_gate_mode(bool gate_mode) {
+  void set_gate_mode(bool gate_mode) {
     options_.gate_mode = gate_mode;
   }
   
-  static inline void IncrementPulseCounter() {
+  inline void IncrementPulseCounter() {
     ++pulse_duration_counter_;
     // Zero all pulses after 1ms.
     if (pulse_duration_counter_ >= kPulseDuration && !options_.gate_mode) {
@@ -197,70 +290,211 @@ class PatternGenerator {
     }
   }
   
-  static inline void ClockFallingEdge() {
+  inline void ClockFallingEdge() {
     if (options_.gate_mode) {
       state_ = 0;
     }
   }
   
-  static inline PatternGeneratorSettings* mutable_settings() {
+  inline PatternGeneratorSettings* mutable_settings() {
     return &settings_;
   }
   
-  static bool on_first_beat() { return first_beat_; }
-  static bool on_beat() { return beat_; }
-  static bool factory_testing() { return factory_testing_ < 5; }
+  inline Random* mutable_random() {
+    return &random_;
+  }
+  
+  // Probability and accent level of the parts.
+  inline DrumEngine<kNumParts>* mutable_drum_engine() {
+    return &drums_;
+  }
+  
+  bool on_first_beat() const { return first_beat_; }
+  bool on_beat() const { return beat_; }
+  bool factory_testing() const { return factory_testing_ < 5; }
 
-  static void SaveSettings();
+  void SaveSettings();
   
-  static inline uint8_t led_pattern() {
-    uint8_t result = 0;
-    if (state_ & 1) {
-      result |= LED_BD;
-    }
-    if (state_ & 2) {
-      result |= LED_SD;
-    }
-    if (state_ & 4) {
-      result |= LED_HH;
+ private:
+  void LoadSettings();
+  void Evaluate();
+  void EvaluateEuclidean();
+  void EvaluateDrums();
+  
+  // With swing enabled, the randomness knob sets the amount of swing
+  // instead.
+  inline uint8_t randomness() const {
+    return options_.swing ? 0 : settings_.options.drums.randomness >> 2;
+  }
+  
+  inline void UpdateDensities() {
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      drums_.set_density(i, settings_.density[i]);
     }
-    return result;
   }
+
+  Options options_;
   
- private:
-  static void LoadSettings();
-  static void Evaluate();
-  static void EvaluateEuclidean();
-  static void EvaluateDrums();
+  uint8_t pulse_;
+  uint8_t step_;
+  uint8_t euclidean_step_[kNumParts];
+  bool first_beat_;
+  bool beat_;
   
-  static uint8_t ReadDrumMap(
-      uint8_t step,
-      uint8_t instrument,
-      uint8_t x,
-      uint8_t y);
+  uint8_t state_;
 
-  static Options options_;
+  uint8_t pulse_duration_counter_;
+  
+  uint8_t factory_testing_;
+  
+  PatternGeneratorSettings settings_;
+  
+  DrumEngine<kNumParts> drums_;
+  
+  // Two buffers of length and pattern per part. Bit i of euclidean_buffer_
+  // selects the one read for part i.
+  uint8_t euclidean_length_[2][kNumParts];
+  uint8_t euclidean_pattern_[2][kNumParts][kEuclideanPatternSize];
+  volatile uint8_t euclidean_buffer_;
+  uint8_t euclidean_num_notes_[kNumParts];
+  uint8_t euclidean_rotation_[kNumParts];
   
-  static uint8_t pulse_;
-  static uint8_t step_;
-  static uint8_t euclidean_step_[kNumParts];
-  static bool first_beat_;
-  static bool beat_;
+  Random random_;
   
-  static uint8_t state_;
-  static uint8_t part_perturbation_[kNumParts];
+  DISALLOW_COPY_AND_ASSIGN(BasicPatternGenerator);
+};
+
+template<typename Random, typename Storage>
+void BasicPatternGenerator<Random, Storage>::EvaluateDrums() {
+  // At the beginning of a pattern, decide on perturbation levels.
+  if (step_ == 0) {
+    drums_.DrawPerturbation(&random_, randomness());
+  }
+  
+  UpdateDensities();
+  uint8_t accent_bits;
+  state_ |= drums_.EvaluateStep(step_, &random_, &accent_bits);
+  if (output_clock()) {
+    state_ |= accent_bits ? OUTPUT_BIT_COMMON : 0;
+    state_ |= step_ == 0 ? OUTPUT_BIT_RESET : 0;
+  } else {
+    state_ |= accent_bits << 3;
+  }
+}
+
+template<typename Random, typename Storage>
+void BasicPatternGenerator<Random, Storage>::EvaluateEuclidean() {
+  // Refresh only on sixteenth notes.
+  if (step_ & 1) {
+    return;
+  }
+  
+  // Euclidean pattern generation
+  uint8_t instrument_mask = 1;
+  uint8_t reset_bits = 0;
+  uint8_t buffer = euclidean_buffer_;
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    uint8_t live = buffer & 1;
+    buffer >>= 1;
+    uint8_t length = euclidean_length_[live][i];
+    while (euclidean_step_[i] >= length) {
+      euclidean_step_[i] -= length;
+    }
+    uint8_t step = euclidean_step_[i];
+    if (euclidean_pattern_[live][i][step >> 3] & (1 << (step & 7))) {
+      state_ |= instrument_mask;
+    }
+    if (euclidean_step_[i] == 0) {
+      reset_bits |= instrument_mask;
+    }
+    instrument_mask <<= 1;
+  }
+  
+  if (output_clock()) {
+    state_ |= reset_bits ? OUTPUT_BIT_COMMON : 0;
+    state_ |= (reset_bits == 0x07) ? OUTPUT_BIT_RESET : 0;
+  } else {
+    state_ |= reset_bits << 3;
+  }
+}
+
+template<typename Random, typename Storage>
+void BasicPatternGenerator<Random, Storage>::LoadSettings() {
+  options_.unpack(Storage::Read(0));
+  factory_testing_ = Storage::Read(1) + 1;
+}
+
+template<typename Random, typename Storage>
+void BasicPatternGenerator<Random, Storage>::SaveSettings() {
+  Storage::Write(0, options_.pack());
+  ++factory_testing_;
+  if (factory_testing_ >= 5) {
+    factory_testing_ = 5;
+  }
+  Storage::Write(1, factory_testing_);
+}
 
-  static uint8_t pulse_duration_counter_;
+template<typename Random, typename Storage>
+void BasicPatternGenerator<Random, Storage>::Evaluate() {
+  state_ = 0;
+  pulse_duration_counter_ = 0;
   
-  static uint8_t factory_testing_;
+  random_.Update();
+  // Highest bits: clock and random bit.
+  state_ |= 0x40;
+  state_ |= random_.state() & 0x80;
   
-  static PatternGeneratorSettings settings_;
+  if (output_clock()) {
+    state_ |= OUTPUT_BIT_CLOCK;
+  }
+
+  // Refresh only at step changes.
+  if (pulse_ != 0) {
+    return;
+  }
   
-  DISALLOW_COPY_AND_ASSIGN(PatternGenerator);
+  if (options_.output_mode == OUTPUT_MODE_EUCLIDEAN) {
+    EvaluateEuclidean();
+  } else {
+    EvaluateDrums();
+  }
+}
+
+template<typename Random, typename Storage>
+uint8_t BasicPatternGenerator<Random, Storage>::swing_amount() const {
+  if (options_.swing && output_mode() == OUTPUT_MODE_DRUMS) {
+    return avrlib::U8U8MulShift8(settings_.options.drums.randomness, 42 + 1);
+  } else {
+    return 0;
+  }
+}
+
+#ifndef TEST
+
+// On the module, the random numbers come from the avrlib generator, and the
+// options are stored in the first two bytes of the EEPROM.
+class SharedRandom {
+ public:
+  inline void Update() { avrlib::Random::Update(); }
+  inline uint16_t state() const { return avrlib::Random::state(); }
+  inline uint8_t GetByte() { return avrlib::Random::GetByte(); }
+};
+
+struct EepromStorage {
+  static inline uint8_t Read(uint16_t address) {
+    return eeprom_read_byte((uint8_t*)(address));
+  }
+  static inline void Write(uint16_t address, uint8_t value) {
+    eeprom_write_byte((uint8_t*)(address), value);
+  }
 };
 
+typedef BasicPatternGenerator<SharedRandom, EepromStorage> PatternGenerator;
+
 extern PatternGenerator pattern_generator;
 
+#endif  // TEST
+
 }  // namespace grids
 
 #endif // GRIDS_PATTERN_GENERATOR_H_
@@ -42,10 +42,12 @@ extern const prog_uint16_t* const lookup_table_table[];
 
 extern const prog_uint32_t* const lookup_table32_table[];
 
+extern const prog_uint8_t* const lookup_table8_table[];
+
 extern const prog_uint8_t* const node_table[];
 
-extern const prog_uint32_t lut_res_euclidean[] PROGMEM;
 extern const prog_uint32_t lut_res_tempo_phase_increment[] PROGMEM;
+extern const prog_uint8_t lut_res_euclidean_start[] PROGMEM;
 extern const prog_uint8_t node_0[] PROGMEM;
 extern const prog_uint8_t node_1[] PROGMEM;
 extern const prog_uint8_t node_2[] PROGMEM;
@@ -72,10 +74,10 @@ extern const prog_uint8_t node_22[] PROGMEM;
 extern const prog_uint8_t node_23[] PROGMEM;
 extern const prog_uint8_t node_24[] PROGMEM;
 #define STR_RES_DUMMY 0  // dummy
-#define LUT_RES_EUCLIDEAN 0
-#define LUT_RES_EUCLIDEAN_SIZE 1024
-#define LUT_RES_TEMPO_PHASE_INCREMENT 1
+#define LUT_RES_TEMPO_PHASE_INCREMENT 0
 #define LUT_RES_TEMPO_PHASE_INCREMENT_SIZE 512
+#define LUT_RES_EUCLIDEAN_START 0
+#define LUT_RES_EUCLIDEAN_START_SIZE 496
 #define NODE_0 0
 #define NODE_0_SIZE 96
 #define NODE_1 1
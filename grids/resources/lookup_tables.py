@@ -22,6 +22,8 @@
 import numpy
 
 lookup_tables = []
+lookup_tables32 = []
+lookup_tables8 = []
 drum_map_nodes = []
 
 
@@ -387,48 +389,51 @@ for i, p in enumerate(nodes):
 
 
 """----------------------------------------------------------------------------
-Euclidean patterns
+Phase increment for tempo.
 ----------------------------------------------------------------------------"""
 
-def Flatten(l):
-  if hasattr(l, 'pop'):
-    for item in l:
-      for j in Flatten(item):
-        yield j
-  else:
-    yield l
+control_rate = 8000
+width = 1 << 32
+tempo_values = numpy.arange(0, 512.0)
+lookup_tables32.append(
+    ('tempo_phase_increment', width * tempo_values * 8 / (60 * control_rate) / 2)
+)
+
 
+"""----------------------------------------------------------------------------
+Euclidean patterns
+----------------------------------------------------------------------------"""
 
-def EuclidianPattern(k, n):
+def BjorklundPattern(k, n):
   pattern = [[1]] * k + [[0]] * (n - k)
   while k:
     cut = min(k, len(pattern) - k)
-    k, pattern = cut, [pattern[i] + pattern[k + i] for i in xrange(cut)] + \
-      pattern[cut:k] + pattern[k + cut:]
-  return pattern
+    k, pattern = cut, [pattern[i] + pattern[k + i] for i in range(cut)] + \
+        pattern[cut:k] + pattern[k + cut:]
+  return sum(pattern, [])
 
 
-table = []
-for num_steps in xrange(1, 33):
-  for num_notes in xrange(32):
-    num_notes = int(round(float(num_notes) / 31 * num_steps))
-    bitmask = 0
-    for i, bit in enumerate(Flatten(EuclidianPattern(num_notes, num_steps))):
-      if bit:
-        bitmask |= (1 << i)
-    table.append(bitmask)
-
-lookup_tables32 = [('euclidean', table)]
-
+def BresenhamPattern(k, n, start):
+  pattern = []
+  accumulator = start
+  for i in range(n):
+    accumulator += k
+    pattern.append(int(accumulator >= n))
+    if accumulator >= n:
+      accumulator -= n
+  return pattern
 
 
-"""----------------------------------------------------------------------------
-Phase increment for tempo.
-----------------------------------------------------------------------------"""
+# The firmware draws euclidean patterns with a Bresenham accumulator. Its
+# initial value is chosen so that patterns of up to 32 steps are the same
+# as the ones generated by Bjorklund's algorithm in earlier firmware versions
+# (and not only rotations of them). Patterns of n steps with 0 < k < n notes
+# are stored from index (n - 2) * (n - 1) / 2 + k - 1.
+euclidean_start = []
+for n in range(2, 33):
+  for k in range(1, n):
+    pattern = BjorklundPattern(k, n)
+    euclidean_start.append(
+        [s for s in range(n) if BresenhamPattern(k, n, s) == pattern][0])
 
-control_rate = 8000
-width = 1 << 32
-tempo_values = numpy.arange(0, 512.0)
-lookup_tables32.append(
-    ('tempo_phase_increment', width * tempo_values * 8 / (60 * control_rate) / 2)
-)
+lookup_tables8.append(('euclidean_start', euclidean_start))
@@ -62,6 +62,8 @@ resources = [
    'lookup_table', 'LUT_RES', 'prog_uint16_t', int, True),
   (lookup_tables.lookup_tables32,
    'lookup_table32', 'LUT_RES', 'prog_uint32_t', int, True),
+  (lookup_tables.lookup_tables8,
+   'lookup_table8', 'LUT_RES', 'prog_uint8_t', int, True),
   (lookup_tables.drum_map_nodes,
    'node', 'NODE', 'prog_uint8_t', int, True),
 ]
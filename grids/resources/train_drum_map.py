@@ -0,0 +1,218 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2026 Mutable Instruments contributors.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -----------------------------------------------------------------------------
+#
+# Drum map training.
+#
+# Every 4/4 bar of a collection of MIDI drum files becomes a training vector:
+# the velocities of the bass drum, snare drum and hi-hat notes at the 32 steps
+# (32nd notes) of the bar. The codewords of a self-organizing map trained on
+# these vectors become the nodes of the drum map. Within a node, the steps
+# played by an instrument are given evenly spaced levels, from the most to the
+# least important one, so that the density knob adds them one at a time.
+#
+# usage, from the root of the repository:
+#   python -m grids.resources.train_drum_map [options] directory...
+#
+# The nodes are printed in the format of lookup_tables.py, or replace those of
+# the file given with --lookup_tables. Run "make resources" afterwards.
+
+import math
+import multiprocessing
+import numpy
+import optparse
+import os
+import sys
+
+from tools.learning import som
+from tools.midi import midifile
+
+
+NUM_INSTRUMENTS = 3
+NUM_STEPS = 32
+STEPS_PER_BEAT = 8
+DRUM_CHANNEL = 10
+
+# General MIDI drum notes.
+INSTRUMENTS = {
+  35: 0, 36: 0,  # Bass drums.
+  37: 1, 38: 1, 39: 1, 40: 1,  # Snares, side stick and clap.
+  42: 2, 44: 2, 46: 2, 51: 2, 53: 2, 59: 2,  # Hi-hats and rides.
+}
+
+# Node at each position of the 5x5 drum map of the firmware, indexed by
+# x, then y (see drum_map in grids/pattern_generator.cc).
+FIRMWARE_GRID_SIZE = 5
+FIRMWARE_NODES = [
+  [10, 8, 0, 9, 11],
+  [15, 7, 13, 12, 6],
+  [18, 14, 4, 5, 3],
+  [23, 16, 21, 1, 2],
+  [24, 19, 17, 20, 22],
+]
+
+
+def FindMidiFiles(directories):
+  for directory in directories:
+    for root, dirs, files in os.walk(directory):
+      dirs.sort()
+      for name in sorted(files):
+        if os.path.splitext(name)[1].lower() in ['.mid', '.midi']:
+          yield os.path.join(root, name)
+
+
+def ExtractPatterns(args):
+  """Returns the path, an error message, and the training vectors of a file."""
+  path, any_channel = args
+  reader = midifile.Reader()
+  try:
+    f = open(path, 'rb')
+    try:
+      reader.Read(f)
+    finally:
+      f.close()
+  except Exception as e:
+    return path, 'cannot parse file (%s)' % e, []
+  if reader.ppq <= 0:
+    return path, 'SMPTE time division not supported', []
+
+  bars = {}
+  for track in reader.tracks:
+    for t, e in track:
+      if not isinstance(e, midifile.NoteOnEvent) or not e.velocity:
+        continue
+      if not any_channel and e.channel != DRUM_CHANNEL:
+        continue
+      instrument = INSTRUMENTS.get(e.note)
+      if instrument is None:
+        continue
+      # Ties are rounded up, whatever the version of python.
+      step = int(math.floor(float(t) * STEPS_PER_BEAT / reader.ppq + 0.5))
+      bar, step = step // NUM_STEPS, step % NUM_STEPS
+      if bar not in bars:
+        bars[bar] = numpy.zeros((NUM_INSTRUMENTS, NUM_STEPS))
+      pattern = bars[bar]
+      pattern[instrument, step] = max(
+          pattern[instrument, step], e.velocity / 127.0)
+  return path, None, [bars[bar].ravel() for bar in sorted(bars)]
+
+
+def NodeLevels(codeword, threshold):
+  """Converts a codeword into the levels of a node."""
+  levels = []
+  for weights in codeword.reshape((NUM_INSTRUMENTS, NUM_STEPS)):
+    order = [step for step in numpy.argsort(-weights, kind='mergesort') \
+        if weights[step] >= threshold]
+    node = [0] * NUM_STEPS
+    for rank, step in enumerate(order):
+      node[step] = 255 * (len(order) - rank) // len(order)
+    levels.extend(node)
+  return levels
+
+
+def FormatNodes(nodes):
+  lines = ['nodes = [']
+  for i, node in enumerate(nodes):
+    lines.append('[')
+    rows = []
+    for j in range(0, len(node), 8):
+      rows.append('\t' + ', '.join(str(value) for value in node[j:j + 8]))
+    lines.append(',\n'.join(rows))
+    lines.append('],' if i != len(nodes) - 1 else ']')
+  lines.append(']')
+  return '\n'.join(lines) + '\n'
+
+
+def ReplaceNodes(path, nodes):
+  text = open(path).read()
+  start = text.index('nodes = [\n')
+  end = text.index('\nfor i, p in enumerate(nodes)')
+  f = open(path, 'w')
+  f.write(text[:start] + FormatNodes(nodes) + text[end:])
+  f.close()
+
+
+def main():
+  parser = optparse.OptionParser(usage='%prog [options] directory...')
+  parser.add_option(
+      '-g', '--grid_size', dest='grid_size', type='int',
+      default=FIRMWARE_GRID_SIZE,
+      help='size of the map. The firmware uses a 5x5 map')
+  parser.add_option(
+      '-r', '--radius', dest='radius', type='float', default=2.0,
+      help='initial neighborhood radius')
+  parser.add_option(
+      '-e', '--epochs', dest='epochs', type='int', default=50,
+      help='number of training epochs')
+  parser.add_option(
+      '-s', '--seed', dest='seed', type='int', default=42,
+      help='random seed')
+  parser.add_option(
+      '-t', '--threshold', dest='threshold', type='float', default=0.1,
+      help='minimum weight of a step in a node')
+  parser.add_option(
+      '-a', '--any_channel', dest='any_channel', action='store_true',
+      default=False, help='read drum notes on all channels, not only 10')
+  parser.add_option(
+      '-j', '--processes', dest='processes', type='int', default=0,
+      help='number of processes reading the MIDI files (default: all CPUs)')
+  parser.add_option(
+      '-l', '--lookup_tables', dest='lookup_tables', default=None,
+      help='replace the nodes in this file instead of printing them')
+  options, args = parser.parse_args()
+  if not args:
+    parser.error('no directory given')
+  if options.lookup_tables and options.grid_size != FIRMWARE_GRID_SIZE:
+    parser.error('the firmware only reads a %dx%d map' % (
+        FIRMWARE_GRID_SIZE, FIRMWARE_GRID_SIZE))
+
+  # Parsing the MIDI files is the slowest part: it is split between processes.
+  jobs = [(path, options.any_channel) for path in FindMidiFiles(args)]
+  pool = multiprocessing.Pool(options.processes or None)
+  data = []
+  for path, error, patterns in pool.imap(ExtractPatterns, jobs, 16):
+    if error:
+      sys.stderr.write('%s: %s\n' % (path, error))
+    data.extend(patterns)
+  pool.close()
+  pool.join()
+  if not data:
+    sys.stderr.write('no drum pattern found\n')
+    return 1
+  data = numpy.array(data)
+  sys.stderr.write('%d files, %d bars\n' % (len(jobs), data.shape[0]))
+
+  grid_size = options.grid_size
+  drum_map = som.SOM(grid_size, options.radius, 0.0)
+  errors = drum_map.train_batch(data, epochs=options.epochs, seed=options.seed)
+  sys.stderr.write('quantization error: %.4f\n' % errors[-1])
+
+  nodes = [None] * (grid_size * grid_size)
+  for i, codeword in enumerate(drum_map.codewords):
+    x, y = i % grid_size, i // grid_size
+    if grid_size == FIRMWARE_GRID_SIZE:
+      i = FIRMWARE_NODES[x][y]
+    nodes[i] = NodeLevels(codeword, options.threshold)
+
+  if options.lookup_tables:
+    ReplaceNodes(options.lookup_tables, nodes)
+  else:
+    sys.stdout.write(FormatNodes(nodes))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main())
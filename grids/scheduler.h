@@ -0,0 +1,207 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Output scheduler.
+//
+// A clock pulse is only noticed by the next run of the control rate
+// interrupt, up to one period after it occurred. Writing the outputs right
+// away would add this uncertainty to their timing. Instead, the time of each
+// pulse is measured at the resolution of a hardware timer, and each change of
+// the outputs of the pattern generator is applied a constant latency after
+// the pulse which caused it.
+//
+// Swing and per-part timing offsets are extra delays of the outputs of the
+// parts, computed from the measured period of the clock. The clock and random
+// outputs are never delayed by more than the latency.
+//
+// Times are counts of the timer, compared modulo 2^32.
+
+#ifndef GRIDS_SCHEDULER_H_
+#define GRIDS_SCHEDULER_H_
+
+#include <string.h>
+
+#include "avrlib/base.h"
+
+#include "grids/pattern_generator.h"
+
+namespace grids {
+
+const uint8_t kMaxOutputEvents = 24;
+
+struct OutputEvent {
+  uint32_t time;
+  uint8_t mask;
+  uint8_t value;
+};
+
+class Scheduler {
+ public:
+  Scheduler() { }
+  ~Scheduler() { }
+
+  // Pulses more than max_pulse_period apart are not used to measure the
+  // tempo: the clock has been stopped.
+  void Init(uint32_t latency, uint32_t max_pulse_period) {
+    latency_ = latency;
+    max_pulse_period_ = max_pulse_period;
+    pulse_time_ = 0;
+    pulse_period_ = 0;
+    swing_delay_ = 0;
+    memset(part_delay_, 0, sizeof(part_delay_));
+    memset(part_offset_, 0, sizeof(part_offset_));
+    num_events_ = 0;
+    outputs_ = 0;
+    written_outputs_ = 0;
+  }
+
+  // A clock pulse, worth num_pulses pulses of the pattern generator, occurred
+  // at time. step is the step of the pattern generator it plays.
+  void Pulse(
+      uint32_t time,
+      uint8_t num_pulses,
+      uint8_t step,
+      uint8_t swing_amount) {
+    uint32_t period = (time - pulse_time_) / num_pulses;
+    pulse_time_ = time;
+    if (period <= max_pulse_period_) {
+      if (period > (pulse_period_ << 1) || period < (pulse_period_ >> 1)) {
+        pulse_period_ = period;
+      } else {
+        // Smooth out the jitter of the clock source.
+        pulse_period_ += static_cast<int32_t>(period - pulse_period_) >> 2;
+      }
+    }
+
+    // The second sixteenth note of an eighth note is delayed by the swing
+    // amount, the 32nd notes around it by half as much.
+    uint32_t step_period = pulse_period_ * kPulsesPerStep;
+    uint8_t position = step & 3;
+    if (position == 3) {
+      position = 1;
+    }
+    swing_delay_ = (step_period * position * swing_amount) >> 7;
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      part_delay_[i] = swing_delay_ + ((step_period * part_offset_[i]) >> 8);
+    }
+  }
+
+  // The outputs of the pattern generator changed to state at time.
+  void Write(uint32_t time, uint8_t state, bool output_clock) {
+    time += latency_;
+    uint8_t clock_mask = 0xc0 | (output_clock ? OUTPUT_BIT_CLOCK : 0);
+    uint8_t common_mask = ~clock_mask;
+    Schedule(time, clock_mask, state);
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      uint8_t part_mask = (1 << i) | (output_clock ? 0 : 8 << i);
+      common_mask &= ~part_mask;
+      Schedule(time + part_delay_[i], part_mask, state);
+    }
+    if (common_mask) {
+      Schedule(time + swing_delay_, common_mask, state);
+    }
+  }
+
+  // Applies the changes due at now. Returns true if the outputs changed.
+  bool Pop(uint32_t now) {
+    uint8_t n = 0;
+    while (n < num_events_ && !Before(now, events_[n].time)) {
+      Apply(events_[n]);
+      ++n;
+    }
+    if (n) {
+      num_events_ -= n;
+      memmove(&events_[0], &events_[n], num_events_ * sizeof(OutputEvent));
+    }
+    bool changed = outputs_ != written_outputs_;
+    written_outputs_ = outputs_;
+    return changed;
+  }
+
+  inline bool pending() const { return num_events_ != 0; }
+  inline uint32_t next_time() const { return events_[0].time; }
+  inline uint8_t outputs() const { return outputs_; }
+  inline uint32_t pulse_period() const { return pulse_period_; }
+
+  // Delay of the outputs of a part, in 1/256th of a step.
+  inline void set_part_offset(uint8_t part, uint8_t offset) {
+    part_offset_[part] = offset;
+  }
+  inline uint8_t part_offset(uint8_t part) const {
+    return part_offset_[part];
+  }
+
+ private:
+  static inline bool Before(uint32_t a, uint32_t b) {
+    return static_cast<int32_t>(a - b) < 0;
+  }
+
+  inline void Apply(const OutputEvent& e) {
+    outputs_ = (outputs_ & ~e.mask) | e.value;
+  }
+
+  void Schedule(uint32_t time, uint8_t mask, uint8_t state) {
+    uint8_t value = state & mask;
+    uint8_t i = num_events_;
+    while (i && Before(time, events_[i - 1].time)) {
+      --i;
+    }
+    if (i && events_[i - 1].time == time) {
+      OutputEvent* e = &events_[i - 1];
+      e->mask |= mask;
+      e->value = (e->value & ~mask) | value;
+      return;
+    }
+    if (num_events_ == kMaxOutputEvents) {
+      // Out of room: the earliest change is applied ahead of time.
+      if (!i) {
+        outputs_ = (outputs_ & ~mask) | value;
+        return;
+      }
+      Apply(events_[0]);
+      --num_events_;
+      --i;
+      memmove(&events_[0], &events_[1], num_events_ * sizeof(OutputEvent));
+    }
+    memmove(
+        &events_[i + 1],
+        &events_[i],
+        (num_events_ - i) * sizeof(OutputEvent));
+    events_[i].time = time;
+    events_[i].mask = mask;
+    events_[i].value = value;
+    ++num_events_;
+  }
+
+  uint32_t latency_;
+  uint32_t max_pulse_period_;
+
+  uint32_t pulse_time_;
+  uint32_t pulse_period_;
+  uint32_t swing_delay_;
+  uint32_t part_delay_[kNumParts];
+  uint8_t part_offset_[kNumParts];
+
+  OutputEvent events_[kMaxOutputEvents];
+  uint8_t num_events_;
+  uint8_t outputs_;
+  uint8_t written_outputs_;
+
+  DISALLOW_COPY_AND_ASSIGN(Scheduler);
+};
+
+}  // namespace grids
+
+#endif  // GRIDS_SCHEDULER_H_
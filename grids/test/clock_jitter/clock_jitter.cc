@@ -0,0 +1,321 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Simulates the clock handling of the module and measures the timing of the
+// drum triggers against an ideal grid, for two ways of writing the outputs:
+//
+// - isr: as soon as the control rate interrupt notices a clock pulse, which
+//   is how the outputs used to be written.
+// - scheduler: at a constant latency after the time of the pulse, measured
+//   at the resolution of timer 2 (see grids/scheduler.h).
+//
+// For each, prints the mean delay of the triggers, and the RMS and peak
+// deviation of the triggers from this mean delay - the jitter. The delay of
+// the scheduler is counted from the end of its constant latency (250us), and
+// from the swing and offsets asked for.
+//
+// usage: clock_jitter [duration in seconds]
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+
+#include "grids/clock.h"
+#include "grids/pattern_generator.h"
+#include "grids/scheduler.h"
+
+using namespace grids;
+
+const double kTimerFrequency = 20000000.0 / 32;
+const uint8_t kUpdatePeriod = 20000000 / 32 / 8000;
+const uint32_t kOutputLatency = 2 * kUpdatePeriod;
+const uint32_t kMaxPulsePeriod = 20000000 / 32 * 60 / (20 * 96);
+const uint8_t ticks_granularity[] = { 24, 12, 4, 1 };
+const uint8_t ppqn[] = { 4, 8, 24, 96 };
+
+class Lfsr {
+ public:
+  Lfsr() : state_(0x21) { }
+  inline void Update() {
+    state_ = (state_ >> 1) ^ (-(state_ & 1) & 0xb400);
+  }
+  inline uint16_t state() const { return state_; }
+  inline uint8_t GetByte() {
+    Update();
+    return state_ >> 8;
+  }
+
+ private:
+  uint16_t state_;
+};
+
+struct NullStorage {
+  static inline uint8_t Read(uint16_t address) { return 0xff; }
+  static inline void Write(uint16_t address, uint8_t value) { }
+};
+
+typedef BasicPatternGenerator<Lfsr, NullStorage> HostPatternGenerator;
+
+struct Scenario {
+  const char* name;
+  bool internal_clock;
+  ClockResolution resolution;
+  uint16_t bpm;
+  double input_jitter;  // In microseconds, peak.
+  uint8_t swing;  // Randomness knob, when the swing option is on.
+  uint8_t part_offset[kNumParts];
+};
+
+const Scenario scenarios[] = {
+  { "external 24 ppqn", false, CLOCK_RESOLUTION_24_PPQN, 120, 0, 0,
+    { 0, 0, 0 } },
+  { "external 96 ppqn", false, CLOCK_RESOLUTION_96_PPQN, 120, 0, 0,
+    { 0, 0, 0 } },
+  { "external 96 ppqn, 174 bpm", false, CLOCK_RESOLUTION_96_PPQN, 174, 0, 0,
+    { 0, 0, 0 } },
+  { "external 24 ppqn, 200us jitter", false, CLOCK_RESOLUTION_24_PPQN, 120,
+    200, 0, { 0, 0, 0 } },
+  { "internal", true, CLOCK_RESOLUTION_24_PPQN, 120, 0, 0, { 0, 0, 0 } },
+  { "external 96 ppqn, swing", false, CLOCK_RESOLUTION_96_PPQN, 120, 0, 255,
+    { 0, 0, 0 } },
+  { "internal, swing", true, CLOCK_RESOLUTION_24_PPQN, 120, 0, 160,
+    { 0, 0, 0 } },
+  { "external 24 ppqn, offsets", false, CLOCK_RESOLUTION_24_PPQN, 120, 0, 0,
+    { 0, 32, 96 } },
+};
+
+class Stats {
+ public:
+  Stats() : n_(0), sum_(0.0), sum_squares_(0.0), min_(1e9), max_(-1e9) { }
+
+  void Add(double x) {
+    ++n_;
+    sum_ += x;
+    sum_squares_ += x * x;
+    min_ = x < min_ ? x : min_;
+    max_ = x > max_ ? x : max_;
+  }
+
+  void Print() const {
+    if (!n_) {
+      printf("  %9s %9s %9s", "-", "-", "-");
+      return;
+    }
+    double mean = sum_ / n_;
+    double variance = sum_squares_ / n_ - mean * mean;
+    double rms = variance > 0.0 ? sqrt(variance) : 0.0;
+    double peak = max_ - mean > mean - min_ ? max_ - mean : mean - min_;
+    printf("  %9.1f %9.1f %9.1f", mean, rms, peak);
+  }
+
+ private:
+  int n_;
+  double sum_;
+  double sum_squares_;
+  double min_;
+  double max_;
+};
+
+// One way of driving the outputs: a pattern generator, and the ideal times
+// of the triggers it has started and which have not reached the outputs yet.
+class Path {
+ public:
+  void Init(const Scenario& scenario, bool scheduled) {
+    scheduled_ = scheduled;
+    generator_.Init();
+    generator_.set_output_mode(OUTPUT_MODE_DRUMS);
+    generator_.set_output_clock(false);
+    generator_.set_gate_mode(false);
+    generator_.set_swing(scenario.swing != 0);
+    generator_.set_clock_resolution(scenario.resolution);
+    PatternGeneratorSettings* settings = generator_.mutable_settings();
+    settings->options.drums.x = 160;
+    settings->options.drums.y = 96;
+    settings->options.drums.randomness = scenario.swing;
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      settings->density[i] = 224;
+    }
+    generator_.UpdateDrumMap();
+    scheduler_.Init(kOutputLatency, kMaxPulsePeriod);
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      scheduler_.set_part_offset(i, scenario.part_offset[i]);
+      pending_[i].clear();
+    }
+    previous_state_ = 0;
+    outputs_ = 0;
+  }
+
+  // A clock pulse occurred at time (as measured), and at ideal_time.
+  void Pulse(
+      uint32_t time,
+      double ideal_time,
+      double ideal_step_period,
+      uint8_t num_ticks) {
+    uint8_t step = generator_.step();
+    uint8_t swing = generator_.swing_amount();
+    scheduler_.Pulse(time, num_ticks, step, swing);
+    generator_.TickClock(num_ticks);
+    uint8_t state = generator_.state();
+    if (scheduled_) {
+      uint8_t position = step & 3;
+      position = position == 3 ? 1 : position;
+      ideal_time += kOutputLatency;
+      ideal_time += ideal_step_period * position * swing / 128.0;
+    }
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      if (state & (1 << i)) {
+        double offset = scheduled_
+            ? ideal_step_period * scheduler_.part_offset(i) / 256.0
+            : 0.0;
+        pending_[i].push_back(ideal_time + offset);
+      }
+    }
+    Update(time);
+  }
+
+  // Runs what follows the clock handling in the control rate interrupt
+  // at time; then the output compare interrupts until the next period.
+  void Tick(uint32_t time, Stats* stats) {
+    generator_.IncrementPulseCounter();
+    Update(time);
+    if (!scheduled_) {
+      Output(time, previous_state_, stats);
+      return;
+    }
+    while (true) {
+      scheduler_.Pop(time);
+      Output(time, scheduler_.outputs(), stats);
+      if (!scheduler_.pending() ||
+          static_cast<int32_t>(scheduler_.next_time() - time) >=
+              kUpdatePeriod) {
+        break;
+      }
+      uint32_t next = scheduler_.next_time();
+      time = static_cast<int32_t>(next - time) > 0 ? next : time;
+    }
+  }
+
+ private:
+  void Update(uint32_t time) {
+    uint8_t state = generator_.state();
+    if (state != previous_state_) {
+      previous_state_ = state;
+      if (scheduled_) {
+        scheduler_.Write(time, state, false);
+      }
+    }
+  }
+
+  void Output(uint32_t time, uint8_t outputs, Stats* stats) {
+    uint8_t rising = outputs & ~outputs_;
+    outputs_ = outputs;
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      if ((rising & (1 << i)) && !pending_[i].empty()) {
+        double deviation = time - pending_[i].front();
+        stats->Add(deviation / kTimerFrequency * 1e6);
+        pending_[i].pop_front();
+      }
+    }
+  }
+
+  bool scheduled_;
+  HostPatternGenerator generator_;
+  Scheduler scheduler_;
+  std::deque<double> pending_[kNumParts];
+  uint8_t previous_state_;
+  uint8_t outputs_;
+};
+
+uint32_t random_state = 1;
+
+double Random() {
+  random_state = random_state * 1664525L + 1013904223L;
+  return static_cast<double>(random_state >> 8) / (1 << 24);
+}
+
+void Simulate(const Scenario& scenario, double duration, Stats* stats) {
+  Path isr, scheduled;
+  Stats ignored;
+  isr.Init(scenario, false);
+  scheduled.Init(scenario, true);
+
+  uint8_t num_ticks = ticks_granularity[scenario.resolution];
+  double pulse_period = kTimerFrequency * 60.0 / \
+      (scenario.bpm * ppqn[scenario.resolution]);
+  double step_period = pulse_period / num_ticks * kPulsesPerStep;
+  double jitter = scenario.input_jitter * 1e-6 * kTimerFrequency;
+  double next_edge = pulse_period;
+  double next_ideal_edge = next_edge;
+  double previous_ideal_edge = 0.0;
+  Clock::Update(scenario.bpm, scenario.resolution);
+  Clock::Reset();
+
+  uint32_t num_periods = duration * kTimerFrequency / kUpdatePeriod;
+  for (uint32_t n = 1; n < num_periods; ++n) {
+    uint32_t time = n * kUpdatePeriod;
+    bool pulse = false;
+    double edge = 0.0;
+    double ideal_edge = 0.0;
+    uint32_t pulse_time = time;
+    if (scenario.internal_clock) {
+      Clock::Tick();
+      if (Clock::raising_edge()) {
+        pulse = true;
+        pulse_time -= Clock::raising_edge_delay(kUpdatePeriod);
+        // Time of the edge, from the phase of the clock, at a finer
+        // resolution than the timer.
+        ideal_edge = time - Clock::raising_edge_delay(255) / 255.0 * \
+            kUpdatePeriod;
+        // The tempo of the internal clock is not exactly the one asked for.
+        if (previous_ideal_edge > 0.0) {
+          step_period = (ideal_edge - previous_ideal_edge) / num_ticks * \
+              kPulsesPerStep;
+        }
+        previous_ideal_edge = ideal_edge;
+      }
+    } else if (next_edge <= time) {
+      pulse = true;
+      edge = next_edge;
+      ideal_edge = next_ideal_edge;
+      pulse_time = static_cast<uint32_t>(edge);
+      next_ideal_edge += pulse_period;
+      next_edge = next_ideal_edge + (Random() * 2.0 - 1.0) * jitter;
+    }
+    if (pulse) {
+      isr.Pulse(time, ideal_edge, step_period, num_ticks);
+      scheduled.Pulse(pulse_time, ideal_edge, step_period, num_ticks);
+    }
+    // The outputs were not swung when written by the interrupt.
+    isr.Tick(time, scenario.swing ? &ignored : &stats[0]);
+    scheduled.Tick(time, &stats[1]);
+  }
+}
+
+int main(int argc, char** argv) {
+  double duration = argc > 1 ? atof(argv[1]) : 60.0;
+  printf("%-32s  %29s  %29s\n", "", "isr (us)", "scheduler (us)");
+  printf("%-32s  %9s %9s %9s  %9s %9s %9s\n", "scenario",
+         "delay", "rms", "peak", "delay", "rms", "peak");
+  for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i) {
+    Stats stats[2];
+    Simulate(scenarios[i], duration, stats);
+    printf("%-32s", scenarios[i].name);
+    stats[0].Print();
+    stats[1].Print();
+    printf("\n");
+  }
+  return 0;
+}
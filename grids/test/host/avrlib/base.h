@@ -0,0 +1,41 @@
+// Copyright 2011 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for the parts of avrlib/base.h used by the Grids engine.
+
+#ifndef GRIDS_TEST_HOST_AVRLIB_BASE_H_
+#define GRIDS_TEST_HOST_AVRLIB_BASE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef union {
+  uint16_t value;
+  uint8_t bytes[2];
+} Word;
+
+typedef union {
+  uint32_t value;
+  uint16_t words[2];
+  uint8_t bytes[4];
+} LongWord;
+
+#define DISALLOW_COPY_AND_ASSIGN(TypeName) \
+  TypeName(const TypeName&);               \
+  void operator=(const TypeName&)
+
+#endif  // GRIDS_TEST_HOST_AVRLIB_BASE_H_
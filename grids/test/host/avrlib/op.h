@@ -0,0 +1,42 @@
+// Copyright 2011 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for the 8-bit arithmetic helpers of avrlib/op.h. The
+// results are the same as those of the optimized AVR versions.
+
+#ifndef GRIDS_TEST_HOST_AVRLIB_OP_H_
+#define GRIDS_TEST_HOST_AVRLIB_OP_H_
+
+#include "avrlib/base.h"
+
+namespace avrlib {
+
+static inline uint8_t U8Mix(uint8_t a, uint8_t b, uint8_t balance) {
+  return (a * (255 - balance) + b * balance) >> 8;
+}
+
+static inline uint8_t U8U8MulShift8(uint8_t a, uint8_t b) {
+  return a * b >> 8;
+}
+
+static inline uint16_t U8U8Mul(uint8_t a, uint8_t b) {
+  return a * b;
+}
+
+}  // namespace avrlib
+
+#endif  // GRIDS_TEST_HOST_AVRLIB_OP_H_
@@ -0,0 +1,38 @@
+// Copyright 2011 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for avrlib/resources_manager.h. The resources are read
+// directly; the manager types only need to be declared.
+
+#ifndef GRIDS_TEST_HOST_AVRLIB_RESOURCES_MANAGER_H_
+#define GRIDS_TEST_HOST_AVRLIB_RESOURCES_MANAGER_H_
+
+#include <avr/pgmspace.h>
+
+namespace avrlib {
+
+template<
+    const prog_char* const* strings,
+    const prog_uint16_t* const* lookup_tables>
+struct ResourcesTables { };
+
+template<typename ResourceId, typename Tables>
+class ResourcesManager { };
+
+}  // namespace avrlib
+
+#endif  // GRIDS_TEST_HOST_AVRLIB_RESOURCES_MANAGER_H_
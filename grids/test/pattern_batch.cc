@@ -0,0 +1,381 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Evaluates the drum patterns of many pattern generators, each with its own
+// random seed, over a sweep of the map position, density and randomness
+// settings. The generators are shared between threads; the checksum of the
+// patterns does not depend on the number of threads.
+//
+// Before that, checks that a pattern evaluated at once is the same as the
+// one played step by step, and that the euclidean patterns of up to 32 steps
+// are those of the table of the earlier firmware versions. After that,
+// compares the cost of the drum engine with 3 and 8 parts.
+//
+// usage: pattern_batch [num_generators] [num_threads]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "grids/pattern_generator.h"
+
+using namespace grids;
+using namespace std;
+
+// 16-bit Galois LFSR, same sequence as avrlib::Random.
+class Lfsr {
+ public:
+  Lfsr() : state_(0x21) { }
+
+  inline void Seed(uint16_t seed) {
+    state_ = seed ? seed : 0x21;
+  }
+  inline void Update() {
+    state_ = (state_ >> 1) ^ (-(state_ & 1) & 0xb400);
+  }
+  inline uint16_t state() const { return state_; }
+  inline uint8_t GetByte() {
+    Update();
+    return state_ >> 8;
+  }
+
+ private:
+  uint16_t state_;
+};
+
+// Options of a freshly erased EEPROM: drums mode, no swing.
+struct NullStorage {
+  static inline uint8_t Read(uint16_t address) { return 0xff; }
+  static inline void Write(uint16_t address, uint8_t value) { }
+};
+
+typedef BasicPatternGenerator<Lfsr, NullStorage> HostPatternGenerator;
+
+const uint8_t kCoordinateIncrement = 16;
+const uint8_t kNumDensities = 4;
+const uint8_t kNumRandomness = 4;
+
+static const uint8_t densities[kNumDensities] = { 64, 128, 192, 255 };
+static const uint8_t randomness[kNumRandomness] = { 0, 64, 160, 255 };
+
+uint32_t Fnv1a(uint32_t hash, uint32_t word) {
+  for (uint8_t i = 0; i < 4; ++i) {
+    hash = (hash ^ (word & 0xff)) * 16777619;
+    word >>= 8;
+  }
+  return hash;
+}
+
+void Configure(
+    HostPatternGenerator* generator,
+    uint8_t x,
+    uint8_t y,
+    uint8_t density,
+    uint8_t randomness) {
+  PatternGeneratorSettings* settings = generator->mutable_settings();
+  settings->options.drums.x = x;
+  settings->options.drums.y = y;
+  settings->options.drums.randomness = randomness;
+  for (uint8_t i = 0; i < kNumParts; ++i) {
+    settings->density[i] = density - i * 16;
+  }
+}
+
+// Plays the pattern at 24 ppqn and compares each step with the pattern
+// evaluated at once by a generator in the same random state.
+bool CheckAgainstPlayback(uint16_t seed) {
+  HostPatternGenerator live;
+  HostPatternGenerator batch;
+  live.Init();
+  live.set_output_clock(false);
+  batch.Init();
+  Configure(&live, 100, 200, 200, 255);
+  Configure(&batch, 100, 200, 200, 255);
+  live.UpdateDrumMap();
+  live.mutable_random()->Seed(seed);
+  // The first step updates the random state before drawing the perturbation.
+  batch.mutable_random()->Seed(seed);
+  batch.mutable_random()->Update();
+
+  DrumPattern pattern;
+  batch.EvaluateDrumPattern(&pattern);
+  for (uint8_t step = 0; step < kStepsPerPattern; ++step) {
+    live.TickClock(1);
+    for (uint8_t i = 0; i < kNumParts; ++i) {
+      bool trigger = live.state() & (1 << i);
+      bool accent = live.state() & (8 << i);
+      if (trigger != static_cast<bool>((pattern.trigger[i] >> step) & 1) ||
+          accent != static_cast<bool>((pattern.accent[i] >> step) & 1)) {
+        fprintf(stderr, "seed %d, step %d, part %d: mismatch\n",
+                seed, step, i);
+        return false;
+      }
+    }
+    live.TickClock(kPulsesPerStep - 1);
+  }
+  return true;
+}
+
+// Same for a kit of 8 parts, some of them probabilistic: the pattern
+// evaluated at once is the same as the one evaluated step by step.
+bool CheckDrumEngine(uint16_t seed) {
+  DrumEngine<8> live;
+  DrumEngine<8> batch;
+  Lfsr live_random;
+  Lfsr batch_random;
+  live_random.Seed(seed);
+  batch_random.Seed(seed);
+  live.Init();
+  batch.Init();
+  for (uint8_t i = 0; i < 8; ++i) {
+    live.set_density(i, 255 - i * 24);
+    batch.set_density(i, 255 - i * 24);
+    live.set_probability(i, i & 1 ? 128 + i * 8 : 255);
+    batch.set_probability(i, i & 1 ? 128 + i * 8 : 255);
+    live.set_accent_level(i, 160 + i * 8);
+    batch.set_accent_level(i, 160 + i * 8);
+  }
+  live.UpdateDrumMap(40, 180);
+  batch.UpdateDrumMap(40, 180);
+
+  DrumLanes<8> lanes;
+  batch.EvaluatePattern(&batch_random, 48, &lanes);
+  live.DrawPerturbation(&live_random, 48);
+  for (uint8_t step = 0; step < kStepsPerPattern; ++step) {
+    uint8_t accents;
+    uint8_t triggers = live.EvaluateStep(step, &live_random, &accents);
+    for (uint8_t i = 0; i < 8; ++i) {
+      if (((triggers >> i) & 1) != ((lanes.trigger[i] >> step) & 1) ||
+          ((accents >> i) & 1) != ((lanes.accent[i] >> step) & 1)) {
+        fprintf(stderr, "8 parts, seed %d, step %d, part %d: mismatch\n",
+                seed, step, i);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Throughput of the drum engine alone, in patterns per second.
+template<uint8_t num_parts>
+double BenchmarkDrumEngine(uint32_t num_patterns, uint32_t* hash) {
+  DrumEngine<num_parts> engine;
+  Lfsr random;
+  DrumLanes<num_parts> lanes;
+  engine.Init();
+  for (uint8_t i = 0; i < num_parts; ++i) {
+    engine.set_density(i, 192);
+  }
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t n = 0; n < num_patterns; ++n) {
+    engine.UpdateDrumMap(n >> 8, n >> 12);
+    engine.EvaluatePattern(&random, 64, &lanes);
+    *hash = Fnv1a(*hash, lanes.trigger[n % num_parts]);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed = (end.tv_sec - start.tv_sec) + \
+      (end.tv_nsec - start.tv_nsec) * 1e-9;
+  return num_patterns / elapsed;
+}
+
+// Sweeps the settings for the generators first, first + stride, ...
+void Run(
+    std::vector<HostPatternGenerator*>* generators,
+    std::vector<uint32_t>* checksums,
+    size_t first,
+    size_t stride) {
+  for (size_t g = first; g < generators->size(); g += stride) {
+    HostPatternGenerator* generator = (*generators)[g];
+    uint32_t hash = 2166136261U;
+    DrumPattern pattern;
+    for (uint16_t x = 0; x < 256; x += kCoordinateIncrement) {
+      for (uint16_t y = 0; y < 256; y += kCoordinateIncrement) {
+        for (uint8_t d = 0; d < kNumDensities; ++d) {
+          for (uint8_t r = 0; r < kNumRandomness; ++r) {
+            Configure(generator, x, y, densities[d], randomness[r]);
+            generator->EvaluateDrumPattern(&pattern);
+            for (uint8_t i = 0; i < kNumParts; ++i) {
+              hash = Fnv1a(hash, pattern.trigger[i]);
+              hash = Fnv1a(hash, pattern.accent[i]);
+            }
+          }
+        }
+      }
+    }
+    (*checksums)[g] = hash;
+  }
+}
+
+// Bjorklund's algorithm, as run by the script which generated the table of
+// euclidean patterns of the earlier firmware versions (lut_res_euclidean).
+// Step n of the pattern plays when pattern[n] is set.
+vector<uint8_t> BjorklundPattern(uint8_t k, uint8_t n) {
+  vector<vector<uint8_t> > groups;
+  for (uint8_t i = 0; i < n; ++i) {
+    groups.push_back(vector<uint8_t>(1, i < k ? 1 : 0));
+  }
+  while (k) {
+    uint8_t cut = min<uint8_t>(k, groups.size() - k);
+    vector<vector<uint8_t> > merged;
+    for (uint8_t i = 0; i < cut; ++i) {
+      merged.push_back(groups[i]);
+      merged.back().insert(
+          merged.back().end(), groups[k + i].begin(), groups[k + i].end());
+    }
+    merged.insert(merged.end(), groups.begin() + cut, groups.begin() + k);
+    merged.insert(merged.end(), groups.begin() + k + cut, groups.end());
+    groups.swap(merged);
+    k = cut;
+  }
+  vector<uint8_t> pattern;
+  for (size_t i = 0; i < groups.size(); ++i) {
+    pattern.insert(pattern.end(), groups[i].begin(), groups[i].end());
+  }
+  return pattern;
+}
+
+// The euclidean patterns of up to kMaxTabulatedEuclideanLength steps are
+// exactly those of the table, for every number of notes, rotated by the
+// rotation setting. The generator, driven by its length and density settings,
+// plays them with the same number of notes as the table: the one of the
+// 5-bit density rounded over the length.
+bool CheckEuclidean() {
+  for (uint8_t length = 1; length <= kMaxTabulatedEuclideanLength; ++length) {
+    for (uint8_t num_notes = 0; num_notes <= length; ++num_notes) {
+      vector<uint8_t> expected = BjorklundPattern(num_notes, length);
+      for (uint8_t rotation = 0; rotation < length; ++rotation) {
+        uint8_t pattern[kEuclideanPatternSize];
+        ComputeEuclideanPattern(length, num_notes, rotation, pattern);
+        for (uint8_t step = 0; step < length; ++step) {
+          bool plays = pattern[step >> 3] & (1 << (step & 7));
+          if (plays != expected[(step + rotation) % length]) {
+            fprintf(stderr, "euclidean: %d notes in %d steps, rotation %d, "
+                    "step %d: mismatch\n", num_notes, length, rotation, step);
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  HostPatternGenerator generator;
+  generator.Init();
+  generator.set_output_mode(OUTPUT_MODE_EUCLIDEAN);
+  generator.set_output_clock(false);
+  for (uint8_t length = 1; length <= kMaxTabulatedEuclideanLength; ++length) {
+    for (uint8_t density = 0; density < 32; ++density) {
+      for (uint8_t rotation = 0; rotation < length; ++rotation) {
+        // Each part gets its own density and rotation.
+        PatternGeneratorSettings* settings = generator.mutable_settings();
+        vector<uint8_t> expected[kNumParts];
+        uint8_t part_rotation[kNumParts];
+        for (uint8_t i = 0; i < kNumParts; ++i) {
+          uint8_t part_density = (density + i * 11) % 32;
+          uint8_t num_notes = static_cast<uint8_t>(
+              round(part_density / 31.0 * length));
+          expected[i] = BjorklundPattern(num_notes, length);
+          part_rotation[i] = (rotation + i) % length;
+          settings->options.euclidean_length[i] = (length - 1) << 2;
+          settings->density[i] = part_density << 3;
+          settings->euclidean_rotation[i] = part_rotation[i];
+        }
+        generator.UpdateEuclideanPatterns();
+        generator.Reset();
+        for (uint8_t step = 0; step < length; ++step) {
+          generator.TickClock(1);
+          for (uint8_t i = 0; i < kNumParts; ++i) {
+            bool plays = generator.state() & (1 << i);
+            if (plays != expected[i][(step + part_rotation[i]) % length]) {
+              fprintf(stderr, "euclidean: length %d, density %d, rotation %d, "
+                      "part %d, step %d: mismatch\n", length,
+                      (density + i * 11) % 32, part_rotation[i], i, step);
+              return false;
+            }
+          }
+          generator.TickClock(2 * kPulsesPerStep - 1);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  size_t num_generators = argc > 1 ? strtoul(argv[1], NULL, 0) : 1024;
+  size_t num_threads = argc > 2 ? strtoul(argv[2], NULL, 0) : 0;
+  if (!num_threads) {
+    num_threads = std::thread::hardware_concurrency();
+    if (!num_threads) {
+      num_threads = 1;
+    }
+  }
+
+  for (uint16_t seed = 1; seed < 64; ++seed) {
+    if (!CheckAgainstPlayback(seed) || !CheckDrumEngine(seed)) {
+      return 1;
+    }
+  }
+  if (!CheckEuclidean()) {
+    return 1;
+  }
+
+  std::vector<HostPatternGenerator*> generators(num_generators);
+  std::vector<uint32_t> checksums(num_generators);
+  for (size_t g = 0; g < num_generators; ++g) {
+    generators[g] = new HostPatternGenerator;
+    generators[g]->Init();
+    generators[g]->mutable_random()->Seed(g * 0x9e37 + 1);
+  }
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t) {
+    threads.push_back(std::thread(
+        Run, &generators, &checksums, t, num_threads));
+  }
+  for (size_t t = 0; t < num_threads; ++t) {
+    threads[t].join();
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  uint32_t checksum = 2166136261U;
+  for (size_t g = 0; g < num_generators; ++g) {
+    checksum = Fnv1a(checksum, checksums[g]);
+    delete generators[g];
+  }
+
+  double elapsed = (end.tv_sec - start.tv_sec) + \
+      (end.tv_nsec - start.tv_nsec) * 1e-9;
+  size_t per_generator = (256 / kCoordinateIncrement) * \
+      (256 / kCoordinateIncrement) * kNumDensities * kNumRandomness;
+  double num_patterns = static_cast<double>(num_generators * per_generator);
+  printf("%.0f patterns, %d threads, %.3f s, %.2f Mpatterns/s\n",
+         num_patterns, static_cast<int>(num_threads), elapsed,
+         num_patterns / elapsed * 1e-6);
+  printf("checksum: %08x\n", checksum);
+
+  uint32_t hash = 0;
+  double three_parts = BenchmarkDrumEngine<3>(1 << 20, &hash);
+  double eight_parts = BenchmarkDrumEngine<8>(1 << 20, &hash);
+  printf("drum engine: %.2f Mpatterns/s with 3 parts, %.2f with 8 (%08x)\n",
+         three_parts * 1e-6, eight_parts * 1e-6, hash);
+  return 0;
+}
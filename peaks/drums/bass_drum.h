@@ -48,7 +48,7 @@ class BassDrum {
   ~BassDrum() { }
 
   void Init();
-  int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) IN_RAM;
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -69,6 +69,11 @@ class BassDrum {
   }
   
   void set_decay(uint16_t decay) {
+    // The resonance is only recomputed when the decay actually changes.
+    if (decay == decay_) {
+      return;
+    }
+    decay_ = decay;
     uint32_t scaled;
     uint32_t squared;
     scaled = 65535 - decay;
@@ -78,6 +83,10 @@ class BassDrum {
   }
   
   void set_tone(uint16_t tone) {
+    if (tone == tone_) {
+      return;
+    }
+    tone_ = tone;
     uint32_t coefficient = tone;
     coefficient = coefficient * coefficient >> 16;
     lp_coefficient_ = 512 + (coefficient >> 2) * 3;
@@ -97,6 +106,10 @@ class BassDrum {
   int32_t lp_coefficient_;
   int32_t lp_state_;
 
+  // Last values passed to set_decay() and set_tone(), -1 when unknown.
+  int32_t decay_;
+  int32_t tone_;
+
   DISALLOW_COPY_AND_ASSIGN(BassDrum);
 };
 
@@ -106,7 +119,7 @@ class RandomisedBassDrum {
   ~RandomisedBassDrum() { }
 
   void Init();
-  int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) IN_RAM;
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -135,6 +148,11 @@ class RandomisedBassDrum {
   }
   
   void set_decay(uint16_t decay) {
+    // The resonance is only recomputed when the decay actually changes.
+    if (decay == decay_) {
+      return;
+    }
+    decay_ = decay;
     uint32_t scaled;
     uint32_t squared;
     scaled = 65535 - decay;
@@ -144,6 +162,10 @@ class RandomisedBassDrum {
   }
   
   void set_tone(uint16_t tone) {
+    if (tone == tone_) {
+      return;
+    }
+    tone_ = tone;
     uint32_t coefficient = tone;
     coefficient = coefficient * coefficient >> 16;
     lp_coefficient_ = 512 + (coefficient >> 2) * 3;
@@ -170,6 +192,10 @@ class RandomisedBassDrum {
   int32_t frequency_;
   int32_t lp_coefficient_;
   int32_t lp_state_;
+
+  // Last values passed to set_decay() and set_tone(), -1 when unknown.
+  int32_t decay_;
+  int32_t tone_;
   
   uint16_t frequency_randomness_ ;
   uint16_t hit_randomness_ ;
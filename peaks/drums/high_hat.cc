@@ -49,112 +49,95 @@ void HighHat::Init() {
   noise_.set_resonance(24000);
   noise_.set_mode(SVF_MODE_BP);
   
-  // vca_coloration_.Init();
-  // vca_coloration_.set_frequency(110 << 7);  // 13kHz
-  // vca_coloration_.set_resonance(0);
-  // vca_coloration_.set_mode(SVF_MODE_HP);
-  
   vca_envelope_.Init();
   vca_envelope_.set_delay(0);
   vca_envelope_.set_decay(4093);
 }
 
-int16_t HighHat::ProcessSingleSample(uint8_t control) {
-  if ((control & CONTROL_GATE_RISING) &&
-      (open_ || (!open_ && !(control & CONTROL_GATE_RISING_AUXILIARY)))) {  
-    // randomise parameters
-    // frequency
-    uint32_t random_value = stmlib::Random::GetWord() ;
-    bool freq_up = (random_value > 2147483647) ? true : false ;
-    int32_t randomised_frequency = freq_up ? 
-                                   (last_frequency_ + (frequency_randomness_ >> 2)) :
-                                   (last_frequency_ - (frequency_randomness_ >> 2));
-    // Check if we haven't walked out-of-bounds, and if so, reverse direction on last step
-    if (randomised_frequency < 0 || randomised_frequency > 65535) {
-      // flip the direction
-      freq_up = !freq_up ;
-      randomised_frequency = freq_up ? 
-                                   (last_frequency_ + (frequency_randomness_ >> 2)) :
-                                   (last_frequency_ - (frequency_randomness_ >> 2));
-    }
-    // constrain randomised frequency - probably not necessary
-    if (randomised_frequency < 0) { 
-      randomised_frequency = 0; 
-    } else if (randomised_frequency > 65535) { 
-      randomised_frequency = 65535; 
-    }
-    // set new random frequency
-    set_frequency(randomised_frequency) ; 
-    last_frequency_ = randomised_frequency ;
-
-    // decay
-    random_value = stmlib::Random::GetWord() ;
-    freq_up = (random_value > 2147483647) ? true : false ;
-    randomised_frequency = freq_up ? 
-                                   (last_decay_ + (decay_randomness_ >> 2)) :
-                                   (last_decay_ - (decay_randomness_ >> 2));
-    // Check if we haven't walked out-of-bounds, and if so, reverse direction on last step
-    if (randomised_frequency < 0 || randomised_frequency > 65535) {
-      // flip the direction
-      freq_up = !freq_up ;
-      randomised_frequency = freq_up ? 
-                                   (last_decay_ + (decay_randomness_ >> 2)) :
-                                   (last_decay_ - (decay_randomness_ >> 2));
-    }
-    // constrain randomised frequency - probably not necessary
-    if (randomised_frequency < 0) { 
-      randomised_frequency = 0; 
-    } else if (randomised_frequency > 65535) { 
-      randomised_frequency = 65535; 
-    }
-    // set new random decay
-    set_decay(randomised_frequency) ; 
-    last_decay_ = randomised_frequency ;
+// One step of a random walk of the frequency and decay, taken at each
+// trigger. A step that would leave the range is taken in the other direction.
+void HighHat::Randomise() {
+  int32_t step = frequency_randomness_ >> 2;
+  int32_t frequency = last_frequency_ + \
+      (Random::GetWord() & 0x80000000 ? step : -step);
+  if (frequency < 0 || frequency > 65535) {
+    frequency = 2 * last_frequency_ - frequency;
+  }
+  CONSTRAIN(frequency, 0, 65535);
+  set_frequency(frequency);
+  last_frequency_ = frequency;
 
-    // Hit it!
-    vca_envelope_.Trigger(32768 * 15);
+  step = decay_randomness_ >> 2;
+  int32_t decay = last_decay_ + \
+      (Random::GetWord() & 0x80000000 ? step : -step);
+  if (decay < 0 || decay > 65535) {
+    decay = 2 * last_decay_ - decay;
   }
-  
-  phase_[0] += 48318382;
-  phase_[1] += 71582788;
-  phase_[2] += 37044092;
-  phase_[3] += 54313440;
-  phase_[4] += 66214079;
-  phase_[5] += 93952409;
+  CONSTRAIN(decay, 0, 65535);
+  set_decay(decay);
+  last_decay_ = decay;
+}
 
-  int16_t noise = 0;
-  noise += phase_[0] >> 31;
-  noise += phase_[1] >> 31;
-  noise += phase_[2] >> 31;
-  noise += phase_[3] >> 31;
-  noise += phase_[4] >> 31;
-  noise += phase_[5] >> 31;
-  noise <<= 12;
-  
-  // Run the SVF at the double of the original sample rate for stability.
-  int32_t filtered_noise = 0;
-  filtered_noise += noise_.Process(noise);
-  // filtered_noise += noise_.Process(noise);
+void HighHat::FillBuffer(
+    InputBuffer* input_buffer,
+    OutputBuffer* output_buffer) {
+  // The metallic source does not depend on the gate: six square waves at
+  // inharmonic frequencies, rendered for the whole block.
+  int32_t noise[kBlockSize];
+  uint32_t phase_0 = phase_[0];
+  uint32_t phase_1 = phase_[1];
+  uint32_t phase_2 = phase_[2];
+  uint32_t phase_3 = phase_[3];
+  uint32_t phase_4 = phase_[4];
+  uint32_t phase_5 = phase_[5];
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    phase_0 += 48318382;
+    phase_1 += 71582788;
+    phase_2 += 37044092;
+    phase_3 += 54313440;
+    phase_4 += 66214079;
+    phase_5 += 93952409;
+    noise[i] = ((phase_0 >> 31) + (phase_1 >> 31) + (phase_2 >> 31) + \
+                (phase_3 >> 31) + (phase_4 >> 31) + (phase_5 >> 31)) << 12;
+  }
+  phase_[0] = phase_0;
+  phase_[1] = phase_1;
+  phase_[2] = phase_2;
+  phase_[3] = phase_3;
+  phase_[4] = phase_4;
+  phase_[5] = phase_5;
 
-  // The 808-style VCA amplifies only the positive section of the signal.
-  if (filtered_noise < 0) {
-    filtered_noise = 0;
-  } else if (filtered_noise > 32767) {
-    filtered_noise = 32767;
+  // A trigger changes the filter frequency and the VCA decay, so the block is
+  // split at each trigger, and the filter and VCA run on each part.
+  uint8_t start = 0;
+  for (uint8_t i = 0; i <= kBlockSize; ++i) {
+    bool trigger = false;
+    if (i < kBlockSize) {
+      uint8_t control = input_buffer->ImmediateRead();
+      trigger = (control & CONTROL_GATE_RISING) &&
+          (open_ || !(control & CONTROL_GATE_RISING_AUXILIARY));
+      if (!trigger) {
+        continue;
+      }
+    }
+    
+    noise_.ProcessBlock(&noise[start], &noise[start], i - start);
+    for (uint8_t j = start; j < i; ++j) {
+      // The 808-style VCA amplifies only the positive section of the signal.
+      int32_t filtered_noise = noise[j];
+      CONSTRAIN(filtered_noise, 0, 32767);
+      int32_t envelope = vca_envelope_.Process() >> 4;
+      int32_t vca_noise = envelope * filtered_noise >> 14;
+      CLIP(vca_noise);
+      output_buffer->Overwrite(vca_noise);
+    }
+    start = i;
+    
+    if (trigger) {
+      Randomise();
+      vca_envelope_.Trigger(32768 * 15);
+    }
   }
-  
-  int32_t envelope = vca_envelope_.Process() >> 4;
-  int32_t vca_noise = envelope * filtered_noise >> 14;
-  CLIP(vca_noise);
-  return vca_noise;
-  // int32_t hh = 0;
-  // hh += vca_coloration_.Process(vca_noise);
-  // hh += vca_coloration_.Process(vca_noise);
-  // hh <<= 1;
-  // hh <<= 2;
-  // CLIP(hh);
-  // return hh;
 }
 
-
 }  // namespace peaks
@@ -48,7 +48,7 @@ class HighHat {
   ~HighHat() { }
 
   void Init();
-  int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) IN_RAM;
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
       set_frequency(parameter[0]);
@@ -94,8 +94,9 @@ class HighHat {
   }
   
  private:
+  void Randomise();
+  
   Svf noise_;
-  // Svf vca_coloration_;
   Excitation vca_envelope_;
   
   uint32_t phase_[6];
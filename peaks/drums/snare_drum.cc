@@ -72,35 +72,54 @@ void SnareDrum::Init() {
   set_frequency(0);
 }
 
-int16_t SnareDrum::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    excitation_1_up_.Trigger(15 * 32768);
-    excitation_1_down_.Trigger(-1 * 32768);
-    excitation_2_.Trigger(13107);
-    excitation_noise_.Trigger(snappy_);
-  }
+void SnareDrum::FillBuffer(
+    InputBuffer* input_buffer,
+    OutputBuffer* output_buffer) {
+  int32_t excitation_1[kBlockSize];
+  int32_t excitation_2[kBlockSize];
+  int32_t body_1[kBlockSize];
+  int32_t body_2[kBlockSize];
+  int32_t noise[kBlockSize];
+  int32_t noise_envelope[kBlockSize];
   
-  int32_t excitation_1 = 0;
-  excitation_1 += excitation_1_up_.Process();
-  excitation_1 += excitation_1_down_.Process();
-  excitation_1 += !excitation_1_down_.done() ? 2621 : 0;
+  // The excitations do not depend on the filters, so they are computed first
+  // and the three filters then run over the whole block.
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    uint8_t control = input_buffer->ImmediateRead();
+    if (control & CONTROL_GATE_RISING) {
+      excitation_1_up_.Trigger(15 * 32768);
+      excitation_1_down_.Trigger(-1 * 32768);
+      excitation_2_.Trigger(13107);
+      excitation_noise_.Trigger(snappy_);
+    }
+
+    int32_t e = 0;
+    e += excitation_1_up_.Process();
+    e += excitation_1_down_.Process();
+    e += !excitation_1_down_.done() ? 2621 : 0;
+    excitation_1[i] = e;
+
+    e = 0;
+    e += excitation_2_.Process();
+    e += !excitation_2_.done() ? 13107 : 0;
+    excitation_2[i] = e;
+    
+    noise[i] = Random::GetSample();
+    noise_envelope[i] = excitation_noise_.Process();
+  }
   
-  int32_t body_1 = body_1_.Process(excitation_1) + (excitation_1 >> 4);
+  body_1_.ProcessBlock(excitation_1, body_1, kBlockSize);
+  body_2_.ProcessBlock(excitation_2, body_2, kBlockSize);
+  noise_.ProcessBlock(noise, noise, kBlockSize);
   
-  int32_t excitation_2 = 0;
-  excitation_2 += excitation_2_.Process();
-  excitation_2 += !excitation_2_.done() ? 13107 : 0;
-
-  int32_t body_2 = body_2_.Process(excitation_2) + (excitation_2 >> 4);
-  int32_t noise_sample = Random::GetSample();
-  int32_t noise = noise_.Process(noise_sample);
-  int32_t noise_envelope = excitation_noise_.Process();
-  int32_t sd = 0;
-  sd += body_1 * gain_1_ >> 15;
-  sd += body_2 * gain_2_ >> 15;
-  sd += noise_envelope * noise >> 15;
-  CLIP(sd);
-  return sd;
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    int32_t sd = 0;
+    sd += (body_1[i] + (excitation_1[i] >> 4)) * gain_1_ >> 15;
+    sd += (body_2[i] + (excitation_2[i] >> 4)) * gain_2_ >> 15;
+    sd += noise_envelope[i] * noise[i] >> 15;
+    CLIP(sd);
+    output_buffer->Overwrite(sd);
+  }
 }
 
 // randomised version
@@ -137,86 +156,92 @@ void RandomisedSnareDrum::Init() {
   randomised_hit_ = 65535 ;
 }
 
-int16_t RandomisedSnareDrum::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    // randomise parameters
-    // frequency
-    uint32_t random_value = stmlib::Random::GetWord() ;
-    bool freq_up = (random_value > 2147483647) ? true : false ;
-    int32_t randomised_frequency = freq_up ? 
-                                   (last_frequency_ + (frequency_randomness_ >> 2)) :
-                                   (last_frequency_ - (frequency_randomness_ >> 2));
-    // Check if we haven't walked out-of-bounds, and if so, reverse direction on last step
-    if (randomised_frequency < -32767 || randomised_frequency > 32767) {
-      // flip the direction
-      freq_up = !freq_up ;
-      randomised_frequency = freq_up ? 
-                                   (last_frequency_ + (frequency_randomness_ >> 2)) :
-                                   (last_frequency_ - (frequency_randomness_ >> 2));
-    }
-    // constrain randomised frequency - probably not necessary
-    if (randomised_frequency < -32767) { 
-      randomised_frequency = -32767; 
-    } else if (randomised_frequency > 32767) { 
-      randomised_frequency = 32767; 
+void RandomisedSnareDrum::FillBuffer(
+    InputBuffer* input_buffer,
+    OutputBuffer* output_buffer) {
+  uint8_t size = kBlockSize;
+  while (size--) {
+    uint8_t control = input_buffer->ImmediateRead();
+    if (control & CONTROL_GATE_RISING) {
+      // randomise parameters
+      // frequency
+      uint32_t random_value = stmlib::Random::GetWord() ;
+      bool freq_up = (random_value > 2147483647) ? true : false ;
+      int32_t randomised_frequency = freq_up ? 
+                                     (last_frequency_ + (frequency_randomness_ >> 2)) :
+                                     (last_frequency_ - (frequency_randomness_ >> 2));
+      // Check if we haven't walked out-of-bounds, and if so, reverse direction on last step
+      if (randomised_frequency < -32767 || randomised_frequency > 32767) {
+        // flip the direction
+        freq_up = !freq_up ;
+        randomised_frequency = freq_up ? 
+                                     (last_frequency_ + (frequency_randomness_ >> 2)) :
+                                     (last_frequency_ - (frequency_randomness_ >> 2));
+      }
+      // constrain randomised frequency - probably not necessary
+      if (randomised_frequency < -32767) { 
+        randomised_frequency = -32767; 
+      } else if (randomised_frequency > 32767) { 
+        randomised_frequency = 32767; 
+      }
+      // set new random frequency
+      set_frequency(randomised_frequency) ; 
+      last_frequency_ = randomised_frequency ;
+
+      // now randomise the hit
+      // bool hit_up = (random_value > 2147483647) ? true : false ;
+      // randomised_hit_ = hit_up ? 
+      //                                (last_random_hit_ - (hit_randomness_ >> 2)) :
+      //                               (last_random_hit_ + (hit_randomness_ >> 2));
+      // Check if we haven't walked out-of-bounds, and if so, reverse direction on last step
+      // if (randomised_hit_ < 0 || randomised_hit_ > 65535) {
+      //   // flip the direction
+      //   hit_up = !hit_up ;
+      //   randomised_hit_ = hit_up ? 
+      //                                (last_random_hit_ - (hit_randomness_ >> 2)) :
+      //                                (last_random_hit_ + (hit_randomness_ >> 2));
+      // }  
+
+      randomised_hit_ = last_random_hit_ + ((stmlib::Random::GetSample() * hit_randomness_) >> 16);
+      // constrain randomised hit
+      if (randomised_hit_ < 0) { 
+        randomised_hit_ = 0; 
+      } else if (randomised_hit_ > 65535) { 
+        randomised_hit_ = 65535; 
+      }
+      last_random_hit_ = randomised_hit_;
+      set_tone(randomised_hit_);
+      set_decay(randomised_hit_);
+      excitation_1_up_.Trigger(15 * 32768);
+      excitation_1_down_.Trigger(-1 * 32768);
+      excitation_2_.Trigger(13107);
+      excitation_noise_.Trigger(snappy_);
     }
-    // set new random frequency
-    set_frequency(randomised_frequency) ; 
-    last_frequency_ = randomised_frequency ;
-     
-    // now randomise the hit
-    // bool hit_up = (random_value > 2147483647) ? true : false ;
-    // randomised_hit_ = hit_up ? 
-    //                                (last_random_hit_ - (hit_randomness_ >> 2)) :
-    //                               (last_random_hit_ + (hit_randomness_ >> 2));
-    // Check if we haven't walked out-of-bounds, and if so, reverse direction on last step
-    // if (randomised_hit_ < 0 || randomised_hit_ > 65535) {
-    //   // flip the direction
-    //   hit_up = !hit_up ;
-    //   randomised_hit_ = hit_up ? 
-    //                                (last_random_hit_ - (hit_randomness_ >> 2)) :
-    //                                (last_random_hit_ + (hit_randomness_ >> 2));
-    // }  
-
-    randomised_hit_ = last_random_hit_ + ((stmlib::Random::GetSample() * hit_randomness_) >> 16);
-    // constrain randomised hit
-    if (randomised_hit_ < 0) { 
-      randomised_hit_ = 0; 
-    } else if (randomised_hit_ > 65535) { 
-      randomised_hit_ = 65535; 
-    }
-    last_random_hit_ = randomised_hit_;
-    set_tone(randomised_hit_);
-    set_decay(randomised_hit_);
-    excitation_1_up_.Trigger(15 * 32768);
-    excitation_1_down_.Trigger(-1 * 32768);
-    excitation_2_.Trigger(13107);
-    excitation_noise_.Trigger(snappy_);
+
+    int32_t excitation_1 = 0;
+    excitation_1 += excitation_1_up_.Process();
+    excitation_1 += excitation_1_down_.Process();
+    excitation_1 += !excitation_1_down_.done() ? 2621 : 0;
+
+    int32_t body_1 = body_1_.Process(excitation_1) + (excitation_1 >> 4);
+
+    int32_t excitation_2 = 0;
+    excitation_2 += excitation_2_.Process();
+    excitation_2 += !excitation_2_.done() ? 13107 : 0;
+
+    int32_t body_2 = body_2_.Process(excitation_2) + (excitation_2 >> 4);
+    int32_t noise_sample = Random::GetSample();
+    int32_t noise = noise_.Process(noise_sample);
+    int32_t noise_envelope = excitation_noise_.Process();
+    int32_t sd = 0;
+    sd += body_1 * gain_1_ >> 15;
+    sd += body_2 * gain_2_ >> 15;
+    sd += noise_envelope * noise >> 15;
+    // sd = (sd * (32767 + (randomised_hit_ >> 1))) >> 16;
+    sd = (sd * (16383 + (randomised_hit_ >> 1) + (randomised_hit_ >> 2) )) >> 16;
+    CLIP(sd);
+    output_buffer->Overwrite(sd);
   }
-  
-  int32_t excitation_1 = 0;
-  excitation_1 += excitation_1_up_.Process();
-  excitation_1 += excitation_1_down_.Process();
-  excitation_1 += !excitation_1_down_.done() ? 2621 : 0;
-  
-  int32_t body_1 = body_1_.Process(excitation_1) + (excitation_1 >> 4);
-  
-  int32_t excitation_2 = 0;
-  excitation_2 += excitation_2_.Process();
-  excitation_2 += !excitation_2_.done() ? 13107 : 0;
-
-  int32_t body_2 = body_2_.Process(excitation_2) + (excitation_2 >> 4);
-  int32_t noise_sample = Random::GetSample();
-  int32_t noise = noise_.Process(noise_sample);
-  int32_t noise_envelope = excitation_noise_.Process();
-  int32_t sd = 0;
-  sd += body_1 * gain_1_ >> 15;
-  sd += body_2 * gain_2_ >> 15;
-  sd += noise_envelope * noise >> 15;
-  // sd = (sd * (32767 + (randomised_hit_ >> 1))) >> 16;
-  sd = (sd * (16383 + (randomised_hit_ >> 1) + (randomised_hit_ >> 2) )) >> 16;
-  CLIP(sd);
-  return sd;
 }
 
 }  // namespace peaks
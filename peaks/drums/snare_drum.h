@@ -50,7 +50,7 @@ class SnareDrum {
   ~SnareDrum() { }
 
   void Init();
-  int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) IN_RAM;
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
@@ -118,7 +118,7 @@ class RandomisedSnareDrum {
   ~RandomisedSnareDrum() { }
 
   void Init();
-  int16_t ProcessSingleSample(uint8_t control) IN_RAM;
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) IN_RAM;
   
   void Configure(uint16_t* parameter, ControlMode control_mode) {
     if (control_mode == CONTROL_MODE_HALF) {
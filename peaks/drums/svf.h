@@ -30,59 +30,18 @@
 #define PEAKS_DRUMS_SVF_H_
 
 #include "stmlib/stmlib.h"
+#include "common/state_variable_filter.h"
 
-namespace peaks {
-
-enum SvfMode {
-  SVF_MODE_LP,
-  SVF_MODE_BP,
-  SVF_MODE_HP
-};
+#include "peaks/resources.h"
 
-class Svf {
- public:
-  Svf() { }
-  ~Svf() { }
-  
-  void Init();
-  
-  void set_frequency(int16_t frequency) {
-    dirty_ = dirty_ || (frequency_ != frequency);
-    frequency_ = frequency;
-  }
-  
-  void set_resonance(int16_t resonance) {
-    resonance_ = resonance;
-    dirty_ = true;
-  }
-  
-  void set_punch(uint16_t punch) {
-    punch_ = (static_cast<uint32_t>(punch) * punch) >> 24;
-  }
-  
-  void set_mode(SvfMode mode) {
-    mode_ = mode;
-  }
-
-  int32_t Process(int32_t sample) IN_RAM;
-  
- private:
-  bool dirty_;
-  
-  int16_t frequency_;
-  int16_t resonance_;
-  
-  int32_t punch_;
-  int32_t f_;
-  int32_t damp_;
+namespace peaks {
 
-  int32_t lp_;
-  int32_t bp_;
-  
-  SvfMode mode_;
+using common::SvfMode;
+using common::SVF_MODE_LP;
+using common::SVF_MODE_BP;
+using common::SVF_MODE_HP;
 
-  DISALLOW_COPY_AND_ASSIGN(Svf);
-};
+typedef common::StateVariableFilter<lut_svf_cutoff, lut_svf_damp> Svf;
 
 }  // namespace peaks
 
@@ -66,22 +66,12 @@ class BouncingBall {
     }
   }
   
-  inline int16_t ProcessSingleSample(uint8_t control) {
-    if (control & CONTROL_GATE_RISING) {
-      velocity_ = initial_velocity_;
-      position_ = initial_amplitude_;
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) {
+    uint8_t size = kBlockSize;
+    while (size--) {
+      output_buffer->Overwrite(ProcessSingleSample(
+          input_buffer->ImmediateRead()));
     }
-    velocity_ -= gravity_;
-    position_ += velocity_;
-    if (position_ < 0) {
-      position_ = 0;
-      velocity_ = -(velocity_ >> 12) * bounce_loss_;
-    }
-    if (position_ > (32767L << 15)) {
-      position_ = 32767L << 15;
-      velocity_ = -(velocity_ >> 12) * bounce_loss_;
-    }
-    return position_ >> 15;
   }
   
   inline void set_gravity(uint16_t gravity) {
@@ -102,11 +92,25 @@ class BouncingBall {
     initial_velocity_ = static_cast<int32_t>(initial_velocity) << 4;
   }
   
-  inline bool FillBuffer() const {
-    return true;
+ private:
+  inline int16_t ProcessSingleSample(uint8_t control) {
+    if (control & CONTROL_GATE_RISING) {
+      velocity_ = initial_velocity_;
+      position_ = initial_amplitude_;
+    }
+    velocity_ -= gravity_;
+    position_ += velocity_;
+    if (position_ < 0) {
+      position_ = 0;
+      velocity_ = -(velocity_ >> 12) * bounce_loss_;
+    }
+    if (position_ > (32767L << 15)) {
+      position_ = 32767L << 15;
+      velocity_ = -(velocity_ >> 12) * bounce_loss_;
+    }
+    return position_ >> 15;
   }
   
- private:
   int32_t gravity_;
   int32_t bounce_loss_;
   int32_t initial_amplitude_;
@@ -53,9 +53,10 @@ void Lfo::Init() {
   reset_phase_ = 0;
   sync_ = false;
   previous_parameter_ = 32767;
-  sync_counter_ = kSyncCounterMaxTime;
   level_ = 32767;
-  pattern_predictor_.Init();
+  phase_ = 0;
+  phase_increment_ = 0;
+  clock_follower_.Init(kSyncCounterMaxTime);
 }
 
 const int16_t presets[7][2] = {
@@ -84,31 +85,25 @@ void Lfo::FillBuffer(
   }
   uint8_t size = kBlockSize;  
   while (size--) {
-    ++sync_counter_;
     uint8_t control = input_buffer->ImmediateRead();
-    if (control & CONTROL_GATE_RISING) {
-      bool reset_phase = true;
-      if (sync_) {
-        if (sync_counter_ < kSyncCounterMaxTime) {
-          uint32_t period = 0;
-          if (sync_counter_ < 1920) {
-            period = (3 * period_ + sync_counter_) >> 2;
-            reset_phase = false;
-          } else {
-            period = pattern_predictor_.Predict(sync_counter_);
-          }
-          if (period != period_) {
-            period_ = period;
-            phase_increment_ = 0xffffffff / period_;
-          }
-        }
-        sync_counter_ = 0;
+    if (sync_) {
+      clock_follower_.Process(control & CONTROL_GATE_RISING);
+      if (clock_follower_.has_period()) {
+        phase_increment_ = clock_follower_.phase_increment();
       }
-      if (reset_phase) {
+    }
+    if (sync_ && clock_follower_.locked()) {
+      // The LFO is the local oscillator of the clock follower, with the
+      // reset phase acting as a phase offset.
+      phase_ = clock_follower_.phase() + reset_phase_;
+    } else {
+      // Until the follower locks, the LFO keeps running, and is reset by the
+      // clock.
+      if (control & CONTROL_GATE_RISING) {
         phase_ = reset_phase_;
       }
+      phase_ += phase_increment_;
     }
-    phase_ += phase_increment_;
     int32_t sample = (this->*compute_sample_fn_table_[shape_])();
     output_buffer->Overwrite(sample * level_ >> 15);
   }
@@ -632,8 +627,9 @@ void Plo::Init() {
   // wsm_reset_phase_ = 0;
   // wsm_delta_ = 0 ;
 
-  sync_counter_ = kSyncCounterMaxTime;
-  pattern_predictor_.Init();
+  phase_ = 0;
+  phase_increment_ = 0;
+  clock_follower_.Init(kSyncCounterMaxTime);
   
   pitch_multiplier_ = 0;  
 }
@@ -661,29 +657,27 @@ void Plo::FillBuffer(
     parameter_ = (wsm_sample * wsm_depth_) >> 16;
   }
   // now actual LFO
+  if (pitch_multiplier_ < 0) {
+    clock_follower_.set_ratio(1, 1 << -pitch_multiplier_);
+  } else {
+    clock_follower_.set_ratio(1 << pitch_multiplier_, 1);
+  }
   uint8_t size = kBlockSize;  
   while (size--) {
-    ++sync_counter_;
     uint8_t control = input_buffer->ImmediateRead();
-    if (control & CONTROL_GATE_RISING) {
-        if (sync_counter_ < kSyncCounterMaxTime) {
-          uint32_t period = 0;
-          if (sync_counter_ < 1920) {
-            period = (3 * period_ + sync_counter_) >> 2;
-          } else {
-            period = pattern_predictor_.Predict(sync_counter_);
-          }
-          if (period != period_) {
-            period_ = period;
-            phase_increment_ = 0xffffffff / period;
-            phase_increment_ = pitch_multiplier_ < 0 ? 
-                                phase_increment_ >> -pitch_multiplier_ :
-                                phase_increment_ << pitch_multiplier_ ;
-          }
-        }
-        sync_counter_ = 0;
+    clock_follower_.Process(control & CONTROL_GATE_RISING);
+    if (clock_follower_.has_period()) {
+      phase_increment_ = clock_follower_.phase_increment();
+    }
+    if (clock_follower_.locked()) {
+      phase_ = clock_follower_.phase();
+    } else {
+      // Same as the Lfo: free-running until the follower locks.
+      if (control & CONTROL_GATE_RISING) {
+        phase_ = 0;
+      }
+      phase_ += phase_increment_;
     }
-    phase_ += phase_increment_;
     // int32_t sample = (this->*compute_sample_fn_table_[shape_])();
     // output_buffer->Overwrite(sample);
     output_buffer->Overwrite( (this->*compute_sample_fn_table_[shape_])() );
@@ -34,7 +34,8 @@
 #define PEAKS_MODULATIONS_LFO_H_
 
 #include "stmlib/stmlib.h"
-#include "stmlib/algorithms/pattern_predictor.h"
+
+#include "common/clock_follower.h"
 
 #include "peaks/gate_processor.h"
 
@@ -125,7 +126,7 @@ class Lfo {
   
   inline void set_sync(bool sync) {
     if (!sync_ && sync) {
-      pattern_predictor_.Init();
+      clock_follower_.Reset();
     }
     sync_ = sync;
   }
@@ -148,13 +149,11 @@ class Lfo {
   int32_t level_;
 
   bool sync_;
-  uint32_t sync_counter_;
-  stmlib::PatternPredictor<32, 8> pattern_predictor_;
+  common::ClockFollower clock_follower_;
   
   uint32_t phase_;
   uint32_t phase_increment_;
   
-  uint32_t period_;
   uint32_t end_of_attack_;
   uint32_t attack_factor_;
   uint32_t decay_factor_;
@@ -446,7 +445,7 @@ class Plo {
 
   inline void set_sync(bool sync) {
     if (!sync_ && sync) {
-      pattern_predictor_.Init();
+      clock_follower_.Reset();
     }
     sync_ = sync;
   }
@@ -498,13 +497,11 @@ class Plo {
   uint32_t wsm_phase_increment_;
 
   bool sync_;
-  uint32_t sync_counter_;
-  stmlib::PatternPredictor<32, 8> pattern_predictor_;
+  common::ClockFollower clock_follower_;
   
   uint32_t phase_;
   uint32_t phase_increment_;
   
-  uint32_t period_;
   uint32_t end_of_attack_;
   uint32_t attack_factor_;
   uint32_t decay_factor_;
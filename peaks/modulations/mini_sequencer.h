@@ -78,6 +78,15 @@ class MiniSequencer {
     }
   }
   
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) {
+    uint8_t size = kBlockSize;
+    while (size--) {
+      output_buffer->Overwrite(ProcessSingleSample(
+          input_buffer->ImmediateRead()));
+    }
+  }
+  
+ private:
   inline int16_t ProcessSingleSample(uint8_t control) {
     if (control & CONTROL_GATE_RISING) {
       ++step_;
@@ -95,7 +104,6 @@ class MiniSequencer {
     return steps_[step_];
   }
   
- private:
   uint8_t num_steps_;
   uint8_t step_;
   int16_t steps_[kMaxNumSteps];
@@ -145,6 +153,15 @@ class ModSequencer {
     }
   }
   
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) {
+    uint8_t size = kBlockSize;
+    while (size--) {
+      output_buffer->Overwrite(ProcessSingleSample(
+          input_buffer->ImmediateRead()));
+    }
+  }
+  
+ private:
   inline int16_t ProcessSingleSample(uint8_t control) {
     if (control & CONTROL_GATE_RISING) {
       ++step_;
@@ -163,7 +180,6 @@ class ModSequencer {
     return steps_[step_];
   }
   
- private:
   uint8_t num_steps_;
   uint8_t step_;
   int16_t steps_[kMaxModSeqNumSteps];
@@ -41,251 +41,177 @@ namespace peaks {
 
 using namespace stmlib;
 
-void MultistageEnvelope::Init() {
-  set_adsr(0, 8192, 16384, 32767);
-  segment_ = num_segments_;
-  phase_ = 0;
-  phase_increment_ = 0;
-  start_value_ = 0;
-  value_ = 0;
-  hard_reset_ = false;
-}
-
-int16_t MultistageEnvelope::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    start_value_ = (segment_ == num_segments_ || hard_reset_)
-        ? level_[0]
-        : value_;
-    segment_ = 0;
-    phase_ = 0;
-  } else if (control & CONTROL_GATE_FALLING && sustain_point_) {
-    start_value_ = value_;
-    segment_ = sustain_point_;
-    phase_ = 0;
-  } else if (phase_ < phase_increment_) {
-    start_value_ = level_[segment_ + 1];
-    ++segment_;
-    phase_ = 0;
-    if (segment_ == loop_end_) {
-      segment_ = loop_start_;
-    }
+#define SEGMENT(time, level, shape) \
+  { time, ENV_LEVEL_ ## level, ENV_SHAPE_ ## shape }
+
+// For each type: layout in full control mode, then in half control mode.
+static const EnvelopeLayout envelope_layouts[ENVELOPE_TYPE_LAST][2] = {
+  // ADSR / AD.
+  {
+    { 3, 2, 0, 0, 0, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, SUSTAIN, EXPONENTIAL),
+      SEGMENT(3, ZERO, EXPONENTIAL) } },
+    { 2, 0, 0, 0, 0, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, ZERO, EXPONENTIAL) } }
+  },
+  // Dual attack: ADSAR / linear AD.
+  {
+    { 4, 2, 0, 0, 0, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, SUSTAIN, EXPONENTIAL),
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(3, ZERO, EXPONENTIAL) } },
+    { 2, 0, 0, 0, 0, {
+      SEGMENT(0, FULL, LINEAR),
+      SEGMENT(1, ZERO, LINEAR) } }
+  },
+  // Repeating attack: AD(R) looping while the gate is high.
+  {
+    { 3, 0, 0, 2, ENV_FLAG_LOOP_WHILE_GATE, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, SUSTAIN, QUARTIC),
+      SEGMENT(3, ZERO, EXPONENTIAL) } },
+    { 2, 0, 0, 2, ENV_FLAG_LOOP_WHILE_GATE, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, ZERO, QUARTIC) } }
+  },
+  // Looping: AD(R) looping forever.
+  {
+    { 3, 0, 0, 3, 0, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, SUSTAIN, QUARTIC),
+      SEGMENT(3, ZERO, QUARTIC) } },
+    { 2, 0, 0, 2, 0, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, ZERO, QUARTIC) } }
+  },
+  // Randomised AD.
+  {
+    { 2, 0, 0, 0, ENV_FLAG_RANDOMISED, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, ZERO, EXPONENTIAL) } },
+    { 2, 0, 0, 0, ENV_FLAG_RANDOMISED, {
+      SEGMENT(0, FULL, QUARTIC),
+      SEGMENT(1, ZERO, EXPONENTIAL) } }
   }
-  
-  bool done = segment_ == num_segments_;
-  bool sustained = sustain_point_ && segment_ == sustain_point_ &&
-      control & CONTROL_GATE;
+};
 
-  phase_increment_ =
-      sustained || done ? 0 : lut_env_increments[time_[segment_] >> 8];
+#undef SEGMENT
 
-  int32_t a = start_value_;
-  int32_t b = level_[segment_ + 1];
-  uint16_t t = Interpolate824(
-      lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]], phase_);
-  value_ = a + ((b - a) * (t >> 1) >> 15);
-  phase_ += phase_increment_;
-  return value_;
-}
-
-void DualAttackEnvelope::Init() {
-  set_adsar(0, 8192, 16384, 32767);
+void MultistageEnvelope::Init(EnvelopeType type) {
+  uint16_t parameter[4] = { 0, 8192, 32768, 32767 };
+  type_ = type;
+  segment_ = 0;
+  Configure(parameter, CONTROL_MODE_FULL);
   segment_ = num_segments_;
   phase_ = 0;
   phase_increment_ = 0;
   start_value_ = 0;
   value_ = 0;
   hard_reset_ = false;
+  level_randomness_ = 0;
+  decay_randomness_ = 0;
 }
 
-int16_t DualAttackEnvelope::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    start_value_ = (segment_ == num_segments_ || hard_reset_)
-        ? level_[0]
-        : value_;
-    segment_ = 0;
-    phase_ = 0;
-  } else if (control & CONTROL_GATE_FALLING && sustain_point_) {
-    start_value_ = value_;
-    segment_ = sustain_point_;
-    phase_ = 0;
-  } else if (phase_ < phase_increment_) {
-    start_value_ = level_[segment_ + 1];
-    ++segment_;
-    phase_ = 0;
-    if (segment_ == loop_end_) {
-      segment_ = loop_start_;
+void MultistageEnvelope::Configure(
+    uint16_t* parameter,
+    ControlMode control_mode) {
+  const EnvelopeLayout& layout = envelope_layouts[type_][control_mode];
+  num_segments_ = layout.num_segments;
+  sustain_point_ = layout.sustain_point;
+  loop_start_ = layout.loop_start;
+  loop_end_ = layout.loop_end;
+  flags_ = layout.flags;
+  
+  level_[0] = 0;
+  for (uint8_t i = 0; i < num_segments_; ++i) {
+    const EnvelopeSegment& segment = layout.segment[i];
+    time_[i] = parameter[segment.time];
+    shape_[i] = segment.shape;
+    if (segment.level == ENV_LEVEL_SUSTAIN) {
+      level_[i + 1] = parameter[2] >> 1;
+    } else {
+      level_[i + 1] = segment.level == ENV_LEVEL_FULL ? 32767 : 0;
     }
   }
   
-  bool done = segment_ == num_segments_;
-  bool sustained = sustain_point_ && segment_ == sustain_point_ &&
-      control & CONTROL_GATE;
-
-  phase_increment_ =
-      sustained || done ? 0 : lut_env_increments[time_[segment_] >> 8];
-
-  int32_t a = start_value_;
-  int32_t b = level_[segment_ + 1];
-  uint16_t t = Interpolate824(
-      lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]], phase_);
-  value_ = a + ((b - a) * (t >> 1) >> 15);
-  phase_ += phase_increment_;
-  return value_;
-}
-
-void LoopingEnvelope::Init() {
-  set_adr_loop(0, 8192, 16384, 32767);
-  segment_ = num_segments_;
-  phase_ = 0;
-  phase_increment_ = 0;
-  start_value_ = 0;
-  value_ = 0;
-  hard_reset_ = false;
-}
-
-int16_t RepeatingAttackEnvelope::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    start_value_ = (segment_ == num_segments_ || hard_reset_)
-        ? level_[0]
-        : value_;
-    segment_ = 0;
-    phase_ = 0;
-  } else if (control & CONTROL_GATE_FALLING && sustain_point_) {
-    start_value_ = value_;
-    segment_ = sustain_point_;
-    phase_ = 0;
-  } else if (phase_ < phase_increment_) {
-    start_value_ = level_[segment_ + 1];
-    ++segment_;
-    phase_ = 0;
-    if ((segment_ == loop_end_) && (control & CONTROL_GATE)) {
-      segment_ = loop_start_;
+  if (flags_ & ENV_FLAG_RANDOMISED) {
+    base_level_ = level_[1];
+    base_time_ = time_[1];
+    // In half mode, the amount of randomness set in full mode is kept.
+    if (control_mode == CONTROL_MODE_FULL) {
+      level_randomness_ = parameter[2];
+      decay_randomness_ = parameter[3];
     }
   }
   
-  bool done = segment_ == num_segments_;
-  bool sustained = sustain_point_ && segment_ == sustain_point_ &&
-      control & CONTROL_GATE;
-
-  phase_increment_ =
-      sustained || done ? 0 : lut_env_increments[time_[segment_] >> 8];
-
-  int32_t a = start_value_;
-  int32_t b = level_[segment_ + 1];
-  uint16_t t = Interpolate824(
-      lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]], phase_);
-  value_ = a + ((b - a) * (t >> 1) >> 15);
-  phase_ += phase_increment_;
-  return value_;
-}
-
-void RepeatingAttackEnvelope::Init() {
-  set_adr_loop(0, 8192, 16384, 32767);
-  segment_ = num_segments_;
-  phase_ = 0;
-  phase_increment_ = 0;
-  start_value_ = 0;
-  value_ = 0;
-  hard_reset_ = false;
-}
-
-int16_t LoopingEnvelope::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    start_value_ = (segment_ == num_segments_ || hard_reset_)
-        ? level_[0]
-        : value_;
+  if (segment_ > num_segments_) {
     segment_ = 0;
     phase_ = 0;
-  } else if (control & CONTROL_GATE_FALLING && sustain_point_) {
-    start_value_ = value_;
-    segment_ = sustain_point_;
-    phase_ = 0;
-  } else if (phase_ < phase_increment_) {
-    start_value_ = level_[segment_ + 1];
-    ++segment_;
-    phase_ = 0;
-    if (segment_ == loop_end_) {
-      segment_ = loop_start_;
-    }
+    value_ = 0;
   }
-  
-  bool done = segment_ == num_segments_;
-  bool sustained = sustain_point_ && segment_ == sustain_point_ &&
-      control & CONTROL_GATE;
-
-  phase_increment_ =
-      sustained || done ? 0 : lut_env_increments[time_[segment_] >> 8];
-
-  int32_t a = start_value_;
-  int32_t b = level_[segment_ + 1];
-  uint16_t t = Interpolate824(
-      lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]], phase_);
-  value_ = a + ((b - a) * (t >> 1) >> 15);
-  phase_ += phase_increment_;
-  return value_;
 }
 
-void RandomisedEnvelope::Init() {
-  set_rad(0, 8192, 0, 0);
-  segment_ = num_segments_;
-  phase_ = 0;
-  phase_increment_ = 0;
-  start_value_ = 0;
-  value_ = 0;
-  hard_reset_ = false;
+void MultistageEnvelope::Randomise() {
+  uint32_t random = stmlib::Random::GetWord() >> 16;
+  int32_t level = base_level_ - \
+      static_cast<int32_t>((random * level_randomness_) >> 17);
+  int32_t time = base_time_ - \
+      static_cast<int32_t>((random * decay_randomness_) >> 17);
+  level_[1] = level < 0 ? 0 : level;
+  time_[1] = time < 0 ? 0 : time;
 }
 
-int16_t RandomisedEnvelope::ProcessSingleSample(uint8_t control) {
-  if (control & CONTROL_GATE_RISING) {
-    start_value_ = (segment_ == num_segments_ || hard_reset_)
-        ? level_[0]
-        : value_;
-    segment_ = 0;
-    phase_ = 0;
-    // Randomise values here.
-    uint32_t random_offset = stmlib::Random::GetWord();
-    int32_t level_random_offset = ((random_offset >> 16) * level_randomness_) >> 17;
-    int32_t decay_random_offset = ((random_offset >> 16) * decay_randomness_) >> 17;
-    int32_t randomised_level = base_level_[1] - level_random_offset;
-    int32_t randomised_decay_time = base_time_[1] - decay_random_offset;
-    // constrain
-    if (randomised_level < 0) { 
-      randomised_level = 0; 
-    } 
-    if (randomised_decay_time < 0) { 
-      randomised_decay_time = 0; 
-    } 
-    // reset the level and time values
-    level_[1] =  randomised_level ;  
-    time_[1] =  randomised_decay_time ;  
-  } else if (control & CONTROL_GATE_FALLING && sustain_point_) {
-    start_value_ = value_;
-    segment_ = sustain_point_;
-    phase_ = 0;
-  } else if (phase_ < phase_increment_) {
-    start_value_ = level_[segment_ + 1];
-    ++segment_;
-    phase_ = 0;
-    if (segment_ == loop_end_) {
-      segment_ = loop_start_;
+void MultistageEnvelope::FillBuffer(
+    InputBuffer* input_buffer,
+    OutputBuffer* output_buffer) {
+  uint8_t size = kBlockSize;
+  while (size--) {
+    uint8_t control = input_buffer->ImmediateRead();
+    if (control & CONTROL_GATE_RISING) {
+      start_value_ = (segment_ == num_segments_ || hard_reset_)
+          ? level_[0]
+          : value_;
+      segment_ = 0;
+      phase_ = 0;
+      if (flags_ & ENV_FLAG_RANDOMISED) {
+        Randomise();
+      }
+    } else if (control & CONTROL_GATE_FALLING && sustain_point_) {
+      start_value_ = value_;
+      segment_ = sustain_point_;
+      phase_ = 0;
+    } else if (phase_ < phase_increment_) {
+      start_value_ = level_[segment_ + 1];
+      ++segment_;
+      phase_ = 0;
+      if (segment_ == loop_end_ && (!(flags_ & ENV_FLAG_LOOP_WHILE_GATE) ||
+                                    control & CONTROL_GATE)) {
+        segment_ = loop_start_;
+      }
     }
-  }
-  
-  bool done = segment_ == num_segments_;
-  bool sustained = sustain_point_ && segment_ == sustain_point_ &&
-      control & CONTROL_GATE;
 
-  phase_increment_ =
-      sustained || done ? 0 : lut_env_increments[time_[segment_] >> 8];
-
-  int32_t a = start_value_;
-  int32_t b = level_[segment_ + 1];
-  uint16_t t = Interpolate824(
-      lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]], phase_);
-  value_ = a + ((b - a) * (t >> 1) >> 15);
-  phase_ += phase_increment_;
-  return value_;
+    if (segment_ == num_segments_) {
+      // Done: all curves start at 0, so the output stays at the start value.
+      phase_increment_ = 0;
+      value_ = start_value_;
+    } else {
+      bool sustained = sustain_point_ && segment_ == sustain_point_ &&
+          control & CONTROL_GATE;
+      phase_increment_ = sustained
+          ? 0
+          : lut_env_increments[time_[segment_] >> 8];
+      int32_t a = start_value_;
+      int32_t b = level_[segment_ + 1];
+      uint16_t t = Interpolate824(
+          lookup_table_table[LUT_ENV_LINEAR + shape_[segment_]], phase_);
+      value_ = a + ((b - a) * (t >> 1) >> 15);
+      phase_ += phase_increment_;
+    }
+    output_buffer->Overwrite(value_);
+  }
 }
 
-
 }  // namespace peaks
@@ -46,539 +46,70 @@ enum EnvelopeShape {
   ENV_SHAPE_QUARTIC
 };
 
-const uint16_t kMaxNumSegments = 8;
-
-class MultistageEnvelope {
- public:
-  MultistageEnvelope() { }
-  ~MultistageEnvelope() { }
-  
-  void Init();
-  int16_t ProcessSingleSample(uint8_t control);
-  
-  void Configure(uint16_t* parameter, ControlMode control_mode) {
-    if (control_mode == CONTROL_MODE_HALF) {
-      set_ad(parameter[0], parameter[1]);
-    } else {
-      set_adsr(parameter[0], parameter[1], parameter[2] >> 1, parameter[3]);
-    }
-    if (segment_ > num_segments_) {
-      segment_ = 0;
-      phase_ = 0;
-      value_ = 0;
-    }
-  }
-  
-  inline void set_time(uint16_t segment, uint16_t time) {
-    time_[segment] = time;
-  }
-  
-  inline void set_level(uint16_t segment, int16_t level) {
-    level_[segment] = level;
-  }
-  
-  inline void set_num_segments(uint16_t num_segments) {
-    num_segments_ = num_segments;
-  }
-  
-  inline void set_sustain_point(uint16_t sustain_point) {
-    sustain_point_ = sustain_point;
-  }
-  
-  inline void set_adsr(
-      uint16_t attack,
-      uint16_t decay,
-      uint16_t sustain,
-      uint16_t release) {
-    num_segments_ = 3;
-    sustain_point_ = 2;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = sustain;
-    level_[3] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    time_[2] = release;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_EXPONENTIAL;
-    shape_[2] = ENV_SHAPE_EXPONENTIAL;
-    
-    loop_start_ = loop_end_ = 0;
-  }
-  
-  inline void set_ad(uint16_t attack, uint16_t decay) {
-    num_segments_ = 2;
-    sustain_point_ = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_EXPONENTIAL;
-    
-    loop_start_ = loop_end_ = 0;
-  }
-    
-  inline void set_hard_reset(bool hard_reset) {
-    hard_reset_ = hard_reset;
-  }
-  
- private:
-  int16_t level_[kMaxNumSegments];
-  uint16_t time_[kMaxNumSegments];
-  EnvelopeShape shape_[kMaxNumSegments];
-  
-  int16_t segment_;
-  int16_t start_value_;
-  int16_t value_;
-
-  uint32_t phase_;
-  uint32_t phase_increment_;
-  
-  uint16_t num_segments_;
-  uint16_t sustain_point_;
-  uint16_t loop_start_;
-  uint16_t loop_end_;
-  
-  bool hard_reset_;
-  
-  DISALLOW_COPY_AND_ASSIGN(MultistageEnvelope);
+enum EnvelopeType {
+  ENVELOPE_TYPE_ADSR,
+  ENVELOPE_TYPE_DUAL_ATTACK,
+  ENVELOPE_TYPE_REPEATING_ATTACK,
+  ENVELOPE_TYPE_LOOPING,
+  ENVELOPE_TYPE_RANDOMISED,
+  ENVELOPE_TYPE_LAST
 };
 
-// Just copy the class and adjust it rather than trying to subclass it...
-class DualAttackEnvelope {
- public:
-  DualAttackEnvelope() { }
-  ~DualAttackEnvelope() { }
-  
-  void Init();
-  int16_t ProcessSingleSample(uint8_t control);
-  
-  void Configure(uint16_t* parameter, ControlMode control_mode) {
-    if (control_mode == CONTROL_MODE_HALF) {
-      set_ad(parameter[0], parameter[1]);
-    } else {
-      set_adsar(parameter[0], parameter[1], parameter[2] >> 1, parameter[3]);
-    }
-    if (segment_ > num_segments_) {
-      segment_ = 0;
-      phase_ = 0;
-      value_ = 0;
-    }
-  }
-  
-  inline void set_time(uint16_t segment, uint16_t time) {
-    time_[segment] = time;
-  }
-  
-  inline void set_level(uint16_t segment, int16_t level) {
-    level_[segment] = level;
-  }
-  
-  inline void set_num_segments(uint16_t num_segments) {
-    num_segments_ = num_segments;
-  }
-  
-  inline void set_sustain_point(uint16_t sustain_point) {
-    sustain_point_ = sustain_point;
-  }
-    
-  inline void set_ad(uint16_t attack, uint16_t decay) {
-    num_segments_ = 2;
-    sustain_point_ = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    
-    shape_[0] = ENV_SHAPE_LINEAR;
-    shape_[1] = ENV_SHAPE_LINEAR;
-    
-    loop_start_ = loop_end_ = 0;
-  }
-  
-  inline void set_adsar(
-      uint16_t attack,
-      uint16_t decay,
-      uint16_t sustain,
-      uint16_t release) {
-    num_segments_ = 4;
-    sustain_point_ = 2;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = sustain;
-    level_[3] = 32767;
-    level_[4] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    time_[2] = attack;
-    time_[3] = release;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_EXPONENTIAL;
-    shape_[2] = ENV_SHAPE_QUARTIC;
-    shape_[3] = ENV_SHAPE_EXPONENTIAL;
-    
-    loop_start_ = loop_end_ = 0;
-  }
-    
-  inline void set_hard_reset(bool hard_reset) {
-    hard_reset_ = hard_reset;
-  }
-  
- private:
-  int16_t level_[kMaxNumSegments];
-  uint16_t time_[kMaxNumSegments];
-  EnvelopeShape shape_[kMaxNumSegments];
-  
-  int16_t segment_;
-  int16_t start_value_;
-  int16_t value_;
-
-  uint32_t phase_;
-  uint32_t phase_increment_;
-  
-  uint16_t num_segments_;
-  uint16_t sustain_point_;
-  uint16_t loop_start_;
-  uint16_t loop_end_;
-  
-  bool hard_reset_;
-  
-  DISALLOW_COPY_AND_ASSIGN(DualAttackEnvelope);
+// Level reached at the end of a segment.
+enum EnvelopeLevel {
+  ENV_LEVEL_ZERO,
+  ENV_LEVEL_FULL,
+  ENV_LEVEL_SUSTAIN  // Third parameter.
 };
 
-// And copy the class again...
-class RepeatingAttackEnvelope {
- public:
-  RepeatingAttackEnvelope() { }
-  ~RepeatingAttackEnvelope() { }
-  
-  void Init();
-  int16_t ProcessSingleSample(uint8_t control);
-  
-  void Configure(uint16_t* parameter, ControlMode control_mode) {
-    if (control_mode == CONTROL_MODE_HALF) {
-      set_ad_loop(parameter[0], parameter[1]);
-    } else {
-      set_adr_loop(parameter[0], parameter[1], parameter[2] >> 1, parameter[3]);
-    }
-    if (segment_ > num_segments_) {
-      segment_ = 0;
-      phase_ = 0;
-      value_ = 0;
-    }
-  }
-  
-  inline void set_time(uint16_t segment, uint16_t time) {
-    time_[segment] = time;
-  }
-  
-  inline void set_level(uint16_t segment, int16_t level) {
-    level_[segment] = level;
-  }
-  
-  inline void set_num_segments(uint16_t num_segments) {
-    num_segments_ = num_segments;
-  }
-  
-  inline void set_sustain_point(uint16_t sustain_point) {
-    sustain_point_ = sustain_point;
-  }
-    
-  inline void set_ad_loop(uint16_t attack, uint16_t decay) {
-    num_segments_ = 2;
-    sustain_point_ = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_QUARTIC;
-    
-    loop_start_ = 0;
-    loop_end_ = 2;
-  }
-  
-  inline void set_adr_loop(
-      uint16_t attack,
-      uint16_t decay,
-      uint16_t sustain,
-      uint16_t release) {
-    num_segments_ = 3;
-    sustain_point_ = 0;
+enum EnvelopeFlags {
+  // The loop is only taken while the gate is high.
+  ENV_FLAG_LOOP_WHILE_GATE = 1,
+  // The level and duration of the second segment are randomised at each
+  // trigger, by amounts set by the third and fourth parameters.
+  ENV_FLAG_RANDOMISED = 2
+};
 
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = sustain;
-    level_[3] = 0;
+const uint8_t kMaxNumSegments = 4;
 
-    time_[0] = attack;
-    time_[1] = decay;
-    time_[2] = release;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_QUARTIC;
-    shape_[2] = ENV_SHAPE_EXPONENTIAL;
-    
-    loop_start_ = 0;
-    loop_end_ = 2; // was 3
-  }
-  
-  inline void set_hard_reset(bool hard_reset) {
-    hard_reset_ = hard_reset;
-  }
-  
- private:
-  int16_t level_[kMaxNumSegments];
-  uint16_t time_[kMaxNumSegments];
-  EnvelopeShape shape_[kMaxNumSegments];
-  
-  int16_t segment_;
-  int16_t start_value_;
-  int16_t value_;
-
-  uint32_t phase_;
-  uint32_t phase_increment_;
-  
-  uint16_t num_segments_;
-  uint16_t sustain_point_;
-  uint16_t loop_start_;
-  uint16_t loop_end_;
-  
-  bool hard_reset_;
-  
-  DISALLOW_COPY_AND_ASSIGN(RepeatingAttackEnvelope);
+struct EnvelopeSegment {
+  uint8_t time;  // Index of the parameter controlling the duration.
+  uint8_t level;
+  uint8_t shape;
 };
 
+struct EnvelopeLayout {
+  uint8_t num_segments;
+  uint8_t sustain_point;  // 0 for no sustain.
+  uint8_t loop_start;
+  uint8_t loop_end;  // Equal to loop_start for no loop.
+  uint8_t flags;
+  EnvelopeSegment segment[kMaxNumSegments];
+};
 
-// And copy the class again...
-class LoopingEnvelope {
+// A single segment-based engine renders all the envelope types. Each type is
+// a pair of layouts (full and half control mode) in a table.
+class MultistageEnvelope {
  public:
-  LoopingEnvelope() { }
-  ~LoopingEnvelope() { }
-  
-  void Init();
-  int16_t ProcessSingleSample(uint8_t control);
-  
-  void Configure(uint16_t* parameter, ControlMode control_mode) {
-    if (control_mode == CONTROL_MODE_HALF) {
-      set_ad_loop(parameter[0], parameter[1]);
-    } else {
-      set_adr_loop(parameter[0], parameter[1], parameter[2] >> 1, parameter[3]);
-    }
-    if (segment_ > num_segments_) {
-      segment_ = 0;
-      phase_ = 0;
-      value_ = 0;
-    }
-  }
-  
-  inline void set_time(uint16_t segment, uint16_t time) {
-    time_[segment] = time;
-  }
-  
-  inline void set_level(uint16_t segment, int16_t level) {
-    level_[segment] = level;
-  }
-  
-  inline void set_num_segments(uint16_t num_segments) {
-    num_segments_ = num_segments;
-  }
-  
-  inline void set_sustain_point(uint16_t sustain_point) {
-    sustain_point_ = sustain_point;
-  }
-    
-  inline void set_ad_loop(uint16_t attack, uint16_t decay) {
-    num_segments_ = 2;
-    sustain_point_ = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_QUARTIC;
-    
-    loop_start_ = 0;
-    loop_end_ = 2;
-  }
+  MultistageEnvelope() { }
+  ~MultistageEnvelope() { }
   
-  inline void set_adr_loop(
-      uint16_t attack,
-      uint16_t decay,
-      uint16_t sustain,
-      uint16_t release) {
-    num_segments_ = 3;
-    sustain_point_ = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = sustain;
-    level_[3] = 0;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    time_[2] = release;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_QUARTIC;
-    shape_[2] = ENV_SHAPE_QUARTIC;
-    
-    loop_start_ = 0;
-    loop_end_ = 3;
-  }
+  void Init(EnvelopeType type);
+  void Configure(uint16_t* parameter, ControlMode control_mode);
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer);
   
   inline void set_hard_reset(bool hard_reset) {
     hard_reset_ = hard_reset;
   }
   
  private:
-  int16_t level_[kMaxNumSegments];
-  uint16_t time_[kMaxNumSegments];
-  EnvelopeShape shape_[kMaxNumSegments];
-  
-  int16_t segment_;
-  int16_t start_value_;
-  int16_t value_;
-
-  uint32_t phase_;
-  uint32_t phase_increment_;
-  
-  uint16_t num_segments_;
-  uint16_t sustain_point_;
-  uint16_t loop_start_;
-  uint16_t loop_end_;
-  
-  bool hard_reset_;
-  
-  DISALLOW_COPY_AND_ASSIGN(LoopingEnvelope);
-};
-
-// randomised AD envelope class
-class RandomisedEnvelope {
- public:
-  RandomisedEnvelope() { }
-  ~RandomisedEnvelope() { }
-  
-  void Init();
-  int16_t ProcessSingleSample(uint8_t control);
-  
-  void Configure(uint16_t* parameter, ControlMode control_mode) {
-    if (control_mode == CONTROL_MODE_HALF) {
-      set_rad_half(parameter[0], parameter[1]);
-    } else {
-      set_rad(parameter[0], parameter[1], parameter[2], parameter[3]);
-    }
-    if (segment_ > num_segments_) {
-      segment_ = 0;
-      phase_ = 0;
-      value_ = 0;
-    }
-  }
-  
-  inline void set_time(uint16_t segment, uint16_t time) {
-    time_[segment] = time;
-  }
-  
-  inline void set_level(uint16_t segment, int16_t level) {
-    level_[segment] = level;
-  }
+  void Randomise();
   
-  inline void set_num_segments(uint16_t num_segments) {
-    num_segments_ = num_segments;
-  }
-  
-  inline void set_sustain_point(uint16_t sustain_point) {
-    sustain_point_ = sustain_point;
-  }
-  
-  inline void set_rad(uint16_t attack,
-                      uint16_t decay,
-                      uint16_t level_randomness,
-                      uint16_t decay_randomness) {
-    num_segments_ = 2;
-    sustain_point_ = 0;
-    
-    level_randomness_ = level_randomness;
-    decay_randomness_ = decay_randomness;
-
-    base_level_[0] = 0;
-    base_level_[1] = 32767;
-    base_level_[2] = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = 0;
-
-    base_time_[0] = attack;
-    base_time_[1] = decay;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_EXPONENTIAL;
-    
-    loop_start_ = loop_end_ = 0;
-  }
-
-  inline void set_rad_half(uint16_t attack, uint16_t decay) {
-    num_segments_ = 2;
-    sustain_point_ = 0;
-
-    base_level_[0] = 0;
-    base_level_[1] = 32767;
-    base_level_[2] = 0;
-
-    level_[0] = 0;
-    level_[1] = 32767;
-    level_[2] = 0;
-
-    base_time_[0] = attack;
-    base_time_[1] = decay;
-
-    time_[0] = attack;
-    time_[1] = decay;
-    
-    shape_[0] = ENV_SHAPE_QUARTIC;
-    shape_[1] = ENV_SHAPE_EXPONENTIAL;
-    
-    loop_start_ = 0;
-    loop_end_ = 0;
-  }
-    
-  inline void set_hard_reset(bool hard_reset) {
-    hard_reset_ = hard_reset;
-  }
+  EnvelopeType type_;
   
- private:
-  int16_t level_[kMaxNumSegments];
-  int16_t base_level_[kMaxNumSegments];
-
-  uint16_t base_time_[kMaxNumSegments];
+  int16_t level_[kMaxNumSegments + 1];
   uint16_t time_[kMaxNumSegments];
-  EnvelopeShape shape_[kMaxNumSegments];
+  uint8_t shape_[kMaxNumSegments];
   
   int16_t segment_;
   int16_t start_value_;
@@ -587,20 +118,23 @@ class RandomisedEnvelope {
   uint32_t phase_;
   uint32_t phase_increment_;
   
-  uint16_t num_segments_;
-  uint16_t sustain_point_;
-  uint16_t loop_start_;
-  uint16_t loop_end_;
+  uint8_t num_segments_;
+  uint8_t sustain_point_;
+  uint8_t loop_start_;
+  uint8_t loop_end_;
+  uint8_t flags_;
   
   bool hard_reset_;
   
-  uint16_t level_randomness_ ;
-  uint16_t decay_randomness_ ;
+  // Randomised envelope: values of the second segment before randomisation.
+  int16_t base_level_;
+  uint16_t base_time_;
+  uint16_t level_randomness_;
+  uint16_t decay_randomness_;
   
-  DISALLOW_COPY_AND_ASSIGN(RandomisedEnvelope);
+  DISALLOW_COPY_AND_ASSIGN(MultistageEnvelope);
 };
 
-
 }  // namespace peaks
 
 #endif  // PEAKS_MODULATIONS_MULTISTAGE_ENVELOPE_H_
@@ -107,6 +107,15 @@ class TuringMachine {
     }
   }
   
+  void FillBuffer(InputBuffer* input_buffer, OutputBuffer* output_buffer) {
+    uint8_t size = kBlockSize;
+    while (size--) {
+      output_buffer->Overwrite(ProcessSingleSample(
+          input_buffer->ImmediateRead()));
+    }
+  }
+  
+ private:
   inline int16_t ProcessSingleSample(uint8_t control) {
     if (control & CONTROL_GATE_RISING) {
       ++turing_div_counter_;
@@ -175,7 +184,6 @@ class TuringMachine {
     return turing_value_;
   }
   
- private:
   uint16_t turing_length_;
   uint16_t turing_prob_;
   uint16_t turing_divider_;
@@ -31,15 +31,137 @@
 #include "stmlib/utils/dsp.h"
 #include "stmlib/utils/random.h"
 
-#include "peaks/resources.h"
-
 namespace peaks {
 
-const uint8_t kDownsample = 4;
-const uint8_t kMaxEquationIndex = 1;
-
 using namespace stmlib;
 
+// The original code rendered kBlockSize / 4 samples per call, and equation 6
+// reset its feedback at each call.
+const uint8_t kSmokerBlockSize = kBlockSize / 4;
+
+// Divisions, modulos and shifts by a variable amount follow the Cortex-M3
+// rules - a division by zero yields 0, a shift only uses the bottom byte of
+// its amount and yields 0 from 32 on - so that the host builds compute the
+// same samples as the module.
+static inline uint32_t Div(uint32_t a, uint32_t b) {
+  return b ? a / b : 0;
+}
+
+static inline uint32_t Mod(uint32_t a, uint32_t b) {
+  return b ? a % b : a;
+}
+
+static inline uint32_t Shl(uint32_t a, uint32_t b) {
+  b &= 0xff;
+  return b >= 32 ? 0 : a << b;
+}
+
+static inline uint32_t Shr(uint32_t a, uint32_t b) {
+  b &= 0xff;
+  return b >= 32 ? 0 : a >> b;
+}
+
+// p0 and p1 are the raw 16-bit parameters.
+struct Equation0 {
+  // From http://royal-paw.com/2012/01/bytebeats-in-c-and-python-generative-symphonies-from-extremely-small-programs/
+  // (atmospheric, hopeful)
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 9;
+    p1 >>= 9;
+    return ((((t * 3) & (t >> 10)) | ((t * p0) & (t >> 10)) | \
+        ((t * 10) & ((t >> 8) * p1) & 128)) & 0xff) << 8;
+  }
+};
+
+struct Equation1 {
+  // Equation by stephth via https://www.youtube.com/watch?v=tCRPUv8V22o at
+  // 3:38
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 11;
+    p1 >>= 11;
+    return ((((t * p0) & (t >> 4)) | ((t * 5) & (t >> 7)) | \
+        ((t * p1) & (t >> 10))) & 0xff) << 8;
+  }
+};
+
+struct Equation2 {
+  // From http://www.reddit.com/r/bytebeat/comments/20km9l/cool_equations/
+  // (t>>13&t)*(t>>8)
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 12;
+    p1 >>= 12;
+    return ((((t >> p0) & t) * (t >> p1)) & 0xff) << 8;
+  }
+};
+
+struct Equation3 {
+  // The second one listed at http://xifeng.weebly.com/bytebeats.html
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 11;
+    p1 >>= 9;
+    return (((((((t >> p0) | t) | (t >> p0)) * 10) & ((5 * t) | (t >> 10))) | \
+        (t ^ Mod(t, p1))) & 0xff) << 8;
+  }
+};
+
+struct Equation4 {
+  // BitWiz Transplant from Equation Composer Ptah bank.
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 12;
+    p1 >>= 12;
+    return t * Mod(((t >> p1) ^ ((t >> p1) - 1) ^ 1), p0);
+  }
+};
+
+struct Equation5 {
+  // Arpeggiation from Equation Composer Khepri bank.
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 11;
+    p1 >>= 9;
+    uint32_t p = ((t / (1236 + p0)) % 128) & ((t >> (p1 >> 5)) * p1);
+    uint32_t q = Mod(t / (Div(t, (500 * p1) % 5) + 1), p);
+    return Shr(Shr(t, q), p1 >> 5) + Shr(Div(t, t >> ((p1 >> 5) & 12)), p);
+  }
+};
+
+struct Equation6 {
+  // The Smoker from Equation Composer Khepri bank. FillBuffer() XORs each
+  // sample with the previous one.
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 9;
+    p1 >>= 10;
+    return Shr(t >> (p1 >> 4), (t / 6988 * t % (p0 + 1)) + \
+        Shl(t, Div(t, p1 * 4)));
+  }
+};
+
+struct Equation7 {
+  // Warping overtone echo drone, from BitWiz. The modulus is computed from
+  // the value of t at the beginning of the sample period.
+  static inline uint32_t Compute(uint32_t t, uint32_t p0, uint32_t p1) {
+    p0 >>= 9;
+    p1 = Mod(t - 1, p1);
+    return ((t & p0) - Mod(t, p1)) ^ (t >> 7);
+  }
+};
+
+// Equations 4 and 7 run at twice the normal sample rate.
+static const uint8_t equation_rate[kNumByteBeatsEquations] = {
+  1, 1, 1, 1, 2, 1, 1, 2
+};
+
+template<typename Equation>
+static inline void RenderEquation(
+    const uint32_t* t,
+    uint32_t* out,
+    size_t size,
+    uint32_t p0,
+    uint32_t p1) {
+  while (size--) {
+    *out++ = Equation::Compute(*t++, p0, p1);
+  }
+}
+
 void ByteBeats::Init() {
   frequency_ = 32678;
   phase_ = 0;
@@ -49,113 +171,66 @@ void ByteBeats::Init() {
   equation_index_ = 0;
 }
 
+/* static */
+void ByteBeats::Render(
+    uint8_t equation,
+    const uint32_t* t,
+    uint32_t* out,
+    size_t size,
+    uint32_t p0,
+    uint32_t p1) {
+  switch (equation) {
+    case 0: RenderEquation<Equation0>(t, out, size, p0, p1); break;
+    case 1: RenderEquation<Equation1>(t, out, size, p0, p1); break;
+    case 2: RenderEquation<Equation2>(t, out, size, p0, p1); break;
+    case 3: RenderEquation<Equation3>(t, out, size, p0, p1); break;
+    case 4: RenderEquation<Equation4>(t, out, size, p0, p1); break;
+    case 5: RenderEquation<Equation5>(t, out, size, p0, p1); break;
+    case 6: RenderEquation<Equation6>(t, out, size, p0, p1); break;
+    default: RenderEquation<Equation7>(t, out, size, p0, p1); break;
+  }
+}
+
 void ByteBeats::FillBuffer(
     InputBuffer* input_buffer,
     OutputBuffer* output_buffer) {
-  uint32_t p0 = 0;
-  uint32_t p1 = 0;
-  // uint32_t p2 = 0;
-  int32_t sample = 0;
-  // temporary vars
-  uint32_t p ;
-  uint32_t q ;
-  uint8_t j ;
-  
-  uint16_t bytepitch = (65535 - frequency_) >> 11 ; // was 12
+  equation_index_ = p2_ >> 13;
+  uint8_t rate = equation_rate[equation_index_];
+
+  uint16_t bytepitch = (65535 - frequency_) >> 11;
   if (bytepitch < 1) {
     bytepitch = 1;
   }
-  equation_index_ = p2_ >> 13 ;
-  uint8_t size = kBlockSize / kDownsample;
-  while (size--) {
-    for (uint8_t i = 0; i < kDownsample; ++i) {
-      uint8_t control = input_buffer->ImmediateRead();
-      if (control & CONTROL_GATE_RISING) {
-        // (void)0; // noop
-        phase_ = 0;
-        t_ = 0 ;
-        // ++equation_index_;
-        // if (equation_index_ > kMaxEquationIndex) {
-        //   equation_index_ = 0 ;
-        // }
-      }
-      if (control & CONTROL_GATE) {
-        (void)0; // noop
-      }
+  uint32_t t[kBlockSize];
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    uint8_t control = input_buffer->ImmediateRead();
+    if (control & CONTROL_GATE_RISING) {
+      phase_ = 0;
+      t_ = 0;
     }
-
     ++phase_;
-    if (phase_ % bytepitch == 0) ++t_; 
-    switch (equation_index_) {
-      case 0:
-        // from http://royal-paw.com/2012/01/bytebeats-in-c-and-python-generative-symphonies-from-extremely-small-programs/
-        // (atmospheric, hopeful)
-        p0 = p0_ >> 9; // was 9
-        p1 = p1_ >> 9; // was 11
-        sample = ( ( ((t_*3) & (t_>>10)) | ((t_*p0) & (t_>>10)) | ((t_*10) & ((t_>>8)*p1) & 128) ) & 0xFF) << 8;
-        break;
-      case 1:
-        p0 = p0_ >> 11;
-        p1 = p1_ >> 11;
-        // p2 = p2_ >> 11;
-        // equation by stephth via https://www.youtube.com/watch?v=tCRPUv8V22o at 3:38
-        sample = ((((t_*p0) & (t_>>4)) | ((t_*5) & (t_>>7)) | ((t_*p1) & (t_>>10))) & 0xFF) << 8;
-        // sample = ((((t_*p0) & (t_>>4)) | ((t_*p2) & (t_>>7)) | ((t_*p1) & (t_>>10))) & 0xFF) << 8;
-        break;
-      case 2: 
-        p0 = p0_ >> 12;
-        p1 = p1_ >> 12;
-        // This one is from http://www.reddit.com/r/bytebeat/comments/20km9l/cool_equations/ (t>>13&t)*(t>>8)
-        sample = ( (((t_ >> p0) & t_) * (t_ >> p1)) & 0xFF) << 8 ;
-        break;
-      case 3: 
-        p0 = p0_ >> 11;
-        p1 = p1_ >> 9;
-        // This one is the second one listed at from http://xifeng.weebly.com/bytebeats.html
-        sample = ((( (((((t_ >> p0) | t_) | (t_ >> p0)) * 10) & ((5 * t_) | (t_ >> 10)) ) | (t_ ^ (t_ % p1)) ) & 0xFF)) << 8 ;
-        break;
-      case 4: 
-        p0 = p0_ >> 12; // was 9
-        p1 = p1_ >> 12; // was 11
-        //  BitWiz Transplant from Equation Composer Ptah bank        
-        // run at twice normal sample rate
-        for (j = 0; j < 2; ++j) {
-          sample = t_*(((t_>>p1)^((t_>>p1)-1)^1)%p0) ; 
-          if (j == 0) ++t_ ; 
-        }
-        break;
-      case 5:
-        p0 = p0_ >> 11;
-        p1 = p1_ >> 9;
-        // Arpeggiation from Equation Composer Khepri bank
-        // run at twice normal sample rate
-        // for (uint8_t j = 0; j < 2; ++j) {
-          p = ((t_/(1236+p0)) % 128) & ((t_>>(p1>>5))*p1);
-          q = (t_/(t_/((500*p1) % 5) + 1)) % p;
-          sample = (t_>>q>>(p1>>5)) + (t_/(t_>>((p1>>5)&12))>>p);
-        //  if (j == 0) ++t_ ; 
-        // }
-        break;
-      case 6:
-        p0 = p0_ >> 9;
-        p1 = p1_ >> 10; // was 9
-        // The Smoker from Equation Composer Khepri bank
-        sample = sample ^ (t_>>(p1>>4)) >> ((t_/6988*t_%(p0+1))+(t_<<t_/(p1 * 4)));
-        break;
-      default:
-        p0 = p0_ >> 9;
-        p1 = t_ % p1_ ;
-        // // run at twice normal sample rate
-        for (j = 0; j < 2; ++j) {
-          // Warping overtone echo drone, from BitWiz
-          sample = ((t_&p0)-(t_%p1))^(t_>>7);  
-          // sample = t_*(((t_>>p1)^((t_>>p1)-1)^1)%p0) ; 
-          if (j == 0) ++t_ ; 
-        }
-        break;      
+    if (phase_ % bytepitch == 0) {
+      ++t_;
+    }
+    t_ += rate - 1;
+    t[i] = t_;
+  }
+
+  uint32_t sample[kBlockSize];
+  Render(equation_index_, t, sample, kBlockSize, p0_, p1_);
+  int32_t previous = 0;
+  for (uint8_t i = 0; i < kBlockSize; ++i) {
+    int32_t s = static_cast<int32_t>(sample[i]);
+    if (equation_index_ == 6) {
+      // The Smoker feeds back the previous sample.
+      if (i % kSmokerBlockSize == 0) {
+        previous = 0;
+      }
+      s ^= previous;
     }
-    CLIP(sample)
-    output_buffer->Overwrite(sample);
+    CLIP(s)
+    previous = s;
+    output_buffer->Overwrite(s);
   }
 }
 
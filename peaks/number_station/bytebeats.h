@@ -36,6 +36,8 @@
 
 namespace peaks {
 
+const uint8_t kNumByteBeatsEquations = 8;
+
 class ByteBeats {
  public:
   ByteBeats() { }
@@ -71,17 +73,25 @@ class ByteBeats {
   inline void set_p2(uint16_t parameter) {
     p2_ = parameter;
   }
+
+  // Computes the raw output of an equation for a block of successive values
+  // of t - before the feedback of equation 6 and the clipping.
+  static void Render(
+      uint8_t equation,
+      const uint32_t* t,
+      uint32_t* out,
+      size_t size,
+      uint32_t p0,
+      uint32_t p1);
   
  private:
   uint16_t frequency_;
   uint16_t p0_;
   uint16_t p1_;
   uint16_t p2_;
-  uint32_t t_; 
+  uint32_t t_;
   uint32_t phase_;
-  uint8_t equation_index_ ;
-
-
+  uint8_t equation_index_;
   
   DISALLOW_COPY_AND_ASSIGN(ByteBeats);
 };
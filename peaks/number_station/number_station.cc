@@ -56,12 +56,10 @@ void NumberStation::Init() {
 
   previous_inner_sample_ = 0;
   previous_outer_sample_ = 0;
+  
+  player_.Init(wav_digits);
 }
 
-size_t voice_digits[] = {
-  0, 4913, 7830, 11306, 14601, 18651, 22308, 26438, 30495, 33296, 36801
-};
-
 void NumberStation::FillBuffer(
     InputBuffer* input_buffer,
     OutputBuffer* output_buffer) {
@@ -87,6 +85,10 @@ void NumberStation::FillBuffer(
   int32_t slow_noise = drift_ << 5;
   CLIP(slow_noise);
 
+  // The inner signal is computed at a quarter of the sample rate and
+  // upsampled by 2 before filtering; the filters then run over the block.
+  int32_t outer_samples[kBlockSize / kDownsample * 2];
+  int32_t* outer_sample = &outer_samples[0];
   uint8_t size = kBlockSize / kDownsample;
   while (size--) {
     for (uint8_t i = 0; i < kDownsample; ++i) {
@@ -98,7 +100,7 @@ void NumberStation::FillBuffer(
           digit_ = voice_ ? digit_ % 10 : digit_ & 3;
         }
         if (voice_) {
-          phase_ = voice_digits[digit_] << 16;
+          player_.Start(digit_);
         }
       }
       if (control & CONTROL_GATE) {
@@ -114,21 +116,8 @@ void NumberStation::FillBuffer(
     // Generate a distorted sine wave with fluctuating frequency.    
     int32_t digit;
     if (voice_) {
-      uint16_t integral = phase_ >> 16;
-      uint16_t fractional = phase_ & 0xffff;
-      if (integral < voice_digits[digit_ + 1]) {
-        uint8_t mask_a = integral * 53;
-        uint8_t mask_b = mask_a + 53;
-        int32_t a = static_cast<int32_t>(wav_digits[integral] ^ mask_a);
-        int32_t b = static_cast<int32_t>(wav_digits[integral + 1] ^ mask_b);
-        digit = (a << 8) + (((b - a) * fractional) >> 8);
-        digit -= 32768;
-        phase_ += phase_increment;
-        gate_ = true;
-      } else {
-        digit = 0;
-        gate_ = false;
-      }
+      gate_ = player_.playing();
+      digit = player_.Render(phase_increment);
     } else {
       phase_ += phase_increment + (lp_noise_ << 10);
       digit = Interpolate1022(wav_sine, phase_);
@@ -166,20 +155,19 @@ void NumberStation::FillBuffer(
         wav_fold_sine,
         inner_sample * 8192 + (1UL << 31));
 
-    int32_t outer_sample ;
-    outer_sample = lp_.Process(
-        hp_.Process((inner_sample + previous_inner_sample_) >> 1));
-    output_buffer->Overwrite((previous_outer_sample_ + outer_sample) >> 1);
-    output_buffer->Overwrite(outer_sample);
-    previous_outer_sample_ = outer_sample;
-
-    outer_sample = lp_.Process(hp_.Process(inner_sample));
-    output_buffer->Overwrite((previous_outer_sample_ + outer_sample) >> 1);
-    output_buffer->Overwrite(outer_sample);
-    previous_outer_sample_ = outer_sample;
-
+    *outer_sample++ = (inner_sample + previous_inner_sample_) >> 1;
+    *outer_sample++ = inner_sample;
     previous_inner_sample_ = inner_sample;
   }
+  
+  size = kBlockSize / kDownsample * 2;
+  hp_.ProcessBlock(outer_samples, outer_samples, size);
+  lp_.ProcessBlock(outer_samples, outer_samples, size);
+  for (uint8_t i = 0; i < size; ++i) {
+    output_buffer->Overwrite((previous_outer_sample_ + outer_samples[i]) >> 1);
+    output_buffer->Overwrite(outer_samples[i]);
+    previous_outer_sample_ = outer_samples[i];
+  }
 }
 
 }  // namespace peaks
@@ -32,6 +32,7 @@
 #include "stmlib/stmlib.h"
 
 #include "peaks/drums/svf.h"
+#include "peaks/number_station/sample_player.h"
 #include "peaks/gate_processor.h"
 
 namespace peaks {
@@ -110,6 +111,8 @@ class NumberStation {
   Svf lp_;
   Svf hp_;
   
+  SamplePlayer player_;
+  
   DISALLOW_COPY_AND_ASSIGN(NumberStation);
 };
 
@@ -0,0 +1,104 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Streaming sample player.
+
+#include "peaks/number_station/sample_player.h"
+
+namespace peaks {
+
+// Predictor coefficients, in 1/64th.
+static const int16_t adpcm_filter[][2] = {
+  { 0, 0 }, { 60, 0 }, { 115, -52 }, { 98, -55 }
+};
+
+static inline uint32_t ReadLong(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static inline int16_t ReadShort(const uint8_t* p) {
+  return static_cast<int16_t>(p[0] | (p[1] << 8));
+}
+
+void SamplePlayer::Init(const uint8_t* bank) {
+  bank_ = bank;
+  playing_ = false;
+}
+
+void SamplePlayer::Start(uint8_t index) {
+  if (index >= num_samples()) {
+    playing_ = false;
+    return;
+  }
+  const uint8_t* entry = bank_ + kSampleBankHeaderSize + \
+      index * kSampleBankEntrySize;
+  data_ = bank_ + ReadLong(entry);
+  length_ = ReadLong(entry + 4);
+  loop_start_ = ReadLong(entry + 8);
+  loop_end_ = ReadLong(entry + 12);
+  format_ = entry[16];
+  loop_history_[0] = ReadShort(entry + 20);
+  loop_history_[1] = ReadShort(entry + 22);
+  
+  sample_ = 0;
+  history_[0] = history_[1] = 0;
+  position_ = 0;
+  phase_ = 0;
+  previous_ = Decode();
+  next_ = Decode();
+  playing_ = length_ != 0;
+}
+
+int16_t SamplePlayer::Decode() {
+  if (loop_end_ && sample_ == loop_end_) {
+    sample_ = loop_start_;
+    history_[0] = loop_history_[0];
+    history_[1] = loop_history_[1];
+  }
+  if (sample_ >= length_) {
+    // Past the end: hold the last value, for the interpolation.
+    return history_[0];
+  }
+  uint32_t index = sample_++;
+  if (format_ == SAMPLE_FORMAT_PCM) {
+    history_[0] = static_cast<int8_t>(data_[index]) << 8;
+    return history_[0];
+  }
+  
+  const uint8_t* block = data_ + \
+      (index / kSampleBankBlockSize) * kSampleBankBlockBytes;
+  uint8_t byte = block[1 + (index % kSampleBankBlockSize >> 1)];
+  int32_t code = index & 1 ? byte >> 4 : byte & 0xf;
+  code = code >= 8 ? code - 16 : code;
+  
+  const int16_t* filter = adpcm_filter[block[0] >> 4];
+  int32_t value = (filter[0] * history_[0] + filter[1] * history_[1]) >> 6;
+  value += code << (block[0] & 0xf);
+  CONSTRAIN(value, -32768, 32767);
+  history_[1] = history_[0];
+  history_[0] = value;
+  return value;
+}
+
+}  // namespace peaks
@@ -0,0 +1,113 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+// 
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Streaming playback of ADPCM or PCM samples from a sample bank, with pitch
+// shifting. Banks are built by peaks/resources/sample_bank.py, which also
+// documents their format.
+
+#ifndef PEAKS_NUMBER_STATION_SAMPLE_PLAYER_H_
+#define PEAKS_NUMBER_STATION_SAMPLE_PLAYER_H_
+
+#include "stmlib/stmlib.h"
+
+namespace peaks {
+
+const uint8_t kSampleBankHeaderSize = 4;
+const uint8_t kSampleBankEntrySize = 24;
+const uint8_t kSampleBankBlockSize = 16;
+const uint8_t kSampleBankBlockBytes = 1 + kSampleBankBlockSize / 2;
+
+enum SampleFormat {
+  SAMPLE_FORMAT_ADPCM,
+  SAMPLE_FORMAT_PCM
+};
+
+class SamplePlayer {
+ public:
+  SamplePlayer() { }
+  ~SamplePlayer() { }
+  
+  void Init(const uint8_t* bank);
+  
+  // Starts playing a sample from the beginning.
+  void Start(uint8_t index);
+  
+  inline void Stop() {
+    playing_ = false;
+  }
+  
+  // Returns the sample at the current position, then moves forward by
+  // increment (16.16 fixed point: 65536 plays at the original rate).
+  inline int16_t Render(uint32_t increment) {
+    if (!playing_) {
+      return 0;
+    }
+    int32_t a = previous_;
+    int32_t b = next_;
+    int16_t sample = a + ((b - a) * static_cast<int32_t>(phase_ >> 1) >> 15);
+    phase_ += increment;
+    while (phase_ >= 65536) {
+      phase_ -= 65536;
+      previous_ = next_;
+      next_ = Decode();
+      if (!loop_end_ && ++position_ >= length_) {
+        playing_ = false;
+      }
+    }
+    return sample;
+  }
+  
+  inline bool playing() const { return playing_; }
+  inline uint8_t num_samples() const { return bank_[3]; }
+  
+ private:
+  int16_t Decode();
+  
+  const uint8_t* bank_;
+  const uint8_t* data_;
+  uint32_t length_;
+  uint32_t loop_start_;
+  uint32_t loop_end_;
+  uint8_t format_;
+  int16_t loop_history_[2];
+  
+  // Index of the next sample to decode, and the last two decoded values.
+  uint32_t sample_;
+  int16_t history_[2];
+  
+  // Playback position: samples on both sides, index of the first one, and
+  // fractional part.
+  int16_t previous_;
+  int16_t next_;
+  uint32_t position_;
+  uint32_t phase_;
+  
+  bool playing_;
+
+  DISALLOW_COPY_AND_ASSIGN(SamplePlayer);
+};
+
+}  // namespace peaks
+
+#endif  // PEAKS_NUMBER_STATION_SAMPLE_PLAYER_H_
@@ -39,47 +39,45 @@ namespace peaks {
 using namespace stmlib;
 using namespace std;
 
-#define REGISTER_BUFFERED_PROCESSOR(ClassName) \
+#define REGISTER_PROCESSOR(ClassName) \
   { &Processors::ClassName ## Init, \
-    NULL, \
     &Processors::ClassName ## FillBuffer, \
     &Processors::ClassName ## Configure },
 
-#define REGISTER_UNBUFFERED_PROCESSOR(ClassName) \
-  { &Processors::ClassName ## Init, \
-    &Processors::ClassName ## ProcessSingleSample, \
-    NULL, \
-    &Processors::ClassName ## Configure },
+#define REGISTER_ENVELOPE(Name) \
+  { &Processors::Name ## Init, \
+    &Processors::EnvelopeFillBuffer, \
+    &Processors::EnvelopeConfigure },
 
 /* static */
 const Processors::ProcessorCallbacks 
 Processors::callbacks_table_[PROCESSOR_FUNCTION_LAST] = {
-  REGISTER_UNBUFFERED_PROCESSOR(MultistageEnvelope)
-  REGISTER_BUFFERED_PROCESSOR(Lfo)
-  REGISTER_BUFFERED_PROCESSOR(Lfo)
-  REGISTER_UNBUFFERED_PROCESSOR(BassDrum)
-  REGISTER_UNBUFFERED_PROCESSOR(SnareDrum)
-  REGISTER_UNBUFFERED_PROCESSOR(HighHat)
-  REGISTER_BUFFERED_PROCESSOR(FmDrum)
-  REGISTER_BUFFERED_PROCESSOR(PulseShaper)
-  REGISTER_BUFFERED_PROCESSOR(PulseRandomizer)
-  REGISTER_UNBUFFERED_PROCESSOR(MiniSequencer)
-  REGISTER_BUFFERED_PROCESSOR(NumberStation)
-  REGISTER_BUFFERED_PROCESSOR(ByteBeats)
-  REGISTER_UNBUFFERED_PROCESSOR(DualAttackEnvelope)
-  REGISTER_UNBUFFERED_PROCESSOR(RepeatingAttackEnvelope)
-  REGISTER_UNBUFFERED_PROCESSOR(LoopingEnvelope)
-  REGISTER_UNBUFFERED_PROCESSOR(RandomisedEnvelope)  
-  REGISTER_UNBUFFERED_PROCESSOR(BouncingBall)
-  REGISTER_UNBUFFERED_PROCESSOR(RandomisedBassDrum)
-  REGISTER_UNBUFFERED_PROCESSOR(RandomisedSnareDrum)
-  REGISTER_UNBUFFERED_PROCESSOR(TuringMachine)
-  REGISTER_UNBUFFERED_PROCESSOR(ModSequencer)
-  REGISTER_BUFFERED_PROCESSOR(FmLfo)
-  REGISTER_BUFFERED_PROCESSOR(FmLfo)
-  REGISTER_BUFFERED_PROCESSOR(WsmLfo)
-  REGISTER_BUFFERED_PROCESSOR(WsmLfo)
-  REGISTER_BUFFERED_PROCESSOR(Plo)
+  REGISTER_ENVELOPE(Envelope)
+  REGISTER_PROCESSOR(Lfo)
+  REGISTER_PROCESSOR(Lfo)
+  REGISTER_PROCESSOR(BassDrum)
+  REGISTER_PROCESSOR(SnareDrum)
+  REGISTER_PROCESSOR(HighHat)
+  REGISTER_PROCESSOR(FmDrum)
+  REGISTER_PROCESSOR(PulseShaper)
+  REGISTER_PROCESSOR(PulseRandomizer)
+  REGISTER_PROCESSOR(MiniSequencer)
+  REGISTER_PROCESSOR(NumberStation)
+  REGISTER_PROCESSOR(ByteBeats)
+  REGISTER_ENVELOPE(DualAttackEnvelope)
+  REGISTER_ENVELOPE(RepeatingAttackEnvelope)
+  REGISTER_ENVELOPE(LoopingEnvelope)
+  REGISTER_ENVELOPE(RandomisedEnvelope)
+  REGISTER_PROCESSOR(BouncingBall)
+  REGISTER_PROCESSOR(RandomisedBassDrum)
+  REGISTER_PROCESSOR(RandomisedSnareDrum)
+  REGISTER_PROCESSOR(TuringMachine)
+  REGISTER_PROCESSOR(ModSequencer)
+  REGISTER_PROCESSOR(FmLfo)
+  REGISTER_PROCESSOR(FmLfo)
+  REGISTER_PROCESSOR(WsmLfo)
+  REGISTER_PROCESSOR(WsmLfo)
+  REGISTER_PROCESSOR(Plo)
 };
 
 void Processors::Init(uint8_t index) {
@@ -103,7 +101,6 @@ void Processors::Init(uint8_t index) {
   fm_drum_.set_sd_range(index == 1);
   bouncing_ball_.Init();
   lfo_.Init();
-  envelope_.Init();
   pulse_shaper_.Init();
   pulse_randomizer_.Init();
   mini_sequencer_.Init();
@@ -111,10 +108,6 @@ void Processors::Init(uint8_t index) {
   number_station_.set_voice(index == 1);
   bytebeats_.Init();
   turing_machine_.Init();
-  dual_attack_envelope_.Init();
-  looping_envelope_.Init();
-  repeating_attack_envelope_.Init();
-  randomised_envelope_.Init();
   randomised_bass_drum_.Init();
   randomised_snare_drum_.Init();
   mod_sequencer_.Init();
@@ -123,8 +116,8 @@ void Processors::Init(uint8_t index) {
   plo_.Init();
   
   control_mode_ = CONTROL_MODE_FULL;
+  std::fill(&parameter_[0], &parameter_[kNumParameters], 32768);
   set_function(PROCESSOR_FUNCTION_ENVELOPE);
-  std::fill(&parameter_[0], &parameter_[4], 32768);
 }
 
 /* extern */
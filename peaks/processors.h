@@ -85,7 +85,9 @@ enum ProcessorFunction {
   PROCESSOR_FUNCTION_LAST
 };
 
-#define DECLARE_BUFFERED_PROCESSOR(ClassName, variable) \
+const uint8_t kNumParameters = 4;
+
+#define DECLARE_PROCESSOR(ClassName, variable) \
   void ClassName ## Init() { \
     variable.Init(); \
   } \
@@ -97,18 +99,12 @@ enum ProcessorFunction {
   } \
   ClassName variable;
 
-#define DECLARE_UNBUFFERED_PROCESSOR(ClassName, variable) \
-  void ClassName ## Init() { \
-    variable.Init(); \
-  } \
-  int16_t ClassName ## ProcessSingleSample(uint8_t control) { \
-    return variable.ProcessSingleSample(control); \
-  } \
-  void ClassName ## Configure(uint16_t* p, ControlMode control_mode) { \
-    variable.Configure(p, control_mode); \
-  } \
-  ClassName variable;
-  
+// The envelopes share a single MultistageEnvelope object, and only differ by
+// the layout selected when they are initialized.
+#define DECLARE_ENVELOPE(Name, type) \
+  void Name ## Init() { \
+    envelope_.Init(type); \
+  }
 
 class Processors {
  public:
@@ -118,29 +114,36 @@ class Processors {
   void Init(uint8_t index);
   
   typedef void (Processors::*InitFn)(); 
-  typedef int16_t (Processors::*ProcessSingleSampleFn)(uint8_t); 
   typedef void (Processors::*FillBufferFn)(); 
   typedef void (Processors::*ConfigureFn)(uint16_t*, ControlMode);
   
   struct ProcessorCallbacks {
     InitFn init_fn;
-    ProcessSingleSampleFn process_single_sample;
     FillBufferFn fill_buffer;
     ConfigureFn configure;
   };
   
+  // Parameter changes are only recorded here. The active processor is
+  // reconfigured at most once per block, from Buffer(), and only if one of
+  // the parameters has actually changed.
   inline void set_control_mode(ControlMode control_mode) {
-    control_mode_ = control_mode;
-    Configure();
+    if (control_mode != control_mode_) {
+      control_mode_ = control_mode;
+      parameters_dirty_ = true;
+    }
   }
   
   inline void set_parameter(uint8_t index, uint16_t parameter) {
-    parameter_[index] = parameter;
-    Configure();
+    if (parameter != parameter_[index]) {
+      parameter_[index] = parameter;
+      parameters_dirty_ = true;
+    }
   }
   
   inline void CopyParameters(uint16_t* parameters, uint16_t size) {
-    std::copy(&parameters[0], &parameters[size], &parameter_[0]);
+    for (uint16_t i = 0; i < size; ++i) {
+      set_parameter(i, parameters[i]);
+    }
   }
   
   inline void set_function(ProcessorFunction function) {
@@ -154,29 +157,29 @@ class Processors {
         function != PROCESSOR_FUNCTION_PLO) {
       (this->*callbacks_.init_fn)();
     }
-    Configure();
+    parameters_dirty_ = true;
   }
   
   inline ProcessorFunction function() const { return function_; }
 
+  // Called from the DAC interrupt: all the processing happens in Buffer(),
+  // so this only stores the gate state and pops the next sample.
   inline int16_t Process(uint8_t control) {
-    if (callbacks_.process_single_sample) {
-      return (this->*callbacks_.process_single_sample)(control);
-    } else {
-      input_buffer_.Overwrite(control);
-      return output_buffer_.ImmediateRead();
-    }
+    input_buffer_.Overwrite(control);
+    return output_buffer_.ImmediateRead();
   }
   
   inline bool Buffer() {
-    if (callbacks_.fill_buffer) {
-      if (output_buffer_.writable() < kBlockSize) {
-        return false;
-      } else {
-        (this->*callbacks_.fill_buffer)();
-        return true;
-      }
+    if (output_buffer_.writable() < kBlockSize) {
+      return false;
     } else {
+      if (parameters_dirty_) {
+        // Cleared first: a change made by an interrupt while the processor
+        // is being configured will be picked up at the next block.
+        parameters_dirty_ = false;
+        Configure();
+      }
+      (this->*callbacks_.fill_buffer)();
       return true;
     }
   }
@@ -193,34 +196,43 @@ class Processors {
   
   ControlMode control_mode_;
   ProcessorFunction function_;
-  uint16_t parameter_[4];
+  uint16_t parameter_[kNumParameters];
+  volatile bool parameters_dirty_;
   
   ProcessorCallbacks callbacks_;
   static const ProcessorCallbacks callbacks_table_[PROCESSOR_FUNCTION_LAST];
   
-  DECLARE_UNBUFFERED_PROCESSOR(MultistageEnvelope, envelope_);
-  DECLARE_BUFFERED_PROCESSOR(Lfo, lfo_);
-  DECLARE_UNBUFFERED_PROCESSOR(BassDrum, bass_drum_);
-  DECLARE_UNBUFFERED_PROCESSOR(SnareDrum, snare_drum_);
-  DECLARE_UNBUFFERED_PROCESSOR(HighHat, high_hat_);
-  DECLARE_BUFFERED_PROCESSOR(FmDrum, fm_drum_);
-  DECLARE_BUFFERED_PROCESSOR(PulseShaper, pulse_shaper_);
-  DECLARE_BUFFERED_PROCESSOR(PulseRandomizer, pulse_randomizer_);
-  DECLARE_UNBUFFERED_PROCESSOR(BouncingBall, bouncing_ball_);
-  DECLARE_UNBUFFERED_PROCESSOR(MiniSequencer, mini_sequencer_);
-  DECLARE_BUFFERED_PROCESSOR(NumberStation, number_station_);
-  DECLARE_BUFFERED_PROCESSOR(ByteBeats, bytebeats_);
-  DECLARE_UNBUFFERED_PROCESSOR(DualAttackEnvelope, dual_attack_envelope_);
-  DECLARE_UNBUFFERED_PROCESSOR(LoopingEnvelope, looping_envelope_);
-  DECLARE_UNBUFFERED_PROCESSOR(RepeatingAttackEnvelope, repeating_attack_envelope_);
-  DECLARE_UNBUFFERED_PROCESSOR(RandomisedEnvelope, randomised_envelope_);
-  DECLARE_UNBUFFERED_PROCESSOR(RandomisedBassDrum, randomised_bass_drum_);
-  DECLARE_UNBUFFERED_PROCESSOR(RandomisedSnareDrum, randomised_snare_drum_);
-  DECLARE_UNBUFFERED_PROCESSOR(TuringMachine, turing_machine_);
-  DECLARE_UNBUFFERED_PROCESSOR(ModSequencer, mod_sequencer_);
-  DECLARE_BUFFERED_PROCESSOR(FmLfo, fmlfo_);
-  DECLARE_BUFFERED_PROCESSOR(WsmLfo, wsmlfo_);
-  DECLARE_BUFFERED_PROCESSOR(Plo, plo_);
+  void EnvelopeFillBuffer() {
+    envelope_.FillBuffer(&input_buffer_, &output_buffer_);
+  }
+  void EnvelopeConfigure(uint16_t* p, ControlMode control_mode) {
+    envelope_.Configure(p, control_mode);
+  }
+  DECLARE_ENVELOPE(Envelope, ENVELOPE_TYPE_ADSR);
+  DECLARE_ENVELOPE(DualAttackEnvelope, ENVELOPE_TYPE_DUAL_ATTACK);
+  DECLARE_ENVELOPE(RepeatingAttackEnvelope, ENVELOPE_TYPE_REPEATING_ATTACK);
+  DECLARE_ENVELOPE(LoopingEnvelope, ENVELOPE_TYPE_LOOPING);
+  DECLARE_ENVELOPE(RandomisedEnvelope, ENVELOPE_TYPE_RANDOMISED);
+  MultistageEnvelope envelope_;
+  
+  DECLARE_PROCESSOR(Lfo, lfo_);
+  DECLARE_PROCESSOR(BassDrum, bass_drum_);
+  DECLARE_PROCESSOR(SnareDrum, snare_drum_);
+  DECLARE_PROCESSOR(HighHat, high_hat_);
+  DECLARE_PROCESSOR(FmDrum, fm_drum_);
+  DECLARE_PROCESSOR(PulseShaper, pulse_shaper_);
+  DECLARE_PROCESSOR(PulseRandomizer, pulse_randomizer_);
+  DECLARE_PROCESSOR(BouncingBall, bouncing_ball_);
+  DECLARE_PROCESSOR(MiniSequencer, mini_sequencer_);
+  DECLARE_PROCESSOR(NumberStation, number_station_);
+  DECLARE_PROCESSOR(ByteBeats, bytebeats_);
+  DECLARE_PROCESSOR(RandomisedBassDrum, randomised_bass_drum_);
+  DECLARE_PROCESSOR(RandomisedSnareDrum, randomised_snare_drum_);
+  DECLARE_PROCESSOR(TuringMachine, turing_machine_);
+  DECLARE_PROCESSOR(ModSequencer, mod_sequencer_);
+  DECLARE_PROCESSOR(FmLfo, fmlfo_);
+  DECLARE_PROCESSOR(WsmLfo, wsmlfo_);
+  DECLARE_PROCESSOR(Plo, plo_);
   
   DISALLOW_COPY_AND_ASSIGN(Processors);
 };
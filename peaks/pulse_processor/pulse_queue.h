@@ -0,0 +1,131 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Queue of pending pulse events, ordered by due time (binary min-heap).
+//
+// Checking for due events costs O(1) per tick whatever the number of pending
+// events; scheduling or removing one costs O(log n). Times are tick counts
+// modulo 2^time_bits, ordered by their distance to the current tick. Since
+// all the due events are popped before Tick() is called, no pending event is
+// ever late, and an event can be scheduled up to 2^time_bits - 1 ticks ahead.
+// Storing fewer bits of time keeps the events small, so that more of them fit
+// in the same RAM.
+//
+// Event is any struct with an unsigned time member (possibly a bit field) of
+// at least time_bits bits.
+
+#ifndef PEAKS_PULSE_PROCESSOR_PULSE_QUEUE_H_
+#define PEAKS_PULSE_PROCESSOR_PULSE_QUEUE_H_
+
+#include "stmlib/stmlib.h"
+
+namespace peaks {
+
+template<typename Event, uint8_t capacity, uint8_t time_bits>
+class PulseQueue {
+ public:
+  PulseQueue() { }
+  ~PulseQueue() { }
+
+  void Init() {
+    now_ = 0;
+    size_ = 0;
+  }
+
+  inline void Tick() {
+    ++now_;
+  }
+
+  // Schedules event, delay ticks from now (less than 2^time_bits). Returns
+  // false if the queue is full.
+  bool Schedule(Event event, uint32_t delay) {
+    if (size_ == capacity) {
+      return false;
+    }
+    event.time = now_ + delay;
+    uint8_t i = size_++;
+    while (i) {
+      uint8_t parent = (i - 1) >> 1;
+      if (!Before(event.time, event_[parent].time)) {
+        break;
+      }
+      event_[i] = event_[parent];
+      i = parent;
+    }
+    event_[i] = event;
+    return true;
+  }
+
+  // Removes the earliest event if it is due. Returns false if there is none.
+  bool PopDue(Event* event) {
+    if (!size_ || Ahead(event_[0].time)) {
+      return false;
+    }
+    *event = event_[0];
+    const Event& last = event_[--size_];
+    uint8_t i = 0;
+    while (true) {
+      uint8_t child = (i << 1) + 1;
+      if (child >= size_) {
+        break;
+      }
+      if (child + 1 < size_ &&
+          Before(event_[child + 1].time, event_[child].time)) {
+        ++child;
+      }
+      if (!Before(event_[child].time, last.time)) {
+        break;
+      }
+      event_[i] = event_[child];
+      i = child;
+    }
+    event_[i] = last;
+    return true;
+  }
+
+  inline uint32_t now() const { return now_; }
+  inline uint8_t size() const { return size_; }
+  inline bool full() const { return size_ == capacity; }
+
+ private:
+  static const uint32_t kTimeMask = (1UL << (time_bits - 1) << 1) - 1;
+
+  inline uint32_t Ahead(uint32_t time) const {
+    return (time - now_) & kTimeMask;
+  }
+
+  inline bool Before(uint32_t a, uint32_t b) const {
+    return Ahead(a) < Ahead(b);
+  }
+
+  uint32_t now_;
+  uint8_t size_;
+  Event event_[capacity];
+
+  DISALLOW_COPY_AND_ASSIGN(PulseQueue);
+};
+
+}  // namespace peaks
+
+#endif  // PEAKS_PULSE_PROCESSOR_PULSE_QUEUE_H_
@@ -28,8 +28,6 @@
 
 #include "peaks/pulse_processor/pulse_randomizer.h"
 
-#include <algorithm>
-
 #include "stmlib/utils/dsp.h"
 #include "stmlib/utils/random.h"
 
@@ -47,11 +45,7 @@ void PulseRandomizer::Init() {
   delay_average_ = 32767;
   delay_randomness_ = 0;
 
-  std::fill(
-      &delay_counter_[0],
-      &delay_counter_[kTriggerPulseBufferSize],
-      0xffff);
-  
+  queue_.Init();
   num_pulses_ = 0;
   retrig_counter_ = 0;
 }
@@ -85,23 +79,18 @@ void PulseRandomizer::FillBuffer(
     ++num_pulses_;
   }
     
-  for (uint8_t i = 0; i < kTriggerPulseBufferSize; ++i) {
-    if (delay_counter_[i] == 0xffff) {
-      if (new_pulse) {
-        delay_counter_[i] = delay();
-        new_pulse = false;
-      }
-    } else if (delay_counter_[i]) {
-      --delay_counter_[i];
-    } else {
-      if ((Random::GetWord() >> 16) < repetition_probability_) {
-        ++num_pulses_;
-        delay_counter_[i] = delay();
-      } else {
-        delay_counter_[i] = 0xffff;
-      }
+  // Due pulses are either repeated or forgotten.
+  TriggerPulse pulse = { 0 };
+  while (queue_.PopDue(&pulse)) {
+    if ((Random::GetWord() >> 16) < repetition_probability_) {
+      ++num_pulses_;
+      queue_.Schedule(pulse, delay() + 1);
     }
   }
+  if (new_pulse) {
+    queue_.Schedule(pulse, delay() + 1);
+  }
+  queue_.Tick();
     
   if (retrig_counter_) {
     --retrig_counter_;
@@ -33,14 +33,25 @@
 #include "stmlib/utils/ring_buffer.h"
 
 #include "peaks/gate_processor.h"
+#include "peaks/pulse_processor/pulse_queue.h"
 
 namespace peaks {
 
+// No pulse is delayed by more than 60001 ticks, so 16 bits of time are enough.
 struct TriggerPulse {
-  uint32_t delay_counter;
+  uint16_t time;
 };
 
-static const uint8_t kTriggerPulseBufferSize = 32;
+static const uint8_t kTriggerPulseTimeBits = 16;
+
+// Each slot holds one chain of echoes: an echo is only scheduled after the
+// previous one has been popped, so a chain never takes more than one slot.
+// With a repetition probability close to 1 the chains never end and the
+// queue eventually fills up, whatever its size. From then on new pulses are
+// dropped, as they were by the original 32-slot array. Echoes are never
+// dropped, because they take the slot freed by their predecessor. 128 slots
+// (256 bytes) allow four times as many simultaneous chains as the original.
+static const uint8_t kMaxTriggerPulses = 128;
 
 class PulseRandomizer {
  public:
@@ -91,7 +102,7 @@ class PulseRandomizer {
   uint16_t num_pulses_;
   uint16_t retrig_counter_;
   
-  uint16_t delay_counter_[kTriggerPulseBufferSize];
+  PulseQueue<TriggerPulse, kMaxTriggerPulses, kTriggerPulseTimeBits> queue_;
 
   DISALLOW_COPY_AND_ASSIGN(PulseRandomizer);
 };
@@ -44,14 +44,8 @@ void PulseShaper::Init() {
   delay_ = 0;
   num_repetitions_ = 0;
 
-  Pulse p;
-  p.initial_delay_counter = 0;
-  p.duration_counter = 0;
-  p.delay_counter = 0;
-  p.repetition_counter = 0;
-  
-  std::fill(&pulse_buffer_[0], &pulse_buffer_[kPulseBufferSize], p);
-  
+  queue_.Init();
+  num_pulses_ = 0;
   previous_num_pulses_ = 0;
   retrig_counter_ = 0;
 }
@@ -68,6 +62,49 @@ inline uint16_t PulseShaper::initial_delay() const {
   return Interpolate88(lut_delay_times, initial_delay_);
 }
 
+void PulseShaper::StartRepetition(PulseTrain* train) {
+  // Handle the case when the duration of the pulse is larger than the
+  // delay time. In this case, set the duration to just a sample below
+  // the delay time. The last pulse of the train is only cut when the train
+  // ends, one sample after its delay.
+  uint16_t duration = this->duration();
+  uint16_t delay = this->delay();
+  uint16_t max_duration = train->num_repetitions > 1 ? delay : delay + 1;
+  train->duration = std::min(duration, max_duration);
+  train->delay = delay;
+}
+
+// A repetition starting at time t is ON from t + 1 to t + duration, and the
+// next one starts at t + delay + 1.
+void PulseShaper::Process(PulseTrain train) {
+  switch (train.event) {
+    case PULSE_EVENT_ON:
+      ++num_pulses_;
+      train.event = PULSE_EVENT_OFF;
+      queue_.Schedule(train, train.duration);
+      break;
+
+    case PULSE_EVENT_OFF:
+      --num_pulses_;
+      if (train.num_repetitions > 1) {
+        train.event = PULSE_EVENT_NEXT_REPETITION;
+        queue_.Schedule(train, train.delay - train.duration);
+      }
+      break;
+
+    case PULSE_EVENT_NEXT_REPETITION:
+      --train.num_repetitions;
+      StartRepetition(&train);
+      if (train.duration) {
+        train.event = PULSE_EVENT_ON;
+        queue_.Schedule(train, 1);
+      } else if (train.num_repetitions > 1) {
+        queue_.Schedule(train, train.delay + 1);
+      }
+      break;
+  }
+}
+
 void PulseShaper::FillBuffer(
     InputBuffer* input_buffer,
     OutputBuffer* output_buffer) {
@@ -76,60 +113,44 @@ void PulseShaper::FillBuffer(
     uint8_t control = input_buffer->ImmediateRead();
     new_pulse |= control & CONTROL_GATE_RISING;
   }
-    
-  uint8_t num_pulses = 0;
-  for (uint8_t i = 0; i < kPulseBufferSize; ++i) {
-    Pulse& p = pulse_buffer_[i];
-    if (p.repetition_counter) {
-      // Handle the case when the duration of the pulse is larger than the
-      // delay time. In this case, set the duration to just a sample below
-      // the delay time.
-      if (p.delay_counter < p.duration_counter && p.repetition_counter > 1) {
-        p.duration_counter = p.delay_counter;
-      }
-      
-      if (p.initial_delay_counter == 0) {
-        if (p.duration_counter) {
-          // ON
-          --p.duration_counter;
-          ++num_pulses;
-        }
-        if (p.delay_counter) {
-          --p.delay_counter;
-        } else {
-          // Retrigger
-          --p.repetition_counter;
-          p.duration_counter = duration();
-          p.delay_counter = delay();
-        }
-      } else {
-        // Still in pre-delay phase...
-        --p.initial_delay_counter;
-      }
-    } else {
-      if (new_pulse) {
-        p.repetition_counter = num_repetitions_ + 1;
-        p.initial_delay_counter = initial_delay();
-        p.duration_counter = duration();
-        p.delay_counter = delay();
-        new_pulse = false;
-        num_pulses += p.initial_delay_counter ? 0 : 1;
-      }
+
+  // Only the trains with a due event are visited.
+  PulseTrain train = { 0 };
+  while (queue_.PopDue(&train)) {
+    Process(train);
+  }
+
+  if (new_pulse && !queue_.full()) {
+    uint16_t initial_delay = this->initial_delay();
+    train.num_repetitions = num_repetitions_ + 1;
+    StartRepetition(&train);
+    if (!initial_delay) {
+      // The first pulse starts right away.
+      ++num_pulses_;
+      train.event = PULSE_EVENT_OFF;
+      queue_.Schedule(train, train.duration + 1);
+    } else if (train.duration) {
+      train.event = PULSE_EVENT_ON;
+      queue_.Schedule(train, initial_delay + 1);
+    } else if (train.num_repetitions > 1) {
+      train.event = PULSE_EVENT_NEXT_REPETITION;
+      queue_.Schedule(train, initial_delay + train.delay + 1);
     }
   }
-    
+  queue_.Tick();
+
   // The output is already high, but a new pulse is arriving. Create
   // a short dip in the output to retrigger.
-  if (previous_num_pulses_ && num_pulses > previous_num_pulses_) {
+  if (previous_num_pulses_ && num_pulses_ > previous_num_pulses_) {
     retrig_counter_ = 6;
   }
-  previous_num_pulses_ = num_pulses;
+  previous_num_pulses_ = num_pulses_;
 
   if (retrig_counter_) {
     --retrig_counter_;
   }
-  uint16_t output = num_pulses > 0 && !retrig_counter_ ? 20480 : 0;
-    
+  uint16_t output = num_pulses_ > 0 && !retrig_counter_ ? 20480 : 0;
+
   for (uint8_t i = 0; i < kBlockSize; ++i) {
     output_buffer->Overwrite(output);
   }
@@ -33,17 +33,35 @@
 #include "stmlib/utils/ring_buffer.h"
 
 #include "peaks/gate_processor.h"
+#include "peaks/pulse_processor/pulse_queue.h"
 
 namespace peaks {
 
-struct Pulse {
-  uint16_t initial_delay_counter;
-  uint16_t duration_counter;
-  uint16_t delay_counter;
-  uint16_t repetition_counter;
+enum PulseEvent {
+  PULSE_EVENT_ON,
+  PULSE_EVENT_OFF,
+  PULSE_EVENT_NEXT_REPETITION
 };
 
-static const uint8_t kPulseBufferSize = 32;
+// A train of repeated pulses, waiting for its next event. No event is
+// scheduled more than 2 * 60001 ticks ahead, so 24 bits of time are enough,
+// and a train fits in 8 bytes.
+struct PulseTrain {
+  uint32_t time : 24;
+  uint32_t num_repetitions : 4;  // Including the current one.
+  uint32_t event : 2;
+  uint16_t duration;  // Time spent in the ON state.
+  uint16_t delay;  // Time between the starts of two repetitions, minus 1.
+};
+
+static const uint8_t kPulseTrainTimeBits = 24;
+
+// A train lasts up to 8 repetitions of 10s, so no queue size is enough for
+// all the triggers of a fast clock; new triggers are dropped when the queue
+// is full, as they were by the original 32-slot array. Each Processors
+// instance holds all the processors, and there are two of them on a chip
+// with 8k of RAM: 96 trains (768 bytes) take as much RAM as 64 unpacked ones.
+static const uint8_t kMaxPulseTrains = 96;
 
 class PulseShaper {
  public:
@@ -87,16 +105,19 @@ class PulseShaper {
   uint16_t delay() const;
   uint16_t duration() const;
   uint16_t initial_delay() const;
-  
+  void StartRepetition(PulseTrain* train);
+  void Process(PulseTrain train);
+
   uint16_t initial_delay_;
   uint16_t duration_;
   uint16_t delay_;
   uint16_t num_repetitions_;
-  
+
+  uint16_t num_pulses_;
   uint16_t previous_num_pulses_;
   uint16_t retrig_counter_;
-  
-  Pulse pulse_buffer_[kPulseBufferSize];
+
+  PulseQueue<PulseTrain, kMaxPulseTrains, kPulseTrainTimeBits> queue_;
 
   DISALLOW_COPY_AND_ASSIGN(PulseShaper);
 };
@@ -828,9212 +828,7295 @@ const uint32_t* lookup_table_32_table[] = {
 };
 
 const uint8_t wav_digits[] = {
-     127,     74,     21,    224,
-     171,    118,     65,     12,
-     215,    162,    109,     56,
-     252,     49,    102,    155,
-     208,      5,     58,    111,
-     164,    217,     14,     67,
-     120,    173,     29,    232,
-     179,    126,     73,     20,
-     223,    170,    138,    191,
-     244,    214,     94,    147,
-     200,      2,    205,    103,
-     156,    209,      6,     59,
-     112,     90,    218,    240,
-     187,    134,     81,     28,
-     231,     77,    125,     72,
-      19,    222,     86,    116,
-      63,    245,     42,     95,
-     148,    201,    254,     51,
-     151,     98,     45,    248,
-      60,    142,    166,    219,
-     239,     69,    122,    175,
-      27,     25,     78,    131,
-     184,    237,     34,     87,
-     140,    193,    246,     43,
-      96,    149,    202,      0,
-     203,    150,     97,     44,
-     247,    194,    141,     88,
-      35,    238,    185,    132,
-      79,     26,    229,    176,
-     123,    185,    238,     35,
-      88,    114,    194,      8,
-     211,    158,    105,     52,
-       0,    202,    149,    159,
-      43,      9,     62,    140,
-      87,    221,    237,     71,
-     124,     78,    230,     27,
-      80,    133,     69,    239,
-      36,    166,    142,     60,
-     248,    210,     98,    104,
-      51,      1,    201,    107,
-      95,    213,     10,    192,
-     116,     86,    222,    236,
-     183,    125,     77,    231,
-     227,     81,    134,     68,
-     240,    218,     90,    112,
-     196,    249,    209,     99,
-     103,    205,    253,     55,
-     147,    161,     41,    244,
-      64,    138,     85,    223,
-     235,    182,    129,     76,
-     232,    226,     82,    120,
-     188,     14,    217,    164,
-     111,     58,      5,     47,
-     155,    153,     49,      3,
-      56,    146,    162,    215,
-     243,     65,    137,     84,
-     224,     21,     74,    128,
-     180,     22,     30,    172,
-     119,    189,     13,    216,
-      92,    110,     57,    251,
-     207,    101,    154,     48,
-     251,     57,    145,     92,
-     216,    242,     66,    136,
-      83,    225,    233,     75,
-     127,    181,    234,    224,
-      84,    118,    190,     12,
-      40,     93,    108,    198,
-       3,    206,    103,    101,
-     208,      5,    197,    111,
-     164,     38,     15,    188,
-     135,    172,     29,    232,
-      77,    127,    182,    234,
-     221,     87,    116,     64,
-     245,    215,     94,    108,
-      55,    253,    205,    152,
-     157,     44,      7,    196,
-     143,    165,     37,    240,
-      68,    121,     81,    227,
-      24,    178,    131,     72,
-      18,     35,    171,    139,
-     193,     11,     40,    161,
-     148,    201,      0,     50,
-     151,    157,    210,    249,
-      60,    113,     89,     36,
-      16,     69,    132,    173,
-      26,    230,     79,    125,
-     184,    236,    223,     86,
-     115,     63,    247,    213,
-      97,    104,    203,      0,
-     201,    106,     98,    209,
-     247,    194,    115,     90,
-     221,    239,     70,    123,
-      78,    228,    229,    176,
-     133,     71,    239,    220,
-     167,    143,     63,    245,
-     211,    159,    148,     54,
-       1,    202,    149,    159,
-      42,     11,    195,    114,
-      87,     34,     16,    186,
-     124,    176,     27,     25,
-      80,    120,    184,     17,
-      36,    166,    143,     62,
-     249,    210,    156,    149,
-      49,      1,     54,    148,
-     160,     42,    245,     63,
-     138,    168,     32,     18,
-     183,    130,    178,     24,
-      29,    172,    132,     70,
-     241,     37,    164,    142,
-      59,    249,    209,     98,
-     102,    205,      2,    200,
-     147,    160,     41,    244,
-      65,    139,    170,     32,
-      21,    183,    127,    179,
-      21,     28,     82,    121,
-     190,     15,    217,     90,
-     110,    196,      5,     47,
-     155,    153,     49,    252,
-      57,    144,    160,     40,
-     242,     66,    138,    170,
-     225,    233,     73,    129,
-      75,    233,     30,    172,
-     137,    189,     12,     37,
-     161,    144,     57,      4,
-      48,    154,    154,    207,
-     249,     56,    145,     92,
-     217,    243,     67,    136,
-      83,    224,    233,     75,
-     127,    181,     21,     31,
-      84,    118,    191,     12,
-      40,     93,    108,    199,
-     252,    207,    100,    101,
-      47,      5,    196,    110,
-      91,    216,    241,    188,
-     121,     83,    226,     23,
-     179,    126,    183,     21,
-     223,     84,    116,    191,
-     244,    212,     95,    108,
-      54,    255,    204,    152,
-     157,     46,      6,     59,
-     112,     91,    218,     15,
-     185,    123,     80,     28,
-      26,    176,    131,     72,
-      19,     33,    169,    139,
-      63,    245,    212,     94,
-     148,     52,    253,    205,
-     150,    159,     47,      7,
-      60,    142,     89,    219,
-     239,    186,    122,     80,
-      27,     25,     78,    124,
-      71,    237,    221,    168,
-     141,     63,    246,     43,
-     157,    151,     53,      1,
-      54,    151,     97,    210,
-     245,     61,    114,     90,
-     222,    239,    185,    122,
-      78,    228,    231,     77,
-     123,     70,    239,    220,
-      88,    115,    193,     10,
-      44,     96,    107,    202,
-     255,    202,    106,    159,
-      42,      9,    193,    115,
-      86,    221,     18,    185,
-     124,    177,     24,     27,
-      80,    120,    184,     18,
-     219,     91,    115,     60,
-     250,    209,     99,    151,
-      49,      3,    201,    148,
-     161,     42,    245,     63,
-     116,    169,     32,     17,
-     182,    125,    178,     24,
-      28,     81,    134,     68,
-     240,    218,     90,    113,
-     196,      6,    209,     99,
-     103,     50,      2,     55,
-     146,    160,    214,    245,
-      65,    117,     84,    222,
-     235,     73,    129,    179,
-      23,     29,    173,    120,
-      67,     14,     38,    164,
-     144,     59,    248,    211,
-     102,    102,     48,      2,
-     198,    108,     92,    213,
-     242,     65,    118,     84,
-     224,    235,     72,    129,
-     181,     23,     31,    173,
-     137,     67,     13,     37,
-     160,    146,     56,    251,
-      48,    154,    154,     48,
-     251,    198,    111,     93,
-      39,     12,    188,    119,
-      83,     30,     23,    181,
-     129,     75,    234,     31,
-     171,    136,     65,    242,
-     214,     92,    146,     58,
-     254,    207,    153,    153,
-      44,      7,    197,    144,
-     164,     38,     14,    189,
-     121,     82,    227,    233,
-      77,    127,    182,     20,
-      32,    170,    117,    190,
-       9,     40,    163,    145,
-      53,    253,     50,    153,
-     157,     47,      6,     58,
-     142,    164,     37,    240,
-      69,    135,    172,     30,
-      26,    179,    131,     72,
-      19,     32,    168,    138,
-      63,    245,    213,     95,
-     106,    203,      3,     50,
-     104,     99,    211,    249,
-      62,    141,    165,     37,
-      16,     69,    122,     81,
-     228,     25,    179,    128,
-      70,     19,     35,     87,
-     112,    194,      8,    212,
-      98,    107,    203,      0,
-      53,    148,    159,    211,
-     245,     62,    142,    165,
-      35,    239,     68,    134,
-     178,     27,     27,    176,
-     123,    184,     19,     34,
-     167,    114,    194,      8,
-      44,    158,    150,    203,
-     253,     54,    145,    157,
-     212,    247,     63,    140,
-     168,     35,     17,    187,
-     127,     79,    230,    228,
-      80,    122,     69,    236,
-     223,     90,    115,    194,
-       6,     47,    156,    104,
-     206,    253,     52,    149,
-     161,     43,     11,    192,
-     139,    169,     33,     19,
-     183,    124,     76,    230,
-     226,     81,    135,     70,
-     241,    218,     90,    112,
-     197,    249,    208,     97,
-     101,    205,      2,     55,
-     145,    163,     40,    244,
-      66,    137,    169,     34,
-      22,    181,    122,     72,
-     234,     29,    169,    131,
-      65,    241,     38,     91,
-     110,    196,    250,    209,
-     101,    102,     49,      2,
-     198,    111,     92,     40,
-      12,     65,    137,    171,
-     225,    232,     75,    128,
-      73,    235,    225,    173,
-     138,     64,    243,     39,
-      92,    110,    198,      4,
-     206,     97,     96,    203,
-     249,    198,    108,     95,
-     220,    240,     64,    138,
-     174,     28,     20,     75,
-     124,    182,     20,    226,
-      87,    118,     67,    247,
-     212,     95,    108,    198,
-       0,     50,    152,    101,
-     210,    251,     59,    146,
-     167,     36,     12,    189,
-     120,    173,     29,    232,
-     179,    128,     75,    234,
-     222,     84,    117,     64,
-     246,    212,     95,    108,
-      55,    252,    206,    100,
-      97,     46,      5,    192,
-     115,     90,     37,    240,
-      69,    135,     81,    225,
-     227,     79,    130,     74,
-     237,     32,    170,    136,
-     192,      9,     40,    160,
-     106,    200,      1,    205,
-     105,     98,     44,      6,
-      60,    142,     89,    219,
-     239,    186,    132,    174,
-      26,    231,     76,    126,
-     185,     19,     35,    169,
-     115,    195,     10,     40,
-     157,    151,     52,    255,
-      53,    149,    157,     44,
-     246,     63,    140,     88,
-     222,    236,     71,    123,
-      78,    229,     26,    176,
-     122,    187,     19,     35,
-     167,    115,    195,      9,
-      45,    158,    105,    203,
-     255,    202,    149,    159,
-      42,     11,    194,    114,
-     168,     35,     19,     71,
-     131,     78,    231,    231,
-      83,    121,    187,    239,
-     219,    167,    143,    193,
-       3,     41,    159,    151,
-      51,      1,     54,    149,
-     161,     43,    245,     63,
-     139,    169,     33,     19,
-      72,    128,    177,     27,
-      29,    174,    121,    187,
-      15,     37,    164,    141,
-      56,    250,    210,     99,
-     153,     48,      2,     52,
-     145,     95,    210,    247,
-      64,    118,     86,    223,
-      16,    176,    122,     76,
-      21,     28,    173,    134,
-      65,    245,    221,     88,
-     110,     57,    253,    216,
-      96,    103,     48,      1,
-     197,    110,     94,    211,
-     242,    191,    114,     82,
-     227,    234,    182,    123,
-      72,    235,    227,     82,
-     136,     67,    246,    221,
-      88,    108,     56,    249,
-      48,    154,    100,    204,
-     248,     56,    111,     93,
-     216,     12,    190,    118,
-     173,     29,     21,    180,
-     126,    180,    234,    226,
-      80,    116,     67,    246,
-     210,    162,    149,     61,
-       2,     57,    144,    155,
-     214,    252,     59,    106,
-      92,    216,      8,    182,
-     126,    175,     26,     19,
-      79,    120,    180,    238,
-     215,     81,    142,     71,
-     246,     45,    166,    147,
-     206,      7,    205,    100,
-      96,     46,      4,    197,
-     142,    161,     38,    240,
-      71,    130,    174,    225,
-     230,    178,    128,     74,
-      19,     35,    168,    117,
-     193,     10,     42,    160,
-     105,    202,      2,     51,
-     105,     98,     45,      6,
-     195,    143,    164,     38,
-     239,     71,    133,     82,
-     230,     24,    181,    130,
-     188,     17,    221,     82,
-     112,     60,    243,    214,
-     157,    145,     52,      3,
-      54,    150,     96,    210,
-       9,    193,    112,     89,
-      32,     23,    186,    134,
-     179,    229,    227,     77,
-     129,     78,    236,     38,
-     161,    114,    196,     12,
-     208,    105,    107,     50,
-       6,     55,    146,    157,
-     209,    243,    193,    119,
-      87,     32,     16,     71,
-     128,    179,     25,    229,
-      80,    133,     71,    239,
-      38,    165,    142,    199,
-       7,     45,    102,    151,
-      50,      3,     54,    150,
-      95,     46,    241,    196,
-     141,     84,     34,    237,
-     183,    126,    182,    225,
-      21,     89,    131,    191,
-     243,    219,    163,    114,
-      62,     10,    214,    159,
-     100,     52,      3,     51,
-     146,    165,    220,     14,
-      65,    125,    175,     32,
-      21,     73,    130,     74,
-      19,    224,    171,    123,
-     190,    241,    217,     90,
-     110,    197,    249,    210,
-     155,    152,     50,    253,
-      58,    109,     94,     40,
-      12,     65,    119,    173,
-     233,     28,     67,    119,
-     182,     21,    234,    191,
-     123,     79,      2,    208,
-     163,    144,    195,    244,
-      60,    108,    156,    206,
-       6,     56,    144,    161,
-     222,     12,     64,    113,
-      80,     23,    231,    164,
-     116,     67,     19,    226,
-      83,    133,    178,    252,
-      37,     85,    111,     60,
-       0,    205,    157,    100,
-     213,      1,     57,    108,
-      91,     45,    252,    182,
-     142,     90,     21,    233,
-      75,    136,    189,    231,
-      41,     86,    119,     65,
-       9,    215,     94,    151,
-     192,    250,     55,    152,
-     100,     33,    246,    207,
-     131,     82,     38,     11,
-      72,    118,    162,    239,
-      17,    177,    117,     75,
-      23,    220,     87,    131,
-     204,    252,     46,    163,
-     103,     36,     14,    195,
-     154,    101,    211,     14,
-      50,     96,    168,    209,
-     238,    191,    130,     88,
-      31,    230,     72,    143,
-     182,    228,     35,    160,
-     124,     49,      7,    218,
-     146,    105,    205,    241,
-      36,    102,    148,    209,
-     243,    197,    138,     93,
-      35,     23,     75,    117,
-     186,    224,    227,    161,
-     107,     72,      0,    204,
-     174,    143,    206,    231,
-      35,    109,    144,     52,
-     251,    205,    145,     96,
-     209,      5,     49,    126,
-     160,     33,    226,    171,
-     147,     92,      9,    239,
-     173,    142,    169,    253,
-      41,     80,    142,     58,
-       0,    219,    152,    150,
-     196,     12,     59,     98,
-     161,     35,    231,    208,
-     155,     89,     45,    233,
-      78,    109,    161,    233,
-      21,     80,    124,     67,
-       6,    220,     91,    133,
-     212,    232,     33,    101,
-      99,     34,    232,    218,
-     130,     81,     32,     11,
-      75,     97,    190,    211,
-      23,    178,    134,     68,
-      31,    230,     86,    137,
-     174,    254,     47,    164,
-      98,     47,     16,    194,
-     149,    108,     50,     10,
-      43,    123,    178,    208,
-     247,    183,    128,     94,
-      26,     23,     70,    108,
-     160,    231,     26,    169,
-     100,     91,     27,    201,
-     175,    105,    197,    247,
-      38,    115,    150,    206,
-     243,    204,    154,     84,
-      37,     10,     80,     97,
-     191,    234,     22,    185,
-     101,     80,      3,    240,
-     160,    117,    184,    225,
-      49,     79,    154,     59,
-       9,    196,    145,     98,
-     210,     11,     47,    121,
-     180,    223,    244,    175,
-     155,     73,      9,    229,
-     180,    128,    189,    252,
-      56,     69,    137,     70,
-       1,    220,    166,    110,
-     192,    236,     36,    116,
-     151,     46,    245,    222,
-     144,     66,     52,    249,
-     185,    126,    191,    249,
-      14,     65,    130,     65,
-      24,    215,    175,    138,
-     203,    230,     63,     79,
-     147,     50,     19,    210,
-     138,    116,     32,    255,
-      61,    125,    179,    194,
-       3,     77,    135,     90,
-      23,    238,    179,    133,
-     183,    249,     48,     90,
-     143,     55,     17,    246,
-     131,    121,     63,      4,
-      49,    121,    137,    203,
-       7,     56,    136,     83,
-      47,    233,     70,    114,
-     161,    241,     21,     70,
-     123,     75,     13,    252,
-     191,    127,     59,      8,
-      37,    115,    129,    223,
-      11,     53,    159,    109,
-      32,    240,     60,    126,
-     188,    201,     28,     66,
-     128,     92,      6,    249,
-     189,    115,     71,    235,
-      41,     74,    155,    205,
-     253,    215,    144,    101,
-      58,    255,     62,    120,
-     182,    199,      0,     62,
-     128,     76,      0,    245,
-     186,    134,    179,    237,
-      14,     69,    151,    178,
-     240,    208,    171,    125,
-      61,    251,     32,    117,
-     141,    194,     10,    203,
-     128,     65,     52,    231,
-     181,    136,    175,    208,
-       7,     90,    115,    182,
-      18,    236,    162,    116,
-      64,    246,     55,     77,
-     133,    203,    255,    216,
-     131,    123,     41,    238,
-     206,    147,    170,    216,
-      30,     81,    125,    168,
-      23,    231,    184,    135,
-     180,    227,     15,     71,
-     155,    176,    247,    222,
-     176,    120,     46,     19,
-     223,    156,    155,    201,
-       8,     52,    101,    167,
-      36,    246,    188,    117,
-     164,    238,      5,     89,
-     141,    176,     17,    241,
-     178,    109,     89,     28,
-     223,    162,    150,    207,
-     247,     60,    111,    154,
-      41,    252,    197,    109,
-     173,    201,     26,     83,
-     117,    170,     29,    230,
-     164,    102,     93,     26,
-     214,    168,    117,    188,
-     243,     35,     91,    110,
-      63,      5,    205,     98,
-     146,    196,     31,     47,
-      98,    170,    216,    254,
-     166,    152,     74,      8,
-     233,    181,    121,    183,
-     233,     43,     92,    143,
-      62,      8,     47,     86,
-     132,    218,    235,     60,
-     102,    144,    209,    243,
-     217,    148,     64,     48,
-     254,    176,    131,     83,
-     231,     19,     64,    133,
-      71,     17,     39,     93,
-     131,    211,    229,     36,
-     110,    155,    206,      9,
-     220,    143,    120,     58,
-     228,    207,    135,     95,
-     220,     24,     86,    115,
-     177,     27,     29,     68,
-     138,    171,    250,     50,
-      87,    156,    197,     15,
-     196,    133,    114,     44,
-     235,    196,    159,    104,
-     213,      3,     47,    122,
-     169,     34,     20,     77,
-     112,    160,    245,     10,
-      94,    151,    179,     20,
-     206,    189,    109,     38,
-      17,    221,    145,     98,
-     204,     11,     38,     98,
-     162,    213,      9,     55,
-     120,    186,    202,      0,
-      71,    105,    190,     26,
-     240,    178,    100,     88,
-      25,    203,    168,    123,
-      59,    240,     35,    106,
-     157,    204,      0,     63,
-      98,    180,    195,     31,
-      81,     97,    167,     33,
-     250,    171,    161,     83,
-      15,    241,    163,    115,
-      66,    249,     43,     86,
-     151,    199,    250,     39,
-     106,    141,    218,     21,
-      43,    126,    173,    215,
-     252,    162,    150,    116,
-       6,    254,    187,    140,
-      79,    236,     21,     95,
-     143,    188,     12,     32,
-      81,    130,    211,    236,
-      36,    113,    138,    204,
-     240,    220,    142,     67,
-      62,    230,    178,    133,
-      85,    226,     31,     70,
-     136,    183,     21,     23,
-      91,    157,    171,    228,
-      61,     78,    130,    195,
-      10,    214,    135,    122,
-      55,    238,    213,    157,
-      92,    216,      6,     79,
-     127,    173,     31,     16,
-      65,    147,    160,    252,
-      53,     70,    155,    185,
-      12,    193,    188,    114,
-      47,     23,    220,    151,
-     105,     47,      0,     48,
-     119,    167,     37,      8,
-      73,    106,    185,    251,
-      14,     89,    145,    176,
-      22,    203,    183,    107,
-      38,     29,    198,    175,
-      96,     52,    251,     57,
-     111,    159,     45,      1,
-      48,     98,    190,    204,
-       6,     80,    104,    167,
-      24,    242,    173,     97,
-      94,      5,    207,    184,
-     126,     61,    242,     34,
-     103,    150,    202,    248,
-      57,    122,    136,    196,
-      29,     46,     99,    175,
-      33,    252,    163,    152,
-      87,     15,    247,    160,
-     118,     66,    237,     42,
-      95,    137,    195,    241,
-      32,    115,    128,    221,
-      21,     38,    120,    150,
-      42,    231,    216,    150,
-      64,     55,    254,    169,
-     141,     72,    231,     28,
-      86,    134,    187,    233,
-      40,     75,    152,    213,
-     237,     62,    115,    158,
-      50,    238,    209,    141,
-      72,     63,    231,    207,
-     134,     80,    223,     20,
-      79,    121,    176,    225,
-      16,     64,    147,    174,
-     228,     55,     75,    134,
-      58,      9,    199,    132,
-     113,     38,    238,    217,
-     156,     89,    214,     13,
-      70,    118,    171,    217,
-      24,     88,    106,    167,
-     251,     15,     67,    142,
-      66,      1,    207,    188,
-     121,     46,     23,    192,
-     149,     96,    207,      4,
-      62,    111,    163,    209,
-       0,     80,     98,    190,
-     244,      6,     91,    118,
-      73,     25,    244,    187,
-      98,     81,     31,    200,
-     174,    104,    199,    254,
-      52,    100,    155,    201,
-      15,     41,    122,    182,
-     203,     30,     82,    127,
-      80,     17,    253,    161,
-     107,     88,      5,    239,
-     167,    112,    190,    247,
-      43,     93,    144,    193,
-     247,     33,    114,    143,
-     194,     23,     52,    106,
-      93,     54,    229,    169,
-     148,     67,     18,    229,
-     185,    123,    182,    232,
-      33,    170,    136,    184,
-     248,     56,     74,    134,
-     219,    239,     63,     99,
-     100,     62,    234,    215,
-     158,     85,     40,    253,
-     178,    133,    175,    225,
-     231,    179,    131,    176,
-     224,     48,     66,    159,
-     211,    231,     38,     93,
-      98,     38,     19,    221,
-     135,    108,     33,    244,
-     203,    141,    166,     36,
-     237,    184,    120,    168,
-     232,     11,     90,    144,
-     170,    253,     43,    168,
-     120,     46,     25,    219,
-     146,     97,     63,      9,
-     206,    151,    158,     45,
-     244,    192,    112,    175,
-     209,      3,     82,    104,
-     162,    235,     29,    179,
-     118,     86,     30,    210,
-     171,    120,     55,      1,
-     215,    158,    150,     54,
-     252,    203,    105,    150,
-     216,     25,     46,    124,
-     167,    214,     17,    190,
-     143,     67,     19,    236,
-     170,    126,     64,     21,
-     216,    164,    117,     53,
-      13,    215,     99,    158,
-     193,     19,     36,    122,
-     174,    220,    245,    202,
-     133,     91,     40,    234,
-     181,    131,     76,     25,
-     226,    172,    127,     78,
-       5,    220,     91,    134,
-     202,    235,     60,    115,
-     147,    207,    250,    196,
-     157,     85,     46,    246,
-      65,    119,    174,    221,
-      20,    181,    139,     71,
-      28,    230,     80,    143,
-     178,    254,     40,     80,
-     148,     57,     13,    218,
-     147,     99,    206,      0,
-      61,    107,    166,    215,
-     240,    180,    133,     89,
-      23,    235,     78,    115,
-     185,    231,     21,     80,
-     117,     74,      7,    223,
-     166,    145,    195,    252,
-      59,    109,    158,     49,
-     241,    200,    129,     80,
-      34,    243,     74,    124,
-     161,    237,     21,    181,
-     120,     64,     19,    228,
-      86,    142,    183,    253,
-      35,     85,    147,     49,
-      14,    223,    151,    108,
-      43,      1,     61,    100,
-     174,    219,    243,    186,
-     142,     84,     25,     20,
-      68,    139,    185,    230,
-      42,     86,    114,     75,
-      27,    216,    168,    106,
-     201,    249,     58,    111,
-     156,     44,    255,    194,
-     140,     88,    223,      7,
-      79,    118,    162,    239,
-      26,    180,    119,     88,
-      24,    213,    161,    117,
-      63,    240,     40,    163,
-     105,     49,      5,    205,
-     151,    154,    213,     10,
-      51,    122,    170,    218,
-     235,    178,    137,     86,
-      18,    227,    176,    125,
-     187,     16,    216,    171,
-     116,     63,      8,     40,
-     106,    157,    197,    242,
-      56,     99,     97,     46,
-     254,    203,    136,     80,
-      32,    234,    186,    132,
-      70,     28,    224,    182,
-     133,     71,    233,     43,
-      80,    131,    202,    252,
-      41,    156,    104,     60,
-     252,    201,    144,     96,
-      46,    244,    199,    135,
-      84,     42,    237,     69,
-     125,    187,    224,     23,
-      90,    141,    179,     16,
-      36,    164,    114,    195,
-       4,    208,    158,    109,
-      55,    243,    193,    145,
-      89,    214,     10,     56,
-     114,    175,    215,     22,
-      78,    124,    178,     24,
-     226,     83,    135,     70,
-      14,    223,    161,    123,
-      55,      5,    215,    103,
-     155,    200,      5,     52,
-     105,    162,    210,     10,
-     191,    117,     85,    220,
-      16,    182,    129,     73,
-      17,    235,    160,    122,
-      71,    245,     32,     95,
-     152,    199,    251,    208,
-     100,    103,     49,      3,
-      58,    105,    164,    214,
-     243,    187,    129,     94,
-      16,    234,    181,    121,
-     191,    239,     25,     82,
-     118,     64,     15,    222,
-     162,    145,    197,    253,
-      56,    103,    101,     52,
-     241,    205,    158,    163,
-     218,      4,     82,    127,
-     171,    224,    236,    177,
-     122,     67,     20,    225,
-      87,    129,    183,    240,
-     215,    164,    102,     53,
-      13,     50,     99,    144,
-     194,     15,     60,    110,
-      83,     32,    246,    183,
-     133,     80,    226,     16,
-      68,    128,     73,     28,
-     210,    165,    124,    185,
-     253,     57,     77,    153,
-     205,    252,    197,    155,
-     100,     36,    251,    199,
-     143,    173,    222,    241,
-     185,    141,     92,     19,
-     230,     71,    143,    163,
-     252,     38,     84,    117,
-      56,      9,    211,    168,
-     104,     53,      3,     53,
-     150,    103,     43,    247,
-     211,    134,    175,    213,
-       4,     81,    118,    172,
-     228,    228,    178,    127,
-      67,     16,    222,    170,
-     140,    193,      1,    221,
-     145,    126,     36,    251,
-      58,    123,    135,    220,
-      14,    194,    141,     90,
-      33,    236,    187,    133,
-      76,     27,     27,    183,
-     114,     75,      4,    202,
-     163,    157,    210,    239,
-      57,    102,    148,    202,
-       0,     54,    107,     98,
-     212,    244,    197,    112,
-      83,     40,    230,    174,
-     153,     68,    237,     21,
-      67,    150,    179,    238,
-      38,     95,    140,    197,
-     249,    209,    157,    108,
-      51,    254,    195,    159,
-      77,     55,    249,     53,
-     125,    166,    209,     17,
-     183,    127,    186,    237,
-      21,     86,    134,     69,
-      14,    216,    164,    119,
-      53,     23,    202,    151,
-     149,    202,      9,     59,
-     151,     88,    210,     12,
-      76,    101,    162,    221,
-      20,     73,    126,     79,
-      17,    238,    186,     96,
-      66,    248,     35,     81,
-     146,     54,     12,     43,
-      99,    149,    223,      4,
-      57,    111,    161,    210,
-      12,    186,    131,     76,
-      16,     19,     79,    125,
-     176,     17,    245,    171,
-     143,    187,    252,     40,
-      92,    110,    197,    253,
-      56,    102,    154,     59,
-     233,     60,    102,     93,
-     218,    246,    171,    154,
-     172,    231,     31,     70,
-     133,     77,     23,     28,
-      81,    128,    185,     13,
-     220,     88,    131,    196,
-       1,    202,    140,    121,
-      41,      3,     57,     99,
-     173,     44,    251,    188,
-     121,    168,    235,     19,
-     180,    134,    170,    230,
-     223,     84,    100,     98,
-       0,     47,     93,    148,
-     207,      8,    220,    159,
-     156,    208,      3,     49,
-     137,    162,    254,     28,
-      71,    122,     90,     60,
-     247,     70,    135,    181,
-     235,    211,    179,    127,
-      62,     14,     47,     86,
-     108,    193,    218,     39,
-     105,    153,     40,    228,
-     200,     99,    172,    216,
-      19,    181,    155,     67,
-      24,    229,     79,    137,
-      70,    225,      3,     88,
-     113,     62,     14,    195,
-     157,    128,    216,    246,
-      53,    153,    127,     52,
-     254,    196,    114,    165,
-     217,     10,     95,    125,
-      76,     19,    247,    191,
-     130,    175,    248,     47,
-     166,    127,     43,     27,
-     218,    152,    109,     55,
-      20,     20,    100,    159,
-      46,    228,    216,    142,
-     185,    205,     29,     79,
-     138,     92,     21,    236,
-     167,    120,     66,    239,
-       5,     67,    142,     58,
-      12,    207,    142,    156,
-     221,     12,     63,    144,
-      80,     36,    242,    192,
-     118,    168,    220,      9,
-     106,    119,     74,     19,
-     250,    179,    121,    168,
-     254,     32,    160,     96,
-      40,      8,    212,     97,
-     155,    201,     29,     27,
-     126,     95,     45,    227,
-     156,    140,    164,    213,
-      22,    177,    146,     90,
-       6,    235,    174,    121,
-     184,    210,     23,     66,
-     149,    199,      9,    204,
-     157,    136,    196,    249,
-     202,    135,     64,     60,
-     251,    182,    133,    170,
-     196,     59,     82,    118,
-     178,     30,    240,     86,
-     158,    173,      9,    202,
-     180,    113,     34,      8,
-     199,    137,    102,    233,
-      35,     52,    105,    166,
-      43,    248,     86,     86,
-     184,    225,    230,    162,
-      98,     80,     31,    234,
-     178,    116,    155,    238,
-      41,     95,    147,     41,
-      11,     40,     68,    139,
-      47,    253,    213,    136,
-      74,     34,    252,    170,
-     115,    139,    236,    239,
-     178,    116,     92,     20,
-      61,     74,    141,     71,
-      13,    218,    181,    107,
-     203,      9,    197,    124,
-     188,    211,    243,    194,
-     157,     78,    221,     20,
-      84,    130,     86,     26,
-     246,    163,    125,    183,
-      27,     42,    119,    157,
-      63,     14,    209,    178,
-     100,    194,    236,    204,
-     158,     99,     37,    237,
-     210,    139,     93,    221,
-      14,    103,    106,     80,
-      31,    225,    189,    124,
-     180,    239,    212,    174,
-     112,     53,     24,    196,
-     144,    149,    211,    226,
-      37,     97,    159,     43,
-     242,     62,    119,     91,
-      40,    233,    184,    134,
-      73,     22,    241,    185,
-     138,    160,    254,     43,
-      94,    140,     62,    245,
-      37,    156,    123,     58,
-     251,    200,    106,     99,
-      37,    243,     48,     97,
-     162,    217,     17,     69,
-     120,    183,    226,    231,
-     161,    110,     74,     21,
-      39,    167,    125,     62,
-     232,     57,    104,    147,
-     207,      0,     50,     98,
-     165,     44,    255,    206,
-     153,     93,    220,    237,
-     186,    131,    188,    232,
-      17,     91,    130,    186,
-     249,     44,    167,    125,
-      50,     12,    220,    152,
-     152,     58,    240,    200,
-     101,    168,    223,      0,
-      70,    119,    163,    211,
-     233,    162,    144,     68,
-      16,    227,     90,    120,
-      73,    241,     33,     90,
-     145,    201,    247,     40,
-     111,    146,     55,    234,
-     210,    157,     90,    212,
-       5,     67,    119,    173,
-     227,    238,    183,    120,
-     191,    231,     17,     80,
-     123,     87,     21,    203,
-     166,    151,    192,    248,
-      57,    110,    152,     52,
-       4,     62,     98,    177,
-     213,    246,    169,    145,
-      74,     14,    232,     76,
-     135,    190,    225,     26,
-     169,    117,    191,    249,
-      62,     72,    149,     48,
-      21,    209,    131,    105,
-      44,      3,     42,    124,
-     175,    216,    244,    187,
-     120,    189,    247,     25,
-      74,    121,     82,     10,
-     204,    167,    114,    184,
-     236,     60,     88,    108,
-      54,      3,     55,    106,
-     144,    213,    251,    201,
-     154,     78,     53,    250,
-      69,    107,    184,    238,
-      27,    177,    121,    181,
-     224,     47,     83,    126,
-      46,      5,    196,    178,
-     109,    197,    237,     61,
-      97,    159,     40,    253,
-      57,    126,    171,    218,
-     229,    181,    138,     64,
-      21,    229,     69,    146,
-     182,    234,    221,    173,
-     112,    199,    253,     45,
-     157,     98,     60,     11,
-     197,    157,    159,    217,
-       3,     52,    117,    166,
-      32,     16,     78,    127,
-      74,     29,    225,    181,
-     115,     64,     16,     33,
-      91,    139,    196,    244,
-      44,     98,    144,    201,
-     252,    204,    145,    101,
-      34,    241,     63,    118,
-     172,    216,     23,     68,
-     125,    179,    229,     25,
-     173,    115,     77,     16,
-     218,    161,    114,    199,
-     252,     47,    103,    144,
-     205,      1,     50,    111,
-      93,     32,    252,    196,
-     137,     87,    221,     21,
-      75,    130,    178,    228,
-      30,     80,    130,    189,
-     240,    210,    174,    119,
-      60,      0,     47,    105,
-     148,    202,      3,     55,
-     147,     92,     40,      8,
-      68,    136,     93,     39,
-     236,    189,    137,    183,
-     230,     16,     91,    143,
-     191,     13,    218,     91,
-     144,     62,     13,    212,
-     152,    110,     58,    255,
-      63,    100,    171,    219,
-       7,     69,    136,     85,
-      30,    238,    188,    135,
-      72,     16,    232,    168,
-     137,    190,    246,     47,
-      80,    152,    194,    249,
-      48,    159,    111,     56,
-     248,    197,    151,     88,
-     218,     14,     66,    118,
-     169,    233,     17,     77,
-     134,    180,     18,    234,
-     172,    112,     70,     15,
-      44,     85,    150,    199,
-     253,     51,    103,    152,
-     214,      1,    199,    151,
-      93,     33,    250,    181,
-     135,    165,    232,     16,
-      73,    130,     73,     22,
-      32,     81,    138,     67,
-       9,    212,    171,     96,
-      50,    255,     52,    111,
-     150,    217,      5,    198,
-     139,     88,     36,    240,
-      70,    122,     82,     21,
-     239,    176,    130,    180,
-     235,     43,     95,    136,
-      62,     14,    210,    168,
-     104,    203,    255,    206,
-     149,     98,     44,    249,
-      62,    119,    160,    223,
-      19,     69,    128,     87,
-      24,    230,    179,    127,
-      70,    239,     32,     85,
-     143,    197,    242,     42,
-     158,    149,     53,      1,
-     203,    105,    101,     43,
-     242,    192,    114,    164,
-     217,     22,     67,    123,
-      76,     31,    224,    177,
-     128,    190,    239,    217,
-     175,    116,     63,    244,
-      36,    104,    145,    202,
-     250,    195,    156,    100,
-     214,     15,     56,    114,
-      83,     36,    233,    184,
-     127,    184,    236,     29,
-     174,    124,     77,     22,
-     217,     91,    138,    194,
-       6,    208,    159,    104,
-     206,      7,     48,    111,
-      95,     41,    246,    193,
-     116,    169,     32,    239,
-     178,    134,     79,    230,
-      24,     84,    131,    191,
-      15,    223,    161,    112,
-     199,    250,     47,    157,
-      98,     53,    248,    201,
-     110,    164,    209,     14,
-      64,    137,     86,     33,
-      21,     74,    122,    179,
-      20,    231,    168,    124,
-      66,    243,     35,     93,
-     148,    197,      6,    210,
-     100,    152,    204,      1,
-      57,    144,     88,     44,
-     240,    188,    119,    175,
-     227,     20,    181,    128,
-      75,     22,     30,     82,
-     136,    189,     13,    218,
-     160,    108,     57,    250,
-      49,    100,    155,    205,
-       5,     57,    145,     93,
-      38,    242,    189,    136,
-      82,     30,    233,    180,
-     128,    181,     20,     31,
-      87,    138,    191,    243,
-     215,    161,    110,     58,
-       3,     49,    103,    154,
-      47,    251,    196,    144,
-     165,    219,     13,     65,
-     120,     83,     31,    235,
-     177,    126,    183,    232,
-      34,     85,    119,     66,
-      11,     40,     95,    145,
-     202,    252,    205,    154,
-      97,     44,    249,     57,
-     114,    164,     37,    241,
-     186,    134,    175,    226,
-      25,     76,    130,     72,
-      17,    220,    168,    116,
-     192,    244,     42,    160,
-     148,    201,      1,    204,
-     104,    157,     45,      7,
-      60,    142,     88,     36,
-     239,    186,    122,    175,
-      27,    230,     78,    131,
-      71,     18,    221,    168,
-     115,    193,    246,     43,
-      96,    148,     53,      1,
-     203,    105,    158,    211,
-       8,     61,    141,     89,
-      34,    239,    185,    122,
-     178,    228,     26,    176,
-     122,     70,    238,     35,
-      89,    141,    194,      9,
-     210,    159,    105,     52,
-       0,     52,    107,    159,
-      43,    246,    193,    115,
-     168,    221,     18,    184,
-     131,     79,     25,    228,
-      80,    133,    186,    239,
-      36,     89,    142,    195,
-     248,    210,    157,    105,
-      51,    254,    201,    148,
-     160,    213,     10,    192,
-     139,     86,    222,     18,
-      73,    125,     77,     25,
-     226,    175,    121,    187,
-     240,     37,    165,    143,
-      59,      6,     46,     99,
-     152,    205,      3,     55,
-     147,     94,     41,    244,
-     191,    117,    170,     32,
-     235,     73,    126,    179,
-     233,     28,    173,    120,
-     188,    241,    217,    164,
-     111,     58,      5,    208,
-     155,    153,    206,      3,
-      56,    109,     93,     40,
-     243,    190,    118,    171,
-      31,    234,    181,    128,
-      75,     22,    225,     83,
-     137,    188,    242,     39,
-     163,    111,     56,      4,
-      49,    100,    154,     48,
-     251,    198,    145,    163,
-     216,     13,     66,    119,
-     172,     30,    233,    180,
-     127,     74,     21,     31,
-      84,    137,    190,     12,
-     215,     93,    146,    199,
-     252,     49,    153,    100,
-      47,      5,     58,    111,
-     164,    217,     14,     67,
-     120,    173,    226,    232,
-     179,    129,    182,    235,
-      32,    170,    117,     64,
-      11,     41,     94,    147,
-     200,    253,     50,    103,
-      99,     46,    249,    196,
-     112,    165,    218,    240,
-     187,    134,     81,     28,
-     231,     77,    130,    183,
-     236,    222,    169,    116,
-     192,    245,     42,     95,
-     148,     54,      1,    204,
-     104,    157,    210,      7,
-      60,    113,     89,     36,
-      16,    186,    133,     80,
-      27,     25,     78,    131,
-      71,     18,    221,    168,
-     115,    193,    246,    212,
-     159,    106,     53,      0,
-      52,    105,    158,    211,
-       8,     61,    141,     88,
-      35,     17,     70,    123,
-     176,    229,    229,    176,
-     123,     70,     17,     35,
-      88,    141,    194,      8,
-     211,    158,    105,     52,
-       0,     53,    106,    159,
-      43,    246,    193,    140,
-      87,    221,     18,     71,
-     131,     78,     25,    228,
-     175,    122,     69,    239,
-      36,     89,    142,     60,
-       7,     45,     98,    151,
-     204,      1,     54,    148,
-      95,    213,    245,    192,
-     139,     86,    222,     19,
-      72,    125,    178,     24,
-     227,    174,    121,     68,
-     240,     37,     90,    143,
-      59,      6,    209,    156,
-     103,    205,      2,     55,
-     108,     94,     41,    244,
-     191,    117,    170,    223,
-      20,     73,    129,     76,
-      23,    226,    173,    135,
-     188,    241,    217,    164,
-     111,     58,      5,     47,
-     100,    153,    206,      3,
-      56,    146,     93,     40,
-     243,     65,    118,    171,
-     224,    234,    181,    128,
-      75,    233,     30,     83,
-     136,     66,     13,    216,
-     163,    110,    198,    251,
-      48,    101,    101,     48,
-     251,    198,    145,     92,
-     216,     13,     66,    136,
-      83,     30,    233,    180,
-     127,    181,    234,     31,
-     171,    118,     65,    243,
-      40,    162,    146,     56,
-     252,     49,    102,    155,
-     208,      5,     58,    111,
-     164,    217,     14,     67,
-     135,    173,    226,     23,
-      76,    129,    182,     20,
-     223,    170,    117,     64,
-      11,    214,     94,    147,
-     200,      2,    205,    152,
-      99,     46,    249,     59,
-     143,    165,    218,     15,
-      68,    121,     81,     28,
-     231,     77,    130,    183,
-     236,     33,     86,    139,
-     192,    245,    213,    160,
-     148,     54,      1,    204,
-     151,     98,     45,      7,
-      60,    113,    166,    219,
-      16,    186,    133,     80,
-      27,    230,     78,    124,
-     184,    237,     34,     87,
-     115,     62,      9,    212,
-     159,    106,     53,    255,
-      52,    105,    158,    211,
-       8,    194,    141,     88,
-      35,    238,     70,    123,
-      79,    229,     26,    176,
-     123,    185,    238,     35,
-     167,    114,     61,      8,
-     211,     97,    105,    203,
-     255,     53,    107,     96,
-     215,    246,     61,    113,
-      87,    223,    239,     71,
-     128,     76,     26,    230,
-     173,    120,     68,     19,
-     217,    175,    140,     60,
-     250,     39,     97,    157,
-     200,      4,     50,    144,
-     160,     35,    245,    195,
-     138,    160,    222,     26,
-      76,    124,     76,      8,
-     236,    164,    114,     69,
-     242,     32,     80,    135,
-     207,    250,     46,    152,
-     105,     56,    246,    204,
-     102,    168,    192,     25,
-      78,    124,     93,     43,
-     241,    151,    152,     94,
-      17,     23,     65,    154,
-     166,    230,     41,    164,
-     104,     45,     18,    195,
-     150,    159,    195,     27,
-      34,    124,    174,     45,
-     252,    163,    151,     67,
-      12,    234,     68,    108,
-     169,    245,     12,     88,
-     113,     82,     17,    193,
-     177,    106,    202,    234,
-      44,    115,    150,    202,
-     244,    220,    177,    124,
-      48,    249,     70,    102,
-     182,    254,     15,     90,
-     130,     67,      5,    243,
-     187,    117,    187,    253,
-      62,     77,    157,     57,
-      10,    215,    133,    114,
-      56,    249,     63,    127,
-     191,    193,     27,     72,
-     134,     94,     11,    248,
-     189,    127,    185,    251,
-      59,     71,    129,    191,
-      26,    204,    135,    113,
-      46,      8,     53,    119,
-     129,    204,     28,     52,
-     112,     81,     61,    229,
-     169,    130,    160,    241,
-      56,     85,    144,    179,
-      29,    201,    133,     87,
-      33,     24,     44,     79,
-     180,    232,    224,     37,
-     108,    100,     58,    225,
-     214,    131,    175,    212,
-      12,     88,    105,    162,
-      18,    245,    151,     86,
-      88,     14,    217,     92,
-     148,    229,    233,     48,
-     108,    105,     58,     26,
-     221,    132,    158,    221,
-      29,     34,    103,    182,
-     220,    225,    165,    174,
-     109,      5,    234,     73,
-     151,    155,    205,     60,
-      78,    137,     58,     29,
-     197,    143,     97,    195,
-      16,     44,    114,    144,
-     215,    248,    223,    168,
-     117,     63,    252,     71,
-     109,    169,    197,      7,
-      68,    131,     79,      1,
-     195,    182,    116,    203,
-     237,     52,    121,    134,
-     200,    246,    212,    179,
-     120,      9,    224,    196,
-     101,    181,    253,     55,
-      95,    115,     74,     10,
-     245,    184,    127,    190,
-     227,     57,     65,    150,
-     194,      3,    202,    183,
-      64,     25,    234,    195,
-      98,    189,    247,     33,
-      89,    103,     81,     52,
-     243,    171,    140,    178,
-     230,      1,     78,    155,
-     177,     15,    204,    131,
-      72,     17,     27,    223,
-     108,    141,    234,     43,
-      37,    122,     92,     36,
-     235,    166,    133,     85,
-     241,      3,     84,    101,
-     191,    235,    249,    178,
-      80,    104,     19,    201,
-      84,    157,    224,    219,
-      41,    124,     97,     57,
-     237,    210,    154,    162,
-     202,     30,     93,     98,
-     166,    227,    243,    148,
-      92,     99,     12,    234,
-     171,    147,    163,    208,
-       9,     81,    151,     44,
-      16,    215,    148,    145,
-     216,     38,     45,    118,
-     181,     44,    225,    149,
-     167,    126,      6,    228,
-     177,    154,    160,    193,
-      54,     71,    117,     84,
-       4,    203,     94,    146,
-     220,    226,     38,     71,
-     157,     45,    229,    230,
-     145,    118,     43,    226,
-      78,    106,    179,    192,
-      10,     92,    118,     67,
-      10,    209,     86,    143,
-     222,    227,     53,     76,
-     148,     62,     37,    212,
-     190,    127,     34,    244,
-      45,    127,    133,    194,
-       3,     66,    139,     94,
-       1,    238,     78,    143,
-     165,    245,     57,     91,
-     114,     42,     23,    207,
-     186,    126,     58,      0,
-      58,    124,    131,    199,
-       7,    198,    135,     75,
-      50,    238,     66,     98,
-     170,    249,     15,     76,
-     113,     88,      8,    253,
-     187,    126,     53,    253,
-      62,    118,    129,    199,
-       0,    193,    134,    115,
-      44,     13,     44,    109,
-     183,    199,     30,    190,
-     155,     85,     56,    250,
-     189,    112,    188,    225,
-      61,     77,    158,    192,
-      11,    220,    133,     97,
-      50,     13,     43,    117,
-     191,    197,     11,    211,
-     156,     75,      1,    253,
-     185,    126,    191,    242,
-      11,     92,    128,     72,
-      31,    204,    180,    143,
-     194,    229,     51,    125,
-     143,    205,    246,    222,
-     143,     64,     60,    248,
-      64,    123,    188,    201,
-      27,     77,    141,     95,
-      15,    240,    169,    130,
-     165,    239,      7,     67,
-     147,     60,     23,    203,
-     135,    126,     60,    252,
-      54,    122,    181,    196,
-       8,    183,    157,     77,
-      12,    225,     78,    109,
-     175,    246,     11,     86,
-     136,     78,     27,    206,
-     187,     98,     59,    246,
-      34,    118,    137,     48,
-     253,    210,    134,     83,
-      42,      8,     78,    111,
-     182,    237,     26,     75,
-     118,     68,      2,    240,
-     166,    137,    179,    254,
-      63,     84,    145,     63,
-      22,    193,    138,     99,
-     208,      2,     44,    100,
-     170,    215,    240,    188,
-     138,     66,     19,    227,
-      72,    133,    185,    224,
-      39,     82,    114,     69,
-       6,    218,    164,    107,
-     206,    255,     55,    118,
-     154,    219,      6,    193,
-     138,     87,     36,    245,
-      65,    122,    175,    232,
-     231,     75,    124,     77,
-      23,    210,    173,    122,
-      58,    253,     40,     78,
-     147,    206,    253,    201,
-     104,    105,     44,    242,
-     198,    117,     88,    203,
-      23,     77,    126,     87,
-      31,    241,    186,    120,
-      64,    224,     39,     88,
-     135,    199,    241,    211,
-     158,    121,     61,      5,
-     206,    102,    148,    193,
-       0,     62,    136,     76,
-      39,    255,    190,    132,
-      78,    235,     29,     94,
-     129,    186,     23,    205,
-     175,    125,    192,    240,
-      33,    110,    158,    204,
-     243,    201,    146,    110,
-      41,    253,     61,    112,
-     163,    209,     17,     66,
-     142,     72,     23,    226,
-      86,    131,    170,    232,
-      45,    160,    114,    194,
-      12,     46,    149,    151,
-     206,      3,     60,    148,
-     161,     36,    253,    205,
-     128,    175,    219,      3,
-      67,    116,     73,     29,
-      31,    164,    135,     66,
-     240,     35,     94,    129,
-     198,    248,    221,    147,
-     105,     35,      2,     51,
-     102,    176,    222,     10,
-      68,    116,     86,    223,
-     227,    180,    129,    183,
-     225,     26,     83,    127,
-      74,      3,    211,    166,
-     111,    193,    240,     47,
-     101,    145,    204,      6,
-      57,    145,     95,     42,
-       9,     64,    112,     86,
-      24,    239,    187,    126,
-     180,     22,     22,    175,
-     115,    189,     13,     37,
-      89,    144,    196,    251,
-      53,     96,    155,    206,
-     241,    206,    155,     84,
-     208,     15,     75,    124,
-      87,    229,    233,    178,
-     128,     66,     23,    227,
-      85,    131,    186,    249,
-     215,    164,    107,     52,
-       3,    207,    103,    147,
-      45,      2,     49,    110,
-     162,     34,    246,    182,
-     141,     82,     24,     17,
-      78,    127,    178,     17,
-      39,     87,    138,    183,
-       1,     40,     86,    147,
-     196,      2,     51,    158,
-     104,    208,    247,     59,
-     137,     82,    216,    245,
-      72,    126,    169,    237,
-     237,     69,    134,     75,
-     225,    213,     85,    127,
-      54,    244,    219,     88,
-     101,     50,      2,    198,
-     102,     99,    217,     12,
-     192,    102,    164,    215,
-      26,    179,    127,     74,
-      29,    246,    191,    128,
-      73,    229,    223,     82,
-     130,     62,    249,    210,
-     101,    155,     49,    232,
-     201,    110,     96,     60,
-     246,    220,    136,     75,
-      46,     18,    177,    105,
-     180,    232,     17,    180,
-     146,     66,    229,     37,
-     160,    135,     44,    244,
-     195,    149,    110,     32,
-       2,    193,     98,    150,
-     215,     24,    197,    103,
-     163,    216,      1,    176,
-     123,     94,     30,    233,
-     189,    120,     80,    237,
-     216,     92,    128,    198,
-     247,    214,    106,    144,
-      51,     19,    205,     98,
-      87,     34,    253,    214,
-     140,     79,     39,    235,
-      73,    111,    186,    255,
-      27,     95,    150,     64,
-     252,    211,     91,    123,
-      54,      3,    198,    158,
-     113,     52,    251,    204,
-     124,    162,    192,      1,
-      80,    108,    175,    202,
-     232,     73,    136,     88,
-      29,    254,    164,    109,
-      74,     10,    220,     75,
-     148,    215,    241,     35,
-     124,    159,    218,      2,
-      59,    145,     77,     47,
-     232,    181,    145,     90,
-      24,    224,     69,    123,
-     166,    230,     20,     71,
-     143,    176,    241,    217,
-     162,     98,     61,     10,
-     198,    147,    106,     53,
-     241,     58,    107,    164,
-     214,      7,     76,    126,
-     164,    226,    232,    177,
-     117,     66,     31,    229,
-     175,    117,    190,     15,
-      45,     93,    144,    195,
-     254,     57,    100,    147,
-      47,    251,    199,    155,
-      95,     45,    245,     67,
-     135,    164,    230,     29,
-      74,    128,    180,     16,
-     223,    175,    116,     68,
-      15,     41,    164,    146,
-      54,    253,     49,    103,
-     152,    208,      0,     63,
-     112,    166,     33,     12,
-     185,    143,     82,     20,
-     227,    183,    130,    180,
-     239,     40,     85,    141,
-     194,     11,     41,    164,
-     106,     55,      2,    204,
-     149,     98,     47,    249,
-     193,    140,    167,    219,
-      19,     65,    126,    172,
-     229,     24,    176,    125,
-      68,     16,    222,    169,
-     141,     62,    244,     43,
-      96,    148,     53,    255,
-     202,    151,     97,     46,
-       8,    195,    141,    167,
-      35,     17,    185,    121,
-     177,    228,     24,    176,
-     132,     71,     16,     35,
-     166,    141,     60,      8,
-     211,    156,    150,     54,
-       0,     53,    104,    154,
-     215,     15,     60,    114,
-     168,     38,    239,    188,
-     129,     78,     24,     27,
-     173,    123,     68,     18,
-     219,    166,    140,    193,
-     251,     47,     99,    149,
-      50,    254,    203,    150,
-      94,     43,     10,    192,
-     116,     87,     32,    236,
-     183,    124,    179,    229,
-      29,     81,    135,     69,
-      15,    219,    165,    143,
-      59,    250,     47,     97,
-     153,     50,    253,    202,
-     108,     95,    214,    244,
-     190,    117,     84,     32,
-     235,    182,    126,    179,
-     234,     28,     81,    133,
-     189,    243,    216,     91,
-     110,     56,      4,    212,
-     154,    101,     48,    252,
-     199,    108,    162,    214,
-      13,     64,    116,    170,
-     225,     20,     74,    127,
-      74,     23,    226,    174,
-     117,     64,     13,     39,
-      93,    147,    196,    249,
-      49,    100,    154,    207,
-     251,     57,    110,     92,
-     216,    243,    188,    137,
-      81,     30,    233,     74,
-     129,    180,    234,     31,
-      84,    118,     65,    243,
-     215,     93,    146,     56,
-       3,    207,    153,    101,
-      47,      5,     58,    110,
-     165,    216,     14,    188,
-     134,     83,     28,    232,
-      76,    128,    183,    234,
-      32,    170,    117,     64,
-      11,     41,     94,    145,
-     201,    252,     50,    153,
-      98,     45,    248,    197,
-     112,    167,    219,     14,
-      68,    134,     80,     29,
-     230,    178,    125,    183,
-     236,     33,     86,    116,
-      63,     11,    212,    160,
-     107,    200,    254,     50,
-     105,     98,    210,    249,
-     195,    113,    166,    219,
-     239,     69,    122,     80,
-     228,    230,     78,    124,
-     184,    237,    221,     87,
-     115,     62,      9,    212,
-      96,    106,     53,      0,
-     203,    150,     97,    211,
-       8,     60,    115,    167,
-     220,    238,    185,    133,
-      78,     26,    229,     79,
-     123,     70,    238,    220,
-      88,    114,    194,    247,
-      44,     96,    151,    202,
-       1,     53,    149,     97,
-      42,    247,    192,    140,
-      87,     34,    237,    184,
-     131,    177,    230,     27,
-      81,    132,    187,    238,
-      36,     89,    113,     61,
-       6,    211,    156,    105,
-      51,    254,    201,    148,
-     160,    213,     10,     62,
-     117,    168,    220,     18,
-      72,    125,     77,     25,
-     226,    175,    120,     68,
-      15,    218,    165,    112,
-     196,    249,     46,     99,
-     153,    204,      3,     55,
-     108,     94,     41,    244,
-     190,    139,     84,     33,
-     235,    183,    129,     76,
-      23,     29,     82,    134,
-     189,    240,     38,     91,
-     144,     58,    250,    208,
-     100,    102,     49,    252,
-     199,    146,     93,     40,
-     243,    190,    118,    171,
-     225,     20,     74,    127,
-     180,    233,    225,    172,
-     119,     66,     13,    216,
-     163,    110,     57,      4,
-     207,    101,    154,    207,
-       4,     57,    110,    163,
-     216,     13,    189,    136,
-      83,     30,    232,    180,
-     127,     74,    234,    224,
-      84,    137,    190,    243,
-      40,     93,    146,    199,
-     252,    206,    153,    100,
-      47,    250,    197,    111,
-     164,    217,     14,     67,
-     120,    173,    227,     23,
-      76,    129,     73,     20,
-     223,    171,    116,     65,
-      10,    214,    161,    147,
-     200,    253,     51,    102,
-     157,    208,      6,     59,
-     112,     90,     37,    240,
-     187,    135,     81,     28,
-     231,     77,    125,    183,
-     236,     33,     86,    139,
-     193,    245,     42,     95,
-     107,    201,      0,    204,
-     151,     98,     45,    248,
-     195,    142,    166,    219,
-      16,     69,    122,    175,
-     228,     25,     78,    124,
-      71,     18,    221,    168,
-     115,     62,      9,    212,
-      96,    149,    202,    255,
-      52,    105,    158,    211,
-       8,     61,    141,     88,
-      35,    238,    185,    132,
-      79,     26,     26,     79,
-     132,    185,    238,     35,
-      88,    141,    194,    247,
-      44,    158,    105,     52,
-     255,    202,    149,     96,
-      43,    246,    193,    115,
-     168,    221,     18,     71,
-     124,    177,    230,     27,
-      80,    133,     69,     16,
-     219,    166,    113,     60,
-       7,    210,     98,    151,
-     204,      1,     54,    107,
-     160,    213,     10,     63,
-     116,     86,     33,    236,
-     183,    130,     77,     24,
-     227,    174,    121,    187,
-     240,     37,     90,    143,
-     196,    249,     46,     99,
-     152,    205,    253,    200,
-     147,     94,     41,    244,
-     191,    138,     85,    223,
-     235,     73,    126,    179,
-     232,    226,     82,    135,
-     188,    241,     38,     91,
-     111,     58,      5,    208,
-     100,    102,    206,      3,
-      56,    109,     93,    215,
-     243,     65,    118,     84,
-     224,     21,     74,    128,
-      75,     22,    225,    172,
-     119,     66,     13,     39,
-      92,    145,    198,      4,
-      48,    154,    101,     48,
-     251,    198,    145,     92,
-      39,     13,     66,    119,
-     172,    225,     22,     75,
-     128,    181,    234,     31,
-      84,    137,    190,     12,
-      40,    162,    109,     56,
-       3,     49,    153,    155,
-     208,      5,     58,    111,
-     164,    217,     14,     67,
-     135,    173,     29,    232,
-     179,    126,     73,     20,
-      32,     85,    117,     64,
-      11,     41,    161,    147,
-     200,      2,     50,    152,
-     156,    209,    249,    196,
-     143,     90,     37,    240,
-     187,    134,    174,    227,
-      24,     77,    130,    183,
-     236,     33,     86,    139,
-     192,     10,    213,    160,
-     148,     54,    254,     51,
-     151,    157,    210,      7,
-      60,    142,     89,     36,
-     239,    186,    133,     80,
-      27,     25,    177,    124,
-      71,     18,     34,     87,
-     140,    193,    246,     43,
-      96,    149,    202,    255,
-     203,    105,     97,     44,
-     247,    194,    141,     88,
-      35,    238,    185,    123,
-     176,    229,     26,     79,
-     132,    185,    238,     35,
-      88,    141,    194,      8,
-      44,    158,    105,     52,
-     255,    202,    149,    159,
-     212,      9,    193,    140,
-     168,     34,     18,     71,
-     131,     78,     25,     27,
-     174,    129,     69,     21,
-      39,    165,    112,    199,
-       6,     45,     98,    105,
-     204,      3,     54,    149,
-     161,     40,    245,     63,
-     137,    168,     33,    236,
-      75,    125,    178,    230,
-      28,     81,    121,    184,
-      11,    217,     90,    115,
-     197,    248,     46,     98,
-     152,    204,      2,     54,
-     147,     95,     41,    246,
-     191,    137,    175,    221,
-     238,     76,    130,     77,
-     235,    224,     83,    120,
-      66,     14,     39,     90,
-     111,    199,      4,    209,
-     103,    100,    207,      0,
-     193,    109,    162,     41,
-      13,     65,    119,     85,
-     224,     21,    180,    125,
-      73,     22,     31,    175,
-     138,     67,     13,     38,
-     163,    145,    198,    251,
-      48,    101,    154,     48,
-     250,     57,    145,     92,
-      39,    242,     66,    119,
-     172,    225,     22,    180,
-     128,     74,     21,     31,
-     170,    118,     65,    241,
-      40,    163,    146,     56,
-     252,    206,    102,    100,
-      47,    250,    196,    110,
-      91,     38,     15,    184,
-     124,    175,     30,     21,
-     178,    124,    182,     20,
-     223,     85,    117,     64,
-     245,     41,     94,    146,
-      54,      2,    205,    152,
-     157,     47,      6,     59,
-     112,    164,     36,     15,
-      69,    135,    174,     28,
-     229,     79,    125,     72,
-     237,    223,     86,    116,
-      62,    245,    213,    160,
-     148,     54,      1,     51,
-     104,     98,    210,      7,
-     195,    113,     89,     37,
-      16,    186,    133,    175,
-     228,     25,     78,    124,
-     184,     18,    220,     87,
-     141,     63,    246,     42,
-     159,    149,    202,      1,
-      52,    105,     97,    211,
-     247,     61,    141,     88,
-     220,     17,     70,    123,
-     176,     26,    229,     79,
-     122,    185,    238,    220,
-      88,    141,    194,      8,
-      44,     97,    105,    203,
-     255,    202,    106,     96,
-     212,    246,    193,    115,
-      87,    221,     18,    184,
-     124,     78,     25,     27,
-      80,    122,    186,    239,
-     219,     89,    142,     60,
-       7,     45,     98,    104,
-     204,    254,     54,    107,
-      95,     42,    245,     63,
-     116,     86,    222,     19,
-      72,    130,     77,     24,
-     227,     81,    121,     68,
-     240,    218,    165,    143,
-      59,      6,     46,    156,
-     152,     50,    253,     55,
-     147,     94,    214,    245,
-      64,    138,     85,    223,
-     235,     73,    129,    179,
-     232,    226,     82,    120,
-     188,    241,    217,    164,
-     111,     58,      5,    208,
-     100,    102,    206,      3,
-     199,    109,    162,     40,
-     243,    190,    118,    171,
-      31,     21,    181,    128,
-     180,     22,     30,    172,
-     119,    189,     13,    216,
-      92,    145,     57,    251,
-     207,    154,    154,     48,
-     251,     57,    110,     92,
-     216,     13,    189,    119,
-      83,     30,     22,    180,
-     128,     74,    234,     31,
-     171,    137,     65,     12,
-      40,    162,    146,     56,
-     252,     49,    153,    155,
-      47,      5,     58,    144,
-     164,     38,    241,     67,
-     135,    173,     29,    232,
-      76,    126,    182,    235,
-      32,    170,    138,    191,
-      11,     41,     94,    108,
-     200,    253,    205,    103,
-     156,     46,      6,    196,
-     143,     90,    218,    240,
-     187,    121,     81,    227,
-     231,     77,    125,     72,
-     236,    222,     86,    116,
-      63,    245,    213,     95,
-     148,     54,      1,     51,
-     151,     98,    210,    248,
-      60,    113,     89,    219,
-      16,    186,    122,     80,
-      27,     25,     78,    124,
-     184,     18,    221,     87,
-     115,     62,      9,     43,
-     159,    149,     53,    255,
-     203,    105,    158,     44,
-     247,    194,    141,    167,
-      35,     17,     70,    132,
-     176,     26,     26,     79,
-     123,    185,     17,    220,
-      88,    114,    194,    247,
-     211,     97,    150,     52,
-       0,     53,    106,    159,
-     212,    246,    193,    140,
-     168,     34,    237,     71,
-     131,     78,     25,    228,
-      80,    122,     69,     16,
-      36,     89,    142,    195,
-       7,     45,    157,    104,
-     204,    254,     54,    107,
-      95,    213,     10,     63,
-     139,    169,     33,    236,
-      72,    130,     77,    231,
-     227,     81,    121,     68,
-     240,    218,    165,    143,
-     196,    249,     46,     99,
-     152,     50,      2,    200,
-     147,    161,     41,    244,
-      64,    138,    170,    223,
-     235,     73,    129,    179,
-     232,     29,     82,    120,
-     188,     14,     38,     91,
-     111,    197,      5,    208,
-     100,    102,     49,    252,
-     199,    109,    162,    215,
-     243,    190,    118,     84,
-     224,     21,    181,    128,
-      75,     22,     30,     83,
-     119,     66,    242,    216,
-      92,    145,    198,    251,
-      48,    154,    154,     48,
-     251,     57,    145,    163,
-     216,    242,     66,    136,
-      83,    225,    233,     75,
-     128,     74,    234,     31,
-      84,    137,    190,     12,
-     215,     93,    146,    199,
-     252,     49,    153,    100,
-     208,    250,    197,    111,
-      91,     38,     14,     67,
-     120,    173,     29,     23,
-     179,    126,     73,     20,
-     223,    170,    117,    191,
-      11,    214,    161,    108,
-     200,      2,    205,    103,
-     156,    209,      6,    196,
-     143,    165,     37,    240,
-     187,    134,    174,    227,
-     231,    178,    125,     72,
-      19,    222,     86,    139,
-      63,    245,     42,     95,
-     148,     54,    254,     51,
-     104,    157,    210,      7,
-      60,    113,    166,    219,
-      16,    186,    122,    175,
-      27,     25,    177,    131,
-      71,    237,     34,     87,
-     140,    193,    246,     43,
-      96,    149,    202,    255,
-      52,    105,    158,    211,
-       8,     61,    114,    167,
-     220,     17,     70,    123,
-     176,    229,     26,     79,
-     132,    185,    238,     35,
-      88,    141,    194,    247,
-      44,     97,    150,    203,
-       0,     53,    106,    159,
-     212,      9,     62,    115,
-     168,    221,    237,     71,
-     131,     78,     25,    228,
-     175,    122,     69,     16,
-     219,    166,    113,    195,
-     248,    210,    157,    151,
-      51,    254,     54,    148,
-      95,     42,    245,     63,
-     139,    169,    222,     19,
-      72,    125,    178,    231,
-      28,     81,    134,    187,
-     240,     37,    165,    112,
-      59,      6,    209,    156,
-     103,     50,      2,     55,
-     147,     94,    214,    244,
-     191,    138,     85,    223,
-      20,     73,    126,     76,
-      23,    226,    173,    120,
-      67,     14,    217,    164,
-     111,     58,      5,    208,
-     100,    153,    206,      3,
-      56,    109,    162,    215,
-      12,     65,    118,    171,
-     224,     21,     74,    128,
-      75,     22,    225,    172,
-     119,     66,     13,    216,
-     163,    110,    198,    251,
-      48,    101,    154,    207,
-       4,     57,    110,    163,
-     216,    242,    189,    136,
-      82,     31,    232,    181,
-     126,     75,     21,    224,
-      84,    137,    191,    242,
-      41,     95,    144,    197,
-     253,     48,    103,    154,
-     208,    250,    197,    145,
-      89,     37,    242,    191,
-     132,     80,     28,    232,
-      76,    128,    183,    233,
-      35,     86,    137,    189,
-     246,     43,     95,    146,
-     200,      2,    204,    154,
-      96,     42,    253,    192,
-     139,     89,     39,    241,
-     187,    120,    172,    224,
-      28,     73,    134,    179,
-     232,     37,     85,    136,
-     194,    244,    213,    161,
-     104,     51,      7,    203,
-     144,    100,     40,    251,
-     194,    113,    167,    216,
-      20,     65,    126,    170,
-     225,     31,     72,    133,
-     190,    232,     33,     86,
-     114,     58,     15,    221,
-     148,    102,     62,     10,
-     204,    146,     96,    210,
-      11,     56,    117,    160,
-     218,     23,     64,    125,
-     182,    227,     28,     74,
-     128,    186,    239,    221,
-     163,    117,     55,      4,
-     222,    146,     98,     61,
-     249,    200,    107,    155,
-     211,      1,     55,    123,
-     175,    219,     20,     65,
-     122,    180,    227,     31,
-      83,    132,     68,     19,
-     221,    175,    125,     49,
-      10,    222,    151,    111,
-      48,      0,     51,     99,
-     170,    223,      3,     56,
-     113,    173,    218,     23,
-      76,    121,    177,    228,
-      30,     81,    120,     64,
-       8,    208,    169,    124,
-      48,     15,    215,    159,
-     152,    206,      5,     63,
-     100,    166,    211,      8,
-      65,    116,    168,    221,
-      23,     74,    125,    176,
-     234,     28,    173,    123,
-      69,      6,    211,    174,
-     102,     50,      3,    211,
-     100,    154,    203,      5,
-      61,    105,    160,    215,
-      12,     64,    117,    174,
-     230,     18,     77,    121,
-     177,    234,     30,    175,
-     113,     75,      7,    211,
-     169,    103,     62,      1,
-     205,    101,    152,    204,
-       7,     58,    108,    161,
-     219,      9,     71,    112,
-     164,    233,     30,     76,
-     134,    182,    234,    226,
-     174,    126,     72,      6,
-     221,    168,    101,     62,
-       7,    207,    153,    154,
-     210,      7,     56,    109,
-     167,    221,     11,     68,
-     127,    165,    234,     16,
-      73,    130,    183,     21,
-     219,    172,    124,     74,
-       1,    220,    168,    107,
-      50,      1,    204,    103,
-     158,    210,      2,     63,
-     116,    160,    223,      9,
-      67,    113,    166,    228,
-      30,     73,    128,     72,
-      16,    219,    174,    124,
-      54,      3,    221,    168,
-     109,     51,      2,    206,
-     151,    156,    209,      3,
-      56,    117,    162,    222,
-      21,     67,    124,    169,
-     225,     29,     77,    130,
-      71,     16,    222,    173,
-     117,     57,     14,    211,
-     153,    111,     49,      3,
-     201,    150,    158,    209,
-      11,     62,    113,    164,
-     216,     21,     67,    126,
-     181,    225,     30,     76,
-     134,    184,    238,    220,
-     165,    113,     57,     13,
-     214,    155,    109,     48,
-     251,    201,    150,     98,
-      42,    246,    193,    115,
-     169,    223,     16,     68,
-     120,    181,    226,     31,
-      84,    129,    190,    236,
-      39,     91,    142,     60,
-       5,    209,    153,    109,
-      54,    248,    207,    146,
-      89,     47,    241,    195,
-     138,     86,    222,     17,
-      75,    121,    183,    225,
-      26,     86,    128,    189,
-     246,     32,     94,    141,
-     197,      6,    211,    159,
-      99,     53,    245,    192,
-     155,     86,     46,    242,
-     186,    137,     85,    222,
-      23,     77,    123,    183,
-     236,     24,     87,    130,
-     185,    244,     35,     95,
-     147,    198,    248,     46,
-     154,     98,     54,    247,
-     205,    154,     91,     46,
-     246,    188,    118,    169,
-     228,     17,     73,    126,
-     181,    233,     30,     81,
-     139,    185,    244,     32,
-      91,    151,    194,    249,
-     207,    159,    108,     60,
-     245,    202,    150,     88,
-      37,     12,     71,    113,
-     171,    230,     18,     75,
-     125,     78,     17,    225,
-      87,    129,    180,    255,
-      37,     87,    150,     57,
-       4,    193,    140,    124,
-      57,    246,    198,    108,
-     173,    200,     29,     81,
-     118,    171,     30,    228,
-     161,    111,     67,     21,
-      39,     69,    156,    168,
-     224,     34,     94,     98,
-      45,     38,    238,    129,
-     109,     44,     13,     34,
-     111,    186,    193,      0,
-      69,    136,     72,      6,
-     241,    185,    128,    184,
-     244,     60,     76,    155,
-     194,     26,    244,    140,
-      67,     40,     16,    206,
-     103,    189,    250,     47,
-      30,    101,    167,     54,
-     241,    165,    158,     95,
-     228,      9,     84,    156,
-     165,    254,     33,    185,
-      80,     16,     35,    203,
-     142,    104,    219,    220,
-      30,     67,    189,    198,
-       8,    209,    147,     70,
-      59,    226,     71,    116,
-     169,    248,      2,     66,
-     120,     81,     54,    241,
-     129,    107,     55,    244,
-      56,     66,    191,    236,
-      30,     56,    147,    117,
-      55,    237,    211,    136,
-     162,    200,      9,     90,
-     106,    184,     18,    251,
-     130,     84,    102,      4,
-     222,     81,    151,    229,
-     211,      8,    116,    146,
-      63,    228,    214,    136,
-      81,    215,      5,     39,
-     107,    182,    203,     16,
-     164,    166,     98,     52,
-     195,    190,    134,    171,
-     239,     12,    112,    174,
-     212,      5,    196,    130,
-      71,     41,    241,     49,
-     120,    189,    246,     22,
-      82,    139,     77,      9,
-     196,    144,    153,     68,
-     237,      8,    118,    171,
-     149,    234,     46,    174,
-     118,     26,     37,    198,
-     158,    144,    219,     25,
-      37,    116,    174,     32,
-     237,    146,    162,     74,
-      17,    234,     65,    102,
-     146,    194,     58,     64,
-     118,     80,     16,    199,
-     191,    127,     57,    244,
-      40,    126,    131,    221,
-       1,    201,    179,    113,
-       1,    231,    190,    127,
-     189,    252,     49,     97,
-     159,    191,     31,    251,
-     180,    107,     86,      7,
-      43,     79,    136,    220,
-     233,     58,    157,    124,
-       7,    214,    218,    156,
-     160,    215,     24,     99,
-      80,    138,    250,     22,
-     167,     94,    105,     13,
-     208,    169,    131,    170,
-     239,     51,     78,    145,
-      57,     29,    231,    191,
-     116,     45,     10,     46,
-     107,    135,    252,     46,
-      84,    129,     74,     62,
-     250,    163,    123,    180,
-     231,     53,     79,    158,
-     201,     12,    205,    133,
-      76,     45,     11,     54,
-     102,    139,    207,     37,
-      28,    100,    164,     53,
-     243,    166,    150,     86,
-     224,     19,     65,    145,
-     170,    224,    221,    185,
-      82,     24,     21,    222,
-     101,    155,    216,    233,
-      47,    117,    139,    214,
-     249,    217,    144,     76,
-      38,     23,     74,    118,
-     190,    232,     16,     78,
-     118,     88,     55,    195,
-     171,    132,    214,    226,
-      56,    119,    143,    221,
-       9,    192,    143,    127,
-      61,    241,     57,    124,
-     184,    208,     30,     78,
-     120,     70,      0,    194,
-     138,    110,    185,    249,
-      62,     79,    156,    215,
-     237,     34,    159,    126,
-      18,    227,    196,    111,
-     175,    197,      7,     54,
-     114,    173,     37,    255,
-     149,    164,     84,     25,
-       8,     76,    159,    170,
-     255,     52,     74,    138,
-      54,     26,    207,    142,
-     153,    194,     16,     58,
-     105,    160,     41,    247,
-     178,    144,    119,     59,
-     236,     88,     97,    173,
-     252,     22,     88,    140,
-     180,     10,    205,    184,
-     123,     56,    244,     59,
-     107,    156,     53,    251,
-     206,    156,     74,     54,
-     233,    182,    121,    139,
-     194,     12,     70,    122,
-     177,    236,    227,    163,
-     111,     81,     14,     41,
-      74,    131,    192,      1,
-     195,    149,    119,     39,
-     231,    222,    152,    175,
-     199,     40,     95,    120,
-     168,    225,     23,    181,
-     119,     90,      5,    228,
-      95,    159,    173,    244,
-     208,    178,    126,     44,
-      21,    215,    143,    110,
-     216,     31,     25,    112,
-     182,    221,    243,    190,
-     134,     81,     21,    226,
-     176,    136,    165,    249,
-      40,    172,    103,     86,
-      29,    192,    180,    125,
-      49,    244,     42,     71,
-     128,    193,      5,    193,
-     137,     94,     39,    243,
-     184,    121,    166,    236,
-       8,     74,    123,     90,
-      11,    199,    191,    103,
-      49,     14,     35,     73,
-     136,    208,    241,     49,
-     146,    100,     41,    249,
-     195,    113,    165,    210,
-      30,     72,    127,     86,
-      10,    241,    166,    105,
-      85,     31,    222,     94,
-     153,    218,    225,     37,
-      98,    110,     51,      4,
-     202,    105,    156,    215,
-       0,     54,    120,    163,
-      37,    254,    175,    146,
-      91,     11,    238,    177,
-     141,    170,    246,     55,
-      83,    140,     56,     13,
-     209,     97,    149,    206,
-       7,     63,     96,    152,
-     212,    254,    209,    153,
-      65,     54,    255,    180,
-     129,    184,    245,     12,
-      67,    143,    186,     21,
-     222,    167,    143,    199,
-     254,     42,    107,    158,
-     201,    252,    195,    132,
-      77,     59,    231,    209,
-     129,    168,    208,      5,
-      92,    118,    178,     30,
-     229,    175,    130,    179,
-     251,     41,     86,    131,
-     195,      7,    218,    142,
-     115,     35,    242,    199,
-     157,     88,    208,     24,
-      88,    100,    169,     41,
-     231,    177,    124,    187,
-     227,     16,     92,    136,
-     177,    244,    223,    180,
-     121,     44,     23,    222,
-     150,    108,     48,      8,
-      46,    122,    174,     43,
-     253,    176,    143,    175,
-     235,     24,     69,    109,
-     160,    249,     27,    164,
-      99,     88,     21,    203,
-     179,     97,     51,    250,
-      32,    124,    141,    197,
-     254,    200,    159,     89,
-     220,      7,     79,    103,
-     184,    244,      6,     72,
-     116,     92,     15,    247,
-     185,    103,     81,      4,
-      45,     78,    139,    212,
-     248,    199,    151,    110,
-      47,      3,     48,     98,
-     181,    204,     26,     72,
-     133,     92,     10,    240,
-     166,    108,     91,     27,
-     221,     88,    146,    168,
-     254,    211,    175,     97,
-      50,    254,     53,    109,
-     146,    196,     30,     47,
-     119,     93,     54,    233,
-     163,    144,     68,      8,
-     239,     71,    154,    171,
-     255,     32,    164,    100,
-      52,      8,     41,     89,
-     158,    218,    229,     40,
-     122,    156,     35,    224,
-     217,    151,     64,     62,
-     255,     65,    109,    143,
-     254,     17,    185,    115,
-      75,     22,    221,    168,
-     136,    207,    237,     11,
-     121,    157,     61,     21,
-     209,    140,    125,     51,
-     239,    193,     97,    134,
-     194,     30,    186,    136,
-      68,     31,    231,    179,
-     123,    179,    247,      0,
-      71,    131,     57,     27,
-     201,    133,    119,     22,
-     226,    194,    100,    128,
-     244,     26,     63,    139,
-      95,     39,    232,    176,
-     133,    183,    255,     63,
-     113,    151,     69,     31,
-     204,    188,    110,     26,
-      38,    222,    110,    139,
-     208,     16,     50,    148,
-      95,     40,    242,    206,
-     128,    173,    196,     53,
-     106,    110,    179,     19,
-     241,    185,    102,     99,
-      16,    208,     80,    154,
-     215,    243,     42,    101,
-     159,    206,    245,    219,
-     157,    165,    205,     47,
-      93,    123,    170,     41,
-     228,    162,    158,    105,
-       0,    225,     88,    138,
-     186,    241,     35,     85,
-     159,    192,     15,    195,
-     144,    144,    212,     29,
-      47,     97,    162,     47,
-     253,    166,    168,     77,
-      25,     19,     77,    128,
-      76,     18,     23,     65,
-     135,    188,      7,    210,
-      92,    156,    213,    233,
-      63,    108,    101,     58,
-     238,    217,    137,     95,
-     209,     10,    190,    133,
-      94,     30,     31,     64,
-     133,    181,    235,     24,
-      88,    130,    181,    254,
-      37,     88,    106,     44,
-      28,    216,    102,    150,
-     219,      5,    207,    155,
-      94,     36,    242,    191,
-     120,    164,    243,      7,
-      70,    134,    188,    231,
-      38,    175,     96,     95,
-      31,     41,     85,    154,
-     202,      6,    206,    154,
-     100,     32,    246,    194,
-     119,    183,    201,      0,
-      73,    117,    165,    230,
-     227,    161,    102,     70,
-     238,     38,     82,    138,
-     193,    241,     41,    165,
-     123,     34,     12,    204,
-      98,    147,    221,     22,
-      45,    124,    163,     32,
-     252,    172,    130,    171,
-     231,    228,    178,    131,
-     176,    235,    223,    164,
-      99,     50,     15,     43,
-     101,    153,    219,    239,
-      63,    111,    101,     60,
-     252,     61,    119,    166,
-      33,    237,     70,    126,
-     179,     25,    226,    184,
-     115,     64,     21,    220,
-      80,    128,    206,    255,
-      47,    150,     96,    203,
-       5,     54,    106,     96,
-     212,     13,     63,    142,
-      81,     37,    235,    188,
-     135,     72,     27,     31,
-      89,    140,    188,     18,
-     221,    167,    140,    194,
-       7,     44,    102,    159,
-     203,      3,    203,    156,
-      84,     45,    241,    197,
-     143,     86,    217,     31,
-      69,    123,     76,     29,
-     234,    164,    113,     64,
-     240,     34,     86,    129,
-     200,    252,    211,    154,
-      97,     53,    250,    207,
-     144,    160,    208,     15,
-     191,    136,     83,     40,
-     236,    181,    129,    176,
-     239,     16,     67,    137,
-     187,    240,    219,    163,
-     102,     48,     12,    213,
-     155,    152,     49,    252,
-     198,    144,     94,     41,
-      12,     64,    116,    174,
-     233,     31,     66,    122,
-     183,     20,    230,    164,
-     127,     71,     15,    216,
-     162,    145,     57,      7,
-     202,    158,    100,     48,
-     251,     57,    106,    166,
-     221,     11,     74,    112,
-     175,    225,    232,    182,
-     124,     79,     19,    228,
-     168,    117,     66,     13,
-      41,     95,    144,    197,
-     254,     49,    152,    155,
-     213,      3,     63,    106,
-     160,    216,    240,    184,
-     128,     84,     24,    238,
-     183,    126,    182,     20,
-      33,     86,    137,    189,
-      10,    212,    161,    146,
-     202,    249,     55,    101,
-      99,     44,    250,    197,
-     141,     88,     37,     14,
-      68,    121,    175,     28,
-     231,    179,    127,     72,
-     236,     32,     84,    136,
-     192,     11,    214,    164,
-     105,     54,    255,     55,
-     110,    153,    208,      5,
-      60,    140,     92,     33,
-     234,    190,    132,    172,
-     225,     26,    177,    120,
-      65,     23,    217,    169,
-     143,    201,    252,     33,
-     106,    157,    203,      4,
-     206,    144,    105,     37,
-     243,     61,    115,     88,
-      33,    237,    186,    128,
-      76,    229,     25,     75,
-     140,    183,    227,     36,
-      90,    115,     57,     13,
-     213,    152,    108,     51,
-     246,    204,    148,     97,
-      40,      8,     59,    119,
-     171,    219,     26,     65,
-     120,    181,    228,    228,
-     172,    123,     69,     19,
-     220,    175,    119,     58,
-       2,     45,    103,    147,
-     200,      9,     62,    111,
-      95,     40,    246,    196,
-     136,    169,    220,    236,
-     180,    125,    177,     25,
-     224,    174,    135,     68,
-     241,     32,     95,    141,
-      59,      7,    210,    155,
-     111,     54,    255,    203,
-     146,    165,    208,     13,
-      72,    124,    175,    223,
-     235,     73,    128,     74,
-      31,    229,    171,    126,
-      64,     12,    221,    160,
-     146,    194,    242,     35,
-     105,    147,    198,      4,
-      60,    147,     85,     36,
-     254,    176,    132,     92,
-      25,    236,    183,    121,
-     190,    229,     16,     92,
-     132,    183,    251,     34,
-     162,    102,     50,      9,
-     192,    149,    105,     60,
-     246,    192,    108,    171,
-     214,     24,     85,     98,
-     191,    238,     30,    181,
-     117,     69,      6,    244,
-     186,    121,     81,      3,
-     208,    162,    145,    205,
-     238,     36,    115,    141,
-     196,      8,     56,    149,
-      81,     54,    228,    175,
-     150,     65,     13,    238,
-      76,    132,    189,    251,
-      49,     68,    152,    175,
-     254,     43,    163,    106,
-      60,     15,    193,    150,
-     115,     34,    255,    196,
-     118,    169,    212,     31,
-      84,    119,    167,    227,
-     225,    184,    112,     68,
-      26,    212,    162,    124,
-      60,    247,     45,     84,
-     154,    198,    240,     62,
-      98,    156,     42,    244,
-     204,    158,     86,     52,
-     255,    176,    134,    172,
-     239,      8,     90,    150,
-     173,    255,     46,     85,
-     117,     53,      7,    196,
-     143,    123,     36,     14,
-     193,    147,    156,    217,
-      25,     40,    106,    176,
-     206,     24,     70,    130,
-      66,     10,    245,    161,
-     107,     75,     24,    217,
-      89,    138,    201,    249,
-      60,    110,    155,    195,
-       2,    207,    159,    106,
-      32,    250,    202,    132,
-      81,     33,     22,     77,
-     113,    191,    246,     21,
-      89,    132,     65,     29,
-     200,    182,    124,     48,
-       0,    211,    157,    147,
-     199,     17,     38,    121,
-     177,    222,     15,    193,
-     130,     71,     50,    248,
-     164,    146,     64,     16,
-     227,     86,    136,    174,
-     233,     60,     66,    156,
-     206,      6,    219,    143,
-     126,     43,    235,    217,
-     159,     89,     40,     14,
-      77,     97,    178,    198,
-       3,     88,    118,     77,
-      29,    243,    187,    110,
-      80,      1,    211,    167,
-     145,    195,    241,     32,
-     116,    150,    195,      4,
-      56,    150,     84,     37,
-     254,    181,    128,     81,
-      30,     20,     78,    119,
-     191,    229,     18,     89,
-     141,     66,     11,    212,
-     172,    126,     55,     14,
-     203,    103,    146,    193,
-      20,     41,     97,    174,
-     208,     12,    190,    129,
-      92,     12,    251,    166,
-     111,     67,     21,     26,
-      88,    155,    170,    224,
-      58,     82,    154,    198,
-       6,    194,    136,    119,
-      60,    233,    203,    151,
-      91,    220,      5,     77,
-     104,    189,    242,     27,
-      74,    129,     77,     29,
-     212,    167,    123,     75,
-      12,    212,     92,    148,
-     193,    247,     57,    109,
-     154,    210,    249,    193,
-     135,     82,     47,    250,
-     188,    130,     81,    224,
-      31,     68,    136,    189,
-     228,     37,     87,    118,
-      56,      3,    223,    171,
-      96,     62,      5,    205,
-     107,    149,    216,     12,
-      55,    120,    160,    217,
-     239,    190,    131,     88,
-      18,    239,    182,    122,
-      68,    236,     38,     81,
-     132,    200,    241,     46,
-      99,    149,     52,      1,
-     201,    146,    101,     40,
-     243,    192,    140,     88,
-     222,     21,     66,    120,
-     177,    229,    228,    177,
-     121,     68,     19,    221,
-     167,    141,    195,    246,
-      45,     96,    150,    203,
-       0,    202,    149,     96,
-      43,    247,    192,    142,
-      86,     34,     18,     70,
-     126,    179,    228,     26,
-      81,    122,     69,     16,
-     219,    166,    142,     60,
-       7,    210,    157,    104,
-      51,    254,    200,    149,
-      94,     42,    245,     63,
-     117,    168,    220,     17,
-      74,    127,    179,    230,
-      28,    175,    123,     64,
-      11,    222,    166,    114,
-      58,    249,     47,     96,
-     156,    200,      7,     51,
-     111,    160,    214,    245,
-     189,    137,     81,     36,
-     239,    181,    131,     77,
-     232,     28,     80,    132,
-     184,    242,     36,     90,
-     144,     58,      4,    209,
-     153,    100,     51,    253,
-     199,    109,    162,    214,
-      14,     67,    116,    170,
-     224,    234,    180,    129,
-      74,     23,    224,    173,
-     119,    189,    243,     38,
-      94,    147,    196,    250,
-      49,    101,    101,     49,
-     249,    197,    147,     94,
-      38,    242,     66,    119,
-     173,    227,     20,     73,
-     129,    180,     21,    224,
-     170,    116,     67,     14,
-     214,    162,    146,    199,
-     253,     48,    103,    155,
-     208,      5,    197,    144,
-     164,    217,     14,     67,
-     120,     82,     29,    232,
-     179,    129,    182,    235,
-      32,    170,    117,     65,
-      11,    214,    161,    108,
-      55,      2,    205,    103,
-     156,    208,      7,     58,
-     113,    164,    218,    240,
-     186,    135,     80,     29,
-     230,    179,    124,     72,
-      19,    222,     86,    138,
-     193,    244,     43,     94,
-     148,     54,      1,    204,
-     151,     98,     45,      7,
-     195,    142,     89,     36,
-     239,     69,    122,    175,
-     228,     25,     78,    131,
-      71,     18,    221,    168,
-     115,     62,      9,    212,
-     159,    106,     53,      0,
-     203,    150,     97,     44,
-       8,     61,    114,    167,
-     220,     17,     70,    123,
-      79,     26,    229,    176,
-     122,     71,     17,    220,
-     167,    141,    195,    246,
-      45,     96,    151,    203,
-       0,     53,    149,     97,
-      42,    247,    192,    141,
-      86,     34,     18,     70,
-     126,    179,    228,     26,
-      81,    133,    186,     16,
-     219,    167,    115,     62,
-       6,    211,    156,    104,
-     204,      1,     55,    106,
-     161,    212,     11,     63,
-     139,     86,     32,    237,
-     182,    128,     76,     25,
-     227,     81,    135,    185,
-     242,     39,     88,    141,
-     197,    249,    209,    157,
-     101,     48,    255,    202,
-     146,     95,     41,     11,
-      65,    116,    171,    222,
-      21,     72,    126,    179,
-      23,    227,    172,    121,
-      65,     15,    216,    165,
-     111,    197,    251,     45,
-     102,    155,    204,      2,
-      56,    146,     92,     41,
-     242,    188,    136,     85,
-      31,     21,     74,    126,
-     181,    232,     31,     83,
-     136,    189,    242,    216,
-     163,    110,     57,      4,
-     206,    154,    101,     48,
-     251,     57,    110,    163,
-     216,     13,     66,    136,
-      83,     30,    233,    180,
-     127,     74,     21,    224,
-      84,    137,    190,    243,
-      40,     93,    146,     56,
-       3,    206,    153,    100,
-      47,    250,    197,    111,
-     164,    217,     14,     67,
-     120,    173,    226,     23,
-      76,    126,     73,     20,
-     223,    171,    116,     65,
-      11,    214,     94,    147,
-     200,    252,     51,    103,
-     156,    209,    249,    196,
-     143,     90,     36,    240,
-     187,    134,     81,     28,
-      24,     77,    130,    183,
-     236,     33,     86,    139,
-     192,     10,    213,    160,
-     107,     54,      1,    204,
-     151,     98,     45,    248,
-      60,    113,    166,    219,
-      16,     69,    122,    175,
-     228,    230,    177,    124,
-      71,     18,    221,    168,
-     115,     62,      9,    212,
-      96,    149,    202,    255,
-     203,    150,     97,     44,
-     247,    194,    141,     88,
-      35,    238,    185,    123,
-     176,    229,     26,     79,
-     132,    185,    238,     35,
-     167,    114,     61,      8,
-     211,    158,    105,     52,
-     255,    202,    149,    159,
-     212,      9,     62,    115,
-     168,    221,    237,    184,
-     131,     78,     25,    228,
-     175,    122,     69,    239,
-      36,     89,    142,    195,
-     248,     45,     98,    151,
-     204,    254,    201,    148,
-      95,     42,    245,    192,
-     116,    169,    222,     19,
-      72,    125,    178,    231,
-     227,    174,    121,     68,
-      15,    218,    165,    112,
-      59,    249,     46,     99,
-     152,    205,      2,     55,
-     108,     94,     41,    244,
-     191,    138,     85,     32,
-     235,     73,    126,    179,
-     232,     29,     82,    135,
-      67,     14,    217,    164,
-     111,     58,      5,    208,
-     155,    153,    206,      3,
-      56,    109,    162,    215,
-      12,     65,    118,     84,
-      31,    234,    181,    128,
-      75,     22,     30,     83,
-     136,    189,    242,     39,
-     163,    110,     57,      4,
-     207,    154,    101,     48,
-     251,     57,    110,    163,
-     216,     13,     66,    119,
-     172,    225,     22,     75,
-     127,     74,     21,    224,
-     171,    118,     65,    243,
-     215,     93,    146,    199,
-     252,     49,    102,    155,
-     208,      5,    197,    144,
-      91,     38,    241,    188,
-     135,    173,    226,     23,
-      76,    129,    182,     20,
-      32,     85,    117,    191,
-     244,     41,    161,    108,
-      55,      2,    205,    152,
-      99,     46,    249,     59,
-     112,    165,    218,     15,
-      68,    134,     81,     28,
-      24,     77,    125,    183,
-     236,     33,     86,    139,
-     192,    245,     42,     95,
-     148,    201,    254,     51,
-     151,     98,     45,    248,
-     195,    142,     89,     36,
-     239,    186,    133,     80,
-      27,    230,     78,    131,
-     184,    237,     34,    168,
-     115,     62,      9,    212,
-     159,    106,     53,    255,
-      52,    105,    158,    211,
-       8,     61,    114,    167,
-     220,     17,     70,    123,
-     176,     26,    229,    176,
-     132,    185,    238,     35,
-      88,    141,    194,    247,
-      44,    158,    150,    203,
-     255,    202,    149,     96,
-      43,    246,    193,    140,
-      87,     34,    237,    184,
-     131,     78,     25,    228,
-      80,    133,    186,    239,
-      36,     89,    142,    195,
-     248,     45,     98,    151,
-     204,      1,     54,    107,
-     160,    213,     10,     63,
-     116,     86,     33,    236,
-     183,    130,     77,     24,
-     227,     81,    134,     68,
-      15,    218,    165,    112,
-      59,      6,    209,    156,
-     103,     50,    253,    200,
-     108,    161,    214,     11,
-      64,    117,    170,    223,
-      20,     73,    126,    179,
-     232,    226,     82,    120,
-      67,    241,    217,    164,
-     111,     58,      5,    208,
-     155,    102,     49,      3,
-      56,    109,    162,     40,
-      12,    190,    137,     84,
-      31,    234,    181,    128,
-      75,    233,    225,    172,
-     136,     66,    242,    216,
-      92,    145,    198,    251,
-      48,    101,    154,    207,
-       4,    198,    110,     92,
-     216,     13,    189,    136,
-      83,     30,    233,     75,
-     127,     74,     21,     31,
-      84,    137,     65,     12,
-     215,    162,    109,     56,
-     252,     49,    102,    155,
-     208,      5,     58,    111,
-     164,    217,     14,     67,
-     120,     82,     29,    232,
-     179,    129,     73,     20,
-      32,     85,    138,    191,
-     244,     41,     94,    147,
-      55,      2,    205,    152,
-     156,    209,      6,     59,
-     112,     90,     37,    240,
-     187,    134,     81,     28,
-      24,     77,    125,     72,
-     236,    222,    169,    116,
-      63,    245,     42,    160,
-     107,     54,    254,     51,
-     151,     98,    210,    248,
-      60,    142,    166,     37,
-      16,     64,    132,     82,
-      25,     26,     79,    127,
-      71,     19,    221,    169,
-     141,    195,      8,    212,
-      96,    149,    200,    250,
-      53,    147,    103,     47,
-     247,    194,    141,    164,
-     223,     16,    185,    121,
-     178,    229,     25,    176,
-     127,     67,     18,    221,
-     167,    140,    195,    246,
-      45,     96,    149,    201,
-       0,    202,    148,     97,
-      43,    246,    193,    140,
-     168,     34,    237,     71,
-     125,    177,     25,    228,
-      80,    133,     69,     16,
-      36,     89,    142,     60,
-       7,     45,    157,    104,
-      50,    254,    200,    148,
-     160,    213,     11,     63,
-     116,    169,    222,     18,
-     183,    128,     76,     24,
-     226,    174,    121,    187,
-     241,     36,     91,    143,
-      59,    249,     46,     99,
-     103,     50,    252,    201,
-     146,     94,     41,     11,
-      65,    117,    171,    222,
-     235,    182,    129,     77,
-      23,    227,    172,    135,
-     188,    240,     38,     91,
-     145,    197,    250,    209,
-     155,    153,    206,    252,
-     199,    146,    162,    215,
-      12,     65,    118,     84,
-      31,    234,    181,    128,
-     180,    233,    225,     83,
-     136,     66,     13,    216,
-      92,    145,    198,    251,
-      48,    154,    154,     48,
-     251,    198,    145,    163,
-      39,    242,    189,    136,
-     172,    225,     22,     75,
-     128,     74,    234,    224,
-     171,    118,     65,     12,
-     215,    162,    146,    199,
-     252,     49,    102,    155,
-     208,      5,     59,    110,
-     165,    216,     15,     67,
-     120,     83,     31,    234,
-     176,    122,     77,     23,
-     221,    170,    138,    188,
-     241,     46,     86,    155,
-     207,    248,     48,    152,
-     103,     38,    240,    205,
-     134,     93,     32,    244,
-      68,    123,    173,    228,
-      30,     75,    132,    180,
-     238,     32,    169,    116,
-      59,     14,    214,    162,
-     148,    203,    251,     49,
-     104,     96,     46,    248,
-     199,    141,     91,     32,
-     238,    186,    122,    173,
-     229,     25,    179,    124,
-      71,    239,     37,     95,
-     129,    207,    253,     34,
-      99,    111,     57,     13,
-     223,    130,    113,     35,
-     241,     63,    117,    169,
-     204,     30,     77,    125,
-     178,    229,    228,    179,
-     132,    186,    234,     38,
-      90,    141,     62,      3,
-     219,    145,    120,     57,
-     241,    207,    107,    151,
-     196,      6,     49,    121,
-     172,    220,    239,     71,
-     130,     78,    226,     31,
-      86,    134,    186,     21,
-     211,    175,     97,     50,
-       9,    222,    158,    150,
-     196,     13,     58,     96,
-     167,    208,      8,     60,
-     112,    171,    217,     21,
-      78,    121,     76,     30,
-     232,    165,    104,     86,
-       1,    215,    160,    143,
-     194,    245,     34,    111,
-     145,    197,      5,     50,
-     107,    164,    208,     12,
-      68,    119,     81,     43,
-     231,    185,    146,     92,
-      24,    233,    169,    134,
-     180,    253,     43,     80,
-     150,    192,    249,     43,
-      99,    159,    196,     10,
-      63,    104,     92,     33,
-     254,    174,    156,     71,
-      13,    228,    179,    127,
-     189,    231,     17,     94,
-     129,    186,    246,     34,
-      91,    151,    204,    242,
-      56,     96,    103,     58,
-     244,    212,    135,     73,
-      53,    252,    184,    117,
-     166,    241,      7,     68,
-     137,    176,    235,     31,
-      87,    139,    185,    251,
-      32,     85,    147,     60,
-       9,    195,    141,    112,
-      59,    235,    204,    145,
-     163,    212,      1,     76,
-     113,    170,    225,     20,
-      74,    133,    191,    224,
-      42,     92,    136,     68,
-       0,    217,    180,    123,
-      33,     22,    193,    156,
-     152,    220,     22,     43,
-     124,    173,    223,     11,
-      67,    124,    167,    232,
-      17,     71,    134,     74,
-      25,    208,    189,     99,
-      41,     28,    218,    167,
-     149,    195,    241,     60,
-     101,    151,    212,      1,
-      52,    118,    172,    215,
-      27,     78,    127,     80,
-      18,    233,    162,    101,
-      94,     10,    201,    162,
-     113,    198,    248,     59,
-     111,    153,    195,    248,
-      61,     96,    151,    216,
-       2,     55,    119,     88,
-      36,    224,    168,    156,
-      86,     13,    240,    188,
-     127,    188,    224,     51,
-      87,    128,    200,    255,
-      37,    104,    159,    192,
-      11,     63,    109,    157,
-      40,    251,    209,    152,
-      77,     53,    245,    169,
-     139,     78,    236,     21,
-      64,    138,    177,    231,
-      35,     81,    134,    202,
-     243,     39,    107,    145,
-     205,    249,    199,    133,
-      69,     48,    236,    214,
-     135,     82,    216,     30,
-      71,    109,    190,    236,
-      20,     89,    140,    179,
-     252,     46,     80,    134,
-     199,      7,    218,    140,
-     114,     46,    228,    209,
-     129,     87,     41,      0,
-      78,    100,    186,    211,
-      31,     78,    117,    186,
-     224,     17,     90,    142,
-     185,    241,    220,    180,
-     126,     32,     24,    201,
-     131,    107,     52,      7,
-      55,    124,    182,    199,
-       1,     74,    127,    160,
-     233,     30,     65,    119,
-     189,    235,    224,    160,
-      99,     84,     18,    196,
-     185,    120,     48,      5,
-      58,    116,    137,    219,
-      20,     52,    103,    170,
-     210,     10,     72,    126,
-     164,    231,     22,    176,
-     111,     94,     12,    255,
-     178,    110,     78,      9,
-      42,     83,    128,    210,
-     232,     33,    107,    146,
-     218,     12,     60,    102,
-     163,    222,     10,    189,
-     143,     65,      8,    244,
-     174,    102,     94,     31,
-     221,     83,    155,    172,
-     226,     61,     78,    159,
-     207,    247,     52,     97,
-     148,    212,      0,     59,
-     139,     87,     50,    231,
-     165,    156,     71,     14,
-     226,     76,    137,    163,
-     249,     54,     68,    132,
-     202,    253,     32,     90,
-     156,    193,    251,     53,
-     150,    100,     60,    224,
-     218,    145,     64,     49,
-     224,    185,    120,    161,
-     240,     15,     89,    146,
-     182,    229,     42,     95,
-     136,    201,    240,     46,
-      98,    111,     60,     21,
-     211,    140,    127,     58,
-     228,    200,    114,    160,
-     206,      4,     81,    109,
-     191,    233,     28,     71,
-     131,    189,    231,     38,
-      93,    140,     59,      4,
-     202,    137,    114,     40,
-     236,    216,    147,    158,
-     221,     29,     45,    100,
-     187,    211,     25,     66,
-     118,    183,    224,     17,
-      84,    128,     71,     24,
-     212,    188,    102,     33,
-      30,    192,    141,    107,
-     206,     13,     34,    127,
-     184,    199,      4,     54,
-     114,    163,    219,     27,
-      65,    121,    177,     29,
-     233,    186,     99,     92,
-      18,    204,    180,    124,
-      59,    252,     33,    119,
-     142,    219,     13,     58,
-     106,    166,    223,     15,
-      74,    115,    174,    222,
-     227,    189,    150,     85,
-      15,    255,    190,    105,
-      75,    240,     33,     73,
-     131,    211,    238,     34,
-     104,    159,    199,     11,
-      63,    102,    167,    211,
-     242,    183,    135,     78,
-       8,    240,    172,    145,
-      68,     18,     28,     88,
-     155,    169,    228,     54,
-      81,    152,    195,    242,
-      54,    109,    147,    204,
-       7,    195,    155,     79,
-      62,    228,    161,    157,
-      66,     18,    233,     79,
-     142,    161,    255,      9,
-      91,    133,    182,    244,
-      34,     91,    152,    192,
-     248,     48,    145,    105,
-      56,    226,    221,    138,
-      73,     54,    249,     67,
-     127,    188,    241,      2,
-      94,    141,    188,    237,
-      41,     93,    141,    181,
-     241,     45,    163,    101,
-      38,     26,    218,    131,
-     116,     60,    244,    198,
-     115,    168,    200,     28,
-      80,    119,    165,    235,
-      31,     71,    133,    188,
-     229,     39,     85,    113,
-      51,     28,    194,    186,
-     112,     34,     19,    196,
-     151,    154,    195,     20,
-      41,     99,    170,    210,
-      22,     76,    114,    167,
-     239,     30,     72,    125,
-      64,      3,    202,    176,
-     109,     38,     28,    218,
-     156,    151,    196,    236,
-      32,    125,    144,    216,
-      15,     53,    123,    175,
-     208,     24,     78,    120,
-      76,     17,    243,    165,
-     103,     93,      7,    201,
-     175,    115,    197,    230,
-      62,    116,    134,    199,
-       8,     51,     99,    151,
-     222,      2,     55,    116,
-     168,     36,    255,    173,
-     154,     80,     14,    243,
-     161,    126,    184,    225,
-      54,     77,    156,    206,
-     242,     43,    107,    159,
-     197,     13,     60,     97,
-     163,     40,    249,    212,
-     157,     73,     58,    244,
-     163,    133,     77,    237,
-      13,     66,    149,    181,
-     252,     34,     82,    134,
-     204,    244,     36,    105,
-     158,     50,    245,    218,
-     135,     66,     52,    237,
-     169,    128,     87,    216,
-      27,     88,    109,    189,
-     229,     21,     85,    140,
-     180,    252,     42,     81,
-     153,    199,      1,    223,
-     136,    125,     47,    230,
-     222,    157,     91,    213,
-       1,     81,    101,    164,
-     236,     31,     77,    117,
-     188,    226,     19,     89,
-     131,    185,     12,    212,
-     178,    118,     39,     31,
-     213,    136,    109,    207,
-      15,     54,    127,    172,
-     211,      7,     69,    125,
-     165,    234,     25,     71,
-     140,    178,    234,    233,
-     164,     99,     92,     16,
-     203,    183,    102,     58,
-     244,     63,    119,    148,
-     219,     15,     61,    100,
-     174,    210,      1,     79,
-     116,    165,    227,    239,
-     190,    109,     85,      8,
-     194,    188,    123,     69,
-     241,     37,     78,    156,
-     195,    244,     53,    108,
-     151,    221,     22,     53,
-     125,    172,    222,    245,
-     177,    151,     75,      6,
-     249,    165,    114,     79,
-     233,     42,     89,    134,
-     201,    253,     46,     86,
-     158,    194,    238,     61,
-     102,    151,    214,    252,
-     201,    158,     64,     62,
-     241,    162,    138,     87,
-     231,     19,     64,    142,
-     177,    234,     38,     94,
-     128,    204,    228,     59,
-     111,    158,    207,      4,
-     195,    135,    121,     53,
-     233,    213,    157,     80,
-     222,     25,     75,    113,
-     183,    227,     24,     70,
-     142,    180,    252,     51,
-      72,    129,    198,     11,
-     212,    143,    127,     44,
-     226,    220,    133,    104,
-     214,     14,     50,    122,
-     174,    217,     19,     79,
-     118,    191,    245,     10,
-      65,    136,    190,     18,
-     221,    183,    101,     36,
-      28,    198,    141,    110,
-     206,      7,     60,    110,
-     163,    212,     10,     55,
-     126,    185,    202,      0,
-      90,    113,    182,     27,
-     228,    191,    106,     83,
-      22,    200,    171,    116,
-     198,    255,     38,     96,
-     152,     51,      2,     48,
-     102,    179,    195,     31,
-      83,    121,    168,     35,
-     226,    164,    146,     91,
-       2,    242,    161,    121,
-     191,    247,     33,     91,
-     109,     57,      5,     40,
-     110,    138,    219,     23,
-      44,    103,    162,     42,
-     255,    175,    155,     67,
-      13,    228,    188,    128,
-     183,    236,     28,    175,
-     115,     70,    243,     32,
-      80,    132,    211,    238,
-      34,     98,    154,     52,
-     246,    201,    128,     79,
-      41,    248,    185,    119,
-     175,    227,    235,    179,
-     120,     73,    233,     22,
-      68,    156,    168,    230,
-      39,     89,    108,     48,
-      13,    193,    137,    106,
-      37,    255,    196,    110,
-     165,     36,    246,    183,
-     143,     81,    225,     28,
-      94,    151,    160,    248,
-      43,     87,    113,     74,
-       5,    217,    172,    102,
-      50,      3,     51,    100,
-      99,     43,    240,    207,
-     136,     90,    223,      1,
-      87,    108,    187,    236,
-      30,    179,    122,     68,
-      30,    211,    163,    114,
-      61,    245,     40,     94,
-     111,     63,     12,    192,
-     146,    156,    219,     22,
-      40,    100,    181,    208,
-      19,    185,    140,     92,
-      22,    236,    183,    125,
-     186,    238,     38,    169,
-     123,     51,      6,    223,
-     155,    151,    198,    238,
-      32,    124,    142,    219,
-       8,    196,    135,     85,
-      47,    230,    189,    123,
-     178,    230,     27,    181,
-     112,     73,     30,    212,
-     166,    139,    210,    227,
-      59,    121,    135,    195,
-     253,    195,    152,    112,
-      38,    255,    196,    115,
-     171,    216,     16,    188,
-     137,     64,     18,    225,
-      80,    140,    170,    253,
-      49,     75,    133,    194,
-       0,    217,    147,    102,
-      56,    248,    201,    104,
-     165,    208,     10,    198,
-     135,     89,     42,    233,
-      73,    119,    162,    244,
-       9,     64,    141,    187,
-       8,    209,    171,    125,
-      51,      2,     46,     96,
-     157,    201,    252,    207,
-     156,     81,     32,    247,
-      68,    120,    184,    203,
-       1,     89,    118,     79,
-      30,    239,    189,    117,
-      75,     13,     38,     95,
-     149,    198,      4,    216,
-     149,    106,     54,    253,
-      62,     96,    179,    196,
-      30,     76,    115,     80,
-      22,    230,    184,    138,
-      77,     20,     31,     87,
-     140,    191,     14,    210,
-     173,    100,     60,    251,
-      56,    107,    138,    221,
-      20,     51,    111,     90,
-      46,    254,    182,    128,
-      87,     30,     20,     79,
-     132,    181,     19,    236,
-     166,    126,     69,    241,
-      33,     83,    130,    215,
-     241,     54,    152,     98,
-      38,    240,    204,    149,
-      89,    216,     10,     71,
-     123,     80,     20,    228,
-     185,    121,     75,    239,
-      43,     91,    154,    177,
-     252,     43,    162,    106,
-      48,      5,    200,    154,
-     156,    213,      2,     56,
-     142,     82,     46,    251,
-     178,    131,    174,    229,
-      19,     67,    143,    191,
-     238,    223,    173,    113,
-      59,      9,    213,     94,
-     144,    205,    252,    207,
-     159,    105,     39,    241,
-     197,    143,    165,    211,
-      28,     78,    125,    173,
-      27,    228,    178,    126,
-      70,    237,     33,     82,
-     138,    194,     11,    211,
-     150,     99,     61,      6,
-     200,    105,    154,    212,
-      14,     62,    115,    167,
-      35,     17,     71,    121,
-     179,    227,     29,     74,
-     134,     69,     22,    212,
-     175,    122,     59,     12,
-     210,     96,    148,    201,
-       1,     53,    106,    158,
-     214,     13,     59,    116,
-     160,    213,     20,     70,
-     128,     72,     17,    237,
-     167,    114,     66,     21,
-     216,    167,    142,    193,
-     250,     46,    102,    145,
-     203,      9,     62,    108,
-     165,    214,    245,    193,
-     136,     83,     38,    229,
-     189,    137,     68,     30,
-     225,    174,    132,    190,
-     247,     44,     80,    133,
-     204,    255,     44,     99,
-     152,    205,    253,    202,
-     151,     86,     37,    249,
-     180,    130,     80,     33,
-      22,     79,    116,    191,
-     227,     20,     86,    135,
-      66,     14,     38,     90,
-     145,     58,      6,    215,
-     147,    111,     57,    251,
-     195,    146,    161,    208,
-       6,     74,    113,    170,
-      29,    233,    180,    128,
-     181,    235,     30,    172,
-     118,     67,     15,    219,
-     167,    109,     56,    249,
-      54,     98,    159,    206,
-     249,    194,    148,     89,
-      36,    243,    188,    136,
-     172,    226,     21,     73,
-     129,    180,    235,     29,
-      80,    140,    189,     13,
-     211,    164,    107,     62,
-       6,    202,    157,     96,
-      46,      7,     63,    106,
-     161,    220,     11,     69,
-     127,    170,    230,    233,
-     182,    120,     79,     19,
-     217,    172,    115,     70,
-       8,     41,     92,    144,
-     205,    251,     53,    111,
-     148,    214,      5,    197,
-     138,     92,     34,    247,
-     189,    131,     84,     24,
-     230,     76,    128,    180,
-     239,     37,     83,    141,
-     199,    240,     43,    162,
-     111,     51,      4,    201,
-     146,    103,     41,    249,
-      63,    119,    161,    221,
-      22,     64,    127,    172,
-     228,    228,    183,    123,
-      64,     20,    219,    174,
-     117,     58,      8,     40,
-     103,    156,    192,    244,
-      63,     99,    153,    208,
-     245,    202,    129,     86,
-      46,    226,    179,    141,
-      72,     25,     24,     72,
-     143,    181,    224,     44,
-      87,    128,    203,    244,
-     208,    151,    100,     58,
-     240,    197,    154,    109,
-      35,    244,     58,    122,
-     165,    205,      3,     85,
-     108,    189,    227,    229,
-     168,    113,     72,     29,
-     214,    168,    124,     54,
-       2,    210,     97,    159,
-     192,     14,     39,    123,
-     173,    221,     10,    197,
-     130,     93,     45,    225,
-     186,    137,     74,     25,
-      30,     87,    143,    176,
-     253,     40,     86,    134,
-     199,      5,    214,    150,
-     108,     57,    241,    196,
-     153,     91,    214,     14,
-      72,    126,    167,    208,
-      27,     69,    121,    179,
-      17,    233,    160,    118,
-      77,      0,    213,    172,
-     110,    193,    243,     35,
-     106,    150,    193,     13,
-      51,    104,     93,     46,
-     249,    178,    132,     90,
-      16,    231,    188,    131,
-     183,    224,     19,     67,
-     153,    173,    255,     47,
-      93,    107,     48,     15,
-     195,    150,    105,     60,
-     242,    195,    145,    167,
-     208,      6,     79,    121,
-     160,    235,     19,    181,
-     121,     67,     31,    235,
-     160,    125,     73,     15,
-      40,     88,    155,    204,
-     241,     60,    109,    156,
-     209,    254,    204,    154,
-      80,     44,    248,    180,
-     130,     82,    225,     17,
-      70,    141,    184,    229,
-      44,     82,    139,     70,
-       6,    198,    176,    124,
-      57,      9,    203,    103,
-     155,    220,     23,     40,
-      98,    181,    214,      9,
-     187,    143,     65,      8,
-     243,    163,    115,     66,
-      21,    222,     80,    135,
-     209,    230,     57,     78,
-     153,    206,      1,    196,
-     154,    115,     60,    232,
-     206,    132,     92,     36,
-      21,     79,    116,    160,
-     235,     23,     68,    135,
-      69,     26,    214,    165,
-     126,     50,      3,    211,
-     156,    148,    205,    245,
-      57,    100,    146,    218,
-      12,    192,    133,     84,
-      46,    226,    179,    131,
-      76,    229,     30,     71,
-     143,    181,    226,     47,
-      82,    139,    195,     13,
-     217,    144,    121,     59,
-     243,    194,    150,    157,
-     211,      2,     48,    124,
-     166,    209,     26,     68,
-     129,     73,     18,    233,
-     161,    119,     79,     23,
-     216,     89,    139,    203,
-     243,     33,    110,    156,
-     196,      2,    200,    146,
-      86,     33,    249,    203,
-     130,     80,     32,     17,
-      78,    116,    185,    236,
-      22,     89,    131,    186,
-      12,    220,    173,    121,
-      50,     14,    215,    159,
-     103,    206,      4,     63,
-     101,    168,    222,     14,
-      66,    139,     81,     39,
-     226,    191,    137,     75,
-      19,    227,     83,    131,
-     187,    248,     47,     82,
-     151,    193,    251,    210,
-     159,     97,     57,    244,
-     192,    148,     94,     41,
-      13,     66,    112,    172,
-     232,     18,     76,    124,
-     180,     20,    229,    170,
-     127,     74,     10,    221,
-     161,    110,    199,    248,
-      52,     99,    156,    201,
-       1,     58,    111,     93,
-      36,    246,    184,    141,
-      86,     29,    232,     75,
-     129,    182,    233,     27,
-      80,    141,    189,    241,
-      40,    162,    111,     59,
-       7,    202,    157,    102,
-      46,      5,     59,    109,
-     167,    218,     13,     65,
-     120,     82,     28,    234,
-     176,    125,     74,     22,
-     222,    170,    138,    189,
-     247,     45,     90,    151,
-     203,    252,    205,    153,
-      97,     45,    253,    192,
-     140,     88,     36,     15,
-      69,    123,    173,    224,
-      28,     73,    129,    181,
-     236,    222,    171,    119,
-      59,     14,    209,    163,
-     105,     55,    254,     50,
-     106,    158,    214,      3,
-      63,    115,    167,    219,
-     238,    184,    134,     83,
-      24,    229,    179,    124,
-     184,    236,     32,     85,
-     143,    194,    244,     42,
-      96,    106,     52,      1,
-     201,    148,     99,     45,
-     247,    194,    114,    166,
-     222,     19,     68,    122,
-     177,    229,    229,    177,
-     122,     68,     19,    222,
-     165,    115,     61,    247,
-      45,     99,    148,    201,
-       2,     55,    107,    159,
-     212,    246,    192,    142,
-      85,     32,    239,    186,
-     130,     78,    230,     26,
-      81,    135,    184,    237,
-      37,     88,    142,     60,
-       7,    210,    156,    105,
-      50,    255,    200,    149,
-      95,     42,     10,     63,
-     117,    168,    223,     18,
-      73,    125,    178,     24,
-     227,    174,    121,     68,
-      15,    218,    165,    112,
-      59,      6,     46,     99,
-     152,    205,      2,    200,
-     147,     94,     41,    244,
-     191,    138,     85,     32,
-     235,    182,    129,     76,
-     232,     29,     82,    135,
-     188,    241,    217,    164,
-     111,     58,      5,    208,
-     100,    153,    206,      3,
-      56,    109,    162,    215,
-      12,    190,    137,     84,
-      31,    234,    181,    128,
-      75,     22,    225,    172,
-     119,     66,     13,     39,
-      92,    145,    198,    251,
-     207,    154,    101,     48,
-       4,     57,    110,    163,
-     217,     13,     66,    119,
-     172,    225,    233,    180,
-     127,     74,     21,    224,
-     171,    118,     65,    243,
-      40,     93,    146,    199,
-     252,     49,    102,    155,
-      47,    250,    197,    144,
-      90,     39,    240,    189,
-     135,     82,    226,     23,
-      77,    128,    183,    234,
-      33,     85,    138,     64,
-      11,    214,    160,    109,
-      54,      2,    205,    152,
-     156,    209,      7,     58,
-     113,    164,    219,     15,
-      68,    134,     81,     29,
-     230,    179,    124,     73,
-      18,    222,     86,    138,
-     193,    244,     43,     94,
-     148,     54,      1,    204,
-     150,     99,     44,    249,
-     195,    142,     89,    219,
-      16,     68,    123,    174,
-     229,     24,     79,    131,
-     184,     18,    221,    169,
-     114,     63,      8,    213,
-     159,    106,    202,    255,
-      53,    104,    159,    210,
-       9,     60,    114,    167,
-      35,    238,    184,    133,
-      78,     27,    228,    176,
-     123,    185,    238,     35,
-      88,    141,    194,    247,
-      44,     97,    105,     52,
-     255,    202,    149,     96,
-      43,    246,    193,    115,
-     168,    221,     18,     71,
-     124,    177,    230,     27,
-     175,    122,     69,     16,
-     219,     89,    142,    195,
-     248,     45,     98,    151,
-     204,      1,     54,    107,
-      95,     42,    245,    192,
-     139,     86,     33,    236,
-     183,    125,    178,    231,
-      28,     81,    134,    187,
-     240,    218,    165,    112,
-      59,      6,    209,    156,
-     103,     50,    253,     55,
-     108,    161,    214,     11,
-      64,    117,    170,    223,
-     235,    182,    129,     76,
-      23,     29,     82,    135,
-     188,    241,     38,     91,
-     144,    197,      5,    208,
-     155,    102,     49,    252,
-     199,    146,     93,     40,
-     243,    190,    118,    171,
-     224,     21,     74,    127,
-     180,     22,    225,    172,
-     119,     66,     13,    216,
-     163,    110,     57,    251,
-      48,    101,    154,    207,
-       4,     57,    110,     92,
-      39,    242,    189,    136,
-      83,     30,    233,     75,
-     128,    181,    234,     31,
-      84,    137,    190,    243,
-      40,     93,    109,     56,
-       3,    206,    153,    100,
-      47,    250,    197,    111,
-     164,    217,     14,     67,
-     120,    173,    226,    232,
-     179,    126,     73,     20,
-     223,    170,    117,    191,
-     244,     41,     94,    147,
-     200,    253,     50,    103,
-     156,     46,    249,    196,
-     143,     90,     37,    240,
-     187,    134,     81,    227,
-      24,     77,    130,    183,
-     236,     33,     86,    139,
-      63,     10,    213,    160,
-     107,     54,    254,     51,
-     104,    157,    210,      7,
-      60,    113,    166,    219,
-      16,     69,    122,    175,
-     228,    230,    177,    124,
-      71,     18,    221,    168,
-     115,    193,    246,     43,
-      96,    149,    202,      0,
-     203,    150,    158,     44,
-     247,    194,    141,     88,
-      35,     17,     70,    123,
-      79,     26,    229,    176,
-     123,     70,     17,    220,
-     167,    141,    194,    247,
-      44,     97,    150,    203,
-       0,     53,    149,     96,
-     212,      9,    193,    140,
-     168,    221,     18,    184,
-     131,     78,     25,     27,
-      80,    133,    186,    239,
-      36,    166,    113,     60,
-     248,    210,    157,    151,
-     204,      1,     54,    148,
-     160,    213,     10,    192,
-     139,     86,     33,    236,
-      72,    125,    178,    231,
-     227,    174,    121,    187,
-     240,     37,     90,    143,
-     196,    249,     46,    156,
-     103,     50,    253,    200,
-     108,    161,    214,     11,
-      64,    117,    170,    223,
-      20,     73,    126,     76,
-     232,    226,    173,    120,
-      67,     14,    217,     91,
-     144,    197,    250,    208,
-     155,    102,     49,    252,
-     199,    146,     93,    215,
-      12,     65,    118,    171,
-      31,    234,    181,    128,
-     180,    233,     30,     83,
-     136,    189,    242,    216,
-     163,    110,    198,      4,
-      48,    154,    154,    207,
-       4,     57,    110,    163,
-     216,     13,     66,    119,
-     172,     30,    233,    180,
-     127,    181,     21,    224,
-      84,    137,     65,     12,
-     215,    162,    109,    199,
-     252,     49,    102,    100,
-     208,      5,    197,    111,
-     164,    217,     14,    188,
-     135,     82,     29,    232,
-     179,    126,     73,    235,
-      32,     85,    138,    191,
-     244,     41,     94,    108,
-     200,      2,     50,    103,
-      99,     46,    249,    196,
-     143,     90,     37,    240,
-     187,    121,    174,     28,
-      24,    178,    130,     72,
-      19,    222,     86,    116,
-      63,     10,     42,     95,
-     148,    201,      1,     51,
-     104,    157,    210,    248,
-      60,    142,    166,     37,
-      16,     68,    135,    175,
-     228,    230,     78,    131,
-      71,     18,     34,    168,
-     140,    193,      9,     43,
-     159,    106,    202,      0,
-      52,    150,     97,    211,
-       8,    195,    114,    164,
-      35,    236,    184,    123,
-     176,    229,     26,    177,
-     123,     70,     17,     34,
-      88,    114,     61,      8,
-     211,     97,    150,    203,
-     255,    202,    106,    159,
-     212,    246,     62,    115,
-      87,    221,     18,     71,
-     124,     78,     25,    228,
-      80,    122,     69,     16,
-     219,     89,    113,    195,
-     248,    210,     98,    104,
-      51,      1,     54,    148,
-      95,    213,     10,     63,
-     116,    169,    222,    236,
-      72,    130,    178,    231,
-      28,    174,    134,    187,
-     240,    218,    165,    143,
-      59,    249,     46,    156,
-     152,     50,      2,    200,
-     147,    161,     41,     11,
-     191,    138,     85,     32,
-     235,    182,    126,     76,
-      23,     29,    173,    135,
-      67,    241,    217,     91,
-     144,     58,    250,    208,
-     100,    153,    206,      3,
-      56,    146,    162,    215,
-     243,    190,    118,    171,
-     224,     21,    181,    127,
-     180,     22,     30,    172,
-     119,    189,     13,     39,
-      92,    110,     57,    251,
-     207,    154,    154,     48,
-     251,     57,    145,     92,
-     216,    242,    189,    119,
-      83,     30,     22,    180,
-     127,    181,     21,     31,
-     171,    137,     65,    243,
-     215,     93,    146,     56,
-       3,    206,    102,    100,
-     208,    250,     58,    144,
-     164,    217,    241,     67,
-     135,     82,    227,     23,
-     177,    129,    183,     20,
-      32,    170,    117,    191,
-      11,    214,     94,    147,
-     200,    253,     50,    153,
-     157,     46,    249,     58,
-     142,    165,    218,    240,
-     187,    121,     81,    227,
-      24,    178,    130,    183,
-      19,     33,     86,    116,
-     192,     10,    213,     95,
-     107,     54,    254,     51,
-     151,    157,    210,    248,
-      60,    113,     88,    219,
-      16,    186,    123,     80,
-      27,     25,    177,    131,
-     184,     18,    221,     86,
-     115,     63,    247,    212,
-     159,    149,     53,      0,
-      52,    105,     97,    210,
-     247,    195,    114,    167,
-      35,     17,    184,    123,
-     176,    229,    229,    176,
-     132,     70,     17,     35,
-      88,    141,    194,      8,
-      44,     97,    105,    203,
-       0,    202,    149,    158,
-      43,    246,    193,    115,
-     168,     34,     18,     71,
-     131,     78,     25,     27,
-     175,    122,    186,     16,
-      36,    166,    113,    195,
-       7,    210,     98,    151,
-      51,    254,    201,    107,
-      94,    212,     10,    193,
-     116,     87,    222,     18,
-     183,    125,    178,     25,
-     227,    174,    134,    186,
-     240,    219,    165,    142,
-      59,    249,     46,    156,
-     102,    205,      2,    201,
-     108,    161,     41,    244,
-      64,    138,     85,    222,
-     234,    182,    127,     77,
-     233,     29,    173,    135,
-     188,     14,     39,    164,
-     110,    196,      5,    208,
-     101,    103,     49,      2,
-     198,    146,    163,     40,
-     243,     64,    136,     84,
-     224,    234,    181,    127,
-      75,     22,     30,    173,
-     119,    188,     13,    216,
-      92,    111,    198,    251,
-     206,    101,    154,     49,
-     251,     57,    145,    163,
-     216,    242,    189,    136,
-     172,    225,     22,    180,
-     127,     74,     21,     31,
-      84,    118,    190,     12,
-     215,     93,    146,    199,
-     252,    206,    153,    155,
-      47,      5,     58,    144,
-     164,     38,    241,     67,
-     120,    173,     29,    232,
-     179,    126,    182,     20,
-      32,    170,    117,    191,
-      11,     41,     94,    108,
-     200,    253,    205,    103,
-     156,     46,    249,     59,
-     143,     90,    218,    240,
-      68,    121,     81,     28,
-      24,    178,    130,    183,
-      19,    222,     86,    116,
-      63,    245,    213,    160,
-     148,     54,      1,     51,
-     150,     98,    210,    248,
-      60,    112,    166,    218,
-      17,    186,    123,    174,
-     228,     25,     78,    124,
-      71,     18,    217,    172,
-     119,     54,     13,     43,
-      97,    147,    193,    244,
-      63,     98,    154,    211,
-     246,    203,    132,     80,
-      43,    230,    191,    132,
-      76,     26,    229,     79,
-     136,    181,    231,     41,
-      92,    115,     56,      9,
-     218,    144,    105,     62,
-     246,     63,    102,    157,
-     222,     14,    205,    139,
-      81,     37,     23,     78,
-     126,    185,    226,    226,
-     171,    125,     73,     26,
-     221,     89,    134,    205,
-     239,     61,    104,    148,
-      52,    237,    222,    156,
-      92,    213,      2,     52,
-     112,    168,    221,    234,
-     189,    134,     79,    229,
-      23,     65,    149,    182,
-     243,    216,    170,    104,
-      36,     26,    209,    100,
-     139,    210,     19,     53,
-     111,     88,     50,    230,
-     186,    131,    172,    199,
-       1,     90,    114,     77,
-      29,    243,    183,     92,
-      86,    249,     48,     65,
-     139,    213,      1,    219,
-     148,    117,     60,    245,
-      57,    125,    182,    196,
-      29,     73,    143,     92,
-      21,    252,    149,    148,
-     186,    241,     11,     69,
-     129,     73,     31,    211,
-     168,    100,     56,      4,
-      61,    117,    150,    192,
-      12,    198,    147,     94,
-      55,    232,    160,    138,
-     181,    241,     24,     69,
-     127,     69,     29,    226,
-     172,    114,     67,      9,
-      42,     90,    157,    214,
-     243,     61,    101,    111,
-      53,    216,    229,    107,
-     179,    213,      5,     79,
-     131,     94,    224,     21,
-     182,    123,     64,     27,
-     217,     94,    144,    164,
-     239,     38,    166,    116,
-      22,     47,    215,    113,
-     128,    193,     22,     51,
-     158,     85,    218,    241,
-     190,    131,     87,     26,
-      26,     84,    168,    149,
-     255,     33,    176,     93,
-      24,     39,    219,    119,
-     179,    216,    245,    201,
-     139,    108,    211,      6,
-      60,    136,     92,    219,
-      20,     94,     85,    180,
-     231,    234,    146,     81,
-      88,     50,    217,     96,
-     161,    203,    247,    218,
-     190,    101,    204,    250,
-      54,    144,    107,     45,
-      14,     32,     65,    187,
-      37,    248,    156,    162,
-      91,     12,    227,    125,
-     180,    187,     28,    204,
-     188,     99,    204,    230,
-      37,    150,    123,    202,
-      14,     41,     69,    130,
-      36,    212,    223,    149,
-      89,     41,    231,     90,
-      76,    185,     13,    244,
-     191,    105,    179,    247,
-      40,    170,    102,     62,
-     245,     52,     73,    137,
-      34,    218,    211,    159,
-      92,     42,    249,    192,
-      82,    188,     55,    251,
-     176,    140,     79,    242,
-      14,    166,     98,     64,
-     232,     60,     71,    146,
-      50,     47,    203,    102,
-     157,     49,    244,    209,
-     110,    133,    208,    238,
-     180,    142,     89,    215,
-      13,     78,    149,     67,
-     253,     63,     64,    136,
-     184,     20,    199,     92,
-     133,     62,      9,    207,
-     190,    142,    227,    248,
-     208,    147,     87,     34,
-      25,     88,    136,     71,
-      31,     14,     91,    127,
-     189,     23,    251,    164,
-     147,    183,     30,    197,
-     146,    127,    242,    222,
-     222,    149,    102,     33,
-     251,     37,    126,     85,
-      41,      5,     90,    113,
-      82,    228,    235,    190,
-     139,    172,     18,    193,
-     136,     91,     67,    179,
-      15,    182,    123,     53,
-      19,     55,    122,    148,
-      42,    240,     57,    124,
-     165,     35,      1,     69,
-     142,    165,    240,    253,
-     153,     96,    109,    224,
-     109,    114,    107,     99,
-       5,    223,     86,    136,
-     219,      2,    221,    103,
-     142,     45,      5,     33,
-     121,     93,    220,     10,
-     155,    172,     74,      2,
-       0,      0,    149,    102,
-      63,    210,    169,    132,
-     223,    237,    215,    184,
-     105,    221,    252,     59,
-     114,    145,     36,    254,
-     195,    145,    124,     43,
-     244,     85,     49,    183,
-      46,    215,    179,    137,
-     172,    207,     55,    171,
-     111,     53,    229,     38,
-     111,    130,    192,     16,
-     219,    147,    125,     55,
-     240,    216,    114,    231,
-     255,    194,    139,    133,
-     190,    234,      1,     85,
-     129,     91,      5,     52,
-      66,    134,    205,    240,
-     202,    131,    108,     56,
-     239,    203,    132,    113,
-     243,     39,    215,    185,
-      92,    200,      1,     81,
-      96,    186,      2,    250,
-      64,    158,    188,    229,
-      45,    183,    110,     52,
-     248,    214,     98,    103,
-      27,    251,      4,    124,
-     123,     61,     30,     43,
-     125,    189,    204,    224,
-     148,    132,    145,    255,
-      29,     81,    112,     93,
-       2,     44,     92,    117,
-      43,     45,    241,     68,
-     163,     50,    225,     55,
-     102,     94,    222,     24,
-      74,    154,     68,    208,
-       6,     76,    129,     69,
-       4,    236,     81,    137,
-     185,      1,    251,    142,
-     147,    133,    211,    223,
-     129,    109,     54,      3,
-      32,     76,    168,     48,
-     226,     76,    124,     82,
-      21,    238,    176,    130,
-     191,    227,    231,    181,
-      81,     88,    238,     28,
-      79,    115,     27,     14,
-      52,    124,    177,    239,
-     242,    239,    156,    179,
-     217,    255,     64,    103,
-     172,     28,     30,     77,
-     109,    111,     49,    236,
-     122,    179,    190,     39,
-     202,     89,    129,    227,
-     219,     55,    176,     73,
-     209,     23,     56,    106,
-     181,    223,    253,    191,
-     113,     87,      6,    202,
-     170,    139,    143,    194,
-     202,    154,    101,    175,
-     232,     13,     72,    124,
-       3,     23,     42,    118,
-      99,    214,     23,    192,
-     157,     91,    210,    248,
-     160,    157,     67,    244,
-      33,     94,     88,    109,
-     238,     53,     77,    149,
-     196,     21,    241,    161,
-     135,    194,    249,     56,
-     107,    112,     38,     10,
-      55,    131,     66,     56,
-     224,     96,     67,    173,
-      48,    253,     71,    150,
-     162,    255,    222,    180,
-     105,    199,    249,     41,
-      99,    153,     48,     19,
-      52,    121,    156,     58,
-     234,    223,    137,    149,
-     236,    226,    146,    137,
-     191,    244,     12,     95,
-     124,     90,      4,     32,
-      84,    128,    201,    244,
-     216,    148,    156,    198,
-     248,    208,    139,    124,
-     196,     54,     35,    172,
-     127,     33,     29,     81,
-     107,    184,     21,    251,
-     161,    140,    180,    229,
-      44,    166,    125,     63,
-     243,     39,    149,    117,
-      18,    242,     17,     89,
-      95,      3,    233,     54,
-      97,    190,    205,     16,
-     162,    161,     68,    244,
-      10,     88,    120,     67,
-       7,     32,     84,    139,
-      41,     39,    240,     96,
-     174,    232,    234,    228,
-     155,    179,    194,     24,
-      76,    130,     75,     52,
-      19,     93,    111,    182,
-      17,    235,    174,    143,
-     183,     13,    192,    130,
-     120,    228,    192,     39,
-     188,    123,    200,     18,
-      42,    127,    164,     38,
-     238,    181,    100,    177,
-     231,    226,    188,    133,
-     183,    226,     26,    160,
-      87,    107,     12,     29,
-     112,    124,     18,     10,
-      62,    113,    136,    196,
-     249,    210,    133,    163,
-     204,     30,     66,    130,
-      87,     31,     23,     78,
-     125,     83,     63,    243,
-     115,    177,    186,     36,
-     204,     91,    129,    214,
-     240,     54,    147,    120,
-      35,     17,     39,    105,
-      87,     33,    242,     67,
-     125,    173,     17,    200,
-     145,    143,    138,    244,
-     194,    130,    112,    173,
-     224,     36,     82,    147,
-      32,     23,     57,    120,
-     145,     39,    244,    195,
-     142,    167,    216,    246,
-     162,    163,    175,    208,
-      61,    162,     88,     69,
-     230,     48,     88,    134,
-     197,     27,    194,     93,
-     143,    216,      7,    193,
-     145,     98,     45,    250,
-     192,    128,    120,     47,
-      56,    108,    129,    112,
-       8,     26,     94,    146,
-     182,    229,    209,    190,
-     114,    217,    228,    215,
-     148,    108,     54,      3,
-     206,    149,    107,     50,
-     252,     25,     87,     93,
-      63,    229,     64,    112,
-     187,    232,     22,    183,
-     109,     66,    249,     54,
-     164,    124,     59,      8,
-     208,    150,    111,     60,
-     231,    195,     72,    190,
-      33,    235,    198,    122,
-     161,    216,     24,     74,
-     133,     90,     26,      2,
-      68,    127,     85,     23,
-      36,    165,    123,     54,
-      15,    197,    154,    179,
-     237,    242,    214,    144,
-     175,    217,      9,     56,
-     120,     87,     48,    238,
-      95,    110,     78,      8,
-     234,     81,    134,     72,
-      30,    214,    181,    138,
-     226,    225,    197,    131,
-     102,    220,     12,     52,
-     111,    166,     43,    255,
-      66,     96,    187,     34,
-     251,    186,    129,    178,
-      24,    246,    189,    113,
-     169,    212,     33,    184,
-     119,    193,    233,     32,
-      96,    154,    206,    250,
-     199,     98,    172,    211,
-     242,    183,    132,     81,
-     224,    231,    173,    152,
-     178,    199,      3,    185,
-      82,     69,    252,     53,
-      86,    146,    198,     12,
-     202,    107,    143,    203,
-     254,    199,    148,     81,
-      33,    241,    178,    151,
-      71,    194,     35,     73,
-      84,     80,    230,     11,
-      89,    140,    186,      9,
-     219,     90,    143,    214,
-       4,    197,    152,    103,
-      39,    242,    204,    133,
-     123,    209,     58,     94,
-     158,    122,     26,      6,
-      89,    136,    181,     23,
-     209,    168,    144,    162,
-     247,    217,    170,    110,
-      53,      5,    193,    138,
-     127,     47,     42,     36,
-     158,    121,     44,      8,
-      73,    118,    165,     30,
-     242,    186,    158,    145,
-     230,    211,    165,    114,
-      60,      9,    221,    180,
-      74,     53,    204,     23,
-     129,     75,     41,     22,
-      54,    114,    173,    211,
-     248,    175,     99,    128,
-     244,    247,    190,    121,
-      67,     20,    219,    185,
-      86,     59,    194,     13,
-     136,     71,     50,    236,
-      37,    104,    156,    213,
-     229,    214,    102,    137,
-     200,    224,    170,    130,
-      78,     31,    224,    162,
-      89,    189,    192,     59,
-     190,     82,     60,    249,
-      39,     97,    147,     52,
-     235,    207,     74,    184,
-     211,    248,    204,    139,
-      86,     33,    232,    163,
-     150,    171,    249,    237,
-     178,    120,    181,    229,
-      39,    162,    114,     53,
-      13,     34,     74,    139,
-      53,    234,    198,    145,
-     165,    209,    251,    223,
-     115,    129,    220,    198,
-     175,    104,    174,    234,
-     230,    164,    107,     94,
-     243,      8,    116,    136,
-      40,     16,    194,    148,
-     145,    199,    238,    194,
-     114,    174,      1,    223,
-      72,    107,    179,    212,
-     233,    162,    166,     66,
-     201,     46,     79,    135,
-      82,     18,    192,    160,
-     157,    197,    254,     48,
-     107,     65,      9,    244,
-      35,     77,    180,    210,
-     253,    151,    149,    190,
-     208,     10,     77,    133,
-      90,     12,    245,    171,
-     119,    166,    223,     46,
-     136,     93,     55,    244,
-      40,    124,    139,     58,
-     208,    220,    123,    134,
-     194,      4,    184,    135,
-      67,     18,    250,    191,
-     163,    131,    239,    210,
-     129,    114,    178,    225,
-      59,     86,    120,     30,
-       6,     42,    124,    139,
-     213,    243,    203,    148,
-      93,     59,    242,    119,
-      82,     75,     41,    230,
-      71,    139,    191,    251,
-      32,    140,     85,    180,
-     214,     52,     80,    102,
-      45,      4,     61,    145,
-     120,    197,     62,     48,
-     190,    124,    222,     29,
-      87,    107,    175,     60,
-     195,    182,    147,    161,
-     247,     45,    191,    107,
-     193,    250,    217,     92,
-     190,    208,     27,    231,
-     133,    153,    202,     38,
-      50,    146,    115,     46,
-      25,     67,    106,    184,
-      27,    253,    165,    131,
-     186,    255,      0,     88,
-     103,     35,      4,    211,
-     105,    181,    210,     15,
-     232,    155,    150,    217,
-      13,    198,    135,     89,
-     218,    232,    182,    109,
-     150,    230,    253,    189,
-     122,     66,    228,     59,
-      82,    102,     40,    246,
-      39,    107,    147,     59,
-     224,    198,    120,    148,
-     214,     29,     51,    157,
-      65,    221,     20,     66,
-     119,    187,    230,    235,
-     164,    129,    182,    230,
-     219,    183,    110,     44,
-     255,     62,    125,    133,
-      33,    224,    192,    104,
-     168,    195,      4,    200,
-     159,     80,    208,      1,
-      65,    130,     66,      1,
-     242,    174,    140,    155,
-     237,    211,    135,    103,
-      56,    241,     55,    119,
-      98,     43,    236,     48,
-     124,    181,    198,    240,
-     163,    151,     93,    213,
-      48,    106,    130,     83,
-      13,    232,     82,    149,
-     165,    251,    205,    186,
-     110,    212,    247,     39,
-      97,    108,     36,    242,
-      57,    113,    188,    209,
-     225,    165,    152,    171,
-     239,     26,     73,    143,
-      88,     23,     19,     89,
-     136,     70,      4,    208,
-     167,    155,    216,    234,
-     199,    148,    111,     55,
-       6,     42,     98,     84,
-      51,    227,    191,    122,
-     188,    226,    229,    187,
-     119,    182,    244,      6,
-     163,    123,     72,     28,
-     223,     70,    136,     49,
-      13,    198,    158,    102,
-     214,      9,     59,    155,
-      86,     37,      6,     79,
-     116,    174,     21,    227,
-     177,    135,    179,    234,
-      32,    168,    114,     71,
-       8,     47,     87,    108,
-      48,    252,     63,     97,
-     100,     38,    251,    192,
-     137,    163,    220,    246,
-     188,    134,     83,     26,
-      16,     70,    127,     74,
-     235,     44,     95,    142,
-      62,     27,    205,    172,
-     145,    192,    248,     50,
-     157,    114,     42,     14,
-      51,    118,    165,    220,
-      28,     76,    114,    172,
-      23,    243,    188,    131,
-      70,     16,     34,    172,
-     127,     55,    241,     59,
-     104,    145,    205,    245,
-      63,     96,     97,     38,
-     250,    204,    134,     93,
-     222,     23,     66,    129,
-      65,     30,     25,     77,
-     142,    173,    254,     43,
-      91,    116,     51,      5,
-     212,    155,    108,     53,
-     255,    206,    156,    159,
-     217,     14,    193,    115,
-     173,    215,      1,     84,
-     130,     95,     11,    234,
-     166,    122,    178,    233,
-     222,    168,    118,    203,
-     241,     41,    101,    154,
-     199,      6,     51,    107,
-      88,     38,    250,    204,
-     143,    170,    217,     23,
-     178,    139,     73,     24,
-      27,     64,    138,    190,
-     247,     38,    162,    121,
-      62,      0,    217,    155,
-      99,    205,      2,    203,
-     108,    164,    210,     15,
-      69,    114,    162,    215,
-      17,    182,    136,     67,
-      27,    228,     83,    129,
-     190,      8,    213,    162,
-     148,    204,    243,     36,
-      98,    154,    198,      4,
-     198,    149,     87,     35,
-     251,    187,    118,    173,
-     225,    237,    188,    130,
-     181,    238,     18,     90,
-     128,    180,    246,    218,
-     166,    107,     59,      6,
-     205,    101,    100,     54,
-     242,    194,    111,    160,
-     221,      9,     66,    119,
-     171,    230,     22,    182,
-     124,     79,     16,    224,
-      87,    141,    190,      4,
-     208,    166,    108,    194,
-     246,     55,    103,    154,
-      44,    255,    198,    147,
-      88,    217,     12,     64,
-     125,     82,     25,     22,
-      72,    131,    180,    233,
-      32,     86,    137,     66,
-      14,    208,    167,    104,
-      53,    253,     51,    100,
-     158,    209,      2,     61,
-     115,    167,    217,     14,
-     187,    134,     82,     25,
-     229,    177,    117,     79,
-      19,     35,     84,    142,
-     193,     10,     41,     93,
-     151,    207,    252,    205,
-     147,    102,     46,    248,
-     194,    139,     93,     37,
-     239,     70,    127,    172,
-      27,    231,    176,    130,
-     189,    239,     32,     84,
-     113,     59,     11,    213,
-     158,    149,    200,      1,
-     202,    104,     96,    210,
-      12,    194,    140,     89,
-      34,    239,     71,    120,
-     177,    228,     24,    177,
-     127,     71,    236,    220,
-     166,    141,    194,      8,
-     208,    156,    151,    202,
-     255,     53,    106,    159,
-     214,     13,     63,    141,
-      86,     35,    236,    185,
-     131,    179,    230,    224,
-     173,    133,     68,     16,
-      37,     88,    143,    192,
-     249,     45,     99,    104,
-      50,      1,     55,    148,
-      94,     42,    247,    193,
-     117,    169,     35,    237,
-     183,    125,    179,    229,
-      28,    174,    121,     69,
-      15,     36,     88,    143,
-      58,    249,     47,    157,
-     102,    207,      0,    201,
-     145,     94,    214,     11,
-      65,    116,     84,     35,
-     233,     73,    124,    177,
-     232,    226,    172,    135,
-     189,    241,     36,     90,
-     110,     57,      7,    208,
-     100,    102,    206,      3,
-     198,    144,     92,    215,
-      14,     64,    119,    171,
-      31,     21,     75,    126,
-     180,     22,    227,    175,
-     118,    189,     13,    217,
-     163,    110,     57,      4,
-      48,    100,    154,    207,
-       6,     58,    110,    163,
-     216,    240,    191,    136,
-     172,     30,     22,     74,
-     128,     74,    234,    224,
-     171,    118,    190,    242,
-     215,     93,    147,     56,
-       2,    207,    102,    155,
-     208,      5,     56,    109,
-      91,     39,    241,    189,
-     134,     83,     29,     23,
-      77,    128,    182,     20,
-     221,    168,    116,    191,
-     246,     43,     95,    147,
-      55,      3,    204,    152,
-     156,    209,    249,    197,
-     142,    165,    219,    240,
-     186,    135,     81,    227,
-      25,     79,    128,    183,
-      19,    223,    171,    116,
-     192,     10,     42,     94,
-     107,     55,      1,     50,
-     105,    156,    210,    248,
-     194,    142,    167,    218,
-      16,    186,    132,     81,
-      27,     24,     78,    131,
-      71,     19,    221,     87,
-     115,    193,    247,    212,
-     158,    106,     53,      1,
-      52,    104,    158,     44,
-     247,     61,    114,    167,
-     220,    238,    185,    123,
-     176,    229,     26,     79,
-     123,     71,     17,    220,
-     167,    114,     61,    247,
-      44,     97,    150,    203,
-       0,    202,    149,     96,
-     212,      9,     62,    114,
-     168,     35,    236,    184,
-     131,     78,    230,     26,
-      81,    133,     69,     16,
-     219,     89,    142,    195,
-     248,     45,    157,    104,
-      51,    254,    201,    148,
-      95,     43,     10,     63,
-     116,    169,     33,    236,
-      72,    124,    178,    231,
-      28,    174,    121,    187,
-      15,    219,    165,    112,
-      59,    249,     47,     99,
-     103,     50,      2,     55,
-     109,    161,     41,    244,
-     191,    138,     84,    223,
-      20,    182,    129,     76,
-      23,     29,     82,    135,
-     188,     14,    217,    164,
-     144,     58,    250,     47,
-     155,    103,     48,    252,
-      56,    109,    162,    215,
-      12,    190,    118,    171,
-     224,     21,     75,    126,
-      75,     22,    225,    172,
-     136,    188,    242,    216,
-     162,    111,     57,    250,
-      49,    101,    154,     48,
-     250,    198,    110,    163,
-     216,     13,    189,    137,
-      82,    225,     22,    180,
-     127,     74,     21,    224,
-      84,    137,     65,     12,
-      40,     93,    146,     56,
-       3,     49,    102,    100,
-      47,      5,    197,    145,
-      91,     38,    241,     67,
-     120,     82,     29,     23,
-      76,    126,    182,    234,
-      32,    170,    138,    191,
-      11,    214,    161,    147,
-     200,    253,     50,    152,
-      99,    209,      6,    196,
-     112,    165,     37,    241,
-     187,    134,     81,     28,
-      24,    178,    125,    183,
-     237,     33,    169,    139,
-     192,     10,    213,     95,
-     148,    201,    254,    204,
-     151,     98,     45,    248,
-     195,    113,    166,     36,
-     239,     69,    122,    175,
-      27,    230,     78,    131,
-      71,     18,    221,    168,
-     140,    193,      9,    212,
-     159,    106,     53,    255,
-      52,    105,    158,     44,
-     247,     61,    114,     88,
-     220,     17,     70,    132,
-      79,     26,     26,     79,
-     123,     70,    238,     35,
-      88,    141,    194,    247,
-      44,     97,    105,     52,
-     255,    202,    149,    159,
-     212,    246,    193,    140,
-     168,    221,    237,    184,
-     131,     78,    230,     27,
-     175,    122,    186,     16,
-     219,     89,    142,     60,
-       7,     45,    157,    104,
-     204,      1,    201,    107,
-     160,     42,    245,     63,
-     116,    169,    222,    236,
-     183,    130,     77,     24,
-      28,     81,    121,     68,
-      15,    218,    165,    143,
-     196,      6,     46,     99,
-     103,     50,      2,     55,
-     147,    161,     41,    244,
-     191,    117,    170,    223,
-     235,    182,    129,    179,
-     232,     29,    173,    120,
-      67,     14,     38,     91,
-     111,     58,    250,    208,
-     155,    153,    206,      3,
-      56,    109,     93,     40,
-     243,     65,    118,    171,
-     224,    234,    181,    128,
-     180,    233,     30,    172,
-     119,     66,    242,     39,
-      92,    145,     57,      4,
-     207,    101,    101,     48,
-     251,     57,    110,     92,
-      39,    242,    189,    119,
-     172,     30,    233,    180,
-     127,    181,    234,     31,
-      84,    137,     65,     12,
-      40,     93,    109,    199,
-     252,    206,    153,    155,
-     208,    250,     58,    111,
-     164,     38,     14,     67,
-     120,    173,    226,     23,
-     179,    126,     73,    235,
-     223,    170,    117,     64,
-      11,    214,     94,    108,
-      55,    253,     50,    152,
-      99,    209,    249,    196,
-     143,     90,     37,    240,
-      68,    134,     81,    227,
-      24,    178,    125,    183,
-      19,    222,    169,    116,
-      63,     10,     42,     95,
-     107,     54,    254,     51,
-     104,    157,    210,      7,
-      60,    113,    166,    219,
-      16,     69,    133,     80,
-     228,     25,    177,    124,
-     184,     18,    221,     87,
-     115,     62,    246,     43,
-      96,    149,    202,    255,
-      52,    105,    158,    211,
-       8,     61,    114,    167,
-      35,    238,     70,    132,
-      79,     26,    229,    176,
-     123,     70,     17,    220,
-     167,    114,     61,      8,
-     211,    158,    150,    203,
-     255,    202,    149,     96,
-      43,    246,     62,    115,
-      87,     34,     18,     71,
-     131,    177,    230,    228,
-     175,    133,    186,    239,
-      36,     89,    142,    195,
-     248,     45,     98,    151,
-     204,      1,    201,    148,
-      95,     42,    245,     63,
-     116,    169,     33,    236,
-      72,    125,    178,    231,
-      28,     81,    121,     68,
-      15,    218,    165,    112,
-      59,      6,    209,    156,
-     103,     50,    253,    200,
-     147,    161,    214,    244,
-      64,    138,     85,     32,
-     235,    182,    129,    179,
-     232,     29,     82,    120,
-     188,    241,     38,     91,
-     144,    197,    250,     47,
-     100,    153,    206,      3,
-      56,    109,     93,     40,
-      12,     65,    118,    171,
-     224,     21,     74,    127,
-     180,     22,    225,     83,
-     119,     66,     13,    216,
-     163,    110,     57,      4,
-     207,    154,    154,    207,
-       4,     57,    110,     92,
-     216,     13,     66,    119,
-     172,    225,     22,     75,
-     128,    181,    234,     31,
-      84,    137,    190,    243,
-      40,     93,    109,    199,
-     252,     49,    153,    100,
-      47,    250,    197,    144,
-      91,     38,    241,    188,
-     135,     82,     29,    232,
-     179,    129,     73,     20,
-     223,    170,    117,     64,
-      11,    214,    161,    108,
-     200,    253,     50,    103,
-     156,    209,      6,     59,
-     112,    165,    218,     15,
-      68,    121,    174,     28,
-     231,    178,    130,    183,
-      19,     33,     86,    139,
-      63,     10,     42,     95,
-     107,     54,      1,    204,
-     151,     98,     45,    248,
-     195,    142,     89,     36,
-     239,     69,    122,    175,
-      27,    230,    177,    124,
-      71,    237,     34,    168,
-     115,    193,    246,    212,
-     159,    149,    202,    255,
-      52,    105,    158,     44,
-       8,    194,    141,     88,
-      35,     17,     70,    132,
-      79,    229,     26,     79,
-     132,    185,    238,     35,
-      88,    141,    194,    247,
-      44,    158,    105,     52,
-     255,    202,    149,     96,
-      43,    246,    193,    115,
-     168,    221,     18,     71,
-     124,    177,    230,     27,
-      80,    133,     69,     16,
-     219,    166,    113,     60,
-     248,     45,    157,    104,
-     204,    254,    201,    148,
-      95,     42,    245,    192,
-     139,     86,     33,    236,
-     183,    130,     77,     24,
-     227,    174,    121,     68,
-      15,    218,     90,    143,
-     196,    249,     46,     99,
-     152,    205,      2,     55,
-     108,    161,    214,     11,
-      64,    138,    170,    223,
-      20,     73,    126,    179,
-     232,     29,     82,    135,
-     188,    241,     38,     91,
-     144,    197,    250,    208,
-     155,    102,     49,    252,
-     199,    109,     93,     40,
-     243,    190,    137,     84,
-      31,    234,    181,    128,
-      75,     22,    225,    172,
-     119,     66,     13,    216,
-     163,    145,    198,    251,
-      48,    101,    101,     48,
-       4,     57,    110,    163,
-     216,     13,     66,    119,
-     172,    225,     22,     75,
-     128,    181,     21,    224,
-      84,    137,    190,     12,
-     215,    162,    109,     56,
-       3,    206,    102,    155,
-     208,    250,     58,    111,
-      91,     38,    241,    188,
-     135,     82,     29,    232,
-     179,    126,     73,     20,
-     223,    170,    117,     64,
-     244,     41,     94,    147,
-     200,    253,    205,    152,
-      99,     46,    249,     59,
-     112,    165,    218,    240,
-     187,    121,     81,     28,
-     231,     77,    130,    183,
-     236,     33,    169,    116,
-     192,    245,    213,    160,
-     107,     54,      1,    204,
-     151,    157,    210,      7,
-      60,    113,    166,    219,
-      16,    186,    133,     80,
-      27,     25,     78,    131,
-     184,    237,     34,     87,
-     115,     62,      9,     43,
-      96,    149,    202,    255,
-      52,    105,     97,     44,
-     247,    194,    114,    167,
-     220,     17,     70,    123,
-     176,    229,     26,     79,
-     132,    185,    238,     35,
-      88,    141,     61,      8,
-     211,    158,    105,     52,
-     255,     53,    106,    159,
-     212,      9,     62,    115,
-      87,     34,    237,    184,
-     131,     78,     25,    228,
-     175,    122,     69,    239,
-      36,     89,    142,    195,
-     248,    210,    157,    104,
-      51,    254,    201,    148,
-      95,    213,     10,    192,
-     116,    169,     33,    236,
-      72,    125,    178,    231,
-      28,     81,    134,     68,
-      15,    218,    165,    112,
-      59,      6,    209,     99,
-     152,    205,      2,     55,
-     108,    161,    214,     11,
-      64,    117,    170,    223,
-      20,    182,    129,     76,
-      23,    226,     82,    135,
-     188,    241,    217,    164,
-     111,     58,      5,    208,
-     155,    102,     49,    252,
-     199,    146,     93,     40,
-     243,    190,    137,     84,
-     224,     21,     74,    127,
-     180,    233,     30,     83,
-     136,    189,    242,     39,
-      92,    145,    198,    251,
-      48,    101,    101,    207,
-       4,     57,    110,    163,
-      39,     13,    189,    136,
-     172,    225,     22,    180,
-     128,    181,     21,     31,
-      84,    137,    190,     12,
-     215,    162,    146,     56,
-       3,    206,    153,    100,
-      47,      5,     59,    111,
-     164,     38,    241,    188,
-     134,     82,     28,    233,
-     179,    129,    183,    234,
-      34,     84,    139,    190,
-     244,     41,    161,    108,
-      54,      0,    204,    153,
-      98,     47,    249,     58,
-     115,    161,    222,     11,
-      71,    120,    174,     28,
-     230,    179,    124,     74,
-      16,    221,    163,    121,
-      51,      3,    222,     86,
-     186,    226,    244,    221,
-     133,    119,     62,    253,
-      44,    105,    161,     35,
-     229,    189,    122,    161,
-     246,     28,    160,    102,
-      97,     14,     57,    104,
-     174,     46,     20,    206,
-     137,    111,    197,    232,
-      55,    157,    103,    215,
-       6,     43,    104,    169,
-      35,    224,    161,    155,
-      85,     58,    242,     98,
-     200,    162,     13,    198,
-     183,     99,    193,    233,
-      13,    153,     78,     59,
-      11,     32,    116,    130,
-     215,    215,    220,    128,
-      87,     34,    224,    157,
-     128,    137,    204,    236,
-     184,    124,     84,     26,
-      52,     66,    114,     26,
-      20,     58,     70,    183,
-     221,    248,    214,    129,
-     166,    223,    240,    216,
-     160,    127,    253,     93,
-     107,    150,     83,      6,
-     195,     89,    182,    146,
-       7,    255,    175,    131,
-     200,    236,     62,    153,
-     115,    201,      9,    205,
-     136,    118,      5,    252,
-      10,     56,     85,     26,
-     193,    160,    126,    128,
-     172,     11,    156,     56,
-      77,    229,      6,    127,
-     159,     52,     16,     44,
-     108,    110,     47,    216,
-     225,    105,    233,    238,
-     225,    138,    146,     95,
-     243,     85,    126,    145,
-      12,     60,     18,     74,
-     150,    157,    246,    199,
-     180,    156,    214,     13,
-     236,    182,     77,    212,
-      83,     19,    177,    112,
-      55,    247,     93,     74,
-     181,     50,    161,    160,
-     164,    150,    240,     19,
-     179,     92,    185,    216,
-      34,    188,     64,      9,
-      24,    112,     60,    145,
-      19,    209,    205,     99,
-     151,    238,    245,    248,
-     191,    188,    218,      8,
-      68,    112,    106,      1,
-       8,     99,    118,    120,
-      55,    227,    170,    203,
-     171,      3,    134,    179,
-      96,    194,     49,      8,
-     128,     16,     11,     20,
-      99,    115,    171,     22,
-     249,    178,    187,    148,
-      50,    157,    145,     81,
-     226,    132,     20,    146,
-      58,     46,    245,     27,
-      43,    190,      0,    171,
-     218,     88,    184,    209,
-      23,    176,    146,    187,
-     215,     25,    139,     65,
-     109,     30,    109,     60,
-     139,    105,     52,     47,
-      65,    175,    255,      9,
-     133,    211,    149,    231,
-      22,     58,    134,     67,
-      42,     61,    111,    145,
-      14,     46,    197,     85,
-     232,    251,     37,    135,
-     177,    150,    239,    206,
-      53,    179,     62,     43,
-      48,      5,    123,     99,
-      61,    237,     50,     67,
-     164,     14,    214,    146,
-     147,    242,    140,     18,
-     247,     69,    182,    202,
-      20,    117,    117,    116,
-      78,     33,     34,    176,
-     207,    232,    214,    158,
-     130,    241,    255,    238,
-     187,    115,    199,    113,
-     124,    181,      4,     30,
-      60,    119,    161,    176,
-      34,    156,    173,    186,
-     226,    251,    195,    133,
-     105,    217,     38,     50,
-     140,    117,     27,    247,
-      22,     62,    117,    110,
-     253,     93,     99,    151,
-     241,    244,    145,     97,
-     157,    208,     45,    167,
-     120,     44,    247,     10,
-     104,    113,     19,    205,
-     208,     46,    245,     45,
-     181,    158,    126,    185,
-     254,     52,    181,    175,
-      84,    255,      0,     90,
-     118,     76,     24,     37,
-      64,    155,     43,     17,
-     230,    141,    164,    136,
-     244,    253,    131,    165,
-     222,     24,     94,    118,
-     114,      9,     25,     94,
-     140,    179,     24,    248,
-     170,    159,    189,     28,
-     216,    138,    102,    133,
-     206,    237,    182,    152,
-     217,      4,     43,    119,
-      94,     57,    245,     91,
-     117,    169,    230,    229,
-     166,    131,    165,     24,
-     197,    164,    109,    170,
-     189,     61,    156,     68,
-     219,    236,     49,    110,
-     150,     35,    232,     42,
-     108,    164,     34,    241,
-     178,    136,    164,    237,
-     250,    151,    107,    189,
-     210,     17,    183,     73,
-      51,    237,     51,     80,
-     151,     56,     18,     55,
-      76,    136,     37,    242,
-     196,    135,     92,    203,
-     238,    147,    182,     89,
-     161,     93,    161,     66,
-      94,    235,     50,    116,
-     153,     45,     46,    223,
-      69,    184,    207,     19,
-     219,    146,     99,    213,
-       9,    212,    185,    123,
-     231,     67,    187,    198,
-      83,    239,     19,     87,
-     164,     70,     59,    195,
-      71,    182,    211,     26,
-     198,    147,    104,    219,
-       3,    211,    163,    123,
-     234,     73,    208,    188,
-      93,    222,     17,     82,
-     104,     77,     58,    243,
-     118,    176,    177,      2,
-     212,    169,    123,    206,
-     244,    207,    160,    156,
-     135,     16,    255,    131,
-     184,    210,     14,     50,
-     116,     67,     61,     27,
-     120,     88,     77,      8,
-     242,    162,    121,     70,
-      10,    193,    181,    162,
-     218,     32,    247,    105,
-     151,    193,     22,    201,
-     183,    124,    217,     37,
-      92,    115,    170,     42,
-     255,    176,    121,     73,
-      52,    229,    107,    153,
-     117,     57,     50,    120,
-     153,    203,    252,    242,
-     169,    157,    246,     39,
-      62,    146,     81,     60,
-     251,    190,    142,     91,
-     242,     62,    181,    178,
-      96,     23,      4,    116,
-     168,     75,     59,    246,
-      91,    191,    230,    246,
-      48,    151,    107,     55,
-     242,    220,    111,    227,
-     245,    213,    131,    152,
-     173,    234,     49,    106,
-     111,    102,     26,     17,
-      95,    133,    168,    243,
-     198,     94,    159,     26,
-      47,     24,     44,    159,
-      26,    218,    192,    108,
-     190,    197,    224,    145,
-     142,    178,    244,     19,
-     177,    109,     92,    232,
-       1,     86,    111,    179,
-     232,    223,    191,    106,
-     202,    248,     42,    118,
-     123,      5,    245,     44,
-     100,    172,    220,    247,
-     174,    141,    168,     29,
-       9,    107,    138,     87,
-       9,    220,    174,    128,
-     230,    228,    207,    131,
-      99,    199,    236,     53,
-     134,    122,     47,     31,
-      53,    138,    178,    201,
-     249,    154,    125,    160,
-     224,     30,    178,    109,
-      77,    234,     51,     92,
-     113,     49,     16,    201,
-     156,    131,    238,    215,
-     202,    191,    123,    212,
-       4,     44,    102,     93,
-      58,    253,     71,    107,
-     161,    233,    230,    167,
-     103,     75,     22,     48,
-      99,    144,     30,     56,
-     221,    109,    136,    232,
-       8,    235,    186,    100,
-     242,     19,    195,    134,
-      69,     55,    231,     79,
-      88,    170,     18,    249,
-     185,    115,    180,    241,
-      55,    164,    104,     33,
-     248,     13,    117,    110,
-      34,    240,    197,    145,
-     185,    253,     14,    216,
-     152,     68,     51,      0,
-     100,    119,     80,      3,
-     228,     88,    145,    174,
-      14,    198,    189,    143,
-     231,    222,    210,    135,
-     115,     62,    254,     36,
-     123,     91,     60,    248,
-     184,    138,    161,    210,
-      18,    176,    145,     68,
-     244,     60,     83,    119,
-      73,      2,    209,     75,
-     157,     61,     15,    213,
-     156,     96,    202,      5,
-     194,    151,    164,    194,
-      24,     65,    134,     65,
-      21,     29,     65,    126,
-     181,     20,    241,    160,
-     137,    187,    250,     35,
-     166,    110,    201,    234,
-      53,    152,    111,     34,
-     247,     56,    107,    162,
-     218,    240,    179,    128,
-     165,    234,     20,     77,
-     145,    164,    224,    224,
-     160,    103,     79,     11,
-     215,     93,    107,     49,
-       9,    202,    110,    156,
-      47,      6,     42,    117,
-     179,    220,    253,    179,
-     137,     90,    226,     22,
-     180,    115,     89,     30,
-      35,     95,    130,    184,
-     243,     32,     81,    157,
-     203,      6,    196,    147,
-     105,     40,      4,     57,
-     131,     87,     37,     12,
-      68,    126,    186,    242,
-      28,    177,    121,     76,
-      23,    222,     87,    114,
-      50,      6,    221,    161,
-     147,    196,    246,     50,
-     106,    149,    219,      1,
-      61,    138,     81,     47,
-     227,    176,    131,    172,
-     231,    229,    183,    125,
-     190,    228,     40,     90,
-     135,    195,     10,    213,
-      97,    105,     60,     10,
-     204,    147,    102,     41,
-      14,     55,    118,     88,
-     220,     21,     77,    119,
-     181,     24,    226,    186,
-     115,     68,     17,    217,
-     160,    115,    196,    240,
-      42,    103,    104,     60,
-     251,     48,     99,    152,
-     212,    240,    203,    135,
-      94,     33,     18,     68,
-     122,    184,    225,     24,
-      81,    123,    186,    231,
-      44,    167,    121,     53,
-      12,    216,    154,    106,
-     200,      9,     62,     98,
-     168,    215,     11,     60,
-     118,    169,    222,    239,
-     179,    129,     72,     31,
-     233,    166,    123,    191,
-     247,     32,     94,    142,
-     196,    253,     42,    156,
-     101,    205,      0,    205,
-     152,     86,     45,    246,
-      67,    115,    168,     32,
-      20,     75,    127,    178,
-     238,     27,    173,    123,
-     188,    240,    219,    167,
-     110,     57,      1,     45,
-     108,    159,    204,    252,
-     196,    148,     95,    211,
-       8,    191,    139,     84,
-      31,    234,    180,    127,
-     183,    237,     31,    173,
-     117,     67,    243,     38,
-     161,    104,     61,      4,
-      50,    102,    154,     51,
-     248,    198,    106,    164,
-     222,     12,    189,    136,
-     172,     30,    235,    176,
-     121,     79,     21,     30,
-     170,    119,    191,    243,
-     213,     93,    148,    193,
-     255,     50,     98,    154,
-      44,    254,    193,    147,
-      90,    217,    243,    184,
-     134,     82,     29,     21,
-      72,    129,     73,    234,
-      34,     87,    136,    188,
-      11,    213,    162,    111,
-      53,    255,     49,    153,
-     103,     46,      4,     57,
-     112,    165,    218,    241,
-     186,    120,    175,     29,
-     229,    178,    125,    183,
-     239,     34,    168,    118,
-     192,    244,     43,     94,
-     149,     52,      2,    205,
-     151,     98,     45,    249,
-     193,    113,    165,    217,
-      16,     69,    123,    175,
-     228,     25,     78,    131,
-     185,    237,    222,    173,
-     112,    192,    245,     41,
-      96,    107,     52,    255,
-      53,    107,    156,    210,
-       8,     61,    140,     90,
-     220,     16,    186,    129,
-      78,    231,     24,     76,
-     135,     70,     18,    221,
-      90,    143,    195,    245,
-     211,    157,    107,    203,
-       0,     53,    106,     96,
-      42,    247,     62,    113,
-     170,     34,    236,    184,
-     124,    177,    231,    228,
-     173,    121,     68,    239,
-      38,     91,    142,     61,
-       6,    211,    157,    151,
-     205,      1,    201,    107,
-     161,     40,    241,    193,
-     117,    168,    223,     18,
-      73,    130,     76,     24,
-      28,     81,    135,    185,
-     241,    218,    164,    114,
-      57,      5,    208,     98,
-     153,    205,      2,     54,
-     109,    160,    214,    244,
-     191,    116,    168,    222,
-      20,    183,    131,     78,
-      22,    226,     82,    135,
-     188,     14,    217,     91,
-     145,    197,    250,     47,
-     100,    153,    206,      3,
-     198,    147,     93,    215,
-      12,    190,    137,     84,
-      31,     21,    181,    128,
-     180,    232,     31,     83,
-     118,     64,     12,     39,
-      92,    145,    199,    251,
-     206,    155,    154,    207,
-       4,     57,    110,     92,
-      39,     13,     67,    118,
-     172,     28,    234,    180,
-     129,    180,    232,     29,
-      84,    116,     66,     13,
-      41,     92,    146,     57,
-       3,    206,    153,    101,
-      47,      5,     58,    111,
-     165,    216,    241,    188,
-     120,    173,     29,     23,
-      77,    128,     73,     21,
-     223,    170,    117,     64,
-     244,     41,     94,    147,
-      55,      3,    204,    153,
-      99,    208,      4,     59,
-     141,     91,     36,    240,
-      68,    121,     80,     28,
-      25,     79,    130,     73,
-      18,    220,    169,    137,
-     194,    245,     42,    160,
-     106,     55,    254,     51,
-     104,    156,    211,      7,
-     195,    143,     89,     36,
-      16,    186,    122,    175,
-      27,    230,     78,    131,
-      71,    237,     34,     86,
-     141,    193,      9,    213,
-     157,    107,    202,    255,
-      52,    150,     96,     45,
-     247,     61,    114,    167,
-     220,     17,     71,    123,
-      79,     26,    229,    177,
-     123,    185,    238,     35,
-      88,    114,     60,      8,
-     211,     97,    151,    202,
-       0,    202,    149,     97,
-      42,    246,     62,    115,
-     168,    221,    237,    184,
-     124,    176,    230,    228,
-     175,    133,    186,    238,
-      37,    166,    112,     61,
-       6,    210,     98,    150,
-     204,    254,    200,    148,
-      95,    213,     11,     63,
-     116,    169,     33,    237,
-     183,    125,     77,     24,
-      28,     81,    121,     69,
-     240,     37,    165,    112,
-     196,    249,     46,     99,
-     152,     50,    253,     55,
-     147,     94,     41,     11,
-     191,    138,    170,     32,
-     235,    182,    126,    179,
-     232,     28,     82,    121,
-      66,     14,     38,     91,
-     144,     58,      5,    208,
-     155,    153,    206,    252,
-     199,    146,    162,    215,
-      12,    190,    137,     84,
-      31,     21,     74,    128,
-      75,     22,    225,     83,
-     136,    188,    242,    216,
-     163,    145,    198,    251,
-      48,    154,    101,     48,
-     251,     57,    110,    163,
-      39,    242,     66,    119,
-      83,     30,     22,     75,
-     128,     74,     21,    224,
-     171,    137,    190,    243,
-     215,     93,    109,     56,
-       3,    207,    101,    100,
-      46,      5,    196,    144,
-      91,    217,    241,     67,
-     120,     83,    227,     23,
-     179,    129,     73,    235,
-      32,    170,    117,     64,
-     244,     41,     94,    108,
-      55,    253,     50,    103,
-      99,    209,      6,     59,
-     143,     90,     37,     15,
-      68,    134,    174,    227,
-      24,    178,    125,    183,
-     236,     33,    169,    116,
-     192,    245,    213,     95,
-     148,     54,      1,     51,
-     151,    157,    210,    248,
-     195,    113,     89,     36,
-     239,     69,    122,    175,
-     228,    230,    177,    124,
-     184,    237,    221,    168,
-     115,     62,      9,     43,
-      96,    106,    202,      0,
-     203,    105,    158,    211,
-       8,     61,    141,     88,
-     220,     17,    185,    132,
-     176,     26,    229,     79,
-     132,    185,     17,    220,
-     167,    114,    194,    247,
-      44,     97,    105,     52,
-       0,     53,    149,     96,
-     212,      9,    193,    115,
-     168,     34,    237,    184,
-     131,    177,    230,    228,
-     175,    122,     69,    239,
-      36,    166,    113,     60,
-       7,     45,     98,    151,
-      51,    254,    201,    148,
-     160,    213,     10,    192,
-     139,     86,    222,     19,
-      72,    125,     77,     24,
-      28,     81,    134,     68,
-      15,    218,    165,    143,
-     196,    249,    209,    156,
-     152,    205,      2,     55,
-     108,    161,     41,    244,
-     191,    138,    170,    223,
-      20,     73,    129,     76,
-     232,     29,    173,    120,
-      67,    241,    217,     91,
-     144,    197,      5,    208,
-     100,    153,     49,    252,
-     199,    109,    162,    215,
-      12,    190,    137,    171,
-     224,     21,     74,    128,
-      75,    233,     30,     83,
-     136,     66,     13,     39,
-      92,    145,     57,      4,
-     207,    154,    101,    207,
-       5,    198,    147,     92,
-     217,     13,     66,    136,
-      83,     30,    233,     75,
-     128,    181,     21,    224,
-      84,    137,    190,     12,
-     215,    162,    109,    199,
-     252,    206,    153,    155,
-     208,      5,    197,    144,
-     164,     38,    241,     67,
-     120,     82,    226,    232,
-     179,    129,    182,     20,
-      32,    170,    117,    191,
-     244,     41,    161,    108,
-      55,    253,     50,    103,
-      99,     46,      6,     59,
-     112,    165,     37,     15,
-     187,    121,    174,    227,
-     231,    178,    125,    183,
-     236,    222,    169,    139,
-      63,     10,    213,     95,
-     148,     54,    254,    204,
-     104,    157,     45,      6,
-     195,    142,    166,    219,
-      16,    186,    133,    175,
-     228,    230,     78,    124,
-     184,    237,     34,    168,
-     115,    193,    246,     43,
-     159,    106,    202,    255,
-     203,    105,     97,     44,
-       8,    194,    141,    165,
-      35,    239,     70,    122,
-      79,    229,     27,    176,
-     122,    185,    238,     35,
-      88,    114,     61,    247,
-      45,    158,    105,    203,
-     254,     53,    106,     96,
-      43,      9,    193,    140,
-     168,     34,    237,     71,
-     131,     78,    230,     27,
-     175,    133,    186,     16,
-     219,     89,    143,    195,
-       7,    210,    157,    151,
-      51,    254,     55,    107,
-      94,     42,     11,    192,
-     116,    168,     33,    236,
-     183,    130,    178,    231,
-      28,    174,    121,     68,
-      15,     36,     90,    112,
-      59,    249,    209,     99,
-     103,     50,      2,     55,
-     147,     94,    214,     11,
-     191,    138,     85,    223,
-      20,    182,    129,     76,
-     232,     29,    173,    120,
-     188,    241,    217,     91,
-     111,    197,      5,    208,
-     155,    153,    207,      3,
-     199,    109,     93,    215,
-     243,     65,    118,     84,
-      31,     21,    181,    127,
-     181,     22,    225,     83,
-     119,     66,    243,    216,
-     163,    145,     57,    251,
-      48,    101,    101,     48,
-       4,    198,    145,    163,
-     216,    242,     66,    136,
-     172,    225,     22,     75,
-     127,     74,    234,     30,
-     171,    119,    191,    243,
-     214,     93,    146,     56,
-       3,     48,    153,    100,
-     209,      5,    197,    145,
-      91,    216,     14,    189,
-     135,    173,     29,     23,
-     179,    129,    182,     21,
-     223,     85,    117,    191,
-     244,    214,    160,    147,
-     200,      2,     50,    103,
-      98,    209,      6,    196,
-     143,     90,    218,    240,
-      68,    120,     80,     28,
-      24,     77,    125,     72,
-     236,    222,     86,    139,
-      63,    245,    213,     94,
-     148,    201,    254,    204,
-     151,     98,    211,      7,
-     195,    142,    166,     36,
-      16,     69,    133,    175,
-      27,    230,    177,    131,
-     184,     18,    221,    168,
-     140,    193,      9,    212,
-      96,    149,     53,      0,
-     203,    150,    158,     44,
-       8,    194,    141,    166,
-     220,    238,    185,    123,
-      79,     26,     26,    176,
-     132,     70,    238,     35,
-      88,    114,    194,    247,
-     211,     97,    150,     52,
-     255,    202,    106,     96,
-     212,      9,    193,    115,
-      87,    221,    237,     71,
-     124,    177,    230,     27,
-      80,    122,    186,     16,
-     219,     89,    113,    195,
-     248,    210,    157,    104,
-     204,      1,     54,    148,
-     160,     42,    245,    192,
-     139,    169,     33,    236,
-      72,    130,     77,    231,
-      28,    175,    134,     68,
-      15,     37,    164,    143,
-     196,      6,     46,    156,
-     103,    204,      2,    201,
-     147,    161,    214,    244,
-      64,    117,     85,     32,
-      20,     72,    129,     76,
-     232,     29,     82,    135,
-     188,     14,    217,     91,
-     111,     58,    250,     47,
-     155,    102,     49,    252,
-      56,    146,     93,    215,
-     243,    190,    137,    171,
-      31,     21,     74,    128,
-      75,    233,    225,     83,
-     119,     66,    242,    216,
-     163,    110,    198,      4,
-     207,    101,    101,    207,
-     251,    198,    110,    163,
-      39,    242,    189,    136,
-      83,    225,     22,    180,
-     127,    181,    234,    224,
-      84,    137,     65,     12,
-     214,     93,    146,     56,
-     252,    206,    153,    100,
-     209,      5,     58,    144,
-      91,    217,    241,     67,
-     120,     82,     29,    232,
-     179,    129,    182,     20,
-      32,    170,    116,    191,
-     245,    214,     94,    108,
-      55,    253,     50,    152,
-      99,     46,    249,     59,
-     143,     90,     37,     14,
-      68,    121,     81,     28,
-      24,    178,    130,    183,
-      19,    222,     86,    139,
-      63,    245,    213,     95,
-     148,    201,      1,    204,
-     104,    157,    210,      7,
-     194,    142,    166,     36,
-      16,     69,    132,     80,
-      27,    230,     79,    124,
-     184,    237,    220,    168,
-     140,    192,      9,     43,
-     159,    107,    202,    255,
-      52,    105,     97,     44,
-       8,     61,    141,    167,
-      35,    238,    185,    123,
-     176,    229,     26,    176,
-     123,    185,    238,    220,
-     167,    141,    194,      8,
-     211,    158,    150,     52,
-     255,     53,    106,    159,
-      43,    246,    193,    140,
-     169,    221,    237,    184,
-     131,    177,    231,     27,
-     175,    133,    186,     16,
-      36,     89,    113,     60,
-       7,     45,     98,    104,
-      51,      0,     55,    107,
-      95,     42,     10,     63,
-     139,     86,     33,     19,
-     183,    125,    178,     24,
-      28,     81,    121,     69,
-     240,     36,    164,    143,
-     196,    249,     46,     99,
-     103,     50,      2,     55,
-     147,    161,    214,    244,
-      64,    138,    170,    223,
-     235,    182,    129,    179,
-     232,    226,     82,    120,
-      67,     14,    216,     91,
-     146,    197,      4,    208,
-     100,    153,     49,      3,
-     199,    109,    162,     40,
-     243,    190,    118,    171,
-     224,    234,    181,    127,
-     180,    233,     30,     83,
-     136,     66,    242,     39,
-     162,    145,    198,      4,
-      48,    154,    101,     48,
-       4,    198,    145,    163,
-      39,     13,    189,    136,
-     172,    225,    233,     75,
-     128,     74,    234,    224,
-     171,    137,    191,     12,
-     214,    162,    146,    199,
-     252,     49,    152,    155,
-     208,    250,    197,    110,
-     164,    217,    241,    188,
-     121,     82,    226,    232,
-     179,    129,    182,    235,
-      32,     85,    116,     64,
-     245,     41,    161,    108,
-      55,    253,     50,    103,
-      99,     46,      6,    196,
-     112,    165,    218,    240,
-     187,    134,     81,     28,
-      24,    178,    130,    183,
-      19,    222,    169,    139,
-     192,     10,     42,    161,
-     107,     54,      1,     51,
-     104,    157,     45,    248,
-     195,    113,     89,     36,
-      16,     69,    133,    175,
-     228,    230,     78,    131,
-      71,    237,     34,     87,
-     115,     62,    246,    212,
-      96,    149,    202,    255,
-     203,    150,     97,     44,
-       8,     61,    141,     88,
-      35,    238,     70,    123,
-      79,     26,    229,    176,
-     132,    185,     17,    220,
-      88,    114,    194,    247,
-     211,     97,    150,     52,
-       0,     53,    149,    159,
-     212,      9,     62,    140,
-      87,    221,    237,    184,
-     125,     78,     25,     26,
-     175,    133,    186,     16,
-      36,     89,    113,     60,
-     248,    210,     98,    104,
-      51,      1,     54,    148,
-      95,    213,    245,    192,
-     116,     86,     33,    236,
-      72,    130,    178,     24,
-     227,     81,    120,     68,
-     241,    218,    165,    143,
-      59,      6,     46,    156,
-     103,    205,    253,     55,
-     108,     94,    214,     11,
-     191,    117,    170,    223,
-     235,     73,    129,    179,
-     232,     29,     82,    120,
-      67,    241,     38,    164,
-     144,     58,      5,    208,
-     100,    102,    206,      3,
-     199,    109,    162,     40,
-      12,     65,    136,    171,
-      31,    234,     74,    127,
-      75,    233,     30,    172,
-     136,     66,     13,     39,
-     163,    145,    198,      4,
-     207,    101,    101,    207,
-       4,     57,    110,    163,
-     216,    242,     66,    119,
-      83,     30,    233,    180,
-     128,    181,     21,     31,
-     171,    118,    190,     12,
-     215,     93,    146,     56,
-     252,     49,    153,    155,
-     208,    250,     58,    144,
-      91,    217,    241,    188,
-     120,    173,     29,     23,
-     179,    126,    182,     20,
-     223,     85,    117,     64,
-     244,    214,    161,    147,
-      55,      2,     50,    152,
-      99,    209,    249,     59,
-     112,     90,    218,     15,
-     187,    134,    174,     28,
-     231,     77,    125,     72,
-     236,    222,    169,    139,
-      63,     10,     42,    160,
-     107,    201,      1,     51,
-     104,     98,    210,      7,
-     195,    142,    166,    219,
-     239,     69,    133,     80,
-     228,    230,    177,    131,
-      71,     18,    221,    168,
-     115,    193,      9,    212,
-      96,    149,     53,      0,
-     203,    150,    158,    211,
-     247,     61,    114,    167,
-     220,     17,     70,    123,
-      79,     26,     26,    176,
-     132,    185,    238,     35,
-      88,    141,    194,      8,
-     211,    158,    105,     52,
-     255,     53,    106,     96,
-     212,      9,     62,    140,
-      87,     34,    237,    184,
-     131,     78,     25,    228,
-      80,    133,    186,    239,
-     219,     89,    142,     60,
-     248,     45,    157,    104,
-      51,    254,    201,    148,
-      95,    213,     10,     63,
-     116,     86,     33,     19,
-      72,    125,    178,    231,
-     227,     81,    134,     68,
-     240,     37,    165,    112,
-      59,      6,     46,     99,
-     103,     50,    253,    200,
-     147,    161,    214,     11,
-      64,    138,    170,     32,
-     235,    182,    129,     76,
-     232,     29,     82,    135,
-     188,     14,     38,     91,
-     111,     58,      5,    208,
-     155,    153,     49,    252,
-      56,    146,    162,    215,
-     243,     65,    118,    171,
-     224,     21,     74,    127,
-      75,     22,     30,    172,
-     136,    189,     13,    216,
-     163,    110,     57,    251,
-      48,    101,    154,    207,
-       4,     57,    145,     92,
-      39,    242,    189,    136,
-      83,     30,     22,    180,
-     127,    181,    234,     31,
-      84,    118,    190,    243,
-      40,     93,    146,    199,
-     252,     49,    102,    155,
-     208,      5,    197,    144,
-     164,    217,     14,    188,
-     135,     82,     29,    232,
-      76,    129,    182,    235,
-     223,    170,    117,     64,
-     244,    214,    161,    108,
-     200,      2,    205,    152,
-      99,     46,    249,    196,
-     143,     90,    218,     15,
-      68,    134,     81,     28,
-      24,     77,    130,    183,
-     236,     33,     86,    139,
-     192,    245,     42,     95,
-     148,    201,    254,     51,
-     104,    157,    210,      7,
-      60,    113,    166,    219,
-     239,     69,    133,    175,
-     228,    230,    177,    124,
-      71,     18,    221,    168,
-     115,     62,    246,    212,
-     159,    106,     53,      0,
-     203,    150,     97,    211,
-     247,     61,    114,    167,
-     220,    238,    185,    123,
-      79,     26,     26,     79,
-     132,    185,     17,    220,
-     167,    114,    194,    247,
-      44,     97,    150,     52,
-     255,    202,    149,     96,
-      43,      9,     62,    140,
-      87,    221,    237,    184,
-     131,     78,    230,     27,
-      80,    133,    186,    239,
-      36,    166,    113,    195,
-     248,     45,     98,    151,
-     204,      1,    201,    148,
-      95,     42,     10,    192,
-     116,    169,     33,     19,
-      72,    130,     77,     24,
-     227,    174,    121,     68,
-      15,    218,    165,    112,
-      59,      6,     46,     99,
-     152,    205,      2,     55,
-     108,    161,    214,     11,
-      64,    117,    170,    223,
-      20,     73,    126,     76,
-      23,    226,    173,    120,
-      67,    241,    217,     91,
-     144,    197,    250,    208,
-     155,    102,     49,    252,
-     199,    146,     93,     40,
-      12,    190,    137,     84,
-      31,    234,    181,    128,
-      75,    233,    225,     83,
-     136,    189,    242,     39,
-      92,    145,    198,    251,
-      48,    101,    154,    207,
-       4,     57,    110,    163,
-     216,     13,     66,    119,
-     172,     30,     22,     75,
-     128,    181,    234,    224,
-      84,    118,     65,     12,
-     215,    162,    109,     56,
-       3,     49,    102,    155,
-     208,      5,    197,    144,
-      91,     38,    241,    188,
-     135,     82,    226,     23,
-      76,    126,     73,     20,
-     223,    170,    138,    191,
-     244,     41,     94,    147,
-     200,      2,    205,    152,
-     156,    209,      6,     59,
-     112,    165,    218,     15,
-      68,    121,    174,    227,
-     231,    178,    130,     72,
-      19,    222,    169,    116,
-     192,    245,    213,    160,
-     107,     54,      1,    204,
-     151,     98,     45,      7,
-      60,    113,    166,    219,
-      16,    186,    133,     80,
-      27,     25,     78,    131,
-     184,    237,     34,     87,
-     140,     62,    246,     43,
-     159,    149,    202,    255,
-      52,    105,     97,     44,
-     247,    194,    114,     88,
-      35,     17,    185,    132,
-     176,     26,    229,     79,
-     123,    185,    238,    220,
-      88,    141,    194,      8,
-      44,    158,    105,    203,
-     255,     53,    106,     96,
-     212,      9,    193,    115,
-     168,    221,     18,     71,
-     124,    177,    230,    228,
-      80,    133,     69,    239,
-     219,    166,    142,     60,
-       7,     45,    157,    104,
-     204,    254,    201,    107,
-      95,    213,     10,    192,
-     116,    169,     33,    236,
-     183,    130,     77,     24,
-     227,     81,    134,    187,
-     240,     37,    165,    143,
-     196,    249,     46,     99,
-     152,    205,    253,    200,
-     147,    161,     41,    244,
-      64,    138,    170,     32,
-     235,    182,    129,     76,
-      23,     29,    173,    135,
-     188,    241,    217,     91,
-     144,     58,    250,    208,
-     155,    153,     49,    252,
-     199,    109,     93,     40,
-     243,    190,    137,     84,
-     224,     21,     74,    127,
-     180,    233,     30,     83,
-     136,     66,    242,     39,
-     163,    110,    198,      4,
-      48,    101,    101,     48,
-       4,     57,    110,    163,
-     216,     13,    189,    136,
-     172,    225,    233,     75,
-     128,     74,     21,    224,
-     171,    137,     65,     12,
-      40,    162,    109,    199,
-       3,    206,    102,    155,
-      47,      5,     58,    111,
-     164,     38,     14,     67,
-     120,    173,    226,    232,
-      76,    129,     73,     20,
-      32,     85,    138,    191,
-      11,    214,     94,    108,
-      55,    253,     50,    103,
-     156,     46,    249,     59,
-     143,     90,    218,    240,
-     187,    121,     81,     28,
-      24,    178,    125,    183,
-      19,    222,     86,    116,
-     192,    245,    213,     95,
-     148,     54,      1,     51,
-     151,     98,    210,    248,
-      60,    113,     89,    219,
-      16,    186,    122,    175,
-      27,    230,     78,    124,
-     184,    237,    221,    168,
-     140,     62,    246,     43,
-     159,    106,    202,      0,
-     203,    150,    158,     44,
-     247,     61,    141,     88,
-     220,    238,    185,    123,
-      79,     26,     26,    176,
-     123,     70,    238,     35,
-      88,    114,    194,    247,
-     211,    158,    150,     52,
-       0,     53,    149,    159,
-     212,    246,     62,    115,
-      87,    221,    237,    184,
-     124,     78,     25,     27,
-     175,    122,    186,    239,
-     219,    166,    113,     60,
-     248,     45,    157,    151,
-     204,    254,     54,    107,
-      95,    213,     10,    192,
-     116,    169,     33,     19,
-      72,    130,    178,    231,
-     227,     81,    134,     68,
-      15,     37,    165,    112,
-      59,    249,     46,     99,
-     152,     50,      2,    200,
-     108,    161,    214,     11,
-      64,    117,    170,     32,
-     235,     73,    129,     76,
-     232,    226,     82,    135,
-      67,     14,     38,    164,
-     111,    197,      5,    208,
-     155,    102,     49,      3,
-      56,    146,    162,     40,
-     243,    190,    137,     84,
-     224,    234,     74,    128,
-      75,    233,     30,    172,
-     136,    189,     13,    216,
-      92,    110,    198,    251,
-     207,    101,    154,    207,
-       4,     57,    110,     92,
-      39,    242,     66,    119,
-      83,    225,     22,    180,
-     128,    181,     21,    224,
-      84,    118,     65,    243,
-     215,    162,    146,    199,
-       3,     49,    102,    100,
-     208,    250,     58,    111,
-      91,    217,     14,     67,
-     120,    173,    226,    232,
-      76,    129,     73,     20,
-      32,     85,    117,     64,
-      11,    214,    161,    147,
-     200,      2,    205,    103,
-      99,    209,    249,    196,
-     112,     90,    218,     15,
-     187,    134,    174,     28,
-     231,     77,    125,    183,
-      19,     33,     86,    116,
-      63,    245,    213,     95,
-     148,    201,      1,    204,
-     104,    157,     45,    248,
-      60,    142,     89,    219,
-      16,    186,    122,    175,
-      27,     25,    177,    124,
-     184,     18,    221,     87,
-     140,    193,    246,     43,
-     159,    106,     53,    255,
-      52,    150,     97,     44,
-     247,     61,    114,     88,
-     220,     17,     70,    132,
-     176,     26,     26,     79,
-     132,    185,     17,    220,
-      88,    114,     61,    247,
-     211,     97,    105,     52,
-       0,     53,    149,    159,
-     212,    246,    193,    115,
-      87,     34,     18,    184,
-     131,    177,     25,    228,
-      80,    133,     69,    239,
-      36,    167,    142,    195,
-       7,    210,     98,    104,
-     204,      1,     54,    107,
-      95,    213,     10,    192,
-     116,     86,     33,     19,
-     183,    130,    178,    231,
-     227,    174,    134,    187,
-      15,     37,    165,    112,
-     196,      6,    209,     99,
-     152,     50,      2,     55,
-     108,    161,    214,    244,
-     191,    117,     85,     32,
-     235,    182,    126,    179,
-      23,     29,     82,    120,
-      67,    241,    217,     91,
-     144,     58,      5,     47,
-     100,    153,     49,      3,
-      56,    146,    162,    215,
-     243,    190,    118,     84,
-      31,     20,    181,    128,
-     180,    233,    225,     83,
-     119,     66,    242,     39,
-     163,    145,    198,    251,
-      48,    101,    154,     48,
-       4,     57,    145,    163,
-     216,     13,    189,    136,
-     172,     30,     22,     75,
-     127,    181,     21,    225,
-      85,    137,     65,    243,
-      40,    162,    109,    199,
-     252,     49,    102,    100,
-      47,      5,    197,    144,
-     164,    217,    241,    188,
-     135,    173,    226,    232,
-      76,    129,    182,     20,
-     223,     85,    138,     64,
-     244,    214,    161,    147,
-      55,    253,     50,    103,
-     156,     46,    249,    196,
-     112,     90,     37,     15,
-     187,    134,    174,    227,
-     231,     77,    130,     72,
-     236,     33,     86,    117,
-      63,    244,    213,     95,
-     148,    201,      1,    204,
-     104,     98,     45,      7,
-      60,    142,     89,    219,
-      16,    186,    122,     80,
-      27,     25,    176,    131,
-     184,     18,     34,     87,
-     115,     62,      9,    212,
-     159,    149,    202,    255,
-     203,    150,    158,     44,
-       8,     61,    141,     88,
-      35,     17,    185,    132,
-     177,     26,    229,     79,
-     132,     70,    238,     34,
-     167,    141,     61,      8,
-      44,    158,    105,     52,
-       0,    202,    106,    159,
-      43,      9,    193,    140,
-      87,    221,    237,    184,
-     124,     78,     25,     26,
-     175,    122,    186,     16,
-     219,    166,    142,    195,
-     248,    210,     98,    151,
-      51,      1,     54,    148,
-     160,     42,    245,     63,
-     116,     86,    222,     19,
-     183,    130,    179,     24,
-     227,     80,    121,     68,
-     240,    218,    165,    112,
-      59,      4,    208,    157,
-     102,     51,    253,    200,
-     108,    163,    215,     10,
-      67,    118,    169,    220,
-      21,     73,    129,     77,
-      22,    227,    175,    126,
-      69,     10,    222,    163,
-     108,     59,    252,     33,
-     105,    149,    194,      6,
-     197,    150,     84,     35,
-     251,    184,    141,    169,
-     228,     23,     76,    127,
-      66,     29,    229,     85,
-     128,    182,    249,     34,
-     167,    106,     62,     10,
-     196,    146,     99,    203,
-      11,     43,    120,    179,
-     216,    240,    183,    146,
-      79,     11,    232,     71,
-     144,    167,    248,     29,
-     161,    126,     76,     28,
-     213,     88,    149,    210,
-     235,     33,    104,    152,
-      35,    246,    208,    180,
-     122,     40,      3,     89,
-      99,    181,    236,    238,
-     190,    118,     71,     25,
-     219,     87,    131,    177,
-     251,     38,     87,    145,
-      54,      5,    221,    130,
-     120,     59,      3,     35,
-     100,    183,    209,    246,
-     180,    129,     89,     23,
-     230,     77,    129,    167,
-     254,     48,     69,    130,
-      61,     14,    217,    128,
-      74,     45,     18,     34,
-      74,    133,    198,     12,
-     205,    157,     95,     42,
-     226,     69,    120,    163,
-     252,      1,     87,    146,
-     184,     26,    205,    182,
-      91,     33,     17,     40,
-      73,    177,    223,    239,
-     204,    183,    117,     43,
-     251,     60,    127,    168,
-     203,      9,     82,    106,
-     177,     16,    244,    168,
-     100,     91,      2,    208,
-      78,    160,    213,    255,
-     210,    131,     77,     60,
-       2,     48,    120,    141,
-     219,      6,     50,    124,
-     164,     39,    226,    173,
-     153,     83,     13,    235,
-      80,    173,    159,    232,
-      36,    168,     82,     47,
-     242,     33,    111,    135,
-     201,      8,     58,     96,
-     181,    208,    230,    214,
-     159,     65,     54,    226,
-     190,    107,    157,    246,
-     225,    171,    100,     88,
-     244,     55,     85,    133,
-     196,      5,     40,    108,
-     131,    218,    244,    209,
-     138,     75,     56,    251,
-     174,    114,    128,    207,
-     227,    182,    145,     81,
-     234,     11,     89,    129,
-      68,      7,     40,     67,
-     143,    228,      1,    243,
-     131,    104,     58,    240,
-     211,    143,    162,    254,
-      23,     71,    116,     65,
-      63,    235,     83,    111,
-      75,     19,     31,     92,
-     144,    163,    224,    204,
-     189,    101,     58,     13,
-     219,    185,     65,    222,
-      48,     33,    103,     95,
-       5,    237,     73,     97,
-     160,    237,    224,    181,
-     152,    175,    252,     21,
-     189,    106,    191,    243,
-     192,    189,     71,     28,
-     224,     15,     70,    156,
-      62,    209,    219,    126,
-     133,    206,     11,    181,
-     135,    191,    244,     24,
-      78,    105,     89,    227,
-     222,    177,     89,    112,
-      43,     13,     14,    184,
-      49,     36,    226,    132,
-     129,    224,     28,     49,
-     159,     72,    211,     21,
-      82,    127,     94,      8,
-     230,    182,     96,    109,
-      49,    199,    116,    193,
-     229,      1,    242,    143,
-     114,    233,    204,     44,
-      99,    122,     58,     12,
-      37,    101,    173,     40,
-     249,    190,    140,    112,
-      57,    250,    164,    156,
-     254,    242,    204,    129,
-      95,     48,    221,     19,
-     121,    157,     35,     32,
-      53,     73,    190,    218,
-     249,    216,    130,     83,
-      53,    246,    169,    139,
-     161,    208,      0,    189,
-      90,    100,     25,      5,
-     106,    151,     61,     23,
-     203,    111,    139,    211,
-      11,    219,    181,    110,
-      44,    226,    213,    133,
-      95,    222,     48,     94,
-     137,    108,     13,     23,
-      78,    173,    167,     22,
-     198,    172,    128,    215,
-     239,     38,    135,     76,
-      61,    249,    207,    157,
-      92,     47,    243,     49,
-     102,     84,     52,    235,
-      66,    109,    170,    243,
-      28,    189,    116,    179,
-     230,     55,     94,     99,
-      26,     19,    211,    103,
-     101,     50,    245,    216,
-     107,    179,    215,    250,
-      67,    126,    163,    203,
-      26,    182,    140,     72,
-     229,      9,     66,    133,
-      84,     40,    205,     88,
-     154,    199,      6,    213,
-     138,    110,    199,      9,
-      57,    110,    164,    214,
-       5,     73,    112,    168,
-     224,     18,     71,    121,
-      66,      2,    249,    190,
-     139,    173,    248,    221,
-     169,    126,     46,    251,
-      32,    108,    152,    202,
-       3,    198,    104,    172,
-     211,     12,     64,    125,
-      83,     21,    228,    164,
-     115,    179,    254,     25,
-     160,    120,     78,     24,
-     212,     77,    153,    195,
-     249,     53,    155,    159,
-     223,     14,     57,    110,
-     160,     35,    253,    180,
-     129,     86,    230,     25,
-      77,    112,     70,     29,
-     211,    166,    143,    174,
-     243,     45,     91,    111,
-      53,    241,     36,     98,
-      99,    209,    254,    195,
-     141,    165,     45,    242,
-      77,    125,     88,     12,
-     237,    184,    126,    178,
-     228,     38,     87,    116,
-      60,    243,     39,     83,
-     146,    202,    250,    202,
-     159,    102,     46,    253,
-     193,    117,     89,     34,
-     230,    184,    122,     87,
-      27,     29,    181,    120,
-     177,    230,     32,     85,
-     132,    200,    240,     41,
-     158,     98,     63,      3,
-      54,    106,    156,     47,
-     254,    199,    113,    164,
-      33,    233,    187,    132,
-      75,    229,     30,     74,
-     142,    183,    238,    216,
-      94,    136,     56,     11,
-      44,    150,    108,    200,
-     253,    193,    106,    153,
-      45,    244,     61,    142,
-      95,     33,     18,    185,
-     121,    190,    237,    231,
-     174,    135,    184,    237,
-      32,    167,    120,     63,
-     248,     46,    159,    111,
-     205,      4,     54,    149,
-     162,     41,    255,    196,
-     143,     83,    220,     31,
-      66,    131,     76,     26,
-      30,     86,    128,     71,
-       2,    222,     89,    138,
-     199,      2,    213,    103,
-     159,    206,    253,    204,
-     149,     88,     43,    247,
-     188,    113,    163,    217,
-      20,    182,    133,     79,
-     234,     30,     82,    123,
-      66,    240,     39,     90,
-     144,     59,    249,     39,
-     101,     96,     57,    250,
-     196,    108,     94,     47,
-       9,     73,    141,     80,
-     224,     20,     72,    121,
-     179,     21,    227,     81,
-     140,     64,     13,     44,
-      88,    111,    197,    249,
-     200,    158,    155,     53,
-     252,    196,    149,     89,
-     216,    241,    185,    117,
-     164,    231,     22,    180,
-     127,    183,    235,     31,
-      82,    140,    188,    241,
-     214,    160,    147,    197,
-       7,    205,    154,    110,
-      40,    255,    194,    144,
-     161,    217,     14,     70,
-     125,    172,    230,     22,
-     178,    130,    177,    232,
-     222,     87,    136,    191,
-     244,     41,     95,    105,
-      62,      7,    202,    147,
-     103,    216,    251,    206,
-     117,    175,    218,    241,
-      76,    121,     82,    230,
-      17,     79,    126,    180,
-     228,     35,    170,    117,
-     193,     11,    208,    169,
-     108,     50,      3,    206,
-     146,    157,    211,      5,
-      63,    117,    164,    218,
-      22,     64,    121,    174,
-     228,     27,     76,    131,
-      70,     18,    221,    168,
-     112,     57,     13,    208,
-     152,    110,    202,      0,
-     207,    104,    155,    209,
-     247,    195,    116,    175,
-     216,    238,     70,    121,
-     178,    227,     27,    181,
-     120,    185,     19,    216,
-     161,    122,     57,     12,
-     211,    159,    106,     52,
-       6,     60,    107,    158,
-     214,     11,     61,    116,
-     174,     33,    236,     67,
-     127,     77,     26,    228,
-     174,    121,     67,     21,
-     223,    163,    118,     62,
-     252,     47,    157,    145,
-     203,    255,    200,    109,
-     166,    214,      9,     62,
-     136,     86,    219,    236,
-     177,    130,    179,     30,
-     233,    171,    125,     67,
-      12,     33,     93,    138,
-     198,      6,    209,     97,
-     145,    196,      3,    201,
-     110,    160,     43,     11,
-      65,    117,     84,     37,
-     237,    178,    132,     69,
-      18,     30,     90,    130,
-     188,    241,     38,     91,
-     144,    195,    253,     46,
-     153,    152,    205,      3,
-     199,    146,     93,     43,
-     245,    183,    129,     93,
-      22,     28,     94,    123,
-      64,     30,     23,     93,
-     142,     67,     15,    217,
-      93,    154,    207,      6,
-     201,    159,    154,     49,
-     243,    204,    152,     83,
-      40,      1,     89,    112,
-      67,     16,     28,     88,
-     135,     73,     21,    226,
-     173,    143,    177,    244,
-     212,    164,    110,     59,
-       9,    197,    159,    104,
-      62,     15,     27,    104,
-      67,     40,     28,     95,
-     125,     89,     30,     20,
-     178,    132,    185,    236,
-     217,    172,    139,     68,
-      26,    217,    164,    126,
-      56,    235,     19,    157,
-     125,     41,     16,     27,
-     123,     86,     41,    241,
-      66,    119,    191,    230,
-     224,    187,    127,     75,
-       3,    205,    164,     97,
-      59,    232,     61,    178,
-     119,    201,    228,     19,
-     100,    104,     34,    251,
-      48,    105,    183,    218,
-     234,    188,    128,     82,
-      17,    243,    164,    106,
-      71,    241,     45,    186,
-     105,     60,    229,     11,
-     115,     96,     39,      3,
-      38,    112,    143,    214,
-     244,    203,    135,     92,
-      37,    254,    163,    155,
-     177,    197,     23,    166,
-      98,     71,    252,      3,
-      77,    123,     40,     11,
-      59,     65,    135,    206,
-     252,    193,    158,     99,
-      47,    249,    221,    147,
-     168,    195,     25,    160,
-     154,     78,    244,      0,
-      68,    121,     81,     24,
-      51,    124,    155,    198,
-       4,    222,    146,    106,
-     205,    241,    214,    182,
-      95,    202,      7,    214,
-     150,     83,    206,      9,
-      95,    125,     94,     21,
-       9,    122,    159,    191,
-      11,    209,    169,    112,
-     199,      8,    241,    189,
-     100,    212,     15,    217,
-     138,     88,    220,     30,
-      85,    119,     69,     45,
-       4,     97,     96,    181,
-      17,    233,    167,    135,
-     190,      0,    199,    134,
-     105,    220,    234,    194,
-     133,    110,    197,     27,
-      44,    109,     76,     38,
-      29,    106,    105,    168,
-      23,    226,    179,    124,
-     180,     25,    250,    179,
-     116,    166,    253,    204,
-     130,    100,    200,    237,
-      63,     99,     98,     35,
-       7,     21,     70,    165,
-      45,    251,    187,    137,
-     175,     23,    242,    146,
-     111,    162,    240,    231,
-     180,    100,    187,    226,
-      62,     80,    100,     32,
-     254,     29,     79,    156,
-      36,    243,    193,    110,
-     162,     33,    234,    159,
-     150,    189,    251,    233,
-     168,    104,    183,    248,
-      49,     88,    116,     87,
-       3,     14,    111,    153,
-      58,      8,    201,    153,
-     152,     47,    239,    227,
-     150,    181,    198,    242,
-     166,    148,    171,    242,
-      21,     70,    134,     71,
-      27,      1,    102,    133,
-      52,      3,    214,    162,
-     150,     55,     19,    236,
-     138,    156,    196,      1,
-     209,    157,     90,    209,
-       0,     75,    126,     92,
-      23,     14,     97,    148,
-      79,     25,    223,    171,
-     140,    195,      7,    203,
-     191,    109,    223,    241,
-     197,    129,    103,    217,
-       5,     51,    122,     80,
-      46,     30,    104,    102,
-      77,     16,    225,    180,
-     122,    186,     24,    192,
-     133,    125,    205,    228,
-     213,    134,    101,    205,
-      14,     62,    111,    159,
-      46,     12,     31,     80,
-     174,     43,    233,    186,
-     134,    176,     29,    242,
-     142,     97,    185,    249,
-      35,    180,     97,    195,
-     240,     38,    105,    146,
-      52,    254,     42,     78,
-     170,     45,    246,    195,
-     142,    170,     32,    248,
-     170,    158,     73,    244,
-      17,    163,    108,     71,
-     252,     43,     95,    143,
-      59,    251,     56,     64,
-     137,     55,    251,    201,
-     151,     95,    214,    251,
-     163,    169,     91,    203,
-       0,    188,    155,     74,
-     228,     18,     91,    120,
-      71,    241,     50,    127,
-     134,     56,     15,    213,
-     153,    157,    204,    236,
-     220,    137,     87,    217,
-       1,    180,    159,     80,
-     237,     24,     78,    127,
-     181,    232,     19,    114,
-     147,    191,      4,    221,
-     167,    110,    198,     15,
-     215,    187,    117,    192,
-      20,    205,    136,     90,
-     215,     29,     69,    137,
-      84,     26,      6,    109,
-     155,    181,     30,    232,
-     169,    141,    190,      7,
-     195,    187,    103,    203,
-     251,    192,    136,    101,
-     221,     20,     62,    152,
-      94,    218,     28,     99,
-      98,    174,     21,    238,
-     182,    126,     73,     29,
-     202,    180,    112,    172,
-     240,    207,    185,    145,
-     219,    234,     52,    137,
-     119,    208,     24,     19,
-     103,     91,     43,    252,
-     187,    127,     82,     22,
-     243,    162,    139,    184,
-      28,    253,    165,    132,
-     218,    231,    211,    182,
-     101,    195,    225,     19,
-     122,     99,     39,    240,
-     193,    140,     95,     46,
-     251,    189,    105,    165,
-       6,    206,    181,    149,
-     167,    254,    208,    137,
-     124,    212,    222,     53,
-     105,    109,     56,      3,
-      54,    146,    107,     60,
-     245,     42,     98,     67,
-      12,    252,     72,    101,
-     168,     26,    255,    172,
-     135,    152,    206,     44,
-      90,    116,     58,      9,
-     213,    146,    103,     48,
-      20,     44,    146,     80,
-       8,      9,     41,    110,
-     162,     48,    205,    177,
-     101,    147,    244,     25,
-     168,    121,    185,     21,
-     209,    169,    113,    223,
-     239,    223,    186,    114,
-      48,     17,     35,    111,
-      80,     57,    241,     45,
-     110,    164,    223,    238,
-      75,    117,     72,     10,
-     240,     81,    166,    167,
-       0,    241,    178,    141,
-     215,    236,    215,    130,
-     112,    200,     24,     32,
-     106,     86,     33,      3,
-      77,    117,     68,     52,
-       4,     99,    115,    111,
-      48,    228,     67,    144,
-     180,     26,    248,    182,
-     156,    219,    239,     46,
-     151,    111,    196,      8,
-     196,    135,     86,    200,
-      38,    191,    167,    116,
-     225,      2,    106,    121,
-     107,     61,    238,     65,
-     148,    174,     12,    202,
-     165,    153,    207,      3,
-     223,    105,    185,    223,
-     236,    217,    154,    165,
-     207,     21,    189,    151,
-     115,     28,      2,     91,
-     133,     79,     18,     30,
-      80,    118,     81,     15,
-       8,    125,    100,     29,
-      12,     52,    117,    141,
-     208,    237,    221,    145,
-     169,    208,    243,    179,
-     128,    170,    238,     22,
-     163,    131,    168,    248,
-     208,    177,    114,    185,
-     250,     57,     93,    126,
-      46,      3,     42,    104,
-     106,     54,    246,     62,
-     124,    162,     46,    245,
-      93,     99,     87,      1,
-     232,     72,    145,    164,
-     237,    205,    188,    117,
-     211,    231,    214,    181,
-     122,     51,    246,     52,
-     108,    146,    220,    240,
-     212,    141,    172,    216,
-      16,     70,    123,     87,
-      19,     31,     67,    133,
-      65,     28,    212,    172,
-     141,    192,    240,     61,
-     109,    121,     46,    253,
-      38,    100,    156,     35,
-     226,    198,    124,    181,
-     212,    231,    169,    131,
-      76,     27,     24,     69,
-     147,    168,     31,    253,
-     168,    129,    208,    252,
-      40,    147,    117,     63,
-      23,     44,    104,    109,
-      38,    241,    194,    140,
-     174,    202,      8,     69,
-     152,     87,     25,     15,
-      69,    120,     93,      6,
-     218,     73,    129,     61,
-       9,    215,    157,    104,
-      49,      6,     45,    113,
-      91,     53,    230,     56,
-      96,    166,     34,    251,
-     173,    132,    166,    255,
-     231,    184,    116,     68,
-     245,     39,     95,    153,
-     210,      0,    202,    147,
-     147,    209,     13,    199,
-     143,     75,     43,     26,
-      81,    142,     71,     48,
-     232,     64,    111,    166,
-     231,    227,    163,    117,
-      69,    253,     59,     80,
-     124,     33,      9,     40,
-     107,    157,     55,    241,
-     214,    155,    170,    192,
-      26,     68,    130,     88,
-      28,     21,     76,    116,
-     177,     31,    243,    161,
-     118,    181,    245,    216,
-     169,     97,    196,    230,
-      42,    157,    115,     52,
-       2,     61,    107,    167,
-      37,    248,    181,    138,
-     175,    231,    233,    179,
-     123,    181,    225,     11,
-      93,    122,     83,      5,
-     214,     91,    153,    193,
-       5,    222,    150,    100,
-     222,      9,    196,    153,
-      94,    223,     26,     82,
-     134,     64,     12,    237,
-      73,    134,    183,     17,
-     214,    160,    113,    183,
-     249,     46,     94,    110,
-     201,    240,     32,    100,
-     104,     32,    242,    194,
-     114,    162,    216,    244,
-     177,    139,     82,    234,
-      18,     72,    134,    179,
-     232,     40,     92,    139,
-      51,      4,    221,     94,
-     146,    201,     11,    193,
-     144,    159,    219,      3,
-     198,    141,    174,    202,
-       2,     66,    130,     91,
-      30,     25,     79,    124,
-      68,     21,    213,    160,
-     117,    195,    254,     42,
-     157,    150,    204,    246,
-      56,     97,     96,     37,
-     254,    192,    117,    175,
-     221,    231,    168,    137,
-     176,    238,     18,    179,
-     125,    186,    231,     36,
-      91,    142,    195,     11,
-     213,    155,    150,    207,
-       2,    200,    159,    104,
-     214,     15,     63,    140,
-     169,    222,     20,     66,
-     124,     77,     25,     26,
-      80,    121,     64,     20,
-     218,    162,    119,     61,
-     252,     46,    157,    149,
-     202,      7,     50,    107,
-      95,     42,    246,    194,
-     118,    170,     37,    225,
-     187,    134,    182,    228,
-     226,    174,    130,    189,
-     245,     45,     93,    141,
-      59,      6,    208,    157,
-     102,     48,    249,    207,
-     153,     88,     41,     10,
-     190,    138,    175,    214,
-      28,     76,    125,    176,
-     233,     28,     86,    131,
-      64,      5,    213,    172,
-     110,    199,      5,    213,
-     158,    153,    202,      6,
-      59,    110,    166,    212,
-      15,     66,    116,     84,
-      29,    238,    176,    134,
-      72,    233,    225,    174,
-     117,     66,    243,     36,
-      93,    145,    196,    248,
-      51,    102,    153,    205,
-     249,    192,    148,     92,
-     218,    242,    191,    137,
-     172,    224,     20,    180,
-     124,     75,    233,     29,
-      85,    137,     65,     13,
-     213,    162,    144,    197,
-       3,    204,    152,    100,
-     208,      7,     59,    146,
-      95,     39,     15,     64,
-     121,     83,     25,    235,
-      77,    130,    180,    234,
-      33,     85,    117,    191,
-     245,     43,    161,    110,
-      51,      0,     50,    102,
-     157,     47,    251,    199,
-     142,    165,    216,     11,
-      71,    123,    175,    227,
-      25,     76,    125,     75,
-      23,    220,     86,    116,
-      61,      8,    215,    161,
-     148,    203,    255,    204,
-     104,    159,    214,      3,
-      60,    141,     91,    219,
-      16,    186,    132,     81,
-      27,    230,    176,    126,
-     184,    238,     32,     87,
-     115,     62,    247,     41,
-      97,    106,     52,      0,
-      53,    104,     97,     46,
-     245,    194,    114,     88,
-      33,    236,    185,    121,
-     177,     26,    229,     78,
-     134,    185,     16,    220,
-      89,    143,    194,     10,
-     209,     97,    148,    202,
-     253,    207,    150,    158,
-     215,     11,    193,    143,
-      84,    221,     22,     67,
-     126,     78,     24,    228,
-      80,    133,    186,    238,
-     219,    165,    114,     61,
-     248,     45,    156,    105,
-      51,      0,     54,    107,
-     161,    215,     11,    192,
-     139,    169,    223,     19,
-     183,    130,     77,     24,
-     227,     81,    134,    187,
-      15,    219,    164,    143,
-     198,    251,    209,    157,
-     103,    204,      0,     53,
-     108,     95,     43,    244,
-     191,    138,     84,     33,
-     234,    180,    129,    179,
-      23,    227,    173,    135,
-     188,    241,     38,     90,
-     144,    197,    250,     47,
-     100,    153,    206,      3,
-     199,    147,     93,     40,
-     243,    190,    137,     84,
-     224,     20,     72,    126,
-     180,     22,    225,     83,
-     136,    188,    243,    216,
-     162,    110,     57,      5,
-     206,    154,    154,     48,
-     250,    199,    111,    160,
-     217,    243,    191,    137,
-     173,    227,     23,    180,
-     126,     75,     21,     31,
-      84,    119,     64,     12,
-      40,     93,    109,     56,
-     252,     49,    102,    155,
-      47,    250,     58,    110,
-     165,    217,    240,    189,
-     120,    172,    226,    232,
-     179,    129,    182,     20,
-     223,     85,    138,     64,
-      11,    214,    161,    108,
-     200,    253,     50,    152,
-      99,    209,      6,     59,
-     112,     90,     37,    240,
-     187,    121,    174,     28,
-     230,    178,    130,    183,
-      19,    222,     86,    138,
-     192,     10,    213,     95,
-     148,    201,      1,    205,
-     151,    157,    211,      7,
-     195,    142,     89,     36,
-      16,     69,    133,     80,
-      27,     25,     78,    131,
-      71,     18,     34,     87,
-     140,     62,      9,    212,
-     159,    149,    202,      0,
-     203,    150,     97,     44,
-       8,     60,    114,     88,
-      35,    238,     70,    122,
-     176,     26,    229,     79,
-     132,    185,     17,    220,
-     167,    114,     61,      8,
-     211,     97,    150,     52,
-     255,     53,    106,    159,
-     212,      9,     62,    140,
-      87,     34,    237,    184,
-     131,     79,     25,     27,
-      81,    133,     69,     16,
-     219,     89,    142,    195,
-     248,     45,    157,    105,
-      51,      1,     54,    107,
-      95,     43,    245,     63,
-     116,    169,     33,     19,
-      72,    125,    178,     24,
-     227,     81,    134,     68,
-      15,    218,     90,    143,
-      59,      6,    209,     99,
-     152,    205,      2,     55,
-     108,    161,    214,    244,
-     191,    138,     85,     32,
-      20,     73,    129,     77,
-      23,     29,     82,    120,
-      67,     14,     38,     91,
-     144,    197,      5,     47,
-     100,    153,     49,      3,
-      56,    146,     93,    215,
-      12,    190,    137,    171,
-     224,     21,    181,    128,
-     180,    233,     30,    172,
-     119,     66,    242,     39,
-     163,    111,     57,    251,
-      48,    154,    100,     48,
-       4,     57,    110,     92,
-      39,    242,    189,    119,
-     172,    225,     22,    180,
-     127,     74,    234,     31,
-      84,    137,     65,     12,
-     215,    162,    146,    199,
-     252,    206,    153,    155,
-     208,      5,     58,    144,
-      91,     38,     14,     67,
-     120,     82,     29,     23,
-      76,    129,     73,     20,
-     223,     85,    117,     64,
-      11,     41,     94,    108,
-      55,      2,     50,    103,
-     156,     46,    249,    196,
-     112,    165,    218,    240,
-     187,    134,    174,    227,
-      24,    178,    125,     72,
-     236,     33,     86,    139,
-      63,    245,     42,     95,
-     148,    201,    254,     51,
-     151,     98,     45,      7,
-      60,    142,     89,     36,
-     239,     69,    122,    175,
-     228,    230,     78,    131,
-     184,    237,    221,    168,
-     115,     62,    246,    212,
-     159,    106,     53,      0,
-      52,    105,    158,     44,
-     247,    194,    114,    167,
-     220,     17,    185,    132,
-     176,    229,     26,     79,
-     123,     70,     17,    220,
-      88,    141,    194,    247,
-     211,    158,    105,    203,
-       0,     53,    149,     96,
-      43,      9,     62,    115,
-      87,     34,    237,    184,
-     124,    177,    230,    228,
-     175,    122,    186,    239,
-      36,    166,    113,     60,
-       7,    210,     98,    104,
-      51,    254,     54,    107,
-     160,    213,     10,     63,
-     116,    169,    222,     19,
-      72,    130,     77,     24,
-      28,     81,    121,    187,
-     240,    218,    165,    112,
-     196,    249,     46,    156,
-     103,     50,      2,     55,
-     147,     94,     41,    244,
-      64,    117,    170,     32,
-     235,     73,    126,    179,
-     232,     29,    173,    120,
-      67,     14,     38,     91,
-     144,     58,      5,    208,
-     100,    153,     49,    252,
-     199,    146,    162,    215,
-      12,     65,    118,    171,
-      31,    234,     74,    127,
-     180,     22,    225,    172,
-     136,    189,    242,    216,
-     163,    110,     57,    251,
-      48,    154,    154,    207,
-       4,    198,    145,    163,
-     216,     13,     66,    119,
-      83,     30,     22,     75,
-     128,    181,    234,     31,
-      84,    137,    190,    243,
-     215,    162,    109,     56,
-     252,     49,    153,    100,
-      47,    250,    197,    144,
-      91,     38,    241,    188,
-     135,    173,     29,    232,
-     179,    129,    182,     20,
-     223,    170,    138,    191,
-     244,     41,     94,    147,
-     200,    253,     50,    103,
-      99,     46,    249,    196,
-     143,     90,     37,     15,
-     187,    134,     81,     28,
-     231,    178,    125,     72,
-      19,    222,    169,    116,
-      63,     10,     42,    160,
-     107,    201,      1,    204,
-     151,    157,    210,      7,
-      60,    113,    166,    219,
-      16,     69,    122,    175,
-     228,     25,     78,    131,
-     184,    237,     34,     87,
-     140,    193,    246,     43,
-      96,    149,    202,      0,
-     203,    150,     97,     44,
-     247,    194,    141,     88,
-      35,    238,    185,    132,
-     176,    229,    229,     79,
-     132,    185,    238,     35,
-      88,    141,    194,      8,
-      44,     97,    105,    203,
-       0,    202,    106,    159,
-      43,      9,     62,    140,
-     168,    221,    237,     71,
-     124,     78,    230,     27,
-     175,    133,    186,     16,
-      36,     89,    113,    195,
-     248,    210,     98,    151,
-      51,      1,    201,    148,
-     160,    213,    245,     63,
-     116,     86,    222,     19,
-     183,    125,    178,     24,
-      28,     81,    121,    187,
-     240,    218,     90,    143,
-      59,    249,     46,    156,
-     152,    205,    253,     55,
-     108,     94,    214,    244,
-     191,    117,     85,     32,
-     235,    182,    129,    179,
-      23,    226,     82,    120,
-     188,    241,    217,    164,
-     144,     58,    250,     47,
-     155,    153,    206,    252,
-      56,    109,     93,     40,
-      12,    190,    137,    171,
-      31,    234,     74,    128,
-      75,    233,     30,    172,
-     136,    189,     13,     39,
-      92,    110,    198,    251,
-     207,    101,    154,     48,
-       4,     57,    145,    163,
-     216,    242,     66,    119,
-     172,     30,     22,    180,
-     127,    181,     21,    224,
-      84,    118,     65,    243,
-      40,    162,    109,    199,
-       3,     49,    153,    155,
-     208,    250,     58,    144,
-      91,    217,    241,     67,
-     135,    173,    226,     23,
-      76,    126,    182,     20,
-     223,     85,    117,     64,
-     244,    214,    161,    147,
-      55,      2,     50,    152,
-      99,     46,    249,    196,
-     112,    165,     37,     15,
-      68,    134,     81,    227,
-     231,    178,    125,     72,
-      19,     33,     86,    116,
-      63,    245,    213,    160,
-     148,     54,    254,     51,
-     151,    157,    210,    248,
-      60,    113,     89,     36,
-      16,    186,    133,    175,
-      27,     25,     78,    124,
-     184,    237,    221,     87,
-     140,     62,      9,     43,
-     159,    106,    202,      0,
-     203,    105,     97,     44,
-       8,    194,    141,    167,
-      35,    238,     70,    132,
-      79,    229,    229,     79,
-     132,     70,     17,     35,
-     167,    114,    194,      8,
-      44,     97,    105,    203,
-       0,    202,    106,    159,
-      43,      9,     62,    140,
-      87,    221,    237,     71,
-     124,     78,     25,     27,
-     175,    133,     69,     16,
-      36,    166,    113,     60,
-       7,    210,     98,    151,
-     204,      1,    201,    107,
-      95,     42,     10,     63,
-     139,    169,    222,    236,
-      72,    125,     77,    231,
-      28,    174,    121,    187,
-      15,    218,     90,    112,
-      59,    249,    209,    156,
-     103,     50,    253,    200,
-     108,     94,     41,     11,
-     191,    117,    170,     32,
-     235,     73,    129,     76,
-     232,    226,    173,    135,
-      67,    241,     38,     91,
-     144,    197,      5,    208,
-     100,    102,    206,      3,
-      56,    146,    162,    215,
-      12,     65,    118,    171,
-      31,    234,     74,    127,
-     180,     22,    225,     83,
-     119,    189,    242,    216,
-     163,    145,     57,    251,
-      48,    154,    101,     48,
-     251,    198,    110,    163,
-      39,     13,    189,    136,
-      83,     30,    233,    180,
-     128,     74,     21,     31,
-      84,    137,    190,    243,
-     215,    162,    146,     56,
-       3,     49,    102,    100,
-     208,      5,    197,    111,
-     164,     38,     14,     67,
-     135,    173,    226,    233,
-      76,    129,     72,    235,
-      32,    171,    138,    191,
-      10,     41,     94,    108,
-     200,    253,    204,    103,
-     156,     46,      6,    196,
-     143,    165,     37,    240,
-      68,    121,     81,    227,
-      24,    178,    130,    183,
-      19,    222,     86,    116,
-      63,    245,    213,    160,
-     148,     54,    254,     51,
-     104,     98,     45,    248,
-     195,    113,     89,    219,
-     239,    186,    133,     80,
-     228,    230,    177,    124,
-      71,    237,     34,    168,
-     115,    193,      9,    212,
-      96,    149,     53,    255,
-     203,    150,    158,     44,
-       8,     61,    141,     88,
-     220,     17,    185,    123,
-     176,     26,     26,    176,
-     132,    185,     17,    220,
-      88,    141,     61,    247,
-     211,    158,    150,    203,
-     255,    202,    106,    159,
-      43,    246,     62,    115,
-      87,     34,     18,     71,
-     131,     78,    230,     27,
-     175,    133,     69,     16,
-      36,     89,    113,     60,
-       7,     45,     98,    104,
-      51,      1,    201,    148,
-     160,     42,    245,     62,
-     116,     86,    222,     19,
-     183,    125,     77,    231,
-      28,     81,    121,     68,
-     241,    218,    165,    143,
-      59,    249,    209,    156,
-     103,    205,    253,    200,
-     147,     94,    214,    244,
-      64,    117,     85,     32,
-     235,     73,    126,    179,
-      23,    226,     82,    120,
-      67,    241,     38,    164,
-     144,     58,      5,     47,
-     100,    102,    206,    252,
-     199,    109,     93,    215,
-      12,    190,    136,    171,
-     224,    234,     74,    127,
-      75,    233,     30,    172,
-     119,    189,     13,     39,
-      92,    111,    198,    251,
-     207,    154,    154,     48,
-       4,     56,    144,     92,
-     217,    242,    189,    119,
-      83,     30,     23,    180,
-     127,    180,     21,    224,
-      84,    118,    190,    243,
-     215,    162,    146,    199,
-       3,     49,    153,    155,
-     208,    251,     58,    144,
-     164,     38,     14,     67,
-     135,    173,    226,    232,
-      76,    126,     73,    235,
-     223,     85,    138,     64,
-      11,     41,    161,    147,
-     200,      2,     50,    103,
-      99,     46,      7,     59,
-     142,    165,     37,     15,
-      68,    121,    174,     28,
-     231,    178,    131,     72,
-      19,     32,    168,    139,
-     192,     11,     42,     95,
-     107,     54,    254,    204,
-     151,    157,     45,    248,
-      60,    143,    167,    219,
-     238,     68,    133,     81,
-     229,     25,    177,    131,
-      71,     18,     35,    168,
-     114,    192,    246,    212,
-      96,    106,     53,    255,
-     203,    150,    158,     45,
-       8,     61,    140,    167,
-     221,    238,    185,    123,
-      79,     26,     27,    176,
-     123,    185,     17,    221,
-      89,    141,     60,    246,
-     210,    158,    151,     52,
-       0,     53,    149,     96,
-     212,    246,    193,    114,
-      87,     34,     19,    184,
-     124,    177,     25,    228,
-      80,    133,     68,    239,
-      36,    166,    142,    195,
-       7,    210,     98,    104,
-     204,      1,    201,    107,
-      95,     42,     10,     63,
-     116,     86,    222,    236,
-     183,    125,     77,     24,
-     227,    174,    134,     68,
-      15,     37,     90,    143,
-      59,      6,    209,     99,
-     103,     50,      2,    201,
-     108,    161,     41,    244,
-      64,    138,     85,    223,
-     235,    182,    126,    179,
-      23,     29,     82,    120,
-     188,    241,     38,     91,
-     111,    197,    250,    208,
-     100,    153,     49,      3,
-     199,    146,    162,     40,
-      12,     65,    118,     84,
-      31,     21,    181,    128,
-     180,     22,    225,     83,
-     136,     66,     13,    216,
-      92,    110,     57,      4,
-      48,    101,    101,    207,
-       4,     57,    110,     92,
-     216,     13,    189,    136,
-     172,    225,    233,     75,
-     127,     74,    234,    224,
-      84,    118,     65,    243,
-     215,    162,    146,    199,
-       3,     49,    153,    100,
-     208,      5,    197,    111,
-     164,     38,    241,     67,
-     135,     82,    226,     23,
-     179,    129,     73,    235,
-      32,     85,    117,    191,
-     244,    214,     94,    108,
-      55,    252,    204,    103,
-     156,     46,    249,     59,
-     143,     90,    218,    240,
-      68,    121,     81,    227,
-      24,    178,    125,    183,
-     236,     33,    169,    116,
-     193,     10,    213,     95,
-     107,    201,      1,    204,
-     151,    157,     45,    248,
-      60,    142,     89,    219,
-     239,    186,    122,     80,
-      27,     25,     78,    124,
-     184,    237,    221,     87,
-     140,     62,    246,     43,
-     159,    106,    202,    255,
-     203,    105,     97,     44,
-       8,     61,    141,     88,
-     220,     17,    185,    123,
-     176,    229,    229,     79,
-     123,    185,    238,    220,
-     167,    141,     61,    247,
-      44,    158,    105,    203,
-       0,    202,    106,    159,
-      43,    246,     62,    140,
-     168,     34,    237,     71,
-     131,     78,    230,    228,
-     175,    122,    187,     16,
-      36,     89,    113,    195,
-       7,     45,    157,    151,
-     204,    254,    201,    107,
-     160,     42,     10,     63,
-     139,     86,     33,    236,
-      72,    125,     77,     24,
-      28,    174,    134,     68,
-      15,    218,     90,    112,
-      59,    248,    209,    156,
-     152,     50,    253,     55,
-     108,     94,     41,     11,
-     191,    117,    170,    223,
-     235,    182,    126,    179,
-     232,    226,     82,    120,
-     188,    241,     38,     91,
-     111,     58,      5,    208,
-     155,    102,     49,    252,
-      56,    146,    162,    214,
-      13,     65,    119,    169,
-     224,     21,     74,    128,
-      74,     23,    226,    170,
-     114,     68,     10,    220,
-      93,    148,    206,    246,
-      32,    105,    157,    204,
-     255,    204,    154,     81,
-      44,    249,    181,    138,
-      83,     28,     22,     89,
-     151,    187,    228,     20,
-     169,    122,     70,      0,
-     199,    169,    107,     58,
-     255,     59,    111,    156,
-     209,    255,    200,    156,
-     162,    215,      3,     77,
-     116,     80,     16,    227,
-     160,    104,     68,     22,
-      40,     68,    157,    166,
-     230,     45,    160,    100,
-      47,     38,    220,    107,
-     147,    220,     20,     60,
-     159,     72,     46,    224,
-     177,    125,    191,    245,
-      15,     84,    143,     73,
-      20,    213,    186,    111,
-      29,     47,    214,    127,
-     138,    210,    228,     48,
-     131,    114,     39,    247,
-     203,    143,    162,    203,
-       2,     84,    117,    170,
-      25,    231,    184,    101,
-      89,     13,    216,     72,
-     147,    210,    229,    213,
-     131,    121,     49,      9,
-     206,    107,    157,    223,
-       4,     49,     98,    170,
-     223,     16,    186,    146,
-     108,     60,    239,     81,
-     153,    182,    255,    222,
-     185,     98,    193,     13,
-     215,    158,    106,    206,
-      12,     32,     75,    134,
-     208,    254,    210,    170,
-     123,      7,    237,    104,
-      86,    160,    234,    239,
-     140,    104,    186,     21,
-     222,    165,    112,    201,
-     234,     51,     74,    130,
-      54,    234,    232,    190,
-     121,     49,     30,    126,
-      83,    168,     37,    240,
-     154,    142,    188,    239,
-      30,    173,    117,     71,
-     232,     11,    119,    152,
-      50,     32,    248,    131,
-     125,     38,     17,     11,
-     115,     81,     57,    225,
-     157,    137,    183,    203,
-     233,    164,    147,     76,
-     244,     36,    107,    140,
-      92,     32,    240,    189,
-     100,     54,      5,      7,
-      67,     99,     33,    250,
-     212,    159,    179,    192,
-     240,    163,    145,    168,
-     250,     39,    115,    117,
-      96,     58,    244,    168,
-     139,     65,     28,     35,
-     121,    157,     43,      3,
-     202,    137,    100,    214,
-      14,    208,    136,    168,
-     199,     20,    104,    107,
-     116,     50,     21,     66,
-     120,     67,      2,    198,
-      93,    186,    172,      0,
-     222,    173,    117,    194,
-     227,     53,    129,    107,
-     196,     36,     43,    115,
-     161,      8,    233,     90,
-     107,     95,      9,    205,
-     130,    145,    245,    245,
-     212,    177,     86,     88,
-     230,      2,     78,     98,
-      33,      2,     47,    125,
-     136,    212,    238,    203,
-     104,    190,     54,    192,
-     141,    181,    190,    177,
-      41,    160,     83,    106,
-      27,     61,    102,    155,
-      40,     46,    211,    120,
-     139,    194,    251,    216,
-     134,    133,    242,    224,
-     245,    168,    114,     35,
-      66,     15,    144,     17,
-      59,     24,     89,    173,
-     152,     29,    246,    188,
-     146,    233,    250,    212,
-     149,    103,    193,    235,
-     219,    166,     67,     55,
-     226,      9,     36,    160,
-      98,    222,    187,    105,
-     150,    205,     26,    149,
-      89,    180,    223,     58,
-     166,    113,     55,      4,
-      41,    100,    114,     20,
-     248,    216,    157,    166,
-     231,    215,    128,    129,
-     179,    203,     15,     95,
-     142,     99,     10,     52,
-     124,    135,     68,     24,
-     198,    170,    129,     61,
-      16,    216,    152,     77,
-      48,     66,     42,    166,
-     123,    196,     26,     50,
-      84,    165,     60,    206,
-      88,     81,    189,     28,
-     235,    191,    105,    179,
-     255,    222,    171,    121,
-      27,     53,     57,     40,
-     147,     28,    238,     39,
-     100,    180,    245,     12,
-     159,    151,    189,    251,
-     234,    185,    141,     94,
-      16,     15,     70,    124,
-      84,     22,    242,    191,
-     170,    130,     13,    229,
-     144,    149,    201,     35,
-      29,    150,    113,     38,
-      45,     81,    152,     90,
-      26,    239,     65,    101,
-     178,     15,    254,    183,
-      92,    182,    168,     23,
-     142,     93,    198,    252,
-      36,     74,    131,     45,
-     200,     58,     75,    160,
-      54,    247,    189,    136,
-     163,    237,    231,    148,
-     106,     93,      7,     38,
-      26,    114,      9,     41,
-      35,     74,    185,    224,
-       7,    251,    188,    143,
-     202,    250,    195,    108,
-      89,     39,      1,     68,
-     136,     72,     15,    247,
-     176,    198,    128,     48,
-     224,    171,    151,    162,
-     208,     57,    131,     83,
-      58,    219,     42,    152,
-     156,     47,    243,     56,
-     127,    165,     48,    228,
-     175,    166,    182,    175,
-       9,    136,     88,    167,
-     248,     58,     75,    114,
-       9,     35,     63,    120,
-     153,     54,    255,    197,
-     144,    150,    216,    241,
-     213,    158,    121,     42,
-      44,    127,    147,    101,
-      29,     22,     94,    152,
-     182,      8,    241,    170,
-     169,    216,    242,    214,
-     145,    120,    203,    244,
-      54,    153,    113,     63,
-     233,     37,     54,    183,
-      12,    241,     64,    113,
-     165,    249,     25,    147,
-      98,    170,    242,     36,
-     167,    122,     41,     14,
-      33,    109,    109,     59,
-     240,    238,    152,    166,
-     225,    226,    240,    128,
-     172,    209,     50,     80,
-     146,    106,     28,     12,
-      64,    135,     68,     29,
-     215,     93,    130,    193,
-      11,    221,    188,    124,
-     231,     52,    203,    179,
-      77,     42,      1,     33,
-     105,     85,     62,    226,
-      68,    115,    183,    227,
-     228,    160,    120,    179,
-     245,    208,    171,    105,
-      45,    216,      0,     98,
-     120,     61,    248,     55,
-     119,    190,    211,    238,
-     168,    115,    165,    213,
-      30,    179,    149,     73,
-     225,    224,    160,    126,
-      86,     26,      3,    112,
-     102,     36,      1,     47,
-     152,    141,    213,      0,
-     210,    158,    171,    223,
-       4,     78,    141,     66,
-      28,     29,    185,    149,
-      75,     29,    236,    117,
-     171,     85,     47,     47,
-      87,    109,    202,    233,
-     207,    138,     99,    199,
-       0,     62,    127,     95,
-      48,    246,     79,    152,
-      77,     28,    239,     76,
-     165,    185,     55,    250,
-      68,    153,    183,    251,
-      42,    170,    100,    205,
-     243,    206,     96,    151,
-      39,    239,     58,     99,
-      65,      2,    253,     86,
-      73,    163,     61,    201,
-      76,    143,    167,    253,
-      32,    191,    100,    180,
-     212,     37,    169,    145,
-     200,     18,    199,    109,
-     102,     13,    209,     57,
-      48,    128,      5,    219,
-     186,    115,    169,    251,
-      10,    190,     99,     75,
-     200,     60,    169,    115,
-      60,     13,    211,     92,
-     108,     45,     36,    200,
-      92,    191,     59,    219,
-     197,    118,    171,    206,
-      26,    176,    156,     85,
-     196,     57,     73,    116,
-      74,     28,     35,     95,
-     122,     32,     45,     56,
-      83,    107,     28,      8,
-      58,    148,    150,    192,
-      11,    209,    159,    172,
-     249,      8,     70,    131,
-      64,     23,     26,     78,
-     124,    100,     22,     19,
-      75,     90,     30,    241,
-      34,    121,    128,     61,
-     224,    220,     96,    186,
-     203,      3,    195,    156,
-      71,    221,     19,    177,
-     153,    176,    207,     17,
-     134,     91,    178,    233,
-      40,     70,    131,     33,
-      42,    218,     74,    184,
-     217,    250,    223,    155,
-      94,     43,    241,    208,
-     121,    143,     33,    197,
-     147,    133,    190,    198,
-       1,    173,     90,    109,
-      12,      3,    122,    156,
-     206,     22,    201,    151,
-     152,     57,      1,      4,
-     117,    118,      6,    252,
-     183,    139,    130,    251,
-     227,    145,    159,     78,
-     254,     59,     73,    117,
-      84,    240,     47,    177,
-     117,    237,    205,    214,
-     176,    113,     60,    241,
-      32,     72,     94,      9,
-     226,     70,    124,    165,
-     242,    226,    160,    131,
-     160,    233,    245,     75,
-     169,     75,     18,    210,
-     160,    102,    213,    227,
-     195,    185,    116,    201,
-       3,     45,    114,     94,
-       4,    235,     75,    124,
-     187,    202,     31,    145,
-      98,     72,     29,     26,
-     117,    153,     87,     17,
-     219,     93,    153,    215,
-     248,    192,    151,    159,
-     210,      2,     27,    117,
-      74,      6,    240,     65,
-     122,    191,    225,    253,
-     189,    127,     73,    224,
-      43,    163,    110,     90,
-       8,     56,    121,    184,
-     193,     28,    238,    146,
-     153,    200,     31,    199,
-     155,     79,     42,     10,
-      83,    116,     85,      8,
-     253,    163,    139,    148,
-     200,     45,    185,    111,
-      42,    241,     48,     73,
-     156,     35,     39,    199,
-     125,    137,    212,    255,
-     223,    154,    191,    254,
-      22,    189,    130,     64,
-       8,     29,     88,    136,
-      79,     25,    212,    163,
-     140,    202,    255,    212,
-     154,    158,    211,    243,
-     201,    159,    115,     62,
-     245,     63,    140,    164,
-      35,    225,    168,    130,
-     180,    233,     13,    109,
-     157,    184,     26,    208,
-     183,    124,     62,    246,
-     210,    153,    102,     56,
-     248,    200,     99,    136,
-     202,     18,     49,    137,
-      68,     48,    231,    187,
-     134,     69,     21,    227,
-     171,    127,    186,    253,
-      63,     64,    150,    207,
-      14,    198,    146,     98,
-      57,    246,    195,    154,
-      83,     38,    240,     49,
-     105,    182,    197,      0,
-      78,    138,     95,      9,
-     235,    175,    123,     73,
-      27,    202,    175,    142,
-     213,    239,     58,    114,
-     147,     51,    246,    205,
-     146,     84,     36,    253,
-     186,    140,     81,    215,
-      25,     78,    121,    185,
-     227,     17,     88,    123,
-      82,     26,    201,    171,
-     104,     58,      7,    208,
-      99,    158,    202,     13,
-      47,     98,    161,    214,
-     241,    176,    153,     83,
-      26,    225,    190,    134,
-      75,    234,     27,     85,
-     128,    183,    248,     46,
-      88,    144,     57,      1,
-     197,    147,     96,     53,
-     253,    197,    110,    163,
-     220,      4,     75,    114,
-     174,    224,    232,    177,
-     124,    183,    232,    229,
-     160,    122,     71,    246,
-      37,     80,    149,    198,
-       0,    202,    152,    154,
-     212,      6,    199,    153,
-      86,     33,     10,     73,
-     127,    172,     30,    237,
-     183,    126,    181,    238,
-      33,    171,    116,    190,
-     246,     41,    162,    108,
-     204,    249,    205,    157,
-     103,     42,    253,    197,
-     114,    166,    219,     15,
-      68,    123,    172,     30,
-     230,     72,    132,    181,
-      17,    218,    170,    118,
-     192,    244,    212,    162,
-     107,     55,      3,     50,
-     109,    153,    209,      6,
-     192,    137,     95,     36,
-      19,     65,    126,     80,
-      24,    229,    176,    135,
-     189,    238,     35,    169,
-     112,     61,     11,    215,
-     158,    150,    201,      1,
-     201,    151,     96,    209,
-      14,     58,    119,    167,
-      32,    237,     70,    132,
-      76,     24,    231,    180,
-     120,     71,    238,     34,
-      93,    138,    196,    243,
-      45,    156,    109,     55,
-     253,    203,    149,     96,
-      42,    244,    196,    137,
-      87,    219,     27,     79,
-     122,    176,     29,    227,
-     172,    135,    190,    238,
-     217,    163,    118,     56,
-       7,     47,    103,    144,
-     202,      1,    203,    148,
-      94,     40,    244,    192,
-     117,    168,     32,    238,
-     181,    125,    179,    229,
-      29,     81,    135,    185,
-     240,    217,    161,    114,
-     196,      6,    209,    156,
-     102,     51,      0,     49,
-     106,    162,    215,    244,
-     188,    136,     84,     33,
-     234,    183,    131,     72,
-      19,    226,     81,    132,
-     189,    243,     39,     91,
-     144,    199,    255,     43,
-     100,     98,     52,    255,
-     197,    147,     93,    214,
-      14,     66,    119,     86,
-      28,    232,    180,    127,
-     182,    234,     31,    172,
-     117,     64,     13,     37,
-      95,    148,    194,      5,
-     203,    155,    101,     50,
-     250,     56,    111,     92,
-      37,    241,    191,    119,
-     175,    229,     18,     72,
-     129,     72,     17,    227,
-     171,    136,    188,    243,
-     213,    166,    110,     57,
-     253,     53,    101,    155,
-      47,      5,    197,    146,
-      91,    217,    241,    188,
-     121,    172,    226,     22,
-      78,    129,     72,     21,
-     223,     85,    136,    189,
-      11,    213,    165,    110,
-      55,    252,     48,    101,
-      99,    209,      7,     58,
-     113,    164,     37,    242,
-     185,    121,     81,     28,
-     231,    179,    124,     73,
-     236,     32,     87,    138,
-     193,    245,    213,     95,
-     148,     55,      0,    205,
-     150,     96,     47,    248,
-      61,    112,    166,    218,
-      17,     69,    120,    173,
-     229,     25,    177,    125,
-      70,     19,    221,    168,
-     115,    193,      9,    212,
-      96,    106,     53,    254,
-      54,    104,     96,     45,
-     246,    195,    140,    166,
-     221,     17,     70,    122,
-     176,     26,     26,     78,
-     132,     70,     17,    220,
-     165,    113,     60,    247,
-     211,    158,    150,    201,
-       1,     52,    106,     96,
-     212,     11,     60,    114,
-     168,     35,    233,    188,
-     130,    177,    230,     25,
-      81,    123,     71,    239,
-      37,     88,    142,    194,
-     249,     45,    157,    105,
-      49,    255,     54,    107,
-     160,     42,     10,     63,
-     139,     86,    222,    236,
-     183,    125,    179,     24,
-     226,    175,    120,     68,
-     240,     39,     88,    143,
-      58,      6,     46,     98,
-     152,     50,    253,    200,
-     147,     94,     41,    244,
-     191,    138,     85,     32,
-      20,     72,    124,    177,
-     232,    227,    172,    120,
-     188,    241,     38,    164,
-     111,     59,      7,    209,
-     155,    152,    204,      3,
-     199,    147,     92,     40,
-      12,     65,    119,    170,
-     224,    235,    180,    128,
-     180,    233,     30,    172,
-     119,    189,     13,    217,
-     163,    145,    198,      4,
-      48,    101,    154,    207,
-       4,    198,    145,    163,
-     217,     13,    188,    137,
-      83,    225,     22,     75,
-     127,     74,    234,     31,
-      84,    118,     65,     13,
-     215,     93,    146,     56,
-       3,     49,    102,    155,
-     208,      5,     58,    111,
-     164,    217,     14,     67,
-     120,     82,     29,     23,
-      76,    126,     73,    235,
-      32,     85,    138,    191,
-      11,    214,     94,    147,
-     200,      2,    205,    152,
-      99,     46,    249,    196,
-     143,     90,     37,    240,
-      68,    121,    174,    227,
-      24,     77,    125,     72,
-      19,    222,    169,    139,
-     193,    245,     42,     95,
-     148,     54,      1,     51,
-     104,    157,    210,      7,
-     195,    142,     89,     36,
-     239,     69,    122,     80,
-      27,     25,     78,    131,
-     184,    237,     34,    168,
-     115,     62,    246,    212,
-     159,    106,     53,    255,
-      52,    105,    158,     44,
-       8,     61,    114,     88,
-      35,    238,    185,    123,
-     176,     26,    228,    176,
-     132,    185,    238,     34,
-      88,    114,     61,    247,
-      44,     97,    150,    203,
-     255,    202,    149,     96,
-      43,      9,    193,    140,
-      87,    221,     18,     71,
-     124,    177,     25,    228,
-     175,    122,    186,    239,
-     219,    166,    142,    195,
-     248,    210,     98,    104,
-      51,      1,     54,    107,
-      95,     42,    245,    192,
-     139,    169,     33,    236,
-     183,    125,    178,    231,
-      29,    175,    133,    184,
-      11,    218,    164,    113,
-      59,      6,    209,    156,
-     103,    205,      0,     49,
-     111,     92,     43,    247,
-     190,    138,     84,     33,
-     235,     72,    129,    176,
-     236,     28,     80,    120,
-      64,     15,    216,    165,
-     110,     59,      5,     46,
-     100,    102,    204,      2,
-     198,    146,    162,     40,
-      12,    190,    137,    171,
-     225,    234,     74,    127,
-      75,     22,    225,    173,
-     119,    189,     13,    216,
-     163,    110,    198,    251,
-     207,    101,    155,    207,
-     251,    199,    145,     92,
-      39,     13,     66,    118,
-     172,     30,    233,     75,
-     128,     74,     21,     31,
-     171,    119,     65,     12,
-     215,     93,    146,    198,
-     252,     49,    103,    100,
-     208,      5,    196,    145,
-      91,     38,    241,     67,
-     120,     82,    226,     22,
-      76,    129,     73,     20,
-     222,    171,    117,     64,
-     244,     41,     95,    146,
-     200,    252,    205,    152,
-      99,     47,    249,    196,
-     143,     90,     37,     15,
-      68,    121,    174,     28,
-      24,    178,    125,    183,
-     237,     33,     86,    139,
-      63,    245,     42,    161,
-     107,    201,      1,     51,
-     105,     98,    210,      7,
-     195,    142,    166,     36,
-     239,     69,    133,     80,
-     228,    230,     78,    124,
-     184,    237,    221,    168,
-     115,    193,    246,     43,
-      96,    106,     53,      0,
-     203,    150,    158,    211,
-     247,    194,    114,    167,
-     220,     17,     70,    132,
-     176,     26,    229,     79,
-     123,    185,    238,    220,
-     167,    141,    194,      8,
-      44,     97,    150,    203,
-     255,    203,    107,    159,
-      42,      9,     62,    140,
-     168,    221,    236,    184,
-     124,     78,    230,     27,
-     175,    122,     69,     16,
-     219,     89,    113,     60,
-     248,    210,    157,    104,
-     204,      1,    201,    107,
-     160,     42,     10,     63,
-     139,    169,    222,    236,
-      72,    125,     77,     24,
-      28,    174,    121,    187,
-     240,     37,     90,    112,
-      59,    249,    208,    156,
-     152,     50,    253,     55,
-     108,     94,    215,    244,
-     191,    116,     85,     32,
-      20,    182,    129,    179,
-     232,    226,     82,    120,
-      66,    241,    217,    164,
-     145,     58,      4,     47,
-     100,    102,    206,      3,
-     199,    109,    162,     40,
-      12,     65,    137,    171,
-     224,    234,     74,    127,
-      75,    233,     30,    172,
-     119,    189,     13,    216,
-      92,    110,     57,      4,
-      48,    154,    154,    207,
-     251,    198,    110,     92,
-      39,     13,    189,    137,
-     172,     30,    233,     75,
-     128,     74,    234,     31,
-     171,    137,     65,     12,
-      40,     93,    109,     56,
-       3,    206,    102,    155,
-      47,    250,     58,    111,
-      91,    217,     14,    188,
-     120,     82,     29,     23,
-      76,    126,     73,    235,
-     223,    170,    117,     64,
-     244,     41,    161,    108,
-     200,      2,    205,    103,
-      99,     46,      6,    196,
-     143,    165,     37,    240,
-      68,    134,     81,    227,
-     231,    178,    130,     72,
-      19,    222,     86,    139,
-      63,    245,     42,    160,
-     148,    201,    254,     51,
-     151,     98,    210,    248,
-      60,    113,    166,     36,
-      16,    186,    122,    175,
-      27,    230,    177,    124,
-      71,    237,     34,    168,
-     115,     62,      9,     43,
-      96,    106,     53,    255,
-     203,    105,    158,     44,
-       8,     61,    141,     88,
-     220,     17,    185,    132,
-      79,     26,    229,     79,
-     123,     70,    238,    220,
-     167,    114,     61,      8,
-      44,    158,    105,    203,
-     255,    202,    106,    159,
-      43,      9,    193,    140,
-      87,     34,    237,     71,
-     124,    177,    230,     27,
-     175,    133,    186,     16,
-      36,     89,    113,    195,
-     248,    210,    157,    151,
-      51,    254,     54,    148,
-     160,    213,    245,    192,
-     116,    169,     33,    236,
-     183,    130,     77,    231,
-     227,     81,    134,     68,
-      15,     37,    165,    112,
-      59,      6,    209,     99,
-     103,    205,      2,    200,
-     108,    161,     41,    244,
-     191,    138,     85,    223,
-      20,    182,    126,    179,
-      23,     29,     82,    135,
-     188,    241,    217,    164,
-     144,    197,    250,     47,
-     100,    153,    206,      3,
-      56,    146,     93,     40,
-     243,    190,    118,     84,
-      31,     21,    181,    128,
-     180,     22,    225,     83,
-     136,     66,    242,     39,
-      92,    145,    198,      4,
-      48,    154,    101,     48,
-     251,    198,    145,    163,
-      39,     13,     66,    136,
-     172,    225,    233,     75,
-     128,     74,    234,     31,
-      84,    137,    190,     12,
-     215,     93,    146,    199,
-     252,     49,    102,    100,
-      47,    250,    197,    111,
-      91,     38,    241,    188,
-     120,    173,    226,    232,
-     179,    129,     73,    235,
-     223,     85,    117,     64,
-      11,     41,    161,    108,
-     200,      2,    205,    152,
-     156,    209,      6,     59,
-     112,    165,    218,     15,
-      68,    121,    174,     28,
-     231,    178,    125,     72,
-      19,    222,    169,    116,
-      63,     10,     42,     95,
-     148,    201,    254,     51,
-     104,    157,    210,      7,
-     195,    142,    166,     36,
-     239,    186,    133,     80,
-      27,    230,    177,    124,
-      71,     18,    221,    168,
-     140,    193,    246,     43,
-      96,    149,     53,      0,
-      52,    150,     97,    211,
-       8,    194,    114,    167,
-     220,     17,     70,    132,
-      79,     26,    229,    176,
-     123,    185,    238,     35,
-      88,    114,     61,      8,
-     211,    158,    105,     52,
-     255,    202,    149,     96,
-      43,    246,    193,    115,
-     168,    221,     18,     71,
-     124,    177,    230,     27,
-      80,    133,    186,    239,
-      36,     89,    142,     60,
-       7,     45,    157,    104,
-      51,    254,    201,    107,
-      95,     42,    245,    192,
-     139,     86,     33,    236,
-     183,    130,     77,     24,
-     227,    174,    121,    187,
-      15,    218,    165,    143,
-     196,    249,     46,     99,
-     152,    205,      2,     55,
-     108,    161,    214,     11,
-      64,    117,    170,    223,
-      20,    182,    129,    179,
-     232,     29,     82,    120,
-      67,     14,    217,    164,
-     111,     58,      5,    208,
-     100,    153,    206,    252,
-     199,    109,    162,     40,
-      12,     65,    118,    171,
-     224,    234,    181,    128,
-      75,     22,     30,    172,
-     119,    189,    242,     39,
-      92,    145,    198,    251,
-      48,    101,    101,    207,
-       4,    198,    145,     92,
-     216,     13,    189,    119,
-     172,    225,     22,    180,
-     128,     74,     21,    224,
-     171,    118,     65,     12,
-     215,    162,    109,     56,
-       3,    206,    153,    100,
-      47,      5,     58,    144,
-     164,    217,     14,     67,
-     120,     82,     29,     23,
-      76,    126,     73,    235,
-      32,     85,    138,    191,
-     244,    214,    161,    147,
-      55,    253,     50,    152,
-     156,    209,      6,    196,
-     112,     90,     37,    241,
-      71,    114,     84,     23,
-      31,     68,    113,     68,
-     232,     37,    173,    113,
-     192,    243,    215,    167,
-     150,    203,    236,     33,
-     129,     67,    212,     39,
-      59,    134,     90,    216,
-      17,    190,    124,    164,
-      30,    238,    180,    123,
-      79,     18,    215,    180,
-     151,    133,    255,    144,
-     179,    136,    226,    248,
-     197,    158,    109,     56,
-       0,     19,    111,     86,
-      52,     17,     76,    126,
-     180,     30,    240,    165,
-     118,     67,     24,    205,
-     120,    177,    198,     54,
-     244,    118,    179,    218,
-     250,    204,    155,    119,
-     211,     34,     32,    136,
-      69,     36,     16,     79,
-     123,     72,     15,    251,
-     167,    117,    168,    172,
-      42,    140,     89,     62,
-     242,     11,    113,    113,
-      39,    247,     55,     97,
-     177,    247,     25,    222,
-     149,    164,    204,    235,
-     186,    137,     81,     56,
-     250,    112,    218,    182,
-      62,    249,    163,    158,
-     239,    216,    240,    174,
-     119,    209,     30,     55,
-     120,    182,     49,    233,
-      77,    108,     83,     54,
-     247,    175,    160,     79,
-     175,     54,    168,    103,
-     105,     31,     23,     28,
-     105,      7,     41,     60,
-      64,    100,    196,     37,
-     197,    183,     90,    195,
-       5,    182,    154,    119,
-       0,    225,     89,     66,
-     168,      2,    195,    182,
-     154,    137,    224,    253,
-     176,    146,     40,      7,
-      26,     79,     98,     18,
-       6,     44,    151,     85,
-     221,    227,    141,    146,
-     175,    250,     56,     81,
-     101,    127,     16,     48,
-     118,    124,     88,      0,
-     223,    162,    135,    209,
-     247,     50,    158,     98,
-      46,      6,     58,    159,
-      68,     61,    255,     67,
-      83,    130,     29,    205,
-     168,    137,    170,    255,
-     222,    166,    110,     85,
-     225,      0,     87,    101,
-     203,    245,     48,    158,
-     102,     40,    234,    209,
-     128,     87,     37,     44,
-     109,    134,    115,     15,
-      12,    108,    139,     92,
-       6,    218,     85,    130,
-     210,    231,     41,    174,
-     107,    217,    253,    221,
-     141,    112,     33,    232,
-     196,    105,    130,    211,
-     244,    163,    113,    176,
-     232,    239,    161,    114,
-      66,    229,     49,     70,
-     132,    192,    244,     44,
-      98,    102,     59,     14,
-     197,    131,    112,    194,
-      44,     40,    130,     70,
-      35,     14,     85,    128,
-      68,      8,    233,     69,
-     157,    182,    239,    221,
-      92,    139,    192,     11,
-     222,    137,    120,     58,
-     235,     50,     77,    139,
-      57,    239,    193,     97,
-     165,    219,     18,    169,
-     144,    182,    243,     23,
-      84,    129,    184,    235,
-      34,    166,     96,     43,
-       8,    219,    145,    147,
-     236,     21,    198,    128,
-      93,    220,     25,     50,
-     138,     88,     44,     17,
-      68,    114,    188,    224,
-     224,    169,    133,    188,
-       6,    198,    189,    122,
-      56,    240,     52,    115,
-     104,     33,    255,     63,
-      99,    177,     43,    226,
-     177,    112,    167,    212,
-      31,     78,    128,     78,
-     238,     30,    162,    100,
-      91,      0,    221,     74,
-     136,    212,    250,    219,
-     148,    108,    193,     42,
-      33,    141,    113,     43,
-      17,     90,    124,     85,
-      23,    232,     76,    128,
-      68,      0,    244,    186,
-     117,    159,    208,    223,
-     129,    101,    210,    236,
-      54,    152,     97,     56,
-     252,     61,    100,    165,
-     219,     12,     66,    114,
-     170,     25,    254,    173,
-     110,     67,    250,     62,
-      88,    103,     83,    243,
-      34,     82,    131,    193,
-      18,    220,    111,    143,
-     216,    254,    192,    148,
-     167,    215,      9,    176,
-     158,     72,     11,     23,
-     104,    165,     79,     55,
-     207,     92,    154,    178,
-     254,    214,    176,     98,
-     193,    229,     56,    144,
-     104,     45,     14,     50,
-     141,     84,     54,    228,
-     169,    115,    134,    250,
-     247,    146,    122,    166,
-     250,     47,     84,    122,
-      40,      9,     62,     70,
-     156,     63,     17,    201,
-      97,    149,     41,    236,
-     219,    156,    166,    192,
-      15,     69,    156,     64,
-     226,      8,     94,    143,
-      70,     10,    200,     81,
-     148,    208,    247,    216,
-     147,    106,    205,    254,
-     198,    128,    114,     42,
-      28,     28,    122,     76,
-      55,    238,     87,     99,
-     160,     30,    243,    161,
-     129,    182,    229,     37,
-     163,    121,     63,    241,
-      46,    150,    125,     35,
-     241,     38,     67,    142,
-      60,    235,    194,    124,
-     189,    207,     21,    182,
-     148,     75,    233,      8,
-      86,    114,     74,     21,
-      33,     90,    120,     45,
-      21,    220,    110,    182,
-     217,    247,    220,    152,
-     162,    199,     18,     48,
-     131,     67,     39,     24,
-      71,    116,     75,     11,
-     232,     82,    133,     78,
-      28,    201,    172,    159,
-     219,    246,    221,    142,
-      98,    200,      9,     38,
-      97,     90,     36,    244,
-      74,    124,    175,     33,
-     225,    186,    135,     79,
-      29,    239,    161,    120,
-     165,    235,    218,    177,
-     106,    205,    242,     38,
-     110,    155,     55,      3,
-      51,    103,    163,     40,
-     245,    181,    142,     87,
-      18,    242,    166,    132,
-     163,    204,     22,    181,
-      97,    190,    253,     40,
-      86,    110,     53,      1,
-      32,    112,    159,     48,
-     251,    207,    158,     89,
-     216,    224,    156,    158,
-     160,    202,     12,    186,
-     100,     77,    227,     16,
-      70,    131,     74,     25,
-      44,    127,    132,     62,
-      10,    206,    154,    104,
-      38,    247,    210,    140,
-      94,    252,     43,    187,
-     166,     89,    233,     25,
-      92,    143,     72,      0,
-     216,     78,    170,    183,
-      12,    209,    169,    102,
-      49,     11,    219,    184,
-     111,    242,     33,    193,
-     175,     86,    221,      5,
-      74,    119,    175,     19,
-     225,     90,    157,    188,
-      23,    218,    174,    127,
-      55,      1,    193,    128,
-      98,    236,    225,    221,
-     138,    156,    222,      1,
-      52,    118,     95,     52,
-      20,    103,    100,    169,
-      28,    224,    183,    121,
-      66,     24,    202,    139,
-     142,    230,    251,    201,
-     136,    156,    219,    241,
-      50,    145,    115,     37,
-      28,     25,    101,    165,
-      37,    230,    190,    128,
-      74,     19,    253,    160,
-     157,    174,      7,    254,
-     167,    131,    207,    248,
-      47,    138,    117,    207,
-      41,     17,     99,     99,
-      44,    251,    201,    141,
-     168,     49,    245,     85,
-      92,     65,     55,    239,
-      64,    148,    172,    230,
-     194,    142,    119,    231,
-     212,     58,    102,     98,
-      32,    246,    203,    148,
-      86,     45,     28,     44,
-     158,    121,     50,     25,
-      81,     95,    190,      3,
-     211,    189,    154,    151,
-     235,     45,    163,    126,
-      48,     15,    214,    150,
-     148,    230,     12,    235,
-     190,     77,     43,     29,
-     106,    100,     78,      8,
-     230,     88,     98,    170,
-     229,    228,    167,    124,
-      71,     27,    201,    125,
-     160,     61,     43,    203,
-     145,    101,    211,     31,
-     215,    181,     80,    198,
-      24,     78,    113,     93,
-      17,     22,     88,    129,
-      85,    225,     51,     88,
-     104,     84,      8,    209,
-      77,    143,     48,     47,
-     216,    106,    140,    222,
-      16,    197,    138,     82,
-     200,      3,    173,    123,
-     132,    227,    203,    167,
-     123,     66,    252,     63,
-     163,     94,     90,    241,
-      36,     83,    156,     56,
-      19,    194,    110,    153,
-     213,     34,     32,    134,
-      68,     34,    244,    188,
-     109,    167,     14,    255,
-     177,    134,    176,    239,
-     217,    190,    101,    178,
-     231,     41,     72,    178,
-      62,     35,    206,     98,
-      99,    195,     11,    209,
-     145,     95,    214,     29,
-      73,    129,     78,     56,
-     238,     92,    150,    159,
-     200,    208,    130,    102,
-     199,    237,      8,     92,
-      74,     40,      4,     60,
-     113,    146,     36,    227,
-     218,    134,     90,    223,
-      59,     96,    137,    116,
-       8,    228,     89,    160,
-     178,      8,    251,    164,
-     148,    227,    253,    216,
-     132,    113,     49,    245,
-      47,     75,    159,     56,
-     236,    206,    121,    188,
-     211,    229,    160,    159,
-     177,    253,     10,    176,
-     112,     84,     26,     35,
-      68,    160,    193,     16,
-     220,    149,    101,    199,
-      31,     55,    137,    125,
-      45,     24,     46,    119,
-      87,     54,    246,    184,
-      76,    134,    231,    242,
-     187,    117,     66,    251,
-      58,    165,    106,     38,
-      12,     45,    101,    156,
-      51,    247,    219,    104,
-     141,    206,    246,    204,
-     135,     68,    222,     10,
-      67,    136,     94,     22,
-     225,     83,    130,    187,
-       4,    200,     82,    160,
-     220,      4,    218,    138,
-     124,    205,     24,     60,
-     111,     86,     59,    228,
-     187,    127,    187,    215,
-     228,     75,     88,    188,
-      18,    224,    163,     91,
-      68,    227,    221,    161,
-     144,     51,     21,     46,
-      98,    152,    204,     13,
-      17,    116,     93,     44,
-     255,    160,    135,    166,
-      22,    228,    183,    139,
-      95,     21,     21,     86,
-     141,    185,    229,     14,
-      74,    152,     60,     28,
-     215,    153,    152,     52,
-     255,    212,    138,     81,
-      39,     14,     77,    125,
-     190,    193,      4,     76,
-     125,     66,      7,    234,
-     169,    126,     68,      1,
-     195,    171,    108,    199,
-     244,     62,    120,    187,
-     223,    252,    213,    158,
-      81,    220,      9,    188,
-     136,    115,     11,    237,
-      72,    147,    164,    249,
-      55,     67,    131,     72,
-       7,    221,    162,    109,
-      49,     13,    214,    136,
-      98,    208,      1,     48,
-      96,    190,    248,     30,
-     179,    146,     70,     21,
-      30,     79,    117,     80,
-       4,    213,    175,    130,
-     210,    239,     52,     77,
-     150,     51,      3,    196,
-     157,    101,     37,    245,
-     213,    130,     93,     33,
-      19,     72,     96,    141,
-     196,     23,    180,    104,
-      83,     20,    216,    174,
-     120,     43,     27,    222,
-      96,    146,    193,    235,
-      47,    126,    144,    217,
-     240,    208,    128,     81,
-      42,    227,    181,    139,
-      66,     25,     30,     65,
-     147,    161,    252,     47,
-      90,    118,     56,      1,
-     217,    146,    100,     58,
-     243,    200,    105,    153,
-     211,      0,     49,     98,
-     162,    223,     18,    190,
-     138,     74,     28,    237,
-     168,    126,     71,     16,
-     219,     91,    138,    202,
-     244,     38,    103,    107,
-      59,    245,    204,    149,
-      92,     43,    247,    195,
-     118,    173,    221,     16,
-      76,    121,    179,    230,
-      30,     80,    123,     66,
-       6,    214,    163,    141,
-     192,    248,     47,     98,
-     156,    202,      4,     49,
-     111,    160,    215,    245,
-     183,    130,     86,     35,
-     235,    183,    132,     77,
-     233,     28,     82,    134,
-     190,    242,     35,     94,
-     148,     58,      6,    208,
-     155,    103,    206,    253,
-     194,    148,     94,     42,
-     242,     64,    119,    171,
-     225,     21,     74,    126,
-     182,    236,     22,     84,
-     137,     71,      5,    222,
-     160,    111,    198,      5,
-     206,    101,    155,    206,
-       5,     57,    111,    162,
-     219,     15,    189,    138,
-      82,     29,    237,    183,
-     127,    180,    233,     28,
-      85,    118,    190,    241,
-      41,    162,    109,     56,
-       1,    202,    154,    100,
-      47,    250,    196,    110,
-     162,    223,     11,     65,
-     135,     80,     29,     22,
-      77,    125,     79,     18,
-     221,    171,    117,     65,
-       8,     43,     86,    148,
-     204,    255,     50,    156,
-      96,    209,      6,     59,
-     112,     88,     44,    248,
-     184,    120,    171,    234,
-      16,     79,    124,     73,
-      18,    223,     86,    137,
-      63,      9,    215,    163,
-     111,     55,    255,    204,
-     105,    155,    213,      4,
-      60,    143,     93,     39,
-     238,     68,    123,     80,
-      31,    226,    178,    131,
-     188,    235,     38,     87,
-     140,     62,     11,    214,
-      96,    149,     53,      2,
-     202,    151,     97,     44,
-     247,     60,    115,    166,
-     223,     21,     71,    133,
-      77,     24,    231,    178,
-     122,    185,    238,     35,
-      89,    141,     60,     10,
-      44,     99,    149,    207,
-       3,    202,    150,     98,
-      41,    244,    193,    113,
-     171,    222,     19,    185,
-     135,     74,     27,     26,
-      82,    135,    187,    239,
-     218,    164,    112,     61,
-     248,     46,    102,    149,
-     204,    255,    202,    144,
-      94,    212,      8,     63,
-     116,     87,     36,    232,
-     183,    126,    182,    226,
-      31,    174,    123,     70,
-      14,    218,     90,    143,
-     196,      6,    208,    158,
-     101,     50,      3,     54,
-     109,    162,    213,    244,
-     189,    137,     87,     33,
-      21,     74,    127,     77,
-      20,    227,     82,    134,
-     190,    240,     38,    164,
-     111,     59,      4,    208,
-     155,    102,     48,    252,
-      57,    108,    162,    214,
-      13,     65,    119,    171,
-      31,    234,    181,    129,
-      74,     23,    224,    173,
-     119,    188,    243,     38,
-      93,    145,     57,    251,
-      48,    154,    101,     48,
-     251,    198,    145,     92,
-      39,    243,    189,    118,
-     173,    224,     20,     74,
-     127,     74,     20,    226,
-     168,    119,    191,    242,
-      40,    163,    109,    199,
-     253,     48,    102,    154,
-     210,      4,     58,    145,
-      88,     37,    242,    189,
-     120,    172,    226,     23,
-     179,    129,    183,    233,
-      34,     86,    136,     64,
-      10,    212,    163,    110,
-      53,      3,    205,    103,
-      99,     46,    249,     59,
-     112,    167,    217,     12,
-      70,    121,     81,     30,
-     227,    177,    125,    183,
-     236,     32,    169,    117,
-      63,    245,     43,     93,
-     150,    203,    255,    204,
-     149,     96,     47,    249,
-     195,    112,    167,    219,
-     239,    187,    132,     80,
-     229,     27,     76,    131,
-      71,     19,    223,    170,
-     114,     62,    246,     42,
-      97,    149,     53,      1,
-     203,    105,    156,    210,
-       8,    194,    114,     88,
-      34,    238,    185,    133,
-      79,    229,     27,     79,
-     132,     70,     17,     35,
-      88,    143,     61,    243,
-      46,    152,    151,     55,
-       0,    202,    104,    154,
-      45,    247,    192,    114,
-     169,     35,     19,    185,
-     124,     79,    230,    228,
-     172,    133,     69,     16,
-      37,     91,    113,    195,
-       7,    210,     99,    104,
-     204,    254,    201,    107,
-     160,    212,    245,     63,
-     139,     86,    223,     19,
-      74,    131,     76,    231,
-     226,     81,    135,    185,
-     240,    219,     91,    112,
-      59,      7,    211,     99,
-     101,     50,      3,    200,
-     147,     94,    214,    246,
-      67,    138,     85,    220,
-     238,    182,    127,    179,
-      22,     31,    173,    121,
-     191,     14,     39,     90,
-     111,     58,      5,     47,
-     155,    155,     49,    253,
-      57,    109,    162,     40,
-      14,    191,    119,    171,
-      31,     20,    181,    127,
-      75,    232,    224,     83,
-     137,     64,     13,    217,
-     162,    110,    198,      4,
-     207,    154,    101,     48,
-       6,     57,    110,    163,
-      39,    243,    189,    137,
-      82,    225,    232,    180,
-     128,     74,    235,     29,
-      84,    118,    190,     12,
-      41,     92,    146,     56,
-       3,    206,    102,    155,
-     209,      4,    197,    144,
-      91,     38,     14,     67,
-     120,    173,     29,    232,
-      76,    126,     73,    235,
-     222,    171,    138,     65,
-     244,     40,    161,    108,
-     201,      3,    205,    103,
-      98,    209,    249,    196,
-     112,     90,     36,     15,
-      68,    134,    174,    227,
-      24,     77,    131,     72,
-      19,    222,    169,    139,
-     192,    244,     42,    161,
-     106,    201,    254,     51,
-     105,    157,     45,    249,
-     195,    112,     88,    218,
-      16,    184,    122,    175,
-      26,     25,    177,    124,
-     186,     18,    221,     87,
-     115,     62,    247,     43,
-     159,    149,     52,      0,
-      52,    150,    159,    211,
-     246,     61,    141,     89,
-     222,     17,    184,    123,
-      78,     26,     26,    176,
-     133,    184,     16,    220,
-      89,    112,    194,    245,
-     211,     97,    105,     52,
-       0,    202,    149,    158,
-     212,    246,     63,    115,
-      87,     34,     18,    184,
-     131,    177,    230,     27,
-     174,    122,    187,     17,
-      36,     88,    113,    194,
-       7,    211,     98,    104,
-     204,      0,     54,    148,
-     160,     43,    244,     63,
-     139,    168,    223,    236,
-      72,    130,     76,    231,
-      29,    175,    135,    186,
-      14,     36,     90,    113,
-     196,    249,    208,     99,
-     103,     50,      2,     55,
-     147,     94,     41,    245,
-      65,    117,     85,    222,
-     234,    183,    126,     76,
-     232,     29,    173,    135,
-      67,     14,    217,     91,
-     111,    197,    251,    209,
-     100,    153,     49,      3,
-     199,    109,    162,    215,
-      13,     65,    136,     85,
-      30,    235,     74,    126,
-     180,    233,    225,    173,
-     136,     66,     13,     39,
-     163,    110,    198,    251,
-     207,    154,    154,     48,
-     251,     57,    145,    163,
-      39,    242,     66,    136,
-      83,    225,    233,    180,
-     127,     74,     21,    224,
-      84,    118,    190,    243,
-     215,    162,    109,    199,
-     252,     49,    102,    100,
-     208,    250,    197,    144,
-      91,     38,     14,     67,
-     120,    173,     29,    232,
-     179,    126,     73,    235,
-      32,     85,    138,     64,
-      11,    214,    161,    108,
-     200,    253,     50,    152,
-      99,     46,    249,     59,
-     112,    165,     37,     15,
-      68,    134,    174,     28,
-      24,     77,    130,    183,
-     236,    222,    169,    116,
-      63,    245,     42,    160,
-     148,    201,      1,     51,
-     104,     98,     45,      7,
-     195,    113,    166,     36,
-     239,     69,    133,    175,
-     228,    230,     78,    131,
-      71,    237,     34,    168,
-     140,     62,      9,     43,
-      96,    106,    202,      0,
-     203,    105,     97,    211,
-       8,    194,    141,    167,
-      35,     17,     70,    132,
-      79,     26,    229,    176,
-     132,     70,     17,    220,
-     167,    141,    194,      8,
-      44,    158,    105,     52,
-       0,     53,    106,    159,
-      43,      9,    193,    140,
-     168,    221,     18,     71,
-     131,     78,    230,     27,
-     175,    133,    186,     16,
-      36,     89,    113,    195,
-       7,    210,     98,    104,
-      51,      1,     54,    148,
-     160,    213,    245,    192,
-     139,     86,    222,    236,
-     183,    130,     77,     24,
-     227,     81,    121,    187,
-     240,    218,     90,    143,
-     196,    249,     46,    156,
-     103,    205,      2,     55,
-     108,    161,     41,     11,
-      64,    117,    170,    223,
-     235,    182,    129,     76,
-     232,     29,    173,    135,
-     188,     14,     38,    164,
-     111,     58,    250,     47,
-     155,    153,     49,    252,
-     199,    146,    162,     40,
-     243,     65,    137,     84,
-     224,    234,    181,    127,
-      75,    233,     30,    172,
-     119,    189,     13,    216,
-      92,    145,    198,    251,
-     207,    154,    154,    207,
-       4,     57,    110,     92,
-     216,     13,    189,    119,
-     172,    225,     22,     75,
-     128,     74,    234,    224,
-      84,    137,    190,     12,
-     215,    162,    109,     56,
-       3,     49,    153,    100,
-      47,    250,     58,    111,
-     164,     38,    241,    188,
-     135,     82,     29,     23,
-      76,    126,     73,    235,
-      32,     85,    138,     64,
-      11,    214,    161,    147,
-     200,      2,     50,    103,
-      99,    209,    249,    196,
-     143,     90,     37,     15,
-      68,    121,    174,     28,
-     231,     77,    125,    183,
-     236,    222,    169,    116,
-      63,     10,     42,    160,
-     148,    201,      1,    204,
-     151,     98,    210,    248,
-     195,    142,     89,    219,
-      16,    186,    133,    175,
-     228,     25,     78,    131,
-     184,     18,    221,     87,
-     140,    193,    246,     43,
-      96,    149,     53,    255,
-      52,    105,    158,    211,
-       8,    194,    141,     88,
-      35,    238,    185,    132,
-      79,    229,     26,     79,
-     123,     70,     17,    220,
-      88,    141,    194,    247,
-      44,     97,    105,     52,
-     255,     53,    149,     96,
-      43,    246,    193,    140,
-     168,    221,     18,     71,
-     131,     78,     25,     27,
-     175,    133,    186,    239,
-      36,     89,    142,    195,
-     248,     45,    157,    151,
-     204,    254,    201,    148,
-      95,     42,    245,    192,
-     139,     86,     33,     19,
-      72,    125,    178,    231,
-      28,     81,    134,    187,
-     240,     37,     90,    112,
-      59,    249,     46,     99,
-     152,    205,      2,     55,
-     108,    161,     41,    244,
-     191,    138,     85,     32,
-     235,    182,    129,     76,
-      23,     29,     82,    135,
-      67,    241,     38,     91,
-     144,    197,      5,    208,
-     155,    102,     49,      3,
-      56,    109,    162,    215,
-      12,     65,    137,     84,
-      31,    234,    181,    128,
-      75,     22,    225,    172,
-     119,     66,     13,    216,
-     163,    145,    198,    251,
-      48,    101,    101,     48,
-     251,    198,    145,     92,
-     216,     13,     66,    119,
-      83,     30,    233,    180,
-     127,     74,    234,     31,
-      84,    137,    190,    243,
-      40,     93,    146,     56,
-     252,     49,    153,    100,
-      47,    250,    197,    144,
-      91,     38,    241,    188,
-     135,     82,     29,     23,
-      76,    129,    182,    235,
-      32,     85,    138,    191,
-     244,    214,    161,    108,
-      55,      2,    205,    152,
-      99,     46,      6,     59,
-     112,    165,    218,     15,
-      68,    121,    174,    227,
-      24,     77,    125,     72,
-      19,    222,    169,    116,
-      63,     10,    213,    160,
-     107,    201,    254,     51,
-     104,    156,    211,      6,
-      61,    112,    166,    219,
-      16,    186,    133,     81,
-      26,    231,    179,    125,
-      70,     19,    221,     87,
-     140,    192,    244,     41,
-      98,    151,    200,    253,
-      53,    105,     97,     45,
-     245,    192,    142,     91,
-      32,    237,    187,    133,
-      79,    229,     27,     77,
-     134,    186,    237,     33,
-      90,    140,    195,    247,
-     211,    158,    104,     53,
-     253,    200,    151,     98,
-      41,    247,    192,    140,
-     168,    220,     19,     69,
-     126,    179,    231,     26,
-      81,    132,    187,    238,
-      36,     89,    142,     60,
-       6,    208,    159,    107,
-      48,    252,    203,    149,
-      95,    213,     11,     62,
-     118,    171,    220,     17,
-      74,    126,    177,    228,
-      31,     80,    134,     69,
-      12,    223,    163,    118,
-      62,      2,    210,    158,
-     103,    205,      3,     53,
-     110,    162,    213,     15,
-      68,    112,    172,    218,
-      17,     74,    127,     77,
-      20,    228,    165,    113,
-      75,      9,    223,    160,
-     109,     58,    251,     44,
-     103,    154,    205,      0,
-      59,    104,    164,    208,
-      11,     70,    112,    175,
-     225,    232,    178,    138,
-      70,     27,    237,    166,
-     112,     70,     12,     38,
-      88,    148,    195,    255,
-      52,     97,    156,    199,
-      14,     51,    100,    171,
-     222,     15,    188,    142,
-      88,     16,    230,    187,
-     114,     64,     18,    227,
-      84,    138,    184,    244,
-      47,     90,    149,    207,
-     245,     56,    111,    146,
-     215,      0,     56,    145,
-      93,     45,    255,    172,
-     150,     66,     16,    226,
-     181,    127,    181,    236,
-      42,     94,    129,    180,
-     254,     35,     84,    154,
-     192,    250,     54,    102,
-      97,     41,    245,    203,
-     158,     75,     53,    253,
-     177,    128,     80,    224,
-      16,     70,    142,    187,
-     231,     43,     92,    130,
-     200,    242,     47,     92,
-     149,     52,      7,    198,
-     153,    114,     61,    247,
-     207,    135,     95,     38,
-      18,     66,    112,    163,
-     232,     18,     69,    137,
-     177,    229,     37,     82,
-     143,    192,      8,    209,
-     150,    103,     37,     17,
-     219,    152,    109,     36,
-     243,     61,    119,    174,
-     208,     29,     74,    119,
-     187,    238,     16,     70,
-     131,    188,    236,    220,
-     163,    123,     48,     24,
-     194,    142,    102,     56,
-     246,    207,    149,    155,
-     220,      2,     51,    126,
-     165,    209,     25,     77,
-     117,    182,    227,     25,
-     175,    121,     66,     28,
-     212,    180,     96,     44,
-       9,    217,    154,    106,
-     206,      9,     58,    101,
-     174,    216,      6,     52,
-     126,    161,    216,     23,
-      74,    125,     79,     30,
-     233,    160,    104,     86,
-      31,    212,    174,    119,
-      56,    248,     41,    104,
-     150,    194,     12,     59,
-     103,    171,    222,     13,
-      68,    119,    170,     33,
-     239,    190,    141,     67,
-       6,    243,    162,    117,
-      74,     11,    216,     95,
-     153,    200,    245,     32,
-     106,    149,    196,     11,
-      62,    105,    160,    215,
-     243,    188,    140,     93,
-      18,    250,    167,    145,
-      69,     26,    233,    168,
-     137,    187,    254,     40,
-      77,    129,    200,    240,
-      57,     99,    158,    205,
-       5,    198,    144,     95,
-      33,    248,    179,    152,
-      66,     17,    228,    190,
-     121,     75,    233,     22,
-      90,    152,    175,    252,
-      36,     84,    148,    195,
-     253,     49,    153,    101,
-      46,    249,    195,    153,
-      86,     41,    254,    178,
-     140,     90,     25,     23,
-      73,    138,    185,    250,
-      48,     88,    128,    184,
-     241,     43,     94,    108,
-      54,      3,    204,    155,
-     101,     36,    244,    203,
-     129,     86,     47,    246,
-     184,    120,    168,    232,
-      22,     66,    140,    189,
-     235,     36,     85,    138,
-     192,     10,    213,     95,
-     107,     52,      4,    197,
-     155,    108,     32,    244,
-     201,    137,     93,    219,
-      21,     78,    116,    160,
-     233,     19,     73,    134,
-     187,    239,     35,     87,
-     140,    192,    246,    213,
-     155,     99,     56,     15,
-     197,    155,    106,     36,
-     243,     61,    119,    172,
-     211,     30,     75,    113,
-     183,    227,     30,     76,
-     134,    185,     16,     34,
-      88,    113,     58,      5,
-     193,    138,    100,     60,
-     251,     52,    108,    151,
-     223,      6,     51,    123,
-     172,     34,    239,    184,
-     125,    179,    228,     26,
-     175,    122,     70,     24,
-     213,    180,    103,     44,
-     248,     42,    105,    135,
-     220,      6,     62,     99,
-     160,     46,    247,    195,
-     137,    174,    212,     27,
-      79,    121,     79,     31,
-     239,    187,     99,     93,
-      29,     37,     86,    129,
-     213,    233,     40,    103,
-     144,    204,    253,     52,
-     109,    165,    221,      1,
-      71,    113,     87,     40,
-     231,    162,    155,     85,
-      14,    235,     89,    136,
-     173,    229,     44,    164,
-     149,    192,      4,     43,
-      98,    155,    198,      8,
-      63,    107,    162,     32,
-     254,    174,    144,     78,
-       9,    251,     76,    108,
-     165,    248,     15,    172,
-     112,    187,     13,    219,
-      86,    155,    192,    244,
-      32,    109,    158,     51,
-     246,    212,    134,     65,
-      62,    229,    186,    102,
-     184,    240,      7,     66,
-     121,     78,    232,    225,
-      87,    133,    179,    253,
-      38,     80,    149,     58,
-      10,    193,    140,    127,
-      50,    224,    209,    108,
-     177,    203,      1,     77,
-     122,     88,     28,     18,
-      76,    134,    166,    250,
-      46,     91,    134,    189,
-      12,    220,    174,    122,
-      43,     30,    214,    139,
-     148,    198,     23,     54,
-     124,     88,     41,     14,
-      67,    122,    165,    247,
-      10,     64,    142,    189,
-      17,    213,    162,    122,
-      41,     17,    207,    187,
-     123,    199,    228,     34,
-     101,    151,     43,    245,
-      61,    121,    162,    208,
-       5,     87,    115,    167,
-     237,    226,    186,    123,
-      77,      7,    192,    179,
-     111,     46,    230,     54,
-     113,    156,    204,      9,
-     218,    150,    148,    212,
-       5,     43,     97,    175,
-     219,     27,    184,    141,
-      74,     18,    241,    174,
-      96,     90,     30,     54,
-      71,    157,    197,    244,
-     223,    141,    105,    198,
-      12,     58,    126,    141,
-     210,     11,     57,    141,
-      93,     37,    229,    172,
-     162,     81,      2,    239,
-      71,    167,    175,    232,
-     218,    169,     98,     60,
-     246,     63,    112,    131,
-     220,      7,     55,    104,
-      95,     45,    243,    201,
-     152,    118,     62,    246,
-     190,    103,    148,    254,
-      26,    170,    104,     81,
-      12,     40,     79,    157,
-     203,    242,     45,    159,
-     103,    204,    249,    206,
-     153,     76,     55,    235,
-     166,    130,    182,    246,
-      14,     76,    135,     93,
-       2,    230,     92,    157,
-     174,    251,     44,     90,
-     104,     57,    254,    209,
-     159,     97,     62,    230,
-     218,    138,     85,    202,
-      37,     91,    117,     94,
-      14,    255,    176,    113,
-     169,    250,     25,     84,
-     119,     74,      8,     35,
-      92,    106,     49,     20,
-     213,    129,    114,     57,
-      24,     21,    114,    163,
-      42,    226,    169,    143,
-     160,    254,      0,     79,
-     132,    183,     16,    230,
-      86,    139,     66,      6,
-     199,    181,    117,     46,
-      10,     45,     72,    134,
-     208,    246,    200,    128,
-      83,    209,     19,     85,
-     123,     83,     29,    234,
-     181,    124,     73,     21,
-     215,    184,     98,     84,
-      25,    221,     72,    191,
-     232,    252,    195,    148,
-     104,     40,      5,     35,
-     104,    163,     38,    243,
-     186,    130,     84,     24,
-     230,    182,    109,     94,
-       1,    209,    175,    156,
-     233,    234,     43,    175,
-     101,     49,      2,     50,
-     121,    136,    217,    251,
-     197,    141,     89,     32,
-     230,    191,    129,     92,
-      12,    242,    188,    130,
-     163,    201,     59,     87,
-     125,     49,     15,    212,
-     100,    154,    219,    243,
-      54,    146,    101,    211,
-     245,    200,    133,     94,
-      41,    251,    175,    138,
-     186,    196,      5,     64,
-     120,     77,     28,    217,
-      89,    138,    207,    250,
-      38,     98,    107,     54,
-       1,    206,    158,    107,
-      34,    251,    215,    148,
-      93,    200,     55,     94,
-     120,     73,     16,    237,
-     173,    134,    176,    228,
-      46,     80,    139,    195,
-       6,    210,    155,     99,
-      62,    242,    217,    130,
-      72,    213,     40,     24,
-     123,     80,     43,    235,
-     180,    131,    183,    236,
-      22,     89,    129,    190,
-     242,     36,    166,    121,
-      54,      9,    195,    139,
-     124,     60,     23,     28,
-     114,    160,     37,    254,
-     187,    139,    170,    215,
-      30,     66,    116,    187,
-     237,     24,     80,    125,
-      79,      1,    200,    189,
-     112,     34,    243,      7,
-      76,    150,     59,    242,
-     192,    147,     95,    213,
-       5,     74,    122,    161,
-     230,     16,     78,    130,
-      64,     25,    240,    187,
-      86,     99,      9,      6,
-     112,    136,     56,     10,
-     197,    155,    100,     48,
-       1,     50,    126,    179,
-     209,      9,     65,    119,
-      91,     16,    249,    167,
-      98,    111,      5,      8,
-     120,    169,    184,      5,
-     221,    166,    105,     59,
-     253,     57,    119,    143,
-     222,      1,     59,    144,
-      89,     44,    224,    169,
-     157,    112,      8,     28,
-     104,    163,    189,     19,
-     214,    168,    119,     71,
-      14,     44,     74,    138,
-     217,    245,     51,    155,
-     101,     39,    247,    208,
-     147,     69,     40,      4,
-      93,     97,    164,     30,
-     227,    178,    124,     78,
-      24,    222,     67,    171,
-     215,    252,     40,    163,
-      98,     56,     16,    222,
-     142,    120,     43,      8,
-      40,    120,     89,     37,
-      21,     67,    132,     88,
-      21,    224,     94,    161,
-     167,    252,     33,    173,
-     121,     46,     28,    204,
-     133,    101,    205,    238,
-      56,    151,    107,     40,
-       3,     45,    113,     84,
-      50,    235,     73,    101,
-     175,    242,     16,    180,
-     116,     80,      9,    193,
-     188,    112,    219,    238,
-      46,    140,    124,     50,
-      14,     33,     98,    107,
-      57,    245,     47,    104,
-     179,    203,     30,    184,
-     147,     82,     56,    198,
-     189,    136,    152,    244,
-     217,    186,    111,     59,
-     247,     57,    103,     98,
-      59,      7,     36,    127,
-     180,    198,      7,     62,
-     155,    118,     11,    200,
-     178,     96,    154,    244,
-     238,    140,    101,     65,
-     253,     43,    165,    119,
-     197,    235,     56,    115,
-     147,    198,      9,     54,
-     156,    125,      4,    236,
-      76,     82,    136,    217,
-     252,    148,    149,     76,
-     224,     28,    171,    120,
-     172,    237,     62,     86,
-     149,    192,    255,    210,
-     136,     78,     21,    249,
-      37,     69,    177,     36,
-     236,    166,    128,    170,
-      27,    231,    178,    115,
-     169,    246,     11,     91,
-     137,    188,     12,    210,
-     184,    113,     50,    234,
-      18,    126,    154,     41,
-     224,    203,    145,     95,
-      40,    226,     64,    109,
-     136,    250,     28,    180,
-     125,     78,     30,    246,
-     188,    126,    179,    239,
-      63,     89,     98,     46,
-      18,    201,    159,    106,
-      61,    252,     42,     78,
-     134,    203,     12,    185,
-     129,     89,     11,    251,
-     179,    149,    170,    255,
-      33,    167,    122,     74,
-      13,    223,    176,    127,
-      62,    244,     40,    121,
-     137,    217,    250,    207,
-     155,     66,     40,      8,
-      93,    103,    188,     31,
-     247,    191,    120,     75,
-      25,    205,    186,    115,
-     200,    227,     50,     79,
-     145,     55,      8,    216,
-     128,    110,    216,     26,
-      28,     96,     88,     41,
-     227,    189,    128,     90,
-      10,    233,    180,    132,
-     169,    255,     41,     85,
-     118,     51,      6,    223,
-     157,    159,    223,    233,
-      57,    104,    100,     41,
-     242,    202,    128,     86,
-      41,    238,     78,    112,
-     184,    231,    231,    184,
-     112,     65,    239,     43,
-      82,    133,    196,    241,
-      41,     98,    104,     50,
-     246,    192,    157,     99,
-     213,     13,     58,    113,
-      85,     42,    228,    186,
-     122,    189,    237,     31,
-     173,    121,     69,    234,
-      34,     88,    116,     58,
-       3,     45,     98,    106,
-      54,    251,    205,    144,
-      92,    212,      2,     51,
-     127,    172,     34,    229,
-     191,    128,    176,    228,
-      29,     80,    133,    190,
-     245,    218,    173,    127,
-      52,      1,     42,    110,
-     150,    199,      7,     54,
-     146,     93,     47,    252,
-     182,    143,    168,    215,
-      30,     64,    120,    178,
-      17,    237,    185,    118,
-     189,    254,     48,     74,
-     149,     63,     13,    214,
-     159,     97,     59,    246,
-     197,    106,    172,    217,
-       4,    191,    128,     91,
-      16,    226,     75,    114,
-     162,    252,     20,    174,
-     126,     72,      5,    208,
-     169,    103,     59,    253,
-      61,    107,    146,     49,
-     246,    210,    158,     94,
-     211,     24,     87,    121,
-     169,     30,    236,    189,
-     115,     71,     30,    231,
-     170,    140,    178,    254,
-      32,    161,    124,     45,
-      13,    206,    104,    140,
-     198,      8,     62,    145,
-      95,     33,    250,    178,
-     138,     85,    227,     31,
-      71,    136,    181,     18,
-     210,    166,    112,    187,
-     249,     56,     81,    153,
-     204,      2,    206,    159,
-     104,     35,    242,    193,
-     113,    163,    221,     12,
-     191,    141,     90,     24,
-      29,     64,    143,    190,
-     233,     34,     84,    139,
-      60,     13,    220,    168,
-     110,     55,    255,     48,
-     106,     97,     36,    241,
-     193,    121,    182,    202,
-      27,     65,    133,     81,
-      26,    228,    181,    123,
-      79,     23,    220,     85,
-     136,    192,     15,    216,
-     148,    111,    207,    240,
-      39,    121,    151,    209,
-     244,    199,    136,     93,
-      36,    230,    191,    135,
-     176,    230,     24,    179,
-     115,     79,     20,     32,
-      84,    130,    207,    254,
-      41,     98,    151,     53,
-     249,    192,    153,    105,
-      40,     11,     58,    114,
-      84,     36,    235,    185,
-     120,    185,    239,     19,
-      86,    134,    184,    237,
-      37,    166,    114,     52,
-      12,    218,    158,    151,
-     205,    254,    202,    151,
-     160,    208,     13,     59,
-     118,    169,    223,     23,
-      77,    124,     79,     29,
-     229,    170,    120,     68,
-      13,    217,    164,    143,
-     198,    250,     45,     97,
-     153,    205,      2,    200,
-     147,     94,    214,    244,
-     189,    142,     87,    223,
-      22,     74,    124,    178,
-     232,     28,     83,    120,
-      65,     12,     38,     88,
-     146,     59,      0,    215,
-     156,    101,    206,      1,
-      59,    104,    165,    222,
-       4,     69,    136,     83,
-      22,    236,    181,    124,
-     182,    233,    226,    170,
-     113,     70,     15,    216,
-      95,    153,    205,    247,
-      59,     98,    155,     53,
-     242,    206,    148,     94,
-      39,    242,    191,    142,
-      85,     26,    233,     73,
-     134,    189,    227,     23,
-      81,    136,     64,      8,
-     211,    160,    111,     59,
-       6,    198,    145,     98,
-      44,    250,     57,    102,
-     170,    201,      2,     70,
-     132,     91,     22,    239,
-     178,    129,     73,     22,
-     218,    172,    113,     66,
-      11,     40,     91,    159,
-     217,    236,     57,    101,
-     101,     37,    245,    207,
-     134,     93,     35,    245,
-     184,    135,    174,    224,
-      16,     65,    143,    187,
-     228,     34,    169,    118,
-      61,      9,    211,    170,
-     102,     56,     10,    203,
-     149,    158,    216,      8,
-      46,     96,    171,    221,
-     239,    185,    129,     84,
-      31,    224,    185,    119,
-      74,     30,    213,    170,
-     142,    198,    253,     39,
-     107,    156,    205,    250,
-      55,    105,     99,     42,
-     253,    207,    131,     83,
-      36,    238,     67,    114,
-     186,    237,     31,     77,
-     123,     70,    236,     37,
-      95,    137,     60,     15,
-     217,    149,     96,     55,
-       2,     51,    109,    152,
-     208,      9,    195,    143,
-      85,     34,    237,    186,
-     135,     75,     27,     26,
-      86,    140,    178,    234,
-      38,    167,    117,     58,
-       1,    209,     98,    150,
-      51,    248,    194,    154,
-      85,     43,      0,     43,
-      99,    189,    211,     17,
-     177,    137,     70,     31,
-     224,    172,    124,     78,
-       1,    215,    163,    140,
-     200,    232,     60,    109,
-     144,    207,    252,    201,
-     147,    161,     41,    241,
-     179,    152,     70,     46,
-     239,     79,    113,    161,
-     248,     20,     83,    123,
-      64,     14,     36,     95,
-     145,     62,      9,    192,
-     149,     96,    202,     15,
-      55,     97,    167,     42,
-     245,    186,    137,    168,
-     227,     21,    177,    137,
-      71,     28,    229,     86,
-     133,    175,    226,     47,
-     162,    105,     49,      2,
-     205,    155,    103,     53,
-     242,    205,    152,     93,
-     223,     29,     87,    100,
-     166,    225,    238,    190,
-     118,     77,     19,    231,
-     163,    126,     70,     14,
-      44,     87,    157,    215,
-     241,     55,    153,     98,
-      38,    243,    204,    152,
-      93,     34,    241,     71,
-     113,    161,    238,     30,
-      72,    127,     79,     30,
-     211,    161,    125,     66,
-     246,     46,     87,    154,
-     192,    251,     49,    103,
-      97,     43,    241,    205,
-     133,     83,     35,    241,
-      64,    115,    163,    238,
-      18,     73,    124,     77,
-      27,    215,    161,    114,
-      59,     11,     40,     90,
-     147,    193,    246,     54,
-     107,     98,     46,    253,
-     197,    136,     95,     32,
-     237,     69,    121,    170,
-     227,     30,     72,    128,
-      71,     17,    217,    173,
-     119,     61,     11,    214,
-     158,    106,    203,    253,
-      55,    106,    156,    211,
-     245,    193,    143,     88,
-     223,     21,     66,    121,
-      79,     24,    231,    177,
-     123,     70,     17,    220,
-     166,    115,     60,    247,
-      46,     98,    149,    201,
-       0,    203,    151,     98,
-      41,    244,    192,    141,
-     168,    220,     19,     69,
-     126,    179,    231,     27,
-     175,    120,     70,     19,
-     216,    164,    112,     60,
-     249,     46,    103,    146,
-     201,      2,     55,    149,
-      92,     46,    241,    196,
-     136,     87,     33,     18,
-      74,    126,    182,    228,
-      30,     80,    134,     69,
-      12,    217,    166,    113,
-     196,    248,     47,     99,
-     103,     50,    253,     55,
-     109,    160,    214,    244,
-     189,    142,     86,     33,
-      21,     77,    123,    183,
-     233,    227,    169,    125,
-      71,     12,     38,     89,
-     146,    199,    251,     47,
-     100,    152,    204,      1,
-      57,    146,     95,     44,
-     247,    188,    137,    169,
-     227,     22,     72,    126,
-      75,     23,    224,    172,
-     119,     66,     12,    217,
-     162,    110,    198,    250,
-      50,    103,    155,    207,
-     250,    196,    147,     94,
-      37,    243,    189,    118,
-     174,    227,     20,     73,
-     129,     74,     20,    225,
-     170,    118,     65,     12,
-     215,    163,    109,    199,
-     253,     50,    101,    153,
-     208,    251,    198,    147,
-      89,     39,    241,     67,
-     120,    173,     29,    232,
-      76,    128,    180,    232,
-      33,    170,    119,     68,
-      15,    213,    161,    146,
-     202,    255,     51,    152,
-      98,     47,    249,     59,
-     114,    167,    219,    240,
-     186,    135,     80,    227,
-      25,     79,    131,    183,
-      18,    220,    171,    117,
-     192,    244,     40,     94,
-     148,     54,      1,    204,
-     104,    156,    210,    248,
-     194,    140,     91,     38,
-     239,     69,    123,    174,
-     229,     25,     78,    124,
-      71,     18,    221,    168,
-     115,     62,      9,     43,
-      97,    148,    200,    254,
-      52,    150,     99,     46,
-     245,    192,    140,     88,
-     220,     17,     70,    122,
-     178,    231,     25,     76,
-     134,    185,     16,    223,
-     164,    113,     63,      9,
-     211,     97,    150,    202,
-       1,     52,    107,    158,
-     213,      9,    192,    142,
-      84,     33,    239,    184,
-     125,    179,    228,     26,
-      80,    122,     69,    239,
-      36,     88,    143,    195,
-       7,    211,    156,    104,
-     204,      3,     52,    105,
-     160,     43,    247,    195,
-     137,     87,     33,     18,
-      73,    124,    178,    231,
-     227,    174,    121,     68,
-      14,    219,    167,    114,
-      58,      6,     46,     97,
-     155,    206,      0,     55,
-     147,     92,     43,    245,
-     191,    138,    170,    223,
-     235,     73,    126,    178,
-     234,     30,     80,    134,
-      67,     12,    218,    167,
-     110,    197,    251,     45,
-     102,    152,    206,    252,
-     199,    146,     93,     40,
-     243,    190,    136,     85,
-      30,    234,     74,    126,
-     181,    232,     30,    172,
-     118,     67,     12,    217,
-     162,    110,     57,    251,
-      48,    100,    155,    206,
-       5,     56,    110,     92,
-      38,    243,    188,    137,
-      83,    225,     22,     74,
-     129,    180,    234,     31,
-      84,    137,    190,     12,
-     215,    163,    108,     57,
-       3,    206,    102,    154,
-     209,      4,     58,    111,
-      91,     39,    240,    189,
-     135,    173,    226,     22,
-      77,    128,    183,    235,
-      32,    170,    117,     65,
-      10,    215,    161,    108,
-      55,    253,     50,    102,
-     157,    209,      6,     59,
-     143,     90,     37,    240,
-     187,    134,    174,    227,
-      24,     77,    130,    183,
-     236,    222,    169,    116,
-      63,     10,    213,    160,
-     148,    201,    255,     50,
-     105,    157,    210,    248,
-     195,    143,     88,     37,
-     238,    186,    133,    175,
-     228,     24,     79,    131,
-     184,    237,     34,    168,
-     115,     62,      8,    213,
-     159,    106,    202,    255,
-      52,    104,    158,    211,
-       8,     61,    141,     88,
-      35,    238,    185,    132,
-      79,    229,     26,     79,
-     132,    185,    238,     35,
-     167,    114,     61,      8,
-     211,    158,    105,     52,
-     255,     53,    106,    159,
-     212,      9,     62,    140,
-      87,     34,    237,    184,
-     131,    177,    230,     27,
-      80,    133,    186,    239,
-     219,    166,    113,     60,
-       7,    210,    157,    151,
-     204,      1,     54,    107,
-     160,    213,     10,     63,
-     139,     86,     33,    236,
-     183,    130,    178,    231,
-      28,     81,    134,    187,
-     240,    218,    165,    112,
-      59,      6,    209,    156,
-     152,    205,      2,     55,
-     108,    161,    214,    244,
-     191,    138,     85,     32,
-     235,    182,    126,    179,
-     232,     29,     82,    135,
-     188,    241,    217,    164,
-     111,     58,      5,    208,
-     155,    102,     49,      3,
-      56,    109,    162,    215,
-      12,    190,    137,     84,
-      31,    234,    181,    127,
-     180,    233,     30,     83,
-     136,    189,     13,    216,
-     163,    110,     57,    251,
-      48,    101,    154,    207,
-       4,     57,    110,    163,
-     216,     13,     66,    119,
-      83,     30,    233,    180,
-     127,    181,    234,     31,
-      84,    137,    190,     12,
-     215,    162,    109,     56,
-       3,    206,    153,    100,
-     208,      5,     58,    111,
-     164,    217,    241,    188,
-     135,     82,     29,     23,
-      76,    129,    182,    235,
-      32,     85,    138,    191,
-     244,     41,    161,    108,
-      55,      2,    205,    152,
-     156,    209,      6,     59,
-     112,     90,     37,    240,
-     187,    134,     81,     28,
-     231,    178,    125,    183,
-     236,     33,     86,    139,
-     192,     10,    213,    160,
-     107,     54,      1,    204,
-     151,    157,    210,      7,
-      60,    113,    166,    219,
-     239,    186,    133,     80,
-      27,    230,    177,    131,
-     184,    237,     34,     87,
-     140,    193,    246,     43,
-     159,    106,     53,      0,
-     203,    150,     97,    211,
-       8,     61,    114,    167,
-      35,    238,    185,    132,
-      79,     26,    229,    176,
-     132,    185,    238,     35,
-      88,    141,    194,    247,
-     211,    158,    105,     52,
-     255,    202,    106,    159,
-     212,      9,     62,    115,
-     168,    221,     18,    184,
-     124,    177,     25,     27,
-      80,    133,    186,    239,
-      36,     89,    142,     60,
-       7,    210,    157,    104,
-     204,      1,     54,    107,
-      95,     42,     10,     63,
-     116,    169,     33,    236,
-     183,    130,     77,     24,
-     227,     81,    134,    187,
-     240,     37,    165,    112,
-      59,      6,    209,     99,
-     152,    205,    253,     55,
-     108,    161,    214,     11,
-      64,    117,     85,     32,
-     235,    182,    129,     76,
-      23,     29,     82,    135,
-     188,    241,     38,     91,
-     144,    197,      5,    208,
-     155,    102,     49,    252,
-     199,    146,    162,    215,
-      12,     65,    137,     84,
-      31,    234,    181,    128,
-      75,     22,     30,     83,
-     136,    189,    242,     39,
-      92,    145,    198,    251,
-      48,    101,    154,    207,
-       4,     57,    110,    163,
-     216,     13,     66,    136,
-      83,     30,    233,    180,
-     127,     74,     21,    224,
-     171,    118,     65,     12,
-     215,    162,    109,     56,
-     252,     49,    102,    155,
-     208,      5,     58,    111,
-     164,    217,     14,     67,
-     120,    173,     29,    232,
-     179,    126,     73,     20,
-     223,     85,    138,    191,
-     244,     41,     94,    147,
-      55,      2,    205,    152,
-      99,     46,    249,    196,
-     143,     90,     37,     15,
-      68,    121,    174,    227,
-      24,     77,    125,     72,
-      19,    222,     86,    139,
-      63,     10,    213,    160,
-     107,     54,    254,     51,
-     104,     98,    210,      7,
-      60,    113,    166,    219,
-      16,     69,    122,    175,
-     228,     25,     78,    131,
-     184,     18,    221,    168,
-     115,     62,      9,    212,
-     159,    149,    202,    255,
-      52,    150,     97,     44,
-       8,     61,    114,    167,
-     220,     17,     70,    132,
-      79,     26,    229,    176,
-     123,     70,    238,     35,
-      88,    141,    194,    247,
-      44,     97,    105,     52,
-     255,    202,    106,    159,
-     212,      9,     62,    115,
-     168,    221,     18,     71,
-     124,    177,    230,    228,
-     175,    122,     69,    239,
-      36,     89,    142,    195,
-       7,    210,    157,    104,
-      51,    254,    201,    148,
-      95,     42,    245,    192,
-     139,     86,     33,    236,
-      72,    125,    178,    231,
-      28,     81,    134,     68,
-      15,     37,     90,    143,
-     196,    249,     46,     99,
-     152,    205,    253,    200,
-     147,     94,     41,    244,
-     191,    117,    170,    223,
-      20,     73,    126,    179,
-     232,     29,    173,    120,
-     188,     14,    217,    164,
-     111,     58,      5,    208,
-     155,    102,     49,    252,
+      83,      66,       2,      10,
+     244,       0,       0,       0,
+      49,      19,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     200,      11,       0,       0,
+     101,      11,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+      55,      18,       0,       0,
+     148,      13,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     225,      25,       0,       0,
+     223,      12,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+      31,      33,       0,       0,
+     210,      15,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       1,       0,       0,       0,
+       0,       0,       0,       0,
+     241,      48,       0,       0,
+      73,      14,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       1,       0,       0,       0,
+       0,       0,       0,       0,
+      58,      63,       0,       0,
+      34,      16,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       1,       0,       0,       0,
+       0,       0,       0,       0,
+      92,      79,       0,       0,
+     217,      15,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       1,       0,       0,       0,
+       0,       0,       0,       0,
+      53,      95,       0,       0,
+     241,      10,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       1,       0,       0,       0,
+       0,       0,       0,       0,
+      38,     106,       0,       0,
+     177,      13,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       5,     136,     136,     136,
+     136,     136,     136,       0,
+       0,       5,       0,       0,
+       0,       0,       0,     136,
+     136,     136,       5,     136,
+       0,     128,       0,     128,
+       8,       0,       0,       5,
+     128,     128,     136,     136,
+       8,     136,     136,     128,
+       5,       8,       0,       0,
+       0,     136,     136,     128,
+       0,       5,       8,       0,
+       8,       0,       0,       0,
+       0,       0,       5,       0,
+     128,     136,     136,     136,
+     136,     136,     136,       5,
+     136,     136,       8,       0,
+     128,     128,     136,     136,
+       5,     128,       8,       8,
+     128,       8,       8,     128,
+       0,       5,       0,       8,
+     128,     128,     128,     128,
+       8,       8,       5,       8,
+     128,     128,     128,       8,
+       8,       8,     128,       5,
+     128,     128,       0,       8,
+       8,       8,       8,     136,
+       5,     128,       8,     136,
+     136,     128,     128,     128,
+     136,       5,     136,       8,
+       8,       8,     128,       0,
+       8,     136,       5,       0,
+     128,     128,     128,       8,
+     136,     128,       8,       5,
+       8,     128,       8,     136,
+     128,     128,       8,       8,
+       6,      12,     192,     192,
+     192,       0,      72,     204,
+     132,       6,       0,      12,
+     192,     196,      76,     204,
+     132,      64,       7,      74,
+     236,     194,     224,      14,
+     238,     162,     226,       7,
+      14,     238,       0,      14,
+     224,     226,      76,      10,
+       7,     194,     196,       0,
+      44,      14,     192,       0,
+     238,       7,       0,      76,
+     236,     194,      32,      42,
+     206,     194,       7,     162,
+     226,     106,      72,     238,
+     162,     194,       0,       7,
+      44,     238,     194,     226,
+      78,      74,     206,     164,
+       7,     226,      14,      76,
+      42,     238,     164,      32,
+      74,       7,     160,     196,
+     224,     162,     226,      76,
+      10,     224,       7,     224,
+      14,      44,      44,     238,
+     224,     162,     164,       6,
+       4,      72,      12,      76,
+       8,     192,      76,     204,
+       7,     194,     224,     194,
+       2,      42,     192,     196,
+      46,       7,      44,      14,
+      14,     238,     162,     228,
+     108,      40,       7,     130,
+     198,      14,     224,       2,
+      76,      42,     238,       7,
+     224,       0,      42,     238,
+     194,     226,      46,      14,
+       7,      14,      14,     224,
+     226,       0,      12,     192,
+     196,       6,      12,      72,
+      76,     204,     132,       0,
+     204,     132,       7,      46,
+      12,     160,     226,      76,
+     236,     226,       0,       7,
+     192,       0,      74,     236,
+     164,     226,      14,      14,
+       7,      14,      44,     160,
+     198,      76,      10,     224,
+      14,       6,     204,     192,
+      12,     192,      12,     204,
+     132,       0,       7,      74,
+     206,     196,      46,      10,
+     160,     196,      46,       7,
+      44,      74,     238,     226,
+     192,     166,      32,      42,
+       6,     204,       0,       8,
+      12,       8,     128,       0,
+       8,       7,     160,     164,
+      78,     234,     132,       2,
+      74,     238,       7,     226,
+      14,       0,      76,      12,
+     224,       0,     224,       6,
+     192,     128,     192,      12,
+     204,       0,      72,     128,
+       6,       4,      72,      12,
+      12,      12,     204,     204,
+     192,       7,     192,     132,
+     228,      44,      44,      76,
+      12,     224,       7,     192,
+     196,     194,     194,     194,
+      78,     104,      12,       6,
+     192,     192,     204,     132,
+      76,       8,     204,     132,
+       7,     194,       0,      46,
+      46,      44,     160,     196,
+      78,       7,      72,     238,
+     224,     192,     226,     194,
+     194,     224,       7,     224,
+      46,      42,      74,      10,
+     192,     194,      32,       7,
+      44,     238,     194,     164,
+     196,     226,      46,      44,
+       7,      14,      14,      76,
+      42,     192,     194,     132,
+     198,       7,       0,     192,
+       0,     106,     204,       2,
+     104,     236,       7,     196,
+     226,     162,       2,     106,
+      72,     206,     164,       7,
+     196,     226,      46,      42,
+     238,     224,     224,       0,
+       8,      61,      43,     224,
+     241,     224,     195,     227,
+     240,       8,     240,      63,
+      59,      29,      46,     254,
+     194,     226,       7,     194,
+     226,      14,      14,      46,
+      44,      12,     162,       7,
+     226,     224,       2,      76,
+      10,       0,      74,     236,
+       8,     194,     211,     194,
+     180,       2,      75,      13,
+       0,       7,      44,     192,
+     226,      46,      76,     236,
+       0,      14,       7,     162,
+     226,      74,     206,     164,
+       2,     224,     224,       8,
+      78,      74,     253,     194,
+     212,     210,     210,       2,
+       8,      60,     222,     243,
+      77,      44,      30,      60,
+     238,       7,     196,     162,
+     166,     196,       0,     238,
+      46,      42,       8,      30,
+     255,     210,     241,      31,
+      60,     253,     179,       8,
+     243,     255,     225,      47,
+      43,     208,      17,      60,
+       7,     128,     228,      44,
+     206,     226,      44,     224,
+      14,       7,     238,      44,
+     204,     164,     194,     194,
+      78,     104,       7,      74,
+      12,     130,     230,      76,
+     236,     164,       2,       7,
+      12,     224,      76,      10,
+     206,     194,     226,      14,
+       7,     238,      14,      76,
+      40,     192,       2,     238,
+     130,       8,     195,       1,
+     239,      33,      75,      13,
+      15,     224,       7,     194,
+      14,      14,      14,     160,
+     134,     226,      14,       8,
+      15,      46,      60,      12,
+     209,      48,     237,     196,
+       8,      48,      12,     148,
+     244,      29,      31,      77,
+      59,       8,     206,     135,
+     228,      46,      61,      76,
+     238,     148,       8,     243,
+      76,      44,      29,     224,
+     164,     212,      46,       7,
+     224,     108,      40,     194,
+      32,      40,     130,     230,
+       8,      30,     208,     212,
+      93,     250,     167,     126,
+       8,       9,     211,      49,
+      28,     179,      19,      44,
+     210,      49,       8,      72,
+     132,      66,       8,     166,
+      63,     252,     226,       8,
+      78,     252,     179,      32,
+     254,     210,      47,     238,
+       7,     226,     224,     106,
+       8,     226,      46,     206,
+     164,       8,      47,     223,
+      18,      27,     196,      95,
+     220,     213,       8,      77,
+     206,     242,      30,     193,
+     226,     108,     220,       8,
+       3,      41,     133,      82,
+     249,     182,     124,     157,
+       8,      38,      40,     165,
+      79,     223,       2,      44,
+     239,       8,       0,      13,
+     194,      64,      15,       4,
+      46,     208,      23,     132,
+     255,     124,      77,     114,
+      67,     247,     251,      24,
+     191,      75,     141,      68,
+     192,      71,     106,     198,
+      24,     124,     174,     242,
+     220,      33,      44,     230,
+      47,       8,      14,     211,
+      31,     236,       2,     252,
+       0,      97,      25,       2,
+       0,     221,     204,     243,
+      62,      20,      82,      24,
+     238,     190,     241,      77,
+     196,      65,     136,     218,
+      56,     146,     254,     246,
+     127,       1,     109,     225,
+      62,      56,     194,      33,
+     141,       4,     234,      76,
+     210,      51,      24,     174,
+      11,      31,      66,       4,
+     174,     137,      63,      56,
+       8,      47,       3,     127,
+     144,     101,      10,      66,
+      56,     224,     224,     236,
+     130,      28,      16,      65,
+      79,      56,     106,     208,
+     227,      36,     224,     208,
+      30,     172,      56,      92,
+      16,      48,       0,      17,
+     240,      34,     243,      57,
+      16,     237,     211,     236,
+      17,       0,      32,       0,
+      40,      17,       6,      36,
+     205,     141,      94,     198,
+      66,      56,      81,     255,
+      66,      14,     211,      18,
+      34,      31,      56,     206,
+      62,     185,      13,      21,
+      15,       3,      63,      56,
+      29,      36,      33,     226,
+     191,       0,     200,      46,
+      55,     101,     222,      20,
+     229,      59,     119,     225,
+     195,      40,      59,      38,
+       2,     116,     207,     200,
+      91,     228,      56,      35,
+      51,       1,      31,       8,
+     191,     219,      19,      56,
+     246,      29,      49,      13,
+      49,     246,       2,     176,
+      56,      43,     187,     251,
+      98,     178,     227,      35,
+     238,      56,      69,      34,
+       0,     175,     253,     173,
+      43,     114,      40,     136,
+      25,      52,      50,      23,
+     157,     187,     190,      56,
+      30,     201,      45,      85,
+      29,      16,     243,      63,
+      56,      51,       2,     224,
+     171,     193,     156,      50,
+      52,      56,      15,      17,
+      17,      48,      35,      48,
+     207,     185,      56,     163,
+     187,      67,      35,      47,
+      47,      32,      48,      56,
+      35,      78,     190,     248,
+     193,     248,      52,       4,
+      56,       0,      63,     240,
+      51,       3,       1,     129,
+      57,      56,     175,      12,
+      52,     227,     226,      32,
+      47,      82,      56,       0,
+      18,     139,      61,     173,
+      92,      19,       2,      56,
+     209,       1,       2,      53,
+      47,     195,     186,     226,
+      56,     218,      80,      48,
+      32,     253,     241,      34,
+      35,      56,      33,     177,
+      10,     175,     206,      19,
+      18,       2,      40,      75,
+     100,      51,     239,     189,
+     189,     124,       2,      56,
+     255,     252,     244,     226,
+      95,      18,      67,      20,
+      40,     220,     188,      51,
+      85,      33,      14,     240,
+     172,      56,      64,     228,
+      84,     243,      22,     159,
+     254,     189,      40,      48,
+      60,      16,     200,      81,
+      22,       4,     158,      56,
+     119,     185,      43,     201,
+     217,      26,      33,     223,
+      25,      13,      36,      36,
+     225,       0,     155,     248,
+      16,      24,      99,      35,
+     119,     149,     217,     119,
+      70,     210,      56,     103,
+     187,      43,     170,     217,
+     217,      35,     130,      25,
+     237,      37,      34,     242,
+      47,     155,     216,      31,
+      56,     200,     186,      21,
+     130,      82,      39,     113,
+      51,      57,      98,     252,
+      28,     206,     237,     220,
+     244,     209,      57,      48,
+      34,      65,      48,     113,
+     237,      13,     222,      56,
+     154,     185,       5,     207,
+      19,      85,     116,      96,
+      57,      98,     238,     238,
+     222,     190,     221,       2,
+     240,      41,      14,      81,
+      31,      30,      30,     159,
+      15,      19,      25,      34,
+      18,      83,      19,     222,
+      79,      67,      33,      40,
+      59,     140,     249,      70,
+       5,     224,      54,     255,
+      57,      14,      82,      18,
+      66,      50,     211,     192,
+     208,      25,      18,      17,
+      67,      36,     222,      94,
+      51,      19,      40,      14,
+     143,     187,      70,     230,
+     210,      84,     240,      41,
+     252,      81,       0,     240,
+      15,     176,     207,      35,
+      25,       2,      18,      81,
+      51,     239,      78,      67,
+       3,      40,       1,     142,
+     157,      85,     213,     228,
+     112,     210,      40,     234,
+     113,     244,     255,      29,
+     159,     141,      54,      40,
+     230,       1,     112,       0,
+     249,     112,      18,     192,
+      40,       0,     128,     157,
+      84,     244,       0,      97,
+     241,      56,     253,     114,
+      68,      69,     102,     246,
+     175,     239,      56,     154,
+     170,      26,     240,      13,
+     113,      68,      69,      56,
+     101,     246,     175,     208,
+     155,     184,      26,     255,
+      56,      12,     113,      68,
+      68,     102,     230,     191,
+     192,      56,     140,     170,
+      42,     255,     252,      99,
+      68,      84,      40,      30,
+     159,     204,      52,       3,
+      31,      50,     211,      40,
+     236,      67,       2,     225,
+      45,     174,     235,      52,
+      56,     186,     154,     238,
+     224,     253,      52,      68,
+      53,      56,     117,     242,
+     222,     176,     156,     187,
+     237,     224,      40,     252,
+      37,       2,     240,      29,
+     204,      11,      21,      39,
+       5,     208,      87,     160,
+      57,     119,      33,     206,
+      56,     102,       0,      13,
+     222,     202,     171,     224,
+     207,      40,      46,      36,
+      33,     237,     240,     203,
+      77,      35,      39,      16,
+      14,      38,     157,      95,
+     103,      32,     189,      56,
+      54,     209,      15,     175,
+     205,     234,     225,     205,
+      56,      33,      50,      81,
+      66,      22,     239,       0,
+     207,      40,     226,      14,
+     243,     205,      84,      35,
+      46,      12,      55,      85,
+     203,     242,     157,     158,
+     253,     238,     152,      55,
+      16,      53,     114,     119,
+     228,      60,      11,     235,
+      24,      20,     226,     206,
+     233,      96,     103,      38,
+     224,      39,     168,      67,
+      55,     183,     240,     187,
+     158,       7,      40,      54,
+      48,      11,     173,     241,
+      82,      95,     208,      56,
+     198,     226,      12,     253,
+     192,     214,      19,      61,
+      40,      46,     246,       5,
+      77,       9,     187,     245,
+      54,      56,      76,      61,
+     176,     228,      47,      93,
+      15,     231,      56,     228,
+      60,      11,     191,     211,
+       2,      74,      30,      56,
+     224,     230,      98,     126,
+      25,     161,     132,      47,
+      56,     105,     217,     149,
+     245,     125,     124,     242,
+     151,      24,     202,      92,
+      76,       3,     165,      45,
+     107,      80,      41,     209,
+     196,     241,      60,      61,
+     210,     212,      17,      41,
+      90,     224,     181,     214,
+      79,      74,     252,     195,
+      25,       2,      47,      30,
+     222,     212,      36,      95,
+      62,      24,     255,     129,
+     208,      63,      28,     239,
+     128,      51,       8,      57,
+     112,     102,      87,      22,
+     240,      46,     209,      57,
+     210,     193,      48,     106,
+      43,     241,       2,     241,
+      41,       1,      32,     223,
+     226,     241,     127,      91,
+     253,      56,     150,     230,
+     211,       2,      17,     193,
+     210,     223,      25,     125,
+      64,     226,     209,     255,
+     224,      18,      18,      57,
+     225,     241,      14,     125,
+      58,     194,     244,      47,
+      57,     223,     212,      17,
+     224,     225,     224,     111,
+      43,      57,     195,       3,
+      62,     222,     196,      33,
+     223,     210,      25,     238,
+     115,      66,     194,     238,
+      43,     238,     244,      25,
+      66,     238,     191,     255,
+     102,      66,     206,     238,
+      41,      79,      13,     227,
+      65,      24,     178,      52,
+     167,      40,     180,     232,
+     244,      18,      47,      30,
+     211,      88,      57,     220,
+      97,     253,     213,      33,
+     227,       1,      15,      57,
+      46,     160,     210,     252,
+      53,     121,     223,      22,
+      57,      48,      13,     226,
+      95,       8,     129,     111,
+     162,      57,      19,      31,
+      36,      62,      13,     195,
+     212,      43,      57,     187,
+      55,      56,     193,      52,
+     242,      17,      46,      10,
+     240,     224,     204,     217,
+      35,      51,     239,      33,
+      57,      34,      45,      18,
+     224,     208,      11,     215,
+      90,      57,     219,      85,
+      44,     210,      65,      16,
+     254,     159,      42,      69,
+      11,     224,     110,     194,
+     242,      60,       1,      42,
+     224,     209,     113,     220,
+     227,      92,     212,      16,
+      25,     156,      51,      33,
+     207,     123,     167,     253,
+     168,      10,      46,      49,
+     210,      13,      16,      18,
+      46,      55,      26,      13,
+     188,      85,      31,     192,
+      46,       2,      33,      26,
+      75,     199,      13,     188,
+     115,     255,     177,      61,
+      26,     242,      19,      76,
+     199,      28,     173,     116,
+     239,      58,     194,      78,
+     192,      17,     108,     163,
+      80,     221,      58,      23,
+      12,     224,      47,     208,
+     225,      97,     236,      57,
+      20,      60,       6,     237,
+     240,      31,     177,     255,
+      26,      54,     220,     222,
+      94,       5,     240,     235,
+      17,      58,      30,      61,
+     166,      77,     176,      68,
+     252,     225,      26,      13,
+      33,       1,      96,     178,
+     251,     237,      87,      26,
+     239,     221,      31,      34,
+      16,      55,     187,     191,
+      58,     127,     191,     240,
+      15,       0,      14,     112,
+     176,      58,      66,     237,
+       7,     235,     241,      45,
+     223,      62,      58,     230,
+      60,     227,      96,     208,
+      29,     208,      16,      58,
+     189,     117,     218,      21,
+      61,     246,      12,       0,
+      58,      14,     193,     123,
+     133,     110,     223,     100,
+     205,      11,     240,     222,
+     254,     222,      81,     242,
+     240,      13,      58,     210,
+      44,     211,      63,     191,
+     114,     173,      66,      26,
+     253,      87,     190,      15,
+      13,       4,      94,     229,
+      26,     251,     192,      97,
+     194,      45,     222,      33,
+      48,      57,     231,      42,
+       5,     109,     130,     109,
+     175,      15,      57,      93,
+     182,      77,     241,      36,
+     190,      48,     208,      57,
+     253,     107,     214,      43,
+       4,      95,     129,      94,
+      57,     193,     208,     123,
+     182,      45,      19,      17,
+     239,      57,     253,       2,
+     191,     123,     183,      76,
+       2,      19,      25,     175,
+     222,      62,     230,     106,
+      39,     255,     253,      25,
+       4,     171,     242,      78,
+     194,     109,       5,      17,
+      57,      31,      21,     201,
+       7,      27,     131,     127,
+     176,      57,      98,     238,
+       6,     233,     244,      46,
+     190,      36,      56,     188,
+     119,      47,     131,      12,
+      13,     227,     232,      41,
+     229,      11,      22,      47,
+     155,      79,      82,     227,
+      56,      92,     225,      94,
+      85,     199,     234,     189,
+     243,      41,      16,     224,
+     220,      33,      69,     173,
+     207,     124,      57,     177,
+      78,     179,      77,     243,
+      20,     239,     193,      56,
+      15,     220,     115,     172,
+      50,     115,     228,     169,
+      41,      51,      15,      86,
+     187,     240,      78,      21,
+     202,      56,      30,     144,
+      78,     212,      29,      16,
+     117,     190,      57,      30,
+     224,     254,     244,      30,
+     241,      64,     194,      56,
+      75,     163,      44,     241,
+      62,     240,      96,     193,
+      56,      14,     195,      58,
+     212,      61,       1,      48,
+     241,      56,     205,      83,
+     168,      70,      10,      21,
+      75,     229,      40,     233,
+      71,     254,     229,     251,
+      36,      28,       3,      56,
+     202,      50,     249,      37,
+     222,      65,     240,      65,
+      56,     158,      63,     157,
+     115,     176,      66,     255,
+      52,      56,     204,      94,
+     171,     110,     164,     113,
+     208,      66,      56,     192,
+      60,     128,      93,     208,
+      80,     227,      64,      56,
+     192,      62,     176,      59,
+     195,      77,      19,      16,
+      40,     162,      76,     229,
+      79,     229,       8,       4,
+      78,      56,     225,      12,
+     179,      27,      20,     237,
+      35,      30,      24,      67,
+     204,       1,     216,     118,
+      37,     227,     172,      40,
+      67,      15,     242,       8,
+     101,      29,       2,     188,
+       8,     190,     136,      44,
+     209,     253,     238,      98,
+      70,       8,       3,     138,
+     252,     205,      46,      34,
+      67,      20,       8,      14,
+     239,      15,     139,     218,
+      48,     117,       5,      24,
+     236,      79,      54,     155,
+      44,      99,      37,     190,
+      55,      12,      49,     226,
+     157,      62,      19,     112,
+     191,      55,      44,      32,
+      47,     141,      17,      32,
+      66,      13,       8,     207,
+     236,       0,     206,     186,
+      29,      84,      69,       8,
+     175,     251,      51,     225,
+     138,     234,      82,      87,
+       8,     192,     236,      49,
+       4,     172,     186,      46,
+     101,       8,       4,     220,
+      16,      34,     209,     186,
+     220,      65,       7,      38,
+     238,     238,      32,       0,
+     174,     168,      46,       7,
+      34,      66,       2,     206,
+     236,     238,     236,     238,
+       7,       0,      12,     102,
+       2,     142,     168,      14,
+      34,       7,     206,     236,
+      66,      70,     192,     138,
+     234,      98,       7,       4,
+     170,      46,      66,      36,
+     174,     170,      78,       7,
+      36,     206,     236,      34,
+      34,     224,     170,     236,
+       6,      64,     192,       0,
+     204,       0,      12,     192,
+     200,       5,     136,       0,
+     136,       0,     136,     136,
+       8,       0,       6,      64,
+     140,      12,       0,       0,
+     140,     136,      76,       7,
+      36,     224,     236,       0,
+       2,     192,     204,     238,
+       6,      64,       4,     204,
+      12,       0,     192,     140,
+     204,       6,       0,       0,
+       0,       0,     192,     140,
+     204,     204,       6,       0,
+     192,     204,      64,       4,
+     140,     136,      12,       6,
+       0,      12,     204,       0,
+       0,       4,     204,     204,
+       6,      12,     192,      12,
+       0,      68,     204,       0,
+     204,       5,     136,     136,
+       8,       0,       0,     136,
+     136,       0,       6,     204,
+     204,     204,      12,      68,
+       0,     140,     200,       6,
+      68,     192,     204,      12,
+       0,       0,     192,     204,
+       5,     136,       8,       0,
+     128,       8,       0,       0,
+     136,       5,       8,       0,
+       0,       0,       0,     128,
+       8,       0,       5,     128,
+     136,       8,       0,       0,
+       0,     136,     136,       5,
+       0,     128,     136,     136,
+       8,       0,     128,     136,
+       5,       0,       0,     128,
+     136,       0,       0,       0,
+     136,       5,     128,     136,
+       8,       0,     136,     136,
+       8,     128,       5,     136,
+     136,       0,       0,       0,
+     136,       8,       0,       5,
+       0,     136,     136,       8,
+       0,     128,     136,     136,
+       5,       0,       0,     136,
+     136,       8,       0,     136,
+     136,       5,     136,       8,
+       0,     128,       8,       0,
+       0,     128,       5,       8,
+     136,     136,       0,       0,
+     128,     136,     136,       5,
+       0,       0,     136,     136,
+       8,       0,     128,     136,
+       5,       8,       0,       0,
+     136,     136,       8,       0,
+     136,       5,     136,       8,
+       0,       0,     128,     136,
+       8,       0,       5,     128,
+     136,       8,       0,     128,
+     136,     136,       0,       5,
+       0,     136,     136,     136,
+       0,     128,     136,     136,
+       5,       8,       0,     136,
+       8,     128,     128,       0,
+       0,       5,       0,       0,
+       0,       0,       8,       0,
+       0,     128,       5,     136,
+     136,     136,       0,     128,
+     136,     136,       8,       5,
+       8,       0,       0,       0,
+       0,       0,       0,       0,
+       5,       0,       0,     128,
+     136,       0,       0,       0,
+       0,       5,     128,       8,
+     136,     136,     136,       0,
+       0,       0,       5,     136,
+     136,       8,       8,       0,
+     128,     136,     136,       5,
+     136,       0,       0,       0,
+     136,     136,       8,     128,
+       5,       0,     136,       0,
+     128,     136,     136,     128,
+     128,       7,      32,     110,
+     110,     228,     164,     128,
+     138,     170,      25,       0,
+      31,     108,      46,     212,
+     227,       0,      59,       9,
+      11,     254,       5,      37,
+     241,     136,     171,      31,
+      41,      16,      61,      58,
+     222,     230,      83,     122,
+       8,      41,     144,     165,
+     114,      48,     212,     162,
+     193,      60,      57,      58,
+     253,     197,      20,      94,
+      27,      27,     206,      41,
+       7,      76,     203,     176,
+     241,      38,      36,      61,
+      41,     248,     128,      35,
+      66,      50,       0,     206,
+     222,      25,     202,      30,
+      70,      69,      14,     200,
+     216,     242,      57,     198,
+      50,      63,       0,     239,
+     180,      51,     124,      57,
+      60,     207,     145,     163,
+      17,      94,      32,     241,
+      58,     209,     211,      18,
+      78,      46,     255,     176,
+     211,      57,      93,     123,
+      78,     226,     179,     242,
+      95,     107,      57,     240,
+     133,     132,      15,     104,
+      29,     229,     245,      57,
+      16,      60,      92,     255,
+     198,     213,     223,      43,
+      57,      25,     226,     245,
+      36,      47,      45,     255,
+     228,      57,       3,       0,
+     221,     223,     252,      17,
+     126,      62,      57,     224,
+     195,     243,      18,      64,
+      30,     175,     239,      57,
+      11,      62,      79,       2,
+     196,       2,      78,      62,
+      42,     255,     207,     209,
+      64,     110,      79,     238,
+     162,      57,     199,      16,
+      92,      14,     244,     212,
+     209,      27,      57,      24,
+      76,     124,       0,     166,
+     197,      18,      94,      42,
+      45,     221,     177,     244,
+      64,      65,     107,     250,
+      26,     144,     207,      32,
+      83,      48,     238,     158,
+     254,      58,      44,     254,
+     212,       4,      63,      76,
+      60,     178,      26,     231,
+     240,     233,      26,      61,
+      36,       7,     197,      58,
+     213,      48,     123,      75,
+     224,     135,     166,     242,
+      26,     124,     127,      50,
+     194,     144,     192,      66,
+     113,      26,      62,     205,
+     142,     179,      66,     112,
+      80,     254,      58,     208,
+     196,     228,      49,      77,
+      14,     255,     161,      57,
+     135,      18,      64,     108,
+      90,      44,     196,     231,
+      57,      19,      29,      91,
+     216,     147,     230,      33,
+      15,      57,      15,      79,
+      47,       4,     242,     239,
+     162,      14,      57,      60,
+      78,      77,     253,     163,
+     199,      68,      94,      57,
+      45,      76,     218,     131,
+     214,      18,      62,      90,
+      26,      30,      36,      21,
+     225,     219,     237,      47,
+      50,      57,      17,       0,
+     208,     210,      17,     111,
+      78,     208,      41,     212,
+      49,      66,      49,     222,
+     174,     240,      82,      41,
+      66,     241,     174,      76,
+      12,       3,       6,     196,
+      57,      34,     105,      26,
+     162,     199,       5,     124,
+     254,      25,     189,      19,
+     118,      96,     233,     154,
+     226,      69,      57,      80,
+     120,     147,     151,     242,
+      79,     106,      28,      25,
+     129,     193,      48,     127,
+      30,     183,     178,      13,
+      25,      92,     110,     255,
+     165,     196,      14,      76,
+      74,      26,     228,     228,
+     240,      30,      61,      29,
+     227,     229,      10,      18,
+     254,     218,     239,      19,
+      52,      34,      14,      26,
+      43,       1,     245,     226,
+     239,      76,      44,       2,
+      58,     196,     212,     242,
+      62,      92,      29,     225,
+     179,       9,     206,     249,
+      42,      98,      38,     147,
+     157,      61,      25,      80,
+      44,      24,     147,     167,
+      20,      80,      26,      25,
+      56,      29,      23,     230,
+     159,      64,     105,      60,
+      57,     224,     134,     165,
+     242,     124,      58,     178,
+      82,      24,     189,     131,
+      37,      85,     175,     216,
+      43,      39,      24,     101,
+       8,     183,     195,      27,
+     112,      93,     168,      25,
+     177,       7,      64,      10,
+       2,      33,      14,      63,
+       9,      19,     177,     188,
+      76,      81,     230,       2,
+      13,      57,      89,      45,
+     194,     165,      18,     108,
+      27,     131,      25,      37,
+      44,     235,      14,     213,
+     230,      62,     123,       9,
+       1,     180,      65,      96,
+      16,     173,     145,     208,
+       9,      28,     109,      68,
+     183,      36,     126,      42,
+     186,      26,     195,     181,
+       2,     110,      76,     192,
+     183,     243,      10,      30,
+     233,     204,     193,     242,
+      65,      64,      30,      26,
+     179,     167,     226,      76,
+      89,      29,     212,     199,
+      26,     243,     109,      74,
+     207,     149,     181,      17,
+     108,      10,      45,      18,
+     244,      53,      81,      46,
+     236,     189,      26,     180,
+     230,      35,      46,      60,
+     224,     165,     180,      26,
+       0,      76,      75,      32,
+     228,     196,      18,      75,
+      10,      14,     221,     175,
+     175,     238,      79,      97,
+      67,      26,     179,     164,
+     225,      45,      75,      61,
+       1,     213,      10,      53,
+      99,      82,      16,     207,
+     158,     173,     236,      26,
+     111,      62,     240,     211,
+     225,      15,      45,      29,
+      25,     208,     228,      22,
+      50,      47,      14,     222,
+     222,      24,     210,       5,
+      65,     124,      45,     226,
+     182,     134,      57,       3,
+     107,      88,     223,     181,
+     214,      48,      92,       8,
+     234,     187,     160,     225,
+      48,      64,      97,       4,
+      24,     131,     183,      89,
+      59,     111,       3,     182,
+     195,       8,      62,     235,
+     206,     223,     223,     222,
+      29,      48,       8,      68,
+      19,     225,     206,     205,
+      30,      47,       0,       7,
+     226,     192,     236,      10,
+     236,     224,     224,      36,
+       7,      66,      14,     204,
+     192,     192,     238,      10,
+      10,       8,      32,      53,
+      38,       1,     219,     219,
+     239,     208,       7,     204,
+     234,      78,     100,      36,
+     196,     174,     202,       7,
+      12,      14,     204,     238,
+      34,      36,      32,     236,
+       7,     236,     224,      38,
+      36,     238,      10,      12,
+     206,       7,     192,     238,
+      14,      64,      98,      36,
+     196,     192,       8,     237,
+     235,     236,     255,       1,
+      17,      33,      17,       7,
+       2,     192,     140,     170,
+     234,      32,      68,      36,
+       7,       2,     224,       0,
+      14,     204,     172,     238,
+      34,       6,       4,       0,
+     204,     192,       0,     204,
+     200,     200,       6,       0,
+      68,       4,     140,     136,
+      12,      68,       4,       7,
+     238,     238,       0,      36,
+       2,     204,     200,      12,
+       7,      36,       2,     206,
+     204,     238,       0,       0,
+     238,       6,     136,     204,
+       4,      68,      12,     200,
+       0,     192,       5,       0,
+       8,       8,       8,     128,
+     128,     136,       8,       6,
+     204,     204,     204,       0,
+      68,       0,     204,     136,
+       6,     204,     192,      12,
+      12,      12,       0,      68,
+      68,       6,     192,     136,
+     136,     204,     204,     204,
+       0,      64,       6,      68,
+       4,     192,     136,     136,
+     200,     204,      12,       7,
+       0,      34,      66,       2,
+     224,     204,     204,     238,
+       6,     204,      12,       0,
+      64,      68,       0,     204,
+     140,       6,     136,     200,
+     200,     204,       0,      68,
+       4,       0,       6,      12,
+      12,     204,     204,     204,
+     204,      12,      64,       6,
+       4,       0,     192,     204,
+     204,     204,     204,     204,
+       6,       0,       0,       0,
+       0,     192,     204,     140,
+     204,       5,       8,       8,
+       0,       0,       0,       0,
+     136,     136,       6,     204,
+       0,       0,       0,      64,
+       0,     192,     204,       6,
+     136,     136,     204,       0,
+      64,      68,       4,       0,
+       6,     204,     204,     200,
+     204,     192,       0,       0,
+      64,       6,       0,     192,
+     128,     204,     204,     204,
+      12,       0,       5,       0,
+       0,       0,     136,     136,
+     136,     136,       8,       5,
+       0,       0,       0,       0,
+     128,     136,     136,     136,
+       5,       8,       0,       0,
+       0,       0,       0,     136,
+     136,       5,     136,     136,
+     136,       0,       0,       0,
+       0,       0,       5,     128,
+     136,     136,     136,       8,
+       0,       0,       0,       5,
+       0,       0,     136,     136,
+     136,     136,     136,       0,
+       5,       0,       0,       0,
+       0,     128,     136,     136,
+     136,       5,     136,     128,
+       0,       0,       8,       0,
+       0,     128,       5,     136,
+       8,       8,       0,     128,
+     128,       0,       8,       5,
+       0,     136,     136,     136,
+     136,       0,       0,       8,
+       5,     136,     136,     136,
+     136,       0,       0,       0,
+       0,       5,       0,       0,
+       0,       8,     136,     136,
+     128,       0,       5,       0,
+       0,       0,     128,     128,
+     136,     136,       8,       5,
+     128,     136,     128,       0,
+       8,       8,     128,     136,
+       5,     136,     136,       8,
+       0,       0,       0,       0,
+       0,       5,     136,       8,
+       8,     128,       0,       0,
+     136,     136,       5,     136,
+     136,     128,     136,       8,
+       0,       0,       0,       5,
+       0,     128,     128,     136,
+     136,     136,     136,       0,
+       5,       0,       0,       0,
+       0,       0,       8,     136,
+     136,       6,     204,       0,
+     192,      12,      12,     192,
+     204,     128,       8,     244,
+      58,     236,     228,       0,
+      14,       2,      30,       8,
+     253,     208,     241,      63,
+       0,       1,     240,     179,
+       7,       8,      40,       2,
+       2,       2,     226,     236,
+     234,       8,      92,     162,
+     197,      62,      29,     239,
+      31,     241,       8,     226,
+      62,      29,     147,       0,
+      30,      16,      14,       7,
+     192,     164,      46,      72,
+     236,     226,       0,       0,
+       6,       0,     140,     192,
+     204,      12,       0,       0,
+      12,       7,     238,     192,
+     238,       4,      12,      14,
+      14,     238,       8,     239,
+     241,      31,      75,     194,
+     226,      13,     255,       6,
+     192,      76,       0,     132,
+     204,      76,       8,       0,
+       7,     194,      32,      12,
+     174,     228,      46,      12,
+     206,       6,     192,      12,
+     204,       0,      12,     192,
+     192,       8,       6,     204,
+       0,       0,      12,     140,
+      64,       8,     196,       6,
+       0,       8,     192,     192,
+     192,      12,       0,       0,
+       6,     204,     128,       0,
+      12,       0,      12,     192,
+     192,       5,       8,       8,
+     136,     128,       0,       8,
+     136,       0,       5,       8,
+     128,       0,     136,       0,
+       8,       8,     128,       5,
+     136,       0,       8,       0,
+     136,     136,     128,       8,
+       6,     204,     192,      12,
+      12,     204,     192,      12,
+       8,       5,     136,     128,
+     128,       0,       8,       8,
+     128,     136,       5,     136,
+       8,       8,     128,       0,
+     136,       8,     128,       5,
+     128,       8,       8,     136,
+     128,       8,     128,     128,
+       5,       8,     136,       0,
+       8,     128,     128,       8,
+       8,       5,       8,     128,
+     128,       8,       8,       8,
+     128,     128,       5,       0,
+       8,     136,     128,     128,
+       8,       8,       0,       5,
+       8,     128,       0,       8,
+     128,       0,       8,     136,
+       5,       8,     136,     128,
+     128,     128,       8,       8,
+     136,       5,     128,       0,
+     136,     128,       8,       8,
+     128,       0,       5,       8,
+     136,       0,       8,     136,
+     128,     136,     128,       5,
+     128,     128,       0,     136,
+     136,     128,       0,       8,
+       5,       8,     128,     128,
+       8,       8,     128,       0,
+       8,       5,       0,       0,
+     136,       8,     136,     128,
+     136,       8,       5,     136,
+       8,       0,     128,     128,
+       8,       8,     128,       5,
+       0,     128,     128,       8,
+     136,     128,     128,       8,
+       5,     136,       0,       0,
+       0,       8,     136,     128,
+       8,       5,       8,     128,
+     128,       0,       0,       8,
+       8,     128,       5,     128,
+       8,     136,     136,       0,
+     128,       8,       8,       5,
+     128,     136,       8,     128,
+       8,       8,       0,       0,
+       5,       8,     136,     128,
+       0,       8,     136,     128,
+       0,       5,       8,       0,
+       0,     136,       0,       0,
+     128,       8,       5,     136,
+     128,       8,       0,     128,
+     128,     136,     136,       5,
+     136,     128,     136,       8,
+     136,       0,       0,     136,
+       5,     128,     136,       8,
+     128,     136,     136,       8,
+     128,       5,       0,       0,
+       8,       0,       0,       0,
+       0,       0,       5,       8,
+     128,     128,     128,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       5,       0,       0,
+       0,       0,     128,     128,
+     136,     136,       5,     136,
+     136,       8,       0,       0,
+       0,       0,       0,       5,
+       8,     128,       8,     136,
+     128,     136,       8,       8,
+       5,       0,       0,       0,
+       0,       0,       0,     136,
+     136,       5,     136,     136,
+       0,     136,     128,     136,
+       8,       0,       5,     128,
+     136,     136,     136,     136,
+     136,     136,       0,       5,
+       0,       0,       0,       0,
+       0,       0,     128,     136,
+       5,     136,     136,     136,
+     136,       0,       0,       0,
+       0,       6,       0,     192,
+     204,     136,     136,     136,
+     204,       0,       7,      34,
+      66,      68,      34,      34,
+     224,     206,     138,       7,
+     136,     168,     236,      32,
+      66,     102,      70,      68,
+       8,      17,     240,     222,
+     188,     187,     203,     237,
+      31,       8,      50,      68,
+      68,      68,      51,      18,
+     239,     172,       8,     137,
+     152,     202,      14,      49,
+      68,      84,     101,      55,
+      66,      36,      17,     238,
+     158,     170,     139,     190,
+       8,      30,      83,     119,
+     102,     102,     102,      86,
+      52,      38,     187,     222,
+      45,      97,      49,     101,
+     243,     163,      38,     161,
+     240,       4,     193,     211,
+     176,      42,     234,      38,
+      93,      50,      84,     102,
+     225,     144,     205,      63,
+      38,      19,      31,      45,
+     189,     175,     222,      81,
+      68,      38,      21,     231,
+     135,     236,     235,      96,
+     212,     212,      38,      16,
+      11,     187,      45,     125,
+      18,      84,     246,       8,
+     101,      69,       2,      16,
+      83,     118,     103,      53,
+      38,     155,     225,     229,
+       7,      20,      37,     238,
+      13,      38,      61,      20,
+      96,     222,     193,     128,
+     237,     222,      38,     245,
+     243,      23,      97,      89,
+     222,       0,      20,      38,
+      81,      90,     205,     252,
+     190,      30,     106,     242,
+      37,     119,       5,      51,
+     179,     162,     113,     124,
+      20,      38,     206,     223,
+     190,      45,      46,      47,
+     196,     231,       8,     220,
+      31,      67,      68,      84,
+     101,     102,      69,       8,
+      19,     223,     172,     137,
+     136,     169,     203,     253,
+       8,      32,      51,      51,
+      68,      85,      69,      52,
+      18,       8,     240,     205,
+     171,     170,     187,     203,
+     220,     254,       8,      15,
+      33,      50,      68,      68,
+      68,      52,      35,       8,
+     240,     205,     171,     154,
+     153,     169,     203,     254,
+       8,      32,      67,     101,
+     118,     102,      86,      36,
+     241,      38,      62,     143,
+      67,     255,      20,      95,
+     245,     225,       8,      69,
+      84,      85,      85,      69,
+      51,      18,     190,      55,
+     140,     177,     139,      29,
+     239,     227,     242,     244,
+      39,      81,      30,     242,
+     239,     254,     174,     241,
+     113,      39,     230,      79,
+     194,     240,     218,      32,
+      98,      22,      56,      64,
+      19,      31,     190,     203,
+      43,     251,      96,      55,
+     114,       5,     206,     252,
+     225,     114,     103,      23,
+      56,     176,     139,     206,
+     219,      83,      67,       7,
+     209,      56,      13,     253,
+      33,      98,      18,     160,
+     153,     159,      56,     234,
+     116,     115,      39,     192,
+     224,     251,      33,      56,
+      97,      35,     174,     139,
+     174,     233,     102,     115,
+      56,      71,     237,     240,
+     236,      32,      67,      17,
+     157,      56,     170,     158,
+     236,     117,     101,       6,
+      15,     223,      56,      15,
+      18,      99,       1,     169,
+     201,     172,     251,      56,
+     119,      55,      50,     223,
+     222,       2,      63,      71,
+      56,     209,     217,     184,
+     188,      45,     118,      55,
+       2,      56,      13,     188,
+      34,      63,      70,     193,
+     169,     236,      57,     221,
+      32,      68,      18,       1,
+     239,      14,     240,      41,
+     224,     208,     187,      45,
+     102,       2,      33,     225,
+      56,      33,       0,     237,
+     250,       2,      49,      52,
+     143,      41,      47,     103,
+       1,      47,     225,     169,
+     255,      53,      56,       9,
+      64,      48,      34,     140,
+     201,     210,     220,      57,
+      82,      53,     255,      15,
+     224,     254,      48,      17,
+      41,     220,     253,      81,
+      55,     224,      16,     207,
+     171,      56,      15,     209,
+     235,      81,       4,     238,
+     169,      29,      41,      19,
+      30,       0,     205,     235,
+      66,      37,     225,      41,
+       0,     223,     204,      48,
+      87,     224,      15,     241,
+      56,     194,      11,       0,
+     209,     254,      37,     195,
+     138,      57,      45,      32,
+     253,      67,      21,     238,
+      14,     242,      56,     193,
+      16,      38,     144,     136,
+      64,       2,      27,      57,
+      99,       3,     220,       0,
+       2,     238,      17,      18,
+      57,     205,     251,      34,
+     240,      31,      70,     210,
+     252,      56,      49,     212,
+     236,      65,     226,     136,
+      72,     100,      57,     239,
+      49,      37,     177,      13,
+      34,     209,     255,      57,
+      48,     222,     219,      79,
+      18,      15,      66,      35,
+      56,     137,      78,      53,
+     221,      28,     241,     138,
+     216,      56,      85,     245,
+      32,     118,     212,     187,
+     113,       4,      56,     204,
+      30,     191,     136,      44,
+      85,      17,      48,      56,
+     102,     223,      11,     116,
+     209,     220,     255,     141,
+      56,     217,      65,      37,
+      16,      50,      21,     206,
+      48,      56,      52,     176,
+     236,     206,     155,      28,
+      83,      33,      55,      32,
+     119,     227,     252,     117,
+     247,     169,     201,      56,
+     173,     218,      64,      51,
+      16,      65,      34,     255,
+      56,      16,      36,     224,
+     220,     237,     186,      29,
+      50,      55,     246,      34,
+     116,     228,      32,     115,
+       2,     172,      56,     205,
+     204,     233,      33,      35,
+      47,      48,      35,      56,
+      31,      32,      19,     192,
+     238,     221,     184,      33,
+      55,      39,     237,      81,
+     103,       2,      84,     118,
+     191,      56,     237,     253,
+     153,      44,      68,     192,
+      14,      53,      40,     230,
+      14,      31,     173,     251,
+      82,      19,      45,      56,
+      83,     243,     235,      66,
+      35,      15,     100,      22,
+      56,     221,     222,     190,
+     137,      79,      37,     206,
+      47,      41,      68,     226,
+       0,     241,     205,      14,
+      66,     240,      56,      26,
+      53,     224,      12,      52,
+     212,      33,     102,      56,
+     227,      13,     252,     171,
+     184,      70,     210,     251,
+      56,      51,       3,      30,
+     117,       6,     253,     238,
+     173,      41,      15,      70,
+     223,     186,      64,      36,
+      15,      64,      57,      34,
+     255,      15,     207,     188,
+      65,      16,     238,      57,
+      48,       2,     238,      51,
+      36,     224,       0,     239,
+      57,     186,      48,       2,
+     254,      63,       3,     238,
+      65,      57,      37,     224,
+       0,     224,     170,      63,
+      17,     254,      57,      63,
+       3,     222,      81,      36,
+     224,       1,     224,      57,
+     170,      47,     242,     254,
+      49,     227,     207,      67,
+      57,      21,      15,      32,
+     208,     171,      17,     209,
+      14,      57,      66,     241,
+     236,      84,     244,      15,
+      33,     239,      57,     201,
+       4,     237,      29,      53,
+     223,      29,      84,      56,
+     211,      32,      34,     141,
+      56,     180,     152,      96,
+      25,      87,     159,      10,
+     117,       3,     239,     187,
+     170,      57,      51,     189,
+      12,      81,     239,      30,
+      35,     226,      57,      51,
+     225,     238,      76,     181,
+     205,      32,     210,      57,
+     255,      65,     241,      48,
+      20,     223,     252,      52,
+      56,     136,      14,     245,
+     185,      64,      21,      45,
+      86,      57,     242,     191,
+      80,     192,     254,      19,
+     207,      14,      57,      33,
+      15,      48,       3,     240,
+      44,     229,     235,      56,
+      67,     164,     203,      33,
+     254,      64,       3,      49,
+      57,     222,      22,     206,
+      16,       2,     238,       0,
+     255,      56,      15,       5,
+      31,     160,     118,     174,
+      16,      50,      56,     251,
+      14,     224,     205,      36,
+     225,     192,     114,      24,
+     244,      46,      67,     176,
+     171,      61,     242,      49,
+      56,       5,     193,      32,
+     254,     255,      33,      33,
+     241,      55,      78,     147,
+     173,      19,     130,      75,
+     250,      46,      56,      30,
+      66,     244,      32,     210,
+     208,     255,     208,      55,
+      42,     238,      62,     255,
+      81,       7,      34,     149,
+      39,      80,      98,     241,
+     106,     187,      81,     197,
+      47,      55,     230,      97,
+       6,      62,      17,     189,
+      30,     203,       8,     236,
+      33,      34,       2,      14,
+     101,      85,      20,       8,
+     190,     152,     154,     251,
+     240,      49,      35,     222,
+       8,      31,      66,      37,
+     223,     236,     221,      31,
+       0,       8,     241,     239,
+     253,      16,      50,     224,
+     188,     253,       8,      65,
+      70,      34,     208,     170,
+     186,      62,      53,      55,
+     253,      31,      44,      51,
+      49,      39,      27,     212,
+      24,     253,      84,     225,
+     254,     224,      65,      19,
+     116,      24,     160,     204,
+     253,      14,     224,      61,
+       4,      94,      23,     247,
+     111,     213,      13,     173,
+      58,     162,     184,      40,
+     228,      81,     176,      65,
+     205,      46,       1,      65,
+       8,     242,      12,     227,
+     252,     241,      81,      37,
+     239,      55,     156,      48,
+     154,     115,      28,      87,
+     252,      71,      40,     205,
+      50,     240,     227,      30,
+     247,      77,     206,      56,
+      52,     209,     254,     190,
+     238,     188,      82,      46,
+      56,      68,      81,     244,
+     239,     208,     203,     158,
+      59,      39,     215,      82,
+     169,     176,     138,      77,
+      49,     247,      56,     200,
+     226,      93,      37,     117,
+      21,      63,     191,      40,
+      80,     177,     117,     255,
+      18,     253,     225,     220,
+      24,     203,     234,     208,
+      61,     101,     103,      51,
+     241,      39,     137,      79,
+      96,     133,      96,      54,
+       1,     255,      40,      14,
+     174,      46,      17,     226,
+      96,      18,     243,      39,
+     237,     191,     137,     107,
+       2,     211,      82,      66,
+      39,      71,     209,     160,
+     136,      43,      77,     229,
+      82,      39,      18,      39,
+     254,     192,     173,     157,
+     115,     208,      56,     238,
+     237,       5,      49,      22,
+     242,     177,      45,      24,
+       2,      84,      81,     103,
+      49,     176,     155,     136,
+      40,      19,      49,      63,
+      20,      17,     223,     192,
+     203,      56,     192,     203,
+     187,     203,      31,      68,
+      85,      69,      39,     168,
+      30,     113,      53,      83,
+      47,       2,     220,      39,
+     142,      43,      14,      54,
+      65,     242,      65,     239,
+      39,     222,     217,     237,
+      51,      69,      69,      49,
+     218,      40,     224,     237,
+     224,      47,     242,      82,
+     228,      18,      40,     237,
+     224,     236,     224,      32,
+     242,      37,       2,      39,
+     195,     208,     144,     235,
+     255,     243,     113,      51,
+      39,      34,     252,     193,
+      11,     205,      67,      44,
+       7,      39,      35,     225,
+     255,     188,     194,      92,
+       0,      81,      55,     190,
+      52,      81,      38,      20,
+     210,     191,     172,      39,
+     229,      84,      14,     240,
+      11,     223,      49,     238,
+       8,     187,     219,     254,
+      66,      52,       1,     238,
+     221,       7,     202,      14,
+      34,      34,       0,     224,
+     238,     206,       7,     172,
+     236,      32,      68,      36,
+     226,     238,     238,       6,
+     192,     204,     204,     204,
+     136,     200,      12,      68,
+       8,      34,      34,      17,
+     224,     189,     187,     220,
+      14,       8,      49,      84,
+      69,      19,     224,     205,
+     187,     203,       8,     237,
+      16,      50,      52,      18,
+     240,     238,     221,       7,
+     202,      14,      32,      68,
+      36,     224,     204,     204,
+       7,     204,      14,      34,
+      68,      36,       2,     206,
+     138,       7,     170,     236,
+       0,      66,      68,      34,
+     238,     172,       7,     170,
+     236,       0,      34,       2,
+       0,     238,       0,       6,
+       0,     192,     204,      12,
+       0,     192,     140,     204,
+       6,     204,     204,      12,
+      64,      68,      68,     192,
+     136,       6,     136,     136,
+     200,     204,      64,      68,
+      68,     192,       5,     136,
+     136,       8,     136,     136,
+       8,       0,       0,       5,
+       0,     136,     136,     136,
+     136,     136,     136,     136,
+       6,     204,       0,       0,
+       0,       0,     204,     204,
+     136,       6,     204,      12,
+      68,      68,       4,       0,
+     140,     136,       7,     204,
+     236,      32,      68,      36,
+       2,     224,     206,       7,
+     170,     204,     236,       0,
+      34,      34,       2,     238,
+       7,     204,     172,     204,
+      14,      66,      68,      68,
+       2,       7,     206,     170,
+     170,     204,      14,      34,
+      34,      34,       7,       0,
+     206,     204,     202,     204,
+      14,      66,      68,       7,
+      36,     224,     204,     172,
+     204,      14,      32,      34,
+       6,       4,       0,     192,
+     204,     204,     200,     204,
+      12,       5,       0,       0,
+     128,     136,     136,     136,
+     136,       0,       5,       0,
+       0,     128,     136,     136,
+     136,       8,       0,       6,
+       0,       0,       0,     192,
+     204,     140,     136,     204,
+       6,       0,      64,       4,
+       0,     204,     204,     200,
+     204,       5,     136,       0,
+       0,       0,       0,     128,
+     136,     136,       5,     136,
+     136,     136,       0,       0,
+       0,       0,     128,       5,
+     136,     136,     136,     136,
+     136,       0,       0,     136,
+       5,     136,     136,     136,
+     136,       8,       0,       0,
+       0,       5,       0,     136,
+     136,     136,     136,     136,
+       8,       0,       5,       0,
+       0,     136,     136,     136,
+     136,       8,       0,       5,
+       0,       0,       0,     128,
+     136,     136,     136,       0,
+       5,       0,       0,       0,
+     136,     136,     136,     136,
+       8,       5,       0,       0,
+       0,     128,     136,     136,
+     136,       8,       5,       0,
+       0,       0,     136,     136,
+     136,     136,       8,       5,
+       0,       0,       0,       0,
+     128,     136,     136,     136,
+       5,       0,       0,       0,
+     136,     136,     136,     136,
+       8,       5,       0,       0,
+       0,       0,       0,     136,
+     136,     136,       5,       8,
+       8,       0,       0,       0,
+       0,     136,     136,       5,
+     136,       8,       0,       0,
+     128,       0,       8,       0,
+       5,     136,     136,     136,
+     136,       8,       0,       0,
+     128,       5,     136,       0,
+       8,       0,       0,       0,
+       0,       0,       5,       0,
+     136,     136,     136,     136,
+     136,     136,     136,       5,
+       0,       0,     128,     136,
+     136,     136,       8,       0,
+       5,       0,       0,       0,
+       0,       0,     128,     136,
+       0,       5,       0,       0,
+       0,     128,       0,     136,
+     136,     136,       5,     136,
+     136,     136,     136,     136,
+       0,       0,       0,       5,
+       0,       0,       0,       0,
+       0,       0,       0,     128,
+       5,     136,     136,     136,
+       8,     128,     136,     136,
+     136,       5,     136,     136,
+     136,       0,       0,       0,
+       0,       0,       5,       0,
+     128,     128,       8,     136,
+     136,     136,     136,       5,
+       8,       0,     128,     128,
+     136,     136,     136,       8,
+       5,     136,     128,     128,
+       0,       0,       0,       0,
+     128,       5,     128,       0,
+     136,     136,       8,     136,
+       8,       0,       5,     136,
+     136,     136,       0,       0,
+       0,       0,       0,       5,
+       0,     128,     136,       8,
+     136,       0,       0,       0,
+       5,       0,     136,       0,
+       0,       0,       0,       0,
+       0,       5,     136,       0,
+       0,     128,     136,     136,
+     136,       0,       5,     136,
+     128,     136,       8,     128,
+     136,       0,     136,       8,
+     240,     240,     224,      80,
+     222,      61,     193,     239,
+       8,     239,      33,     254,
+       0,      82,     161,     201,
+     255,       8,      63,      19,
+      47,       2,     243,     171,
+     236,      31,       7,      34,
+      34,      70,     224,     204,
+     238,     238,     224,       6,
+      12,       4,     204,       0,
+     204,       0,     192,      12,
+       7,     238,     236,     236,
+       0,       2,       0,      32,
+     174,       6,     200,     200,
+      12,      68,       4,      12,
+       0,     204,       6,     136,
+     200,      12,       4,      68,
+     204,     140,     140,       6,
+       8,      64,       0,       4,
+     128,      12,     192,     204,
+       5,       0,       0,     128,
+     136,     136,       0,       8,
+     128,       5,     136,       0,
+       0,     128,     128,     136,
+       8,     136,       5,     136,
+       0,       0,     128,     128,
+     136,     136,     136,       6,
+       0,       0,       0,       0,
+      68,      68,       4,     128,
+      55,       0,     220,     254,
+      14,      78,      65,      67,
+      35,      39,     254,     252,
+      36,      79,     240,     231,
+     110,      40,       8,      54,
+      18,     255,     187,     220,
+      32,      37,     208,       8,
+     252,     203,     189,     254,
+      32,       1,     253,      47,
+      40,     195,     213,      13,
+     204,      64,     106,     227,
+      39,      55,     125,      68,
+      83,      68,     224,      39,
+      61,      44,      57,     223,
+     163,      15,      44,      15,
+     227,     244,      33,      40,
+     110,      44,     197,     209,
+     222,      18,     122,      31,
+      56,     195,      19,      48,
+      49,      65,     241,     215,
+       3,      24,     186,     251,
+     233,       3,     103,     102,
+      17,      13,      24,     255,
+     242,      17,     238,     153,
+     206,      43,      48,      24,
+     102,      71,     242,     252,
+      46,     243,     245,     239,
+      56,     221,     176,     233,
+     202,     224,       3,      49,
+      81,      24,      30,       2,
+       4,     239,     136,     202,
+      11,      49,      40,      21,
+     242,     236,      28,      63,
+     211,     198,      16,      40,
+       8,      31,      92,      32,
+      22,     227,     238,      43,
+      24,      13,     227,      38,
+       0,     153,     185,     217,
+      31,      56,     223,      48,
+      32,      65,      51,     229,
+      39,      80,      40,     218,
+      31,      30,     243,      39,
+      34,     206,     254,      40,
+      78,     226,       3,      30,
+     250,      43,     193,       5,
+      56,     252,      44,       1,
+      51,      67,      22,      83,
+      65,      40,     251,     253,
+     178,      37,     112,      49,
+     177,      13,      56,      51,
+      38,      83,      34,     242,
+     144,     145,     216,      40,
+     110,      20,     195,     239,
+      13,      18,      16,     210,
+      40,     224,     205,      63,
+     106,      17,      23,     228,
+     253,      40,      59,      62,
+     225,     197,       0,      26,
+      58,     222,      25,     241,
+      67,     100,      34,     224,
+     224,     243,      32,      41,
+      45,      13,     207,     181,
+      50,      95,      47,     209,
+      40,     146,      17,      79,
+      77,     222,     132,     130,
+      65,      25,      11,      16,
+      70,      70,      17,     255,
+      30,     240,      41,     227,
+     240,     255,      60,     255,
+     229,      35,      48,      40,
+      25,     236,     240,     244,
+     109,      44,     220,     190,
+      25,     206,      31,      80,
+      84,      37,       2,     254,
+      30,      41,      30,     225,
+     194,     209,      78,      77,
+      16,     244,      40,      50,
+      41,      41,      30,     149,
+     231,      77,     248,      25,
+     202,     207,      18,      83,
+      99,      35,     225,     223,
+      57,       5,      64,      31,
+     208,     161,     192,      11,
+     251,      40,     229,     181,
+     208,      74,     124,     253,
+     135,     195,      25,     220,
+       9,     238,       4,      69,
+     100,      32,     239,      41,
+     225,     197,      34,      59,
+      12,     223,     198,      51,
+      25,      96,      83,      20,
+     211,     239,      47,      30,
+     225,      41,     209,     208,
+      34,      93,       0,     228,
+     227,      15,      57,      64,
+      64,     226,     214,      17,
+      28,      10,     157,      57,
+     162,       0,      79,      94,
+      17,       4,     245,      50,
+      57,      46,     254,     159,
+     147,      13,      42,      46,
+       2,      40,     161,     241,
+     127,      75,     144,     133,
+     192,     113,      57,      40,
+     250,     209,      20,      49,
+      64,      49,     227,      25,
+     242,     254,     219,     251,
+     239,      19,      67,      84,
+      40,      11,     220,     242,
+     198,      49,      73,     249,
+      13,      40,     166,      39,
+      97,     109,     236,     160,
+     242,      66,      40,     107,
+     251,     175,     192,     230,
+     113,     124,      18,      40,
+     163,     193,      44,      96,
+      28,     163,     131,     161,
+      41,      33,     109,      46,
+     227,     228,      14,      29,
+      32,      57,      17,       3,
+       1,     239,      44,     248,
+     189,     210,      40,      35,
+      42,       9,      16,     197,
+     244,      13,     251,      41,
+      76,     255,     213,      36,
+      63,      13,     254,       0,
+      41,     227,      17,      30,
+     253,      14,     194,      21,
+     111,      40,      91,     207,
+     191,     195,       6,     110,
+      57,     204,      25,     188,
+     206,      30,      81,      84,
+      20,     226,     224,      40,
+      83,     122,     236,     146,
+     191,     180,      84,     126,
+      40,      19,     179,     160,
+       1,      64,      77,     176,
+     148,      40,     175,     196,
+     112,     111,      19,     180,
+     223,      61,      40,      94,
+      77,     177,     194,     220,
+     241,     124,      96,      40,
+      35,     211,     191,      62,
+     110,      44,     148,     211,
+      40,     235,     240,     124,
+     126,      35,     243,     206,
+      29,      25,      63,      16,
+       2,     224,     190,     205,
+      11,      45,      40,      19,
+     183,     207,      45,     126,
+      30,     179,     194,      57,
+     240,     224,     251,      10,
+     237,     241,      16,      32,
+      57,      65,      17,       4,
+      19,     240,     193,     253,
+      25,      57,     252,     240,
+     225,      34,     111,      47,
+       4,      19,      57,     240,
+     178,     223,      11,     237,
+     225,     226,      33,      41,
+      95,      30,     209,     210,
+      14,     208,     227,      65,
+      40,     110,     194,     129,
+     242,     114,      93,     222,
+     176,      56,       1,     130,
+     143,      25,      24,     253,
+     192,       3,      40,      84,
+     109,     221,     160,      44,
+     207,     198,      53,      57,
+      45,      13,     224,       1,
+      34,      64,      33,     243,
+      40,      94,      41,     195,
+      39,      65,     253,     219,
+      35,      40,      21,      81,
+      24,     142,      32,      91,
+      15,       6,      40,       2,
+     223,     252,      83,      19,
+     242,     238,     187,      56,
+     228,     253,     219,     222,
+     239,     222,     237,       2,
+      56,      49,      68,      83,
+      32,     241,     237,     221,
+     239,      40,      15,     250,
+      47,      69,      64,     238,
+     191,      11,      55,     176,
+     158,     204,     236,     206,
+     184,      11,     243,      40,
+      34,      12,     173,      14,
+      16,      50,      18,     224,
+      56,     177,     237,      14,
+     240,       5,      84,      33,
+       1,      40,      17,      51,
+      32,      14,     204,      15,
+     100,      34,      56,      21,
+     102,      48,      47,     206,
+     208,      29,      29,      40,
+     203,      31,      70,      80,
+     223,     162,     189,      79,
+      55,     184,     221,     238,
+     255,     170,     204,     210,
+      97,      56,      65,      37,
+     226,       2,     252,     192,
+     240,     240,      40,     251,
+     124,       6,      36,     238,
+     176,     203,      19,      55,
+     248,     189,      29,     238,
+     155,      75,     238,      69,
+      39,     237,     139,     153,
+      38,      99,      20,       1,
+     203,      40,     220,     114,
+      18,     244,      14,     205,
+      11,     244,      55,     222,
+     237,      30,     175,     186,
+      32,      74,      67,      55,
+     101,      22,      77,     222,
+      12,      27,     208,     129,
+      40,      77,      35,      50,
+     225,     192,     252,      47,
+      17,      39,      51,      49,
+     234,     152,      70,      68,
+      38,     240,      55,       2,
+      50,     241,     208,     226,
+     227,     158,     206,      55,
+     144,      29,      48,     245,
+      17,      20,      31,      15,
+      55,      19,     194,     251,
+     223,     219,      14,      33,
+      13,      39,      17,      48,
+       1,      65,     189,     142,
+      66,     242,      38,      55,
+      52,     202,     253,      83,
+      80,      94,     222,      55,
+     225,      15,     204,     157,
+     235,     236,       0,      62,
+      38,      82,      30,     221,
+     251,     120,     236,     223,
+     242,      39,      53,     226,
+      19,      31,     255,      12,
+      59,       3,      55,     222,
+     142,     201,     189,      10,
+      63,      53,      83,      39,
+      25,      82,       1,     222,
+     236,     244,      19,      67,
+      55,      48,      52,     254,
+      51,     211,     242,      28,
+      31,       8,     205,     203,
+      46,     118,      21,     189,
+     170,     236,       8,     254,
+      48,      35,      17,      33,
+      84,     227,     155,       8,
+     153,     186,     187,      46,
+      85,      85,     101,     119,
+       8,     228,     154,     137,
+     153,     153,      12,      50,
+     101,      55,      84,      52,
+     254,       0,     204,     205,
+     234,       1,       8,      50,
+      67,     101,      87,     209,
+     171,     170,     170,       8,
+     235,      99,     103,      86,
+      53,     208,     137,     152,
+      55,     186,     252,      79,
+      33,     116,      70,      35,
+     220,      39,      49,       4,
+     226,      67,      21,     192,
+       2,     222,      39,     172,
+      12,      65,      31,      48,
+      55,       4,      15,      39,
+      30,     218,     232,      47,
+      34,     224,      67,      21,
+      39,      64,       0,     207,
+     188,      40,      33,       1,
+      64,      39,      69,      47,
+      15,     224,     222,     200,
+       4,      34,      39,      29,
+     116,       3,      31,      31,
+     174,     187,      29,      39,
+      20,       1,      67,      39,
+     255,      15,     254,     156,
+      39,     222,      19,       1,
+     110,      84,      20,     255,
+     222,      39,     204,     218,
+      51,      32,      15,      38,
+      20,     241,      55,     118,
+     116,     224,     240,     156,
+     153,     254,      76,      39,
+     208,     210,     204,     219,
+      96,      63,     241,      69,
+      39,       0,     227,     225,
+     156,     157,      64,      35,
+      35,      39,     116,      33,
+     254,     235,     203,     171,
+      48,      86,      39,      33,
+      82,      20,     208,     206,
+     203,     233,       2,      39,
+      22,      20,      21,      20,
+     176,     224,     186,     252,
+      55,     174,     154,     201,
+      29,       4,      71,      70,
+     209,      39,      47,      52,
+      50,      34,      33,     208,
+      15,     189,      39,     173,
+       1,      82,      36,      52,
+       1,     255,     236,      38,
+     152,       8,      48,      99,
+      55,      53,     214,     163,
+      39,     255,     203,     253,
+       2,      65,      49,     245,
+       2,      38,     159,     190,
+     171,      58,      18,      36,
+      85,      98,      38,     255,
+     222,     141,     189,     224,
+      97,      19,      55,      38,
+      34,     227,      11,     200,
+     158,     181,      68,      18,
+      55,     192,       1,      20,
+      21,     245,       1,     222,
+     234,       8,     168,     253,
+      49,     100,     102,      53,
+     225,     188,       8,     170,
+     202,      14,      49,      67,
+      68,      35,     240,       8,
+     205,     187,     219,      14,
+      33,      51,      35,     240,
+       8,     222,     204,     220,
+     254,      32,      67,      68,
+      19,       8,     239,     205,
+     187,     220,      14,      33,
+      51,      68,       8,      35,
+     240,     205,     187,     203,
+     237,      16,      50,       8,
+      68,      35,       1,     222,
+     204,     204,     253,      16,
+       7,      68,     102,      36,
+     224,     204,     170,     202,
+     238,       7,      32,      68,
+      36,       2,     206,     172,
+     170,     202,       7,      14,
+      66,      68,      68,       2,
+     224,     172,     170,       7,
+     170,     236,      32,      66,
+      68,      34,     224,     238,
+       6,     136,     136,     136,
+     204,       0,      68,      68,
+       4,       5,     128,     136,
+     136,     136,     136,     136,
+       0,       0,       5,     128,
+     136,     136,     136,     136,
+     136,     136,       0,       5,
+       0,       0,     136,     136,
+     136,       0,       0,       0,
+       5,       0,     128,     136,
+     136,     136,     136,     136,
+     136,       6,      12,       0,
+       0,     204,     204,       0,
+       0,       4,       5,       0,
+       0,     136,     136,     136,
+     136,       8,       0,       6,
+       0,       0,       0,     204,
+     204,     136,     136,     204,
+       6,       0,      68,      68,
+       4,     192,     204,     136,
+     200,       6,     204,       0,
+      68,      68,       4,     192,
+     140,     136,       6,     136,
+     200,      64,      68,      68,
+     192,     204,     136,       6,
+     136,     204,      12,      64,
+      68,      68,       4,     192,
+       6,     140,     136,     136,
+     204,       0,      68,      68,
+      68,       6,       0,     204,
+     136,     136,     200,      12,
+       0,       0,       5,       0,
+       0,     136,     136,     136,
+     136,       8,       0,       5,
+       0,       0,       0,     136,
+     136,       8,       0,       0,
+       5,       0,       0,       0,
+     136,     136,     136,     136,
+       8,       5,       0,       0,
+       0,     128,     136,     136,
+     136,     136,       5,       8,
+       0,       0,       0,       0,
+     136,     136,       8,       5,
+       0,       0,       0,       0,
+     136,     136,     136,     136,
+       5,     136,     136,       0,
+       0,       0,     128,     136,
+     136,       5,     136,     136,
+       8,       0,       0,       0,
+     128,     136,       5,     136,
+     136,       8,       0,       0,
+       0,       0,       0,       5,
+     136,     136,     136,     136,
+       8,       0,       0,       0,
+       5,     128,     136,     136,
+     136,       8,       0,       0,
+       0,       5,       0,     128,
+     136,     136,     136,     136,
+       8,       0,       5,       0,
+       0,       0,     136,     136,
+     136,       0,       0,       5,
+       0,       0,       0,       0,
+       0,     128,     136,     136,
+       5,     136,       8,       0,
+       0,     128,     136,     128,
+     136,       5,     136,       8,
+       0,     136,     136,     136,
+     136,       8,       5,       0,
+       0,       0,       0,     136,
+       0,     136,       0,       5,
+     128,     136,       8,       0,
+       0,     128,     136,     128,
+       5,       8,       0,     128,
+       0,     128,     136,     136,
+       0,       5,       0,     136,
+       8,       0,       0,       0,
+     128,     136,       5,     136,
+       0,       0,       0,       0,
+       0,     128,     128,       5,
+     136,     136,       8,       0,
+     128,     136,     136,     136,
+       5,       8,       0,       0,
+     136,     136,       0,       0,
+       0,       5,     128,     136,
+     128,     128,       0,       0,
+       0,       0,       5,       0,
+     128,     136,       8,     136,
+       0,     136,       8,     255,
+     255,       0,       0,       0,
+       0,     255,       0,       0,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,       0,     255,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,       0,     255,
+       0,     255,     255,     255,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+       0,     255,       0,     255,
+       0,     254,       0,       1,
+     253,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,       0,     255,
+     255,       0,       0,     254,
+       0,       3,     255,     253,
+     254,       0,       0,       0,
+       0,     254,     255,     255,
+     255,       1,       0,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+       0,       0,     255,       0,
+       0,       0,       0,     255,
+     255,     255,       0,     255,
+     255,     255,     255,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,     255,       0,     255,
+       0,       0,       0,     255,
+       0,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,     255,
+       0,     255,     255,       0,
+     255,       0,     255,     255,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+     255,       0,     255,       0,
+     255,       0,       0,     255,
+       0,     255,       0,       0,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,     255,       0,
+     255,       0,     255,       0,
+       0,     255,     255,     255,
+       0,     255,       0,     255,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+       1,       0,     253,       0,
+       1,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,       0,       0,
+       0,     254,       1,     255,
+     255,       1,     254,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     254,       0,       0,     255,
+       1,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       1,     255,     254,
+       1,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       1,     255,     254,
+       0,       0,     255,       0,
+     254,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       1,     255,     255,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+     255,       0,     255,     255,
+       0,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+     255,       0,     254,       1,
+       0,     254,       0,     254,
+       0,       1,     255,       0,
+       0,     254,     255,     255,
+       0,       1,       0,     254,
+     255,       1,     255,       0,
+       0,     255,     254,       0,
+       0,     254,       0,       0,
+     255,     255,       0,     255,
+     255,       1,     254,     255,
+       1,     254,       1,       0,
+     255,       0,       0,     255,
+       1,     255,     254,       1,
+     255,     255,       1,     254,
+     255,       1,     254,     255,
+       1,     255,     255,       1,
+     254,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     254,     255,       1,
+     255,     255,       0,     254,
+       0,       0,     254,       0,
+       0,     254,     255,       0,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,       0,       0,
+     255,     255,     255,     255,
+       0,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     254,     255,
+       0,     255,       0,       1,
+       0,       1,       1,     255,
+       1,       1,       0,       0,
+       0,     255,     255,     255,
+     251,     251,     251,     247,
+     251,       0,       1,       6,
+      11,      11,      11,      11,
+       4,       0,     254,     246,
+     246,     247,     247,     247,
+     249,     255,     252,     255,
+     255,       0,      12,      12,
+       9,      10,       4,     254,
+     250,     254,     246,     241,
+     255,     245,     246,      10,
+      12,       2,      10,       7,
+     243,     248,     249,     248,
+       5,       9,       2,       8,
+       4,     249,     251,     248,
+     243,     245,     249,       0,
+       8,      14,      23,      16,
+      10,       3,     248,     236,
+     232,     247,     252,       0,
+       8,      11,       4,       1,
+       3,     249,     245,     251,
+     253,       2,      11,      16,
+      19,      13,       3,     253,
+     240,     231,     224,     227,
+     255,       7,      19,      31,
+      17,       2,       3,     249,
+     228,     237,     250,     246,
+       6,      24,      21,      19,
+      12,     254,     245,     238,
+     229,     219,     234,       8,
+      22,      26,      27,      16,
+     251,     244,     240,     236,
+     242,     246,       1,      16,
+      20,      19,      17,       8,
+     249,     247,     245,     233,
+     223,     235,      14,      24,
+      21,      22,       9,     244,
+     237,     244,     244,     245,
+     254,     255,      13,      16,
+      12,      15,       8,     255,
+     253,     253,     239,     229,
+     226,     253,      25,      16,
+      14,      14,     255,     240,
+     247,     253,     248,     251,
+     253,     250,       2,       7,
+      15,      17,      15,      12,
+       3,     244,     229,     221,
+     223,       4,      23,      12,
+      11,      12,     251,     243,
+       2,       2,     250,     250,
+     246,     240,     249,      11,
+      26,      27,      27,      15,
+     248,     231,     222,     210,
+     229,      22,      28,      16,
+      16,       8,     238,     240,
+       0,     254,     250,     250,
+     249,     249,       2,      25,
+      42,      34,      19,       0,
+     230,     214,     216,     210,
+     241,      40,      39,      17,
+      11,     250,     227,     241,
+       1,       1,       0,     249,
+     250,       0,       4,      27,
+      47,      27,       3,     243,
+     220,     210,     224,     223,
+     251,      55,      45,      10,
+       1,     241,     222,     240,
+       6,       5,       2,     249,
+     245,     254,       6,      29,
+      51,      28,     249,     233,
+     218,     217,     235,     233,
+     249,      50,      48,       2,
+     242,     239,     228,     238,
+      14,      17,       9,     247,
+     237,       1,      14,      28,
+      47,      29,     240,     221,
+     225,     230,     241,     244,
+     245,      29,      48,       8,
+     235,     239,     239,     236,
+       9,      24,      12,     243,
+     232,     253,      13,      25,
+      43,      30,     238,     219,
+     229,     244,     252,     255,
+     243,     255,      38,      21,
+     233,     232,     248,     241,
+     253,      21,      18,     247,
+     228,     251,      24,      25,
+      29,      29,     246,     214,
+     229,       5,       5,     252,
+     246,     230,       2,      36,
+       6,     229,     244,     251,
+     243,       8,      25,       7,
+     235,     240,      21,      34,
+      18,      15,       4,     229,
+     225,       7,      21,     251,
+     243,     224,     218,      23,
+      45,     251,     232,     254,
+     245,     245,      21,      25,
+     254,     236,     255,      27,
+      17,       0,       9,     254,
+     229,     247,      27,      10,
+     236,     226,     206,     238,
+      52,      37,     238,     240,
+     252,     238,     255,      28,
+      16,     246,     241,       8,
+      24,       6,     254,       5,
+     253,     245,      11,      25,
+     248,     222,     220,     210,
+     253,      64,      39,     235,
+     233,     242,     239,       6,
+      28,      15,     250,     245,
+       3,      19,       1,     250,
+      15,       6,     246,       8,
+      18,     234,     213,     225,
+     219,      11,      77,      39,
+     225,     220,     241,     246,
+       8,      27,      19,     255,
+     239,       0,      18,     252,
+       3,      26,       9,     248,
+       6,       5,     223,     213,
+     228,     225,      24,      77,
+      23,     209,     211,     243,
+     255,      15,      31,      24,
+     253,     231,     253,      20,
+       2,       8,      26,      12,
+     246,     249,     255,     224,
+     218,     240,     228,      16,
+      75,      24,     202,     206,
+     253,      10,      20,      34,
+      21,     252,     227,     244,
+      19,      13,      15,      23,
+      10,     239,     239,     250,
+     227,     228,     248,     229,
+       0,      64,      35,     211,
+     205,     254,      14,      15,
+      27,      26,       5,     226,
+     235,      23,      26,      11,
+      15,       7,     230,     226,
+     250,     243,     239,     254,
+     238,     238,      39,      46,
+     233,     202,     244,      21,
+      19,      22,      28,      11,
+     228,     225,      16,      27,
+       6,      10,       9,     238,
+     224,     247,       0,     251,
+       0,     240,     215,     250,
+      50,      23,     219,     232,
+      20,      20,       9,      20,
+      18,     243,     220,     249,
+      35,      24,       1,       0,
+     246,     230,     242,       9,
+       6,     250,     239,     212,
+     223,      39,      59,     255,
+     227,       0,      10,     255,
+       8,      19,      10,     239,
+     238,      15,      18,       5,
+     255,     246,     236,     241,
+       3,      14,       5,     240,
+     221,     213,       3,      64,
+      41,     240,     229,     244,
+     248,       0,      24,      33,
+      10,     231,     238,      13,
+      10,     249,     245,     251,
+     250,     253,      11,      10,
+     249,     230,     217,     229,
+      28,      59,      19,     226,
+     221,     245,       4,      25,
+      43,      32,     246,     214,
+     242,      16,       1,     242,
+       2,      16,       0,     253,
+       8,       6,     237,     218,
+     219,     243,      46,      58,
+       0,     212,     226,       4,
+      19,      36,      39,       6,
+     214,     210,       1,      18,
+       2,       5,      17,       6,
+     243,     252,       9,     250,
+     228,     221,     230,      10,
+      57,      41,     234,     207,
+     239,      16,      28,      36,
+      22,     239,     203,     234,
+      24,      17,     255,       7,
+      17,     251,     237,     254,
+       8,     247,     228,     228,
+     237,      23,      57,      19,
+     218,     218,       2,      20,
+      27,      30,       4,     224,
+     219,     254,      19,      11,
+       7,      11,       3,     237,
+     244,      13,      11,     242,
+     228,     227,     240,      37,
+      57,       2,     212,     228,
+       9,      21,      26,      18,
+     252,     227,     229,       6,
+      15,       2,       3,      12,
+     250,     236,       0,      16,
+       2,     233,     226,     226,
+     251,      50,      48,     243,
+     212,     242,      15,      17,
+      22,      16,     248,     227,
+     234,       3,      12,      13,
+      11,       3,     244,     245,
+      10,      13,     248,     229,
+     225,     227,      16,      63,
+      29,     223,     215,     252,
+      15,      22,      23,       9,
+     243,     224,     241,       9,
+      14,      10,       8,     255,
+     243,     252,      11,      10,
+     247,     226,     222,     243,
+      39,      50,     255,     214,
+     227,       9,      21,      23,
+      19,       3,     234,     220,
+     246,      19,      22,       9,
+     254,     248,     247,       5,
+      14,       4,     237,     222,
+     222,       3,      54,      37,
+     232,     211,     247,      18,
+      20,      19,      12,     247,
+     225,     235,       7,      20,
+      17,       5,     249,     246,
+     252,       8,      11,     252,
+     230,     217,     232,      33,
+      58,       8,     216,     226,
+       6,      17,      18,      18,
+       6,     241,     226,     244,
+      18,      26,       7,     247,
+     246,     250,       3,      11,
+       4,     243,     223,     214,
+     254,      58,      44,     237,
+     212,     241,      14,      20,
+      18,      11,     253,     235,
+     235,       0,      20,      19,
+       0,     245,     251,     254,
+       1,       5,     253,     230,
+     213,     236,      39,      56,
+       4,     215,     228,       6,
+      19,      17,      12,       7,
+     245,     227,     243,      20,
+      29,       6,     243,     248,
+     252,       0,       5,       0,
+     243,     223,     221,      14,
+      60,      31,     226,     215,
+     250,      18,      20,      13,
+      12,       0,     232,     234,
+      11,      31,      13,     246,
+     242,     248,     254,       2,
+       2,     249,     230,     218,
+       1,      51,      37,     239,
+     218,     242,      10,      17,
+      14,      13,       5,     238,
+     232,       2,      27,      17,
+     249,     242,     249,     255,
+     255,     253,     252,     241,
+     222,     244,      40,      41,
+     251,     223,     236,       3,
+      16,      17,      14,       8,
+     243,     233,     254,      24,
+      18,     252,     244,     249,
+     252,     252,     250,     252,
+     245,     225,     244,      36,
+      37,     250,     227,     244,
+       6,      11,      11,      13,
+      12,     248,     233,     251,
+      23,      21,     252,     241,
+     249,     255,     252,     247,
+     249,     247,     231,     246,
+      34,      33,     245,     226,
+     248,       9,       9,       5,
+      10,      13,     249,     235,
+     252,      25,      20,     250,
+     239,     248,       0,     252,
+     245,     245,     247,     232,
+     248,      36,      33,     243,
+     224,     251,      15,      12,
+       3,       7,      12,     254,
+     238,     253,      23,      19,
+     252,     239,     246,       0,
+       0,     243,     238,     243,
+     239,       5,      38,      24,
+     235,     224,     254,      17,
+      14,       3,       3,       7,
+     253,     244,       2,      21,
+      17,     253,     239,     243,
+     255,       1,     240,     235,
+     239,     246,      21,      37,
+       7,     227,     231,       4,
+      19,      15,       4,       3,
+       0,     249,     255,      15,
+      14,       4,     254,     246,
+     242,     250,       0,     242,
+     231,     231,       6,      46,
+      29,     234,     218,     248,
+      14,      18,      10,       3,
+       0,     247,     250,      14,
+      21,       4,     250,     254,
+     250,     242,     249,     252,
+     240,     224,     235,      35,
+      53,       2,     212,     229,
+      12,      20,      13,       5,
+       4,     250,     243,       7,
+      29,      17,     248,     244,
+     254,     252,     247,     247,
+     246,     234,     223,       8,
+      52,      29,     230,     215,
+     248,      17,      21,       9,
+       3,     252,     241,     253,
+      26,      29,       3,     240,
+     244,     253,     253,     248,
+     243,     237,     227,     254,
+      44,      31,     238,     220,
+     246,       7,      13,      15,
+      11,     253,     234,     247,
+      28,      38,      10,     242,
+     243,     249,     252,     252,
+     247,     235,     222,     252,
+      50,      36,     233,     214,
+     251,      17,      10,       3,
+      11,       8,     232,     234,
+      25,      47,      16,     238,
+     240,     250,     251,     249,
+     249,     238,     218,     250,
+      52,      38,     232,     210,
+     248,      19,      17,       1,
+       2,       6,     237,     235,
+      20,      46,      20,     241,
+     236,     249,     254,     250,
+     250,     237,     221,       4,
+      46,      24,     230,     223,
+     254,      14,      11,       0,
+       5,     255,     235,     250,
+      32,      39,       7,     241,
+     242,     248,     254,     252,
+     250,     228,     234,      26,
+      31,     246,     226,     253,
+      15,      10,       3,     251,
+     252,     246,     245,      15,
+      40,      28,     249,     235,
+     240,     250,       5,       4,
+     241,     224,       7,      40,
+       2,     213,     231,      21,
+      28,      13,     250,     245,
+     237,     229,       3,      45,
+      46,       7,     236,     233,
+     236,     247,       9,      10,
+     236,     245,      30,      15,
+     215,     212,       8,      30,
+      25,      11,     253,     235,
+     216,     241,      33,      51,
+      29,       0,     238,     227,
+     230,     251,      13,       0,
+       4,      31,      15,     216,
+     199,     247,      27,      32,
+      22,       5,     241,     214,
+     227,      21,      48,      31,
+       7,     250,     238,     229,
+     235,     248,     255,      27,
+      45,       9,     212,     204,
+     241,      15,      24,      25,
+      17,     245,     212,     229,
+      21,      37,      26,       9,
+     250,     240,     239,     243,
+     236,     244,      35,      54,
+       5,     205,     213,     251,
+      12,      18,      19,      11,
+     234,     217,     250,      27,
+      26,      16,       5,     246,
+     241,     251,     249,     226,
+     252,      52,      42,     230,
+     203,     241,      11,      10,
+       9,      16,       0,     217,
+     223,      11,      34,      29,
+      14,     245,     229,     249,
+      15,     246,     228,      20,
+      56,      11,     206,     217,
+       4,      18,      19,      18,
+       1,     223,     219,     251,
+      17,      22,      27,      12,
+     233,     224,       1,      15,
+     243,       3,      42,      25,
+     229,     212,     237,       4,
+      24,      33,      14,     227,
+     213,     245,       9,       6,
+      16,      23,     255,     228,
+     235,       0,       2,      18,
+      34,      15,     235,     226,
+     242,     248,       9,      32,
+      24,     240,     220,     242,
+       8,      10,       5,     251,
+     245,     254,       6,     249,
+     240,      22,      38,       3,
+     231,     242,     254,     251,
+      10,      24,      10,     235,
+     234,       1,      11,      10,
+       5,     240,     224,     243,
+      18,      11,       2,      20,
+      13,     238,     233,       0,
+       6,       5,      11,      10,
+       0,     240,     244,       4,
+      12,       9,     255,     238,
+     224,     239,       7,      19,
+      31,      18,     237,     225,
+     246,       3,       8,      22,
+      14,     247,     235,     249,
+      14,      18,       9,     255,
+     240,     230,     238,     255,
+      10,      32,      29,     246,
+     221,     232,     252,       8,
+      25,      20,     250,     230,
+     238,       7,      16,      20,
+      16,     251,     227,     226,
+     247,      10,      36,      35,
+     252,     224,     229,     245,
+       0,      18,      25,      10,
+     235,     225,     254,      17,
+      13,       8,       5,     245,
+     234,     241,       1,      28,
+      30,       6,     237,     228,
+     238,       0,      15,      15,
+       3,     240,     236,     254,
+      13,      10,       0,     251,
+     246,     247,     251,      10,
+      30,      17,     247,     241,
+     245,     248,       2,      19,
+      12,     247,     235,     238,
+     253,      13,      16,       3,
+     243,     240,     247,       3,
+      30,      25,     247,     242,
+     246,     239,     247,      27,
+      26,     246,     241,     247,
+     248,     253,       6,      12,
+       1,     244,     242,     252,
+       8,      12,      12,       3,
+     247,     244,     253,       6,
+       5,       1,       0,     253,
+     248,     248,     252,       6,
+       9,     255,     248,       1,
+      13,       6,     248,     247,
+     253,     251,     249,       6,
+       6,     249,     248,     255,
+     253,     249,       8,      11,
+     253,     253,       7,      13,
+       9,       5,     254,     238,
+     231,     243,       5,       9,
+       6,       1,     245,     239,
+     248,       9,      15,       7,
+       3,       7,      12,       9,
+       8,       3,     243,     234,
+     242,       0,     254,     253,
+       0,     251,     243,     246,
+       7,      16,       8,       4,
+       7,      10,      11,       9,
+     255,     245,     242,     241,
+     244,     250,       2,       6,
+       4,     250,     241,     251,
+       3,       2,      10,      20,
+      16,       8,       3,     249,
+     241,     242,     248,     250,
+     250,     254,     255,     251,
+     246,       0,      13,       7,
+     255,       0,       5,      10,
+      19,      19,     254,     238,
+     237,     241,     246,     255,
+       8,       6,     250,     241,
+     248,       8,       9,       4,
+       7,      13,      11,       7,
+       5,       0,     248,     243,
+     240,     243,     251,       3,
+       7,       4,     250,     246,
+     251,     255,       7,      17,
+      12,       5,       7,       3,
+     248,     246,     250,     249,
+     247,     248,     251,       0,
+       0,     252,       0,       5,
+       4,       4,       5,       7,
+       8,       8,       5,     255,
+     246,     240,     243,     249,
+       1,       6,       2,     249,
+     243,     249,       4,       9,
+       9,      11,       6,       3,
+       8,       7,     254,     248,
+     245,     244,     247,     250,
+       0,       6,       1,     248,
+     246,     253,       1,       7,
+      12,       9,       8,       9,
+       4,     253,     250,     250,
+     253,     253,     253,       0,
+     254,     249,     246,     251,
+       1,       3,       5,       4,
+       0,       0,       7,       7,
+       0,     253,     252,     250,
+     250,     255,       3,       4,
+       0,     247,     248,     251,
+     254,       5,      10,       6,
+       1,       1,     252,     250,
+     252,     252,     252,       0,
+       2,       3,       5,     255,
+     251,       1,       4,       2,
+       2,       2,       0,       3,
+       3,     253,     250,     249,
+     249,     251,     253,       0,
+       1,       3,       2,       0,
+       4,       6,       3,       2,
+       3,       1,     255,     255,
+     252,     250,     253,     252,
+     247,     248,     255,       2,
+       2,       5,       1,     255,
+       3,       2,       3,       6,
+       2,     254,     251,     251,
+     252,     255,     254,     250,
+     251,     254,     255,       3,
+       5,       3,     255,     254,
+     254,       1,       5,       2,
+       2,       3,     253,     250,
+     253,     254,     254,       0,
+       2,     254,     254,       1,
+     254,       1,       4,     255,
+     254,     254,     254,     254,
+       1,       3,       1,       1,
+       2,     254,     251,     254,
+       2,     255,     254,       0,
+       0,     255,     252,     253,
+       1,       1,     255,       0,
+       0,       0,       2,       4,
+       1,     254,     254,     254,
+     254,     254,     255,       2,
+       0,     251,     253,       0,
+     254,     255,       1,       1,
+       1,       3,       1,       0,
+       1,     255,     254,       0,
+       1,     255,     254,     255,
+     253,     254,       1,       0,
+     253,     254,     255,       0,
+       1,       2,       0,     255,
+     255,     254,     255,       1,
+       2,       0,     254,       0,
+       1,     254,     254,       2,
+       2,     254,     253,     255,
+       0,       0,       1,       1,
+     254,     252,     253,       0,
+       2,       2,       0,     255,
+     254,       0,       1,       0,
+       2,       1,     254,     252,
+     253,     255,       0,     255,
+       0,       0,     254,     253,
+     254,       0,       2,       1,
+       1,       0,     255,       0,
+       1,       1,       0,     255,
+     253,     252,     254,       0,
+     255,     254,     255,     255,
+     255,     255,       0,       1,
+       0,       0,       2,       3,
+       0,       0,       0,     253,
+     253,     255,       0,     255,
+       0,       1,       0,     255,
+       0,     255,     255,     255,
+       0,       1,     255,       0,
+       1,     255,     254,     254,
+       0,       0,       0,       0,
+       2,       2,     255,     254,
+     255,     254,     254,     254,
+     255,       0,       1,       1,
+       0,     255,     253,     253,
+     254,       0,       2,       2,
+       1,       0,     255,     254,
+     254,     255,       0,       0,
+     255,     254,     254,       0,
+       1,     255,     254,     254,
+     255,       0,       1,       2,
+       2,       0,     255,     254,
+     253,     255,       0,     255,
+       0,       1,     255,     254,
+     255,       1,       1,       1,
+       0,     255,     254,     255,
+       1,       1,       0,     255,
+     254,     254,     255,       1,
+       0,       0,     255,     254,
+     255,       0,     255,       0,
+       1,     255,     254,     255,
+     255,     254,       0,       1,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     254,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,       1,       0,     254,
+     254,     255,     255,     255,
+       0,       1,       1,       0,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     254,
+       0,       0,       0,       0,
+     255,     255,       0,       1,
+       0,       0,       0,     255,
+     255,       0,     255,     254,
+     255,     255,     255,       0,
+       1,       0,     255,     255,
+       0,       0,       1,       0,
+     255,     255,     255,     255,
+     254,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,       0,     255,
+       0,       0,     255,     254,
+     254,     255,       0,       0,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       1,       1,     255,     255,
+     255,     255,       0,       1,
+       0,     255,     254,     254,
+     255,       1,       1,       0,
+       0,     255,     254,     255,
+       0,       0,       0,       0,
+     255,     254,     254,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+     255,     255,       0,       0,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     254,     255,     255,
+     255,       0,       0,     255,
+     255,       0,       0,     255,
+       0,       1,       0,     255,
+       0,       0,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,     254,     255,     255,
+     255,     255,       0,     255,
+     255,       0,       1,       0,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+     255,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,     255,       0,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,       0,     255,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+     255,       0,     255,     255,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,       0,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+       0,       0,     255,       0,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,     255,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+       0,     255,       0,       0,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+       1,       0,       0,     255,
+     255,     255,     254,     255,
+     254,     254,     255,       0,
+       1,       1,       2,       1,
+       1,       1,       0,       0,
+     255,     255,     254,     253,
+     254,     254,     254,     254,
+     255,       1,       3,       4,
+       4,       4,       3,       1,
+       0,     255,     254,     254,
+     254,     253,     252,     252,
+     245,     242,     243,     246,
+     244,       9,      46,      43,
+      10,     238,     237,     234,
+     236,     250,      16,      24,
+       7,     248,     245,     248,
+       0,      14,      18,       5,
+     238,     229,     217,     227,
+      27,      63,      34,     239,
+     226,     229,     233,     250,
+      15,      23,       3,     244,
+     249,       4,      14,      22,
+      26,      14,     255,     241,
+     231,     224,     229,     223,
+     232,      45,      76,      27,
+     227,     229,     239,     238,
+       3,      30,      33,     248,
+     216,     240,      11,      21,
+      30,      29,       3,     222,
+     226,     243,     255,     255,
+     242,     218,     252,      56,
+      42,     247,     232,     249,
+     238,     245,      16,      27,
+     252,     217,     236,      23,
+      36,      32,      17,     249,
+     224,     234,       6,      10,
+     250,     231,     212,     214,
+      35,      78,      35,     235,
+     225,     225,     223,       8,
+      48,      41,     247,     218,
+     245,      12,      12,      21,
+      16,     250,     235,       4,
+      11,     250,     228,     215,
+     211,     247,      74,      77,
+     255,     197,     213,     233,
+       0,      51,      68,      22,
+     206,     191,     241,      20,
+      32,      36,      15,     241,
+     234,       3,       8,     247,
+     225,     219,     217,       4,
+      75,      57,     237,     203,
+     228,     244,      19,      64,
+      52,     238,     184,     213,
+      12,      25,      30,      32,
+       4,     224,     232,      13,
+      16,     246,     220,     211,
+     215,      27,      87,      42,
+     223,     211,     239,     250,
+      31,      61,      25,     211,
+     183,     235,      36,      35,
+      26,      12,     231,     213,
+       7,      43,      10,     225,
+     210,     206,     228,      65,
+      90,      10,     195,     212,
+     247,      12,      51,      55,
+     251,     187,     199,      17,
+      56,      31,       8,     241,
+     220,     234,      40,      54,
+     252,     199,     195,     202,
+     244,      88,      99,     254,
+     180,     212,     252,      19,
+      55,      51,     240,     181,
+     209,      27,      39,      10,
+       5,     245,     225,     255,
+      57,      35,     222,     188,
+     199,     218,      34,     113,
+      62,     205,     174,     231,
+      11,      40,      67,      35,
+     210,     172,     230,      41,
+      30,      10,       7,     245,
+     232,      20,      51,       0,
+     197,     194,     213,     243,
+      79,     107,       7,     168,
+     194,       4,      33,      58,
+      53,     246,     177,     186,
+      11,      52,      30,       7,
+     244,     228,     246,      44,
+      41,     234,     190,     203,
+     223,      26,     108,      66,
+     203,     164,     233,      27,
+      45,      57,      25,     210,
+     168,     224,      48,      48,
+      17,     252,     233,     228,
+      12,      48,      12,     211,
+     196,     213,     239,      67,
+     106,       9,     167,     192,
+      12,      37,      48,      44,
+     251,     183,     182,      12,
+      64,      39,       3,     233,
+     224,     245,      34,      36,
+     245,     209,     207,     218,
+      25,      98,      52,     200,
+     182,     249,      32,      38,
+      39,      11,     210,     185,
+     247,      53,      38,       2,
+     237,     230,     241,      20,
+      36,       5,     224,     212,
+     205,     252,      86,      75,
+     223,     177,     233,      20,
+      29,      36,      25,     233,
+     195,     230,      33,      33,
+      11,     252,     232,     233,
+      13,      37,      12,     232,
+     221,     206,     232,      67,
+      87,     250,     185,     223,
+       8,      18,      30,      33,
+     255,     208,     224,      22,
+      30,       9,     254,     241,
+     234,       2,      28,      10,
+     237,     234,     214,     232,
+      62,      71,     240,     196,
+     237,       6,       6,      21,
+      28,       1,     222,     232,
+      15,      21,      12,       6,
+     242,     231,     254,      22,
+       3,     239,     240,     215,
+     244,      66,      50,     220,
+     208,       3,       9,       1,
+      17,      24,     250,     224,
+     251,      24,      13,       4,
+       4,     242,     234,       2,
+      19,     243,     229,     241,
+     231,      21,      73,      20,
+     194,     215,      19,      17,
+       3,       9,      10,     242,
+     238,      17,      28,       1,
+     248,     254,     246,     241,
+      10,      14,     226,     218,
+     233,      10,      62,      48,
+     225,     194,     243,      24,
+      25,      15,       3,     241,
+     236,       4,      36,      21,
+     247,     245,     248,     246,
+     250,      16,     254,     214,
+     204,     246,      69,      68,
+     239,     193,     230,       6,
+      16,      35,      21,     236,
+     216,     244,      37,      45,
+       5,     236,     239,     251,
+     253,       6,       1,     233,
+     203,     220,      59,      82,
+     253,     189,     227,      10,
+       9,      24,      32,     255,
+     213,     224,      31,      59,
+      17,     237,     234,     242,
+     254,      16,       3,     230,
+     201,     228,      62,      64,
+     238,     207,     245,       3,
+       3,      21,      20,     252,
+     220,     232,      38,      53,
+      11,     237,     240,     240,
+     245,      13,      12,     226,
+     194,      11,      75,      17,
+     201,     232,      24,       7,
+       4,      13,       0,     234,
+     227,       8,      48,      37,
+     255,     239,     238,     243,
+     255,     253,     250,     228,
+     239,      45,      30,     217,
+     217,      10,      15,      12,
+      20,     254,     219,     221,
+      15,      46,      28,       6,
+       0,     245,     235,     249,
+       7,     250,     220,     248,
+      57,      30,     201,     200,
+      20,      35,       9,      14,
+       6,     221,     205,       4,
+      56,      36,       6,     255,
+     243,     235,     247,     255,
+     248,     240,      18,      43,
+     255,     205,     212,     254,
+      26,      39,      32,     246,
+     201,     209,       7,      46,
+      32,      13,       0,     242,
+     241,     248,     246,     229,
+       1,      64,      45,     216,
+     193,     239,       1,      11,
+      39,      33,     239,     211,
+     240,      14,      11,      12,
+      22,       0,     238,       3,
+      13,     221,     211,      41,
+      74,       4,     202,     223,
+     250,       3,      26,      28,
+     238,     210,     246,      31,
+      22,       4,     253,     236,
+     234,       3,      33,       3,
+     229,      12,      28,     246,
+     225,     249,       2,       5,
+      24,      17,     231,     212,
+     243,      23,      20,       9,
+       6,     248,     234,     244,
+       6,     254,      17,      38,
+       8,     224,     229,     253,
+     248,      11,      38,      17,
+     229,     220,     247,      14,
+      18,       6,     238,     231,
+     253,      24,       9,     251,
+      20,      18,     233,     223,
+       7,      15,       4,       7,
+     252,     238,     245,       7,
+      17,      11,     253,     240,
+     230,     226,     252,      22,
+      36,      40,     254,     214,
+     229,       7,      12,      17,
+      20,     250,     230,     236,
+       1,      16,      17,      12,
+     252,     232,     227,     242,
+     248,      19,      59,      29,
+     220,     207,     241,      12,
+      30,      35,       8,     222,
+     208,     251,      38,      26,
+     253,     245,     237,     234,
+     245,       8,      36,      27,
+     244,     226,     233,     246,
+      14,      30,      19,     253,
+     230,     226,       0,      32,
+      23,     249,     238,     241,
+     243,     250,      25,      40,
+       4,     231,     236,     237,
+     237,      19,      44,      10,
+     226,     228,     248,       9,
+      23,      21,     254,     227,
+     231,       0,      35,      39,
+     252,     228,     235,     243,
+     252,      19,      23,     250,
+     234,     243,     248,     255,
+      11,      13,       6,     249,
+     239,     247,      28,      33,
+       1,     240,     245,     243,
+     247,      16,      13,     248,
+     245,     250,     248,     249,
+       4,       6,     250,     250,
+       6,      21,      20,       0,
+     240,     234,     245,       8,
+      11,       1,       1,     253,
+     239,     243,       1,       6,
+       8,       4,     250,     255,
+      15,      17,       5,     253,
+     245,     237,     243,       1,
+       5,       1,       2,     253,
+     241,     247,       9,      11,
+       2,       6,      17,      17,
+      10,     255,     244,     238,
+     241,     248,     255,       0,
+     249,     246,     245,     251,
+       8,       7,     255,       3,
+      16,      26,      23,       5,
+     243,     240,     241,     247,
+       0,       1,     248,     242,
+     239,     245,       3,      10,
+       8,       7,       7,       9,
+      15,      14,       3,     251,
+     246,     244,     245,     249,
+       2,       2,     243,     242,
+     255,       3,       0,       7,
+      20,      17,       4,     252,
+     251,     251,     251,     255,
+       1,     249,     242,     243,
+     247,     254,       7,      13,
+       8,       1,       2,       8,
+       9,       6,       1,     251,
+     247,     244,     243,     245,
+     249,       3,       3,     252,
+     249,     254,       6,       9,
+      10,      13,      11,       2,
+     252,     254,       1,     252,
+     246,     245,     248,     250,
+     248,     250,       6,      10,
+       4,     255,       0,       4,
+      11,      12,       5,     253,
+     248,     245,     247,     253,
+     255,     250,     248,     254,
+       6,       7,       6,       6,
+     254,     247,     251,       5,
+       9,       7,       0,     249,
+     245,     244,     246,     252,
+       0,       3,       6,       9,
+       7,       3,       1,     254,
+       0,       8,       8,     254,
+     247,     246,     244,     245,
+     248,     253,       4,       8,
+       8,       9,       8,       2,
+       1,       3,       2,       0,
+       0,     252,     251,     252,
+     250,     248,     245,     247,
+     253,       4,       7,       5,
+       4,       1,       0,       4,
+       4,     255,     253,       0,
+       2,     250,     244,     247,
+     251,     253,       3,       6,
+       2,     255,       0,       2,
+       1,       1,       6,       6,
+     255,     252,       0,       1,
+     253,     252,     254,     252,
+     251,       2,       8,       6,
+       2,     255,     252,     249,
+     253,       4,       4,     254,
+     253,     255,     255,     255,
+     254,       0,       3,       4,
+       1,     254,     253,     254,
+       1,       1,     253,     249,
+     251,     255,       2,       3,
+       0,     252,     252,     255,
+       4,       7,       6,       1,
+     255,     255,       0,     255,
+     253,     251,     249,     250,
+     255,       1,     254,     254,
+       1,       0,     253,       0,
+       6,       6,       3,       3,
+       4,       1,     252,     251,
+     251,     252,     254,       0,
+     253,     251,     254,     255,
+     255,       2,       4,       0,
+     255,       1,       2,       2,
+       2,       3,     255,     252,
+     252,     252,     253,       2,
+       3,     254,     251,     255,
+       2,       2,       0,       0,
+       0,     254,     254,       1,
+       1,     254,     253,     255,
+     255,       0,       3,       3,
+     254,     253,       0,       1,
+       1,       1,       1,     253,
+     252,     254,     255,     255,
+     255,     254,     253,       0,
+       3,       2,       0,       0,
+       1,       0,       0,       0,
+       0,       0,       1,       0,
+     252,     250,     252,       1,
+       3,       2,       0,     254,
+     254,       0,       1,       2,
+       2,       1,       0,       0,
+     254,     253,       0,       1,
+     252,     250,     254,       2,
+       2,       3,       3,     255,
+     252,     254,       2,       2,
+       1,       2,     255,     252,
+     253,       0,       0,       0,
+       0,     255,     254,     254,
+       0,       2,       2,     255,
+     254,     255,       0,       0,
+       1,     255,     253,     252,
+     254,       0,       2,       2,
+       0,     254,     254,     254,
+     255,       0,       1,       0,
+     255,       0,       1,     253,
+     251,     254,       1,       1,
+       1,       1,       1,     255,
+     254,     255,       0,       0,
+       1,       2,       1,     255,
+     254,     253,     253,     252,
+     254,       1,       1,       0,
+       0,       1,       1,       1,
+       0,     255,     255,       1,
+       2,       1,       0,     254,
+     253,     253,     254,     255,
+       0,       0,       0,     255,
+     255,       0,       1,       0,
+       0,       0,       0,       0,
+       0,       0,     254,     254,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+     255,     255,       0,       1,
+       1,       0,     254,     253,
+     254,       0,       0,       0,
+       1,       0,     254,     254,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+       1,       1,       0,     253,
+     252,     255,       1,       1,
+       2,       2,       0,     253,
+     252,     254,       1,       1,
+       0,     254,     255,     255,
+     255,     254,     255,       0,
+       0,       0,       1,       1,
+     255,     255,       0,       0,
+     255,       0,       1,       1,
+     255,     254,     255,     255,
+     255,     255,       0,       0,
+       0,       0,     255,     254,
+     254,     254,     255,       1,
+       2,       0,     253,     254,
+     254,     255,       0,       0,
+     254,     255,       1,       2,
+       0,     254,     254,     253,
+     255,       2,       2,       0,
+       0,     255,     254,     254,
+       0,       0,       0,       1,
+       1,       0,     255,     254,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+       0,       1,       1,       0,
+     255,     254,     253,     254,
+       0,       0,       0,     255,
+     254,     254,     255,       0,
+       0,       0,       0,       0,
+       1,       0,     255,     255,
+     255,     254,     255,       0,
+       0,       0,       0,     255,
+     254,     255,     255,       0,
+       1,       1,       0,     255,
+     255,     254,     254,     255,
+       0,       0,       0,       0,
+     255,     255,       0,       1,
+       0,     255,     255,       0,
+       0,       1,       1,     255,
+     254,     254,     254,     255,
+       0,       1,       0,     255,
+     254,     255,     255,       0,
+       1,       0,       0,       0,
+     255,     254,     255,       0,
+     255,     255,       0,       0,
+     255,     254,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,     255,
+     255,       0,     255,     255,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+       0,       0,       0,       1,
+       0,     254,     254,     255,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+     255,       0,       0,       1,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,     255,       0,
+     255,     255,     255,     254,
+       3,     255,     254,       0,
+     254,     255,     255,       0,
+     255,       0,       0,     254,
+       1,       0,     255,       0,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,     255,       0,
+       0,       0,     255,       0,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,       0,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       1,     255,
+     253,     255,       1,       0,
+       0,     255,     255,     255,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+       0,     255,       0,     255,
+     255,       0,       0,       0,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+     255,       0,     255,       0,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+     255,       0,       0,     255,
+       0,     255,       0,       0,
+     255,       1,     255,     255,
+       0,       0,       0,     255,
+     255,       0,       0,     255,
+       0,     255,       0,       0,
+       0,     255,     255,       0,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,       0,     255,
+     255,       2,     255,     254,
+       0,       1,     255,       0,
+       1,     255,     254,       0,
+       0,       0,       0,     255,
+     255,       0,       1,     255,
+     255,       0,     254,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+       1,       0,     255,     255,
+     255,       0,     255,     255,
+       1,       0,     254,     255,
+       1,     255,       0,       1,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,       1,
+       0,     255,     255,       0,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+     255,     255,       0,       0,
+     255,       0,     255,       0,
+     255,     255,     255,       0,
+       1,       0,     255,       0,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       1,     255,
+     255,       0,     255,     255,
+       1,     255,     255,       0,
+     255,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,     255,       0,       0,
+       0,       0,     255,     255,
+       0,       1,     255,     254,
+       1,       0,     254,       0,
+       0,     255,     255,       1,
+     255,     255,       1,       0,
+     255,     254,     255,       1,
+       0,     254,     255,       0,
+     255,       0,     255,       0,
+       0,     254,     255,       0,
+     255,       0,       0,     255,
+     254,       0,       0,     255,
+       0,       0,     254,       0,
+       0,     255,     255,     255,
+       0,     255,       0,       1,
+     254,     255,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+     255,       1,       0,       0,
+       0,     255,     255,     255,
+       1,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+       0,     255,       0,     255,
+     255,       1,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,     255,
+       0,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,     255,     255,
+       0,     255,       0,       0,
+     255,       0,     255,       0,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,       0,     255,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     254,
+       0,     255,     255,       0,
+     254,       0,       0,     255,
+       0,     255,     255,       1,
+       0,     254,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,       1,
+     255,     255,       0,       0,
+       0,       0,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+       0,     255,     255,       0,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     254,       0,
+       0,     255,       0,     255,
+     255,     255,       1,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,       0,     255,
+     254,       0,       1,     255,
+       0,     255,     255,       0,
+       0,     255,     255,     255,
+     255,       0,     255,     255,
+     255,       1,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,     254,     255,
+       0,     255,       0,       0,
+     254,     255,     255,     255,
+       1,     255,       0,       0,
+     254,     255,       0,       1,
+     255,       0,     255,     254,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+       0,     255,     255,     255,
+       0,     255,     255,       0,
+       0,       0,     255,     255,
+     255,     255,       1,       0,
+     255,     255,     255,       0,
+       1,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     255,       0,
+       0,     255,     255,       1,
+       1,       0,     255,     255,
+       0,       0,     255,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     254,       0,       1,
+     254,       0,       0,       0,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+       0,     255,     255,     255,
+     254,       0,       2,       0,
+     254,     255,       0,       0,
+     255,       0,     255,       0,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+       0,       0,     254,       0,
+       0,     255,       0,     255,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+       1,     255,     254,     255,
+       0,       0,       0,       0,
+     254,       0,       0,     255,
+     255,       1,       0,       0,
+     255,     255,       1,     255,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+     254,     255,       1,       0,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+       0,     255,     255,     255,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+       0,     254,     255,     255,
+     255,       0,       0,       0,
+     255,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+     255,     255,       1,     255,
+     255,       1,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,     255,       0,     255,
+       0,     255,     255,       0,
+     254,     255,       1,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,       0,     255,       0,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+       0,     255,       0,     255,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     254,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+     255,     255,     255,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+     255,     255,       0,     255,
+     255,     255,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,       0,
+     255,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,     255,       0,
+       0,       0,       0,     255,
+     255,       0,     255,     255,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+       0,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+     255,       0,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+       0,     255,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+       0,     255,     255,     255,
+     255,     255,       0,     255,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+     255,     255,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,       0,       0,
+       0,     255,       0,     255,
+       0,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     254,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       1,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,       0,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+     255,     254,       1,       0,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+     255,     255,     255,       0,
+       0,     255,       0,       0,
+       0,     255,     255,       0,
+       0,     255,       0,     255,
+     255,       0,     255,       0,
+       0,       0,       0,     255,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+       0,     254,     255,       1,
+     255,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     254,       0,       0,     255,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,     255,       0,
+     255,     255,       1,     255,
+     255,       0,       0,     255,
+       0,       1,     255,       0,
+     255,     255,       0,     255,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       1,     255,     255,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       1,     255,     255,       1,
+     255,     255,       0,     255,
+     255,     255,     255,     253,
+     254,     254,     254,     254,
+     255,     255,       0,       2,
+       1,       1,       3,       3,
+       3,       3,       1,       0,
+     255,     254,     254,     254,
+     253,     249,     249,     251,
+     248,     248,     252,     254,
+       6,      14,      13,      12,
+      12,       5,     253,     251,
+     246,     244,     247,     249,
+     251,       2,       4,       2,
+       6,       0,     246,     244,
+     251,       6,       8,      11,
+      11,       5,     251,     251,
+     248,     241,     244,     247,
+     249,       4,      15,      18,
+      22,      16,       0,     253,
+     245,     229,     227,     234,
+     254,      12,      16,      18,
+      18,       2,     245,     247,
+     242,     239,     253,       5,
+       7,      21,      23,      16,
+      14,       3,     243,     243,
+     234,     219,     222,     241,
+      13,      26,      27,      24,
+      14,     249,     242,     247,
+     241,     242,     251,       2,
+       9,      14,      15,      15,
+       9,       2,     254,     248,
+     239,     229,     228,     234,
+       5,      24,      20,      18,
+      11,     249,     240,     248,
+     247,     244,     254,       0,
+       3,      16,      18,      17,
+      19,       9,     253,     251,
+     243,     223,     222,     228,
+     236,      17,      34,      24,
+      20,      11,     241,     236,
+     249,     241,     242,       0,
+       2,      12,      24,      24,
+      25,      17,       0,     247,
+     239,     225,     215,     224,
+     231,       3,      41,      36,
+      21,      16,     248,     222,
+     235,     248,     243,       1,
+      13,      15,      23,      24,
+      20,      17,       1,     245,
+     238,     231,     224,     226,
+     236,     243,      22,      45,
+      23,       8,     254,     226,
+     219,     247,       2,       5,
+      18,      18,      15,      15,
+      12,      15,      12,     250,
+     240,     234,     229,     226,
+     235,     240,       0,      40,
+      37,       7,       0,     241,
+     220,     236,      10,      12,
+      13,      16,       5,       9,
+      12,      11,      21,       5,
+     236,     233,     235,     232,
+     232,     241,     246,      22,
+      47,      17,     253,     250,
+     226,     227,       4,      18,
+      15,      10,       0,     252,
+       6,      15,      27,      23,
+     246,     230,     230,     234,
+     238,     240,     238,       7,
+      42,      16,     247,     255,
+     239,     226,       2,      22,
+      11,       6,     248,     246,
+      14,      24,      31,      33,
+     251,     220,     231,     241,
+     244,     243,     235,     226,
+       0,      41,      27,       6,
+       2,     234,     223,     254,
+      25,      16,     255,     250,
+       1,      15,      24,      30,
+      18,     235,     225,     244,
+     252,     246,     235,     220,
+     219,      17,      52,      24,
+       9,     252,     221,     224,
+      11,      22,      12,      12,
+     246,     254,      24,      26,
+      22,      10,     233,     227,
+       1,       0,     232,     224,
+     213,     219,      28,      62,
+      32,       7,     238,     212,
+     225,      17,      33,      23,
+       5,     246,     255,      18,
+      22,      15,       2,     232,
+     239,       8,     254,     228,
+     211,     207,     223,      36,
+      80,      43,     249,     217,
+     208,     227,      29,      49,
+      26,      10,     239,     237,
+       9,      26,      22,       6,
+     240,     235,     254,     251,
+     226,     218,     221,     230,
+      34,      74,      37,     244,
+     216,     208,     230,      32,
+      50,      31,      11,     231,
+     232,      11,      25,      20,
+      11,     243,     233,     251,
+     246,     223,     221,     227,
+     234,      31,      70,      31,
+     238,     214,     211,     241,
+      43,      56,      25,       8,
+     233,     223,       1,      32,
+      32,       9,     241,     229,
+     240,     244,     233,     231,
+     239,     240,      17,      53,
+      26,     242,     222,     221,
+     247,      38,      50,      26,
+     255,     224,     231,      14,
+      29,      24,      11,     238,
+     223,     241,     248,     235,
+     235,     246,     247,       3,
+      34,      25,     245,     221,
+     235,      12,      30,      40,
+      29,     249,     226,     245,
+      14,      20,      23,      11,
+     229,     219,     241,     248,
+     249,     246,     252,     250,
+     249,      14,      18,     253,
+     234,     248,      10,      16,
+      24,      20,       0,     236,
+     242,       8,      22,      18,
+       4,     236,     222,     234,
+     253,       4,     253,     255,
+     247,     239,       7,      18,
+       1,     241,       3,      11,
+       9,      20,      14,     255,
+     242,     251,      13,      20,
+      16,       2,     232,     217,
+     235,       3,      10,       2,
+     252,     250,     238,     247,
+       9,      10,       1,       3,
+       6,       1,       9,       8,
+       6,       3,       0,       7,
+      13,       6,     246,     235,
+     231,     237,       3,      16,
+      10,     250,     245,     239,
+     232,       0,      16,       9,
+       2,       5,       7,     255,
+       6,      15,      11,       1,
+       2,      10,     255,     244,
+     242,     239,     243,       6,
+      20,       6,     244,     241,
+     240,     235,     252,      16,
+      11,       4,       5,       4,
+     253,       4,      15,      11,
+       3,       1,       4,     250,
+     243,     247,     249,     251,
+       4,      14,       1,     241,
+     240,     246,     243,     243,
+       5,      17,       7,       4,
+       5,     252,     253,      12,
+      22,       5,     255,       0,
+     248,     248,     253,       0,
+     247,     253,       9,       4,
+     246,     239,     245,     245,
+     252,       5,       8,       7,
+       1,     255,     252,       6,
+      13,      12,       6,       3,
+       4,     249,     247,     251,
+     252,     250,     253,       4,
+     255,     249,     246,     253,
+       0,     248,     255,       4,
+     251,     251,       9,      11,
+       2,       2,       8,       9,
+       6,       2,     254,     247,
+     245,     252,       2,       3,
+       2,     252,     246,     250,
+       3,       3,     253,     248,
+     253,     255,     251,       0,
+       4,       5,      10,      14,
+       0,     251,       6,       5,
+     250,     252,       0,     247,
+     250,       3,     253,     244,
+       0,       6,     249,     253,
+       3,     253,     247,     252,
+       0,     254,       5,      15,
+      11,     252,     254,       2,
+       2,       2,       4,     254,
+     246,     252,       0,       3,
+     253,     248,       1,       5,
+       0,     254,       2,     252,
+     245,     251,     251,     250,
+       2,      12,      10,     254,
+     254,     253,       2,       7,
+       6,     252,     242,     251,
+       3,       5,       3,     251,
+     251,       4,       7,       3,
+     255,     251,     249,     249,
+     253,     252,     252,       4,
+       9,       6,       0,     255,
+     251,     252,       2,       3,
+       0,     252,     254,       1,
+       1,       1,       0,     254,
+       3,       8,       1,     249,
+     247,     249,     252,       1,
+     252,     248,       5,       8,
+     251,     251,       0,       1,
+       2,       6,       7,     252,
+     253,       2,       4,     253,
+     255,      11,       4,     254,
+       3,       2,     248,     251,
+       1,     250,     248,     253,
+     251,     250,       0,     252,
+     251,       2,       8,       6,
+       0,     255,     255,       2,
+       1,       0,       6,       5,
+       2,       2,     254,     253,
+       1,       2,     251,     252,
+     252,     245,     248,     250,
+     248,     255,       5,       0,
+       0,       5,       5,       1,
+       4,       1,     254,       3,
+       7,       3,     254,       2,
+       2,       0,       0,       0,
+       1,     250,     246,     250,
+     248,     244,     251,       9,
+     253,     245,       5,      10,
+       0,     254,       8,       0,
+     252,       5,       9,       2,
+     252,       3,       8,       2,
+     252,     254,       1,     254,
+     250,     246,     248,     251,
+     253,     253,     250,       0,
+       1,       2,       3,       4,
+       2,       1,       6,       5,
+       3,       1,       0,       2,
+       2,       0,     254,     255,
+     255,     255,     252,     248,
+     251,     251,     248,     251,
+       0,     255,     251,       1,
+       5,       2,     255,     254,
+       6,       8,       4,     255,
+       0,       2,       2,       6,
+       1,     250,     252,       0,
+     253,     251,     249,     247,
+     251,     251,     255,     254,
+     252,     255,       6,       9,
+       1,       1,       2,       2,
+       3,       7,       6,     252,
+     254,       4,       3,     252,
+     252,     255,     254,     252,
+     249,     250,     251,     250,
+     248,     253,       4,       2,
+     255,       6,       7,     254,
+     254,       6,       6,       3,
+       3,       1,     252,     255,
+       5,     255,     249,     255,
+       1,     249,     245,     250,
+     251,     248,     252,       4,
+       7,       5,       2,     255,
+     255,       2,       9,       9,
+       1,     254,       2,       1,
+     253,       0,       1,       0,
+     254,     250,     249,     251,
+     250,     246,     250,       3,
+       8,       5,       0,       0,
+       0,       0,       0,       6,
+       7,       1,     253,       1,
+       3,       0,     255,     255,
+     255,     252,     249,     246,
+     247,     246,     246,       9,
+      20,       4,     244,     247,
+       9,      14,       6,     254,
+     253,     254,       1,      11,
+       9,     253,     249,     250,
+       0,     254,     247,     245,
+     246,     240,     240,      12,
+      27,       7,     239,     241,
+      10,      19,       7,     252,
+     255,     253,     249,       6,
+      15,       7,     252,     249,
+     252,     252,     245,     244,
+     249,     243,     238,      10,
+      33,       7,     231,     241,
+      18,      28,       5,     244,
+     252,       3,     254,       5,
+      15,       7,     249,     249,
+       1,     251,     238,     240,
+     250,     237,     240,      22,
+      33,     250,     225,     248,
+      22,      32,      11,     243,
+     243,     254,       6,      14,
+      17,       5,     248,     246,
+     253,     252,     239,     236,
+     242,     234,     251,      29,
+      23,     237,     227,       0,
+      26,      32,      12,     245,
+     240,     252,      12,      24,
+      17,       1,     250,     249,
+     250,     253,     245,     234,
+     234,     233,     255,      28,
+      15,     237,     229,     253,
+      19,      32,      19,     245,
+     237,     252,      18,      25,
+      17,       5,     252,     246,
+     245,     251,     249,     239,
+     229,     224,       1,      32,
+      13,     233,     230,     254,
+      18,      32,      21,     246,
+     234,     252,      23,      32,
+      17,       5,     252,     244,
+     244,     252,     251,     240,
+     227,     224,       0,      30,
+      11,     231,     230,     255,
+      18,      27,      20,     252,
+     235,     247,      23,      37,
+      21,       5,     252,     243,
+     240,     253,       1,     240,
+     224,     221,     255,      31,
+      13,     233,     226,     250,
+      16,      26,      23,       0,
+     236,     242,      21,      43,
+      25,       4,     251,     244,
+     243,     255,       3,     241,
+     223,     222,     252,      25,
+      13,     238,     230,     249,
+      10,      21,      21,       2,
+     239,     242,      16,      40,
+      30,       6,     249,     244,
+     245,       0,       2,     241,
+     225,     221,     249,      25,
+      16,     237,     225,     247,
+      11,      24,      20,       0,
+     238,     241,      17,      43,
+      31,       3,     247,     247,
+     249,       3,       0,     240,
+     228,     224,     252,      27,
+      15,     235,     222,     245,
+      14,      22,      15,       6,
+     248,     236,       3,      44,
+      40,       6,     245,     246,
+     249,     254,       3,     246,
+     228,     217,     239,      23,
+      26,     248,     224,     237,
+       5,      17,      22,      13,
+     246,     231,       2,      44,
+      41,       7,     244,     246,
+     251,       1,       6,     248,
+     228,     220,     238,      16,
+      25,     254,     228,     233,
+       1,      19,      17,      13,
+     254,     232,     247,      39,
+      49,      10,     242,     245,
+     251,     254,       4,     254,
+     233,     216,     230,      16,
+      28,     253,     226,     237,
+       5,      17,      13,      11,
+       4,     240,     247,      32,
+      48,      14,     244,     246,
+     252,     253,       2,     254,
+     237,     223,     226,       1,
+      22,       6,     237,     236,
+     252,      10,      16,      14,
+       4,     243,     243,      23,
+      47,      23,     247,     244,
+     253,     252,       0,       2,
+     241,     224,     223,     248,
+      21,      14,     241,     232,
+     249,      10,      13,      14,
+       8,     247,     242,      15,
+      46,      29,     253,     245,
+     251,     251,     254,       3,
+     246,     227,     221,     240,
+      15,      19,     249,     231,
+     243,       6,      14,      11,
+       5,       0,     250,       5,
+      33,      35,       6,     246,
+     251,     253,     250,       1,
+     251,     233,     222,     228,
+       3,      22,       7,     237,
+     239,       0,       8,      11,
+      11,       5,     248,     255,
+      28,      37,      10,     248,
+     252,     252,     250,       3,
+     254,     235,     226,     227,
+     251,      19,      13,     242,
+     234,     252,      12,      14,
+       5,       0,     255,       2,
+      22,      35,      17,     250,
+     249,     254,     251,     254,
+       0,     240,     227,     220,
+     241,      20,      20,     245,
+     229,     249,      12,      15,
+       9,     255,     251,       0,
+      20,      36,      22,     253,
+     245,     250,     253,       4,
+       2,     239,     228,     228,
+     245,      14,      13,     245,
+     233,     251,      13,      13,
+       4,       0,       1,       1,
+      13,      33,      27,       2,
+     246,     250,     251,     255,
+       0,     244,     231,     222,
+     239,      15,      16,     244,
+     230,     249,      15,      16,
+       7,     254,     248,     251,
+      16,      38,      27,       0,
+     244,     247,     253,       4,
+       0,     244,     235,     230,
+     245,      12,       7,     241,
+     238,     254,      13,      17,
+       4,     247,     250,       3,
+      18,      32,      26,       3,
+     247,     249,     250,     255,
+     255,     246,     234,     225,
+     250,      19,       4,     230,
+     231,       2,      19,      23,
+       6,     238,     235,       1,
+      30,      40,      23,     254,
+     241,     243,     255,       6,
+     252,     245,     235,     239,
+       9,      15,     240,     220,
+     243,      15,      26,      18,
+     249,     233,     241,      10,
+      31,      32,      18,     254,
+     245,     247,     253,     253,
+     249,     245,     235,     248,
+      19,      10,     226,     215,
+     251,      22,      31,      19,
+     242,     222,     240,      21,
+      40,      30,       9,     248,
+     242,     252,       2,     251,
+     245,     239,     253,      23,
+      16,     228,     208,     237,
+      14,      30,      24,     255,
+     229,     227,       3,      33,
+      32,      15,       2,     249,
+     248,     254,     249,     243,
+     241,     251,      20,      25,
+     248,     207,     220,       0,
+      23,      29,      10,     237,
+     223,     246,      25,      34,
+      18,       2,     248,     252,
+       3,     250,     245,     240,
+     255,      28,      23,     242,
+     216,     229,     252,      16,
+      21,       4,     240,     236,
+     251,      18,      26,      13,
+       1,     253,       3,       8,
+     250,     237,     236,       0,
+      32,      28,     240,     212,
+     232,       2,      19,      21,
+     249,     225,     232,       5,
+      26,      23,       6,     247,
+     247,       8,      13,       0,
+     238,     235,      16,      42,
+      13,     220,     216,     249,
+      17,      23,       8,     235,
+     222,     237,      12,      30,
+      21,       1,     243,     246,
+      10,      11,     252,     234,
+     244,      31,      42,     254,
+     209,     223,       1,      23,
+      32,       6,     223,     212,
+     240,      18,      28,      19,
+     254,     237,     249,       8,
+       9,     248,     239,      12,
+      35,      16,     232,     224,
+     244,       6,      23,      24,
+     255,     224,     223,     253,
+      20,      16,       5,     250,
+     248,       1,       4,     255,
+     239,     252,      32,      32,
+     246,     218,     240,       5,
+      19,      22,       0,     232,
+     231,     254,      13,       9,
+     253,     240,     248,       7,
+      12,       1,     239,       2,
+      30,      19,     240,     228,
+     248,       6,      14,      16,
+       3,     237,     230,     254,
+      24,      15,     246,     231,
+     240,       5,      12,       7,
+     244,     250,      25,      26,
+     249,     226,     240,       5,
+      19,      19,       1,     236,
+     234,     254,      19,      18,
+     252,     234,     238,     250,
+       8,       7,       4,      15,
+      14,     247,     232,     252,
+      10,       3,       0,       3,
+       1,     248,     247,       6,
+      13,       6,     249,     241,
+     246,     251,       1,       1,
+       6,      22,      13,     236,
+     228,       2,      18,      13,
+       2,     240,     234,     251,
+      14,      18,       8,     246,
+     239,     248,     252,     254,
+       2,      10,      23,      17,
+     241,     222,     240,      12,
+      18,      11,       4,     242,
+     227,     244,      23,      25,
+       2,     242,     242,     248,
+     252,     255,       6,      23,
+      26,       2,     228,     230,
+     255,      20,      21,     253,
+     231,     233,     254,      16,
+      15,     254,     241,     250,
+     255,     255,     253,       7,
+      27,      26,     251,     224,
+     236,       7,      20,      15,
+     252,     232,     229,     249,
+      20,      24,     251,     233,
+     242,     255,       5,       2,
+       5,      22,      22,     249,
+     228,     240,      11,      28,
+      15,     240,     227,     234,
+     253,      17,      17,     251,
+     237,     239,     252,       9,
+      17,      21,      15,     254,
+     241,     242,     249,      12,
+      29,      11,     236,     228,
+     243,       7,      15,       4,
+     249,     242,     238,     246,
+       8,      23,      22,       5,
+     244,     243,     252,       0,
+       6,      11,       5,     246,
+     237,     242,     254,       8,
+       7,     255,     245,     240,
+       2,      29,      26,     248,
+     233,     251,       6,       4,
+       5,       4,     253,     245,
+     247,     253,       3,       6,
+     255,     248,     251,       0,
+      11,      20,       9,     243,
+     237,     246,     254,       6,
+      11,       6,     249,     239,
+     240,     255,      14,      12,
+     254,     246,     250,       6,
+      20,      17,     254,     237,
+     238,     250,       5,       7,
+       1,     250,     246,     245,
+     251,       8,      13,       7,
+       0,     253,       1,      13,
+      18,       3,     244,     241,
+     244,     249,       2,       7,
+       2,     251,     245,     242,
+     252,       9,      10,       5,
+       4,       4,       4,       9,
+      10,       0,     243,     241,
+     247,       1,       6,       0,
+     245,     242,     248,       2,
+       9,       4,     250,     252,
+       8,      17,      18,       7,
+     248,     244,     250,       0,
+       1,     255,     252,     248,
+     247,     247,     249,       2,
+       8,       1,     253,       3,
+       6,       9,      12,       8,
+     254,     246,     246,     253,
+       7,       8,       1,     246,
+     238,     242,       0,      11,
+       8,     252,     249,       3,
+       9,       7,       3,       3,
+       1,     252,     249,     250,
+       0,       4,       2,     253,
+     245,     247,       2,       6,
+       1,     255,       1,       3,
+       6,       5,       0,     252,
+     255,       1,       0,     252,
+     250,     251,     254,     251,
+     249,     254,       4,       3,
+     255,       2,       6,       6,
+       4,       0,     255,     255,
+     252,     253,       2,       3,
+     251,     242,     243,     251,
+       4,       3,     254,     255,
+       4,       6,       5,       8,
+       7,       2,     255,     255,
+     254,     254,     254,     253,
+     251,     248,     245,     249,
+     255,       1,     254,     255,
+       5,       9,       8,       5,
+       3,       3,       1,       1,
+       4,       4,     252,     244,
+     243,     247,     254,       2,
+     255,     250,     250,       0,
+       4,       5,       3,       3,
+       4,       3,       3,       3,
+       2,     255,     253,     251,
+     250,     249,     252,       0,
+     255,     253,     253,     255,
+       1,       3,       1,       0,
+       2,       3,       3,       3,
+       3,       2,     253,     249,
+     250,     255,       2,     255,
+     253,     254,       0,       1,
+       2,     255,     252,     254,
+       3,       2,       1,       0,
+     255,     254,     253,     255,
+       2,       2,     255,     253,
+     254,     255,       0,       2,
+       1,     253,     251,     254,
+       1,       3,       1,     254,
+     251,     252,       1,       3,
+       2,       1,       1,       0,
+     255,       0,       1,       2,
+     255,     253,     251,     253,
+       0,       1,       1,     254,
+     253,     252,     254,       0,
+       2,       4,       3,       2,
+       1,       0,       1,       1,
+     255,     252,     251,     253,
+       0,     255,     253,     253,
+     253,     254,       0,       2,
+       1,     255,       0,       2,
+       4,       4,       0,     252,
+     253,       0,       0,     255,
+     254,     254,     255,     255,
+     254,     253,       0,       3,
+       2,       0,     255,     255,
+       1,       2,       1,     255,
+     254,     255,       1,       1,
+     255,     253,     253,     255,
+       0,     255,     253,     253,
+     255,       2,       1,     255,
+     255,       1,       2,       0,
+     254,     255,       1,       2,
+       0,     253,     253,       0,
+       2,       1,     253,     250,
+     252,       1,       3,       2,
+     255,     252,     252,       0,
+       4,       4,       2,     255,
+     254,     255,       0,       0,
+       0,       1,     255,     252,
+     252,     254,       0,       0,
+     254,     254,     255,       1,
+       0,       0,       1,       2,
+       1,     255,     255,       0,
+       1,       0,     255,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     254,
+     254,       0,       2,       2,
+     255,     254,     255,       1,
+       2,       2,       0,     254,
+     253,     255,     255,     255,
+     254,     254,     254,     253,
+     255,       0,     255,     254,
+     255,       0,       0,       0,
+       0,       1,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     254,
+     255,     255,     255,     255,
+     255,     255,       0,       1,
+       2,       1,       0,     255,
+     255,       0,       0,       1,
+       1,     255,     254,     255,
+     255,     254,     254,     255,
+       0,     255,     254,     254,
+       1,       3,       1,     254,
+     253,     254,       1,       2,
+       1,     255,     254,     254,
+     255,       0,       0,     254,
+     254,     255,       0,       0,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+       0,       1,       1,       0,
+     254,     254,       0,       1,
+       0,     255,     255,       0,
+       0,     255,     255,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     254,     255,
+       0,       0,     255,     255,
+       0,       1,       0,     255,
+     255,       0,       0,       0,
+     255,     254,     255,       0,
+       1,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       1,
+       0,     255,     255,     255,
+       0,       1,       0,     255,
+     255,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     254,
+     255,       0,       1,       0,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     254,     255,       0,
+       0,       0,     255,     254,
+     255,       0,       0,       0,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+       0,     255,     255,     255,
+       0,       0,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+     255,     254,     255,       0,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+     255,       0,       0,     255,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,     255,     254,
+     255,       0,       0,     255,
+     254,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+     255,     255,     255,       0,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+     255,       0,       0,     255,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+     255,       0,       0,       0,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+     255,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,       0,     255,       0,
+       0,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+     255,     255,       0,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+       0,       0,       0,       0,
+     255,     255,       0,     255,
+       0,       0,       0,     255,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,     255,     255,     255,
+       0,       0,     255,       0,
+     255,     255,     255,     255,
+     255,     255,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     254,       0,       0,
+     254,       0,       0,     254,
+       0,       0,     254,       0,
+       0,     255,       0,       0,
+     254,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+     255,       0,     255,     255,
+     255,     255,       0,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       1,       0,     255,
+       0,       0,     255,       0,
+     255,       0,       0,       0,
+     255,     255,       1,     255,
+     255,       0,     255,       0,
+     255,     255,     255,       0,
+     255,     255,     255,     255,
+       0,     255,       0,       0,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,       0,     255,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     254,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     254,
+       0,       0,     255,     255,
+       0,     255,       0,       1,
+     254,     255,       1,     255,
+     255,       0,     255,     255,
+       1,     255,     255,       1,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,       0,       0,     254,
+       0,     255,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       1,       0,     254,       0,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+       1,     255,     255,       1,
+     254,       0,       0,     254,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     254,
+       1,       0,     254,       1,
+     255,     254,       1,       0,
+     255,       0,     255,     255,
+       1,     255,     254,       1,
+       0,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     254,       0,       0,
+     254,       0,       1,     255,
+     255,       0,     255,     255,
+       1,     255,     255,       0,
+     255,     254,       1,       0,
+     254,       1,     254,     255,
+       1,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       1,     255,     255,
+       1,     255,       0,       0,
+     255,     255,       0,       0,
+     254,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+       0,       0,       0,     255,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+       0,       0,     255,     255,
+     255,       0,     255,     255,
+       0,     254,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+     255,     255,       0,     255,
+     255,     255,       0,       0,
+     255,       0,       0,       0,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+     255,       0,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,       1,
+     254,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+     255,     255,       1,     255,
+     255,       0,     255,       0,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+     255,     255,       0,       0,
+     255,       0,       0,       0,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+       1,     255,       0,       0,
+     255,       0,     255,       0,
+     255,       0,       0,     255,
+     255,       0,       0,     255,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+       0,     255,     255,     255,
+       0,     255,     255,       1,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+       0,     255,       0,       0,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,     255,
+       0,       1,       1,       0,
+       1,       2,       0,       0,
+       0,     255,     254,     254,
+     252,     249,     250,     249,
+     248,     251,       1,       5,
+       8,      13,      16,      12,
+       7,       3,     251,     245,
+     244,     242,     244,     244,
+     247,     253,     255,     253,
+       0,      18,      23,      14,
+      14,      11,     253,     243,
+     248,     243,     239,     244,
+     249,     253,       3,      10,
+       9,       7,       1,     250,
+     242,     243,       6,      14,
+      13,      14,      12,     253,
+     242,     244,     236,     233,
+     242,     253,       8,      17,
+      23,      25,      18,       4,
+     254,     247,     231,     219,
+     238,      12,      15,      13,
+      18,       7,     239,     237,
+     244,     239,     245,       4,
+      17,      22,      23,      25,
+      13,     254,     248,     244,
+     236,     228,     221,     218,
+     252,      32,      30,      27,
+      26,       3,     235,     239,
+     245,     240,     247,     254,
+       4,      16,      18,      17,
+      15,       5,     253,     254,
+     246,     230,     225,     224,
+     250,      31,      31,      19,
+      19,     254,     227,     236,
+     251,     246,     250,       2,
+       3,      12,      12,      12,
+      16,      13,       3,       1,
+     252,     233,     220,     217,
+     245,      30,      29,      15,
+      17,     253,     225,     239,
+       3,     250,     251,     255,
+     252,       5,      12,      21,
+      33,      25,       4,     247,
+     236,     217,     211,     218,
+     255,      47,      42,      17,
+      12,     244,     220,     237,
+       0,     250,     250,     252,
+     254,      10,      18,      30,
+      40,      21,     250,     235,
+     222,     213,     217,     228,
+      20,      65,      39,       1,
+     251,     227,     210,     243,
+      14,       8,       2,     252,
+     243,     252,      24,      46,
+      45,      23,     246,     217,
+     214,     224,     229,     235,
+      19,      60,      31,     240,
+     239,     234,     221,     252,
+      29,      20,     253,     237,
+     237,     255,      28,      57,
+      57,      11,     224,     209,
+     214,     230,     244,     243,
+     255,      40,      39,     250,
+     239,     249,     236,     242,
+      17,      23,     252,     226,
+     231,       3,      26,      50,
+      57,      10,     212,     211,
+     234,     251,       3,     252,
+     238,       4,      37,      12,
+     237,     248,     250,     236,
+     254,      25,      10,     233,
+     230,      11,      31,      25,
+      42,      28,     216,     211,
+       3,       9,     248,     246,
+     232,     217,       9,      51,
+      18,     243,     246,     240,
+     231,       5,      31,       4,
+     231,     240,      20,      33,
+      17,      28,       5,     209,
+     231,      25,      19,     242,
+     235,     218,     206,      16,
+      67,      30,     244,     228,
+     220,     231,      18,      43,
+      16,     241,     233,     255,
+      29,      26,      20,       5,
+     232,     240,      24,      27,
+     236,     207,     201,     204,
+      16,      82,      49,     237,
+     209,     221,     247,      28,
+      48,      16,     232,     219,
+     249,      39,      31,      11,
+       5,     235,     238,      24,
+      32,     231,     201,     217,
+     212,     248,      82,      74,
+     234,     190,     223,       1,
+      23,      46,      32,     240,
+     212,     235,      30,      40,
+      12,     255,     245,     242,
+      11,      20,     239,     207,
+     221,     228,     234,      52,
+      86,       7,     190,     207,
+     253,      18,      38,      40,
+       0,     218,     221,      13,
+      49,      25,     254,     252,
+     245,     243,       5,       5,
+     228,     223,     248,     237,
+     247,      57,      51,     222,
+     190,     242,      27,      22,
+      29,      24,     242,     210,
+     236,      47,      44,       2,
+     254,     247,     226,     243,
+      15,     254,     232,     245,
+     250,     218,     252,      67,
+      28,     205,     219,      17,
+      16,      13,      32,      12,
+     226,     221,      16,      44,
+      15,     251,     247,     238,
+     239,       8,      15,     251,
+     241,     246,     223,     204,
+      23,      75,      11,     209,
+     236,      16,       8,      21,
+      35,       7,     223,     226,
+      23,      36,     254,     240,
+     243,     237,     248,      18,
+      20,     251,     232,     231,
+     212,     228,      58,      71,
+     247,     202,     244,      12,
+       7,      32,      37,     251,
+     211,     241,      33,      16,
+     238,     241,     250,     250,
+      11,      26,       6,     230,
+     224,     228,     212,      11,
+      90,      48,     210,     204,
+       0,       7,      20,      47,
+      25,     226,     204,       3,
+      37,       3,     238,     250,
+     255,     255,      15,      12,
+     241,     223,     234,     232,
+     237,      57,      78,     251,
+     183,     218,      11,      23,
+      43,      39,     251,     202,
+     218,      20,      26,     255,
+     249,       3,     253,     254,
+      15,       7,     240,     229,
+     237,     224,     252,      71,
+      54,     219,     192,     254,
+      29,      29,      36,      16,
+     221,     192,     242,      38,
+      24,     255,       0,     254,
+     245,       3,      15,       0,
+     234,     235,     235,     223,
+      24,      76,      17,     197,
+     218,      16,      20,      27,
+      29,     249,     201,     214,
+      21,      39,      13,     255,
+       1,     246,     248,      11,
+      10,     246,     233,     239,
+     223,     241,      60,      58,
+     233,     202,     249,      15,
+      16,      27,      14,     229,
+     211,     253,      37,      25,
+       4,     253,     241,     237,
+       1,      11,       2,     240,
+     239,     236,     225,      24,
+      68,      16,     208,     224,
+       6,      10,      21,      28,
+       3,     220,     230,      19,
+      28,       7,     255,     247,
+     235,     249,      13,      12,
+     251,     240,     240,     219,
+     242,      57,      53,     235,
+     206,     243,       4,      12,
+      32,      23,     238,     219,
+     250,      23,      16,       2,
+     254,     242,     243,       4,
+      12,       2,     243,     240,
+     222,     235,      43,      53,
+     253,     216,     237,     255,
+      11,      30,      29,     252,
+     224,     241,      12,      14,
+       5,       4,     248,     241,
+     254,       8,       5,     245,
+     241,     230,     233,      33,
+      46,       1,     224,     240,
+     250,       0,      27,      31,
+       5,     229,     232,       6,
+      15,      10,      10,     250,
+     235,     250,       9,     253,
+     242,     249,     234,     235,
+      37,      43,     246,     225,
+     251,       0,     252,      20,
+      27,       3,     234,     243,
+       9,       8,       8,      15,
+     251,     233,     252,       8,
+     243,     234,     255,     244,
+     242,      38,      35,     232,
+     221,       8,      11,     252,
+      12,      18,     255,     239,
+     249,       8,       4,       7,
+      17,     252,     232,     251,
+      13,     239,     225,     253,
+     249,       7,      37,      12,
+     221,     229,      16,      16,
+       9,       8,       2,     247,
+     246,      10,      15,     255,
+       6,      12,     247,     234,
+       0,      12,     229,     219,
+     243,      21,      49,      14,
+     223,     222,       0,      14,
+      17,      22,       0,     234,
+     238,      11,      32,      12,
+     247,       2,       0,     239,
+     245,      10,     250,     220,
+     215,       2,      64,      37,
+     223,     212,     254,      10,
+       7,      24,      18,     243,
+     225,     252,      36,      29,
+     255,     248,     252,     248,
+     249,       3,     248,     228,
+     218,     251,      52,      34,
+     233,     220,     249,       7,
+      13,      21,      10,     245,
+     230,     250,      32,      32,
+       7,     247,     242,     241,
+       1,       8,     246,     225,
+     219,      19,      51,     254,
+     214,     247,      14,     253,
+       8,      19,       3,     236,
+     237,      11,      37,      25,
+       0,     248,     240,     242,
+       0,       1,     248,     221,
+     248,      48,      19,     215,
+     220,       6,      14,      24,
+      22,     246,     224,     233,
+      10,      37,      31,      10,
+     253,     239,     239,       0,
+       1,     246,     229,       1,
+      41,      10,     214,     222,
+       8,       6,      12,      31,
+      13,     226,     210,     247,
+      40,      47,      21,     251,
+     233,     240,     254,     254,
+     251,     239,      13,      38,
+     255,     214,     219,     248,
+      12,      33,      29,     252,
+     220,     214,     252,      38,
+      32,      19,      10,     239,
+     231,     244,       0,     244,
+       3,      51,      25,     215,
+     208,     247,     247,     254,
+      40,      36,     247,     216,
+     225,     253,      22,      38,
+      27,     242,     232,       1,
+       9,     234,     229,      40,
+      55,     249,     212,     232,
+     242,     242,      24,      37,
+     252,     222,     238,       7,
+      10,      14,      18,     247,
+     234,     252,      20,       0,
+     235,      24,      33,     246,
+     224,     245,     252,     247,
+      19,      24,     243,     220,
+     238,       6,       7,      20,
+      28,     253,     220,     230,
+       9,      11,      23,      43,
+       9,     218,     226,     253,
+     247,       5,      33,      16,
+     233,     226,     243,       0,
+      11,      16,       4,     241,
+     241,       4,       2,       7,
+      33,      26,     238,     223,
+     254,       2,       2,      18,
+       3,     234,     241,     254,
+     255,      11,      11,     246,
+     228,     229,     252,      17,
+      39,      43,       9,     225,
+     220,     245,       5,      25,
+      25,     252,     235,     234,
+     240,       5,      23,      13,
+     251,     235,     229,     238,
+       9,      35,      36,      12,
+     239,     228,     234,       4,
+      26,      22,       8,     234,
+     217,     244,      21,      20,
+       6,     248,     227,     235,
+      25,      37,       6,     248,
+     248,     239,     236,       4,
+      22,      11,     247,     244,
+     246,     244,       0,      11,
+       9,     255,     250,      11,
+      25,      12,     253,     246,
+     237,     237,     253,       2,
+     254,       3,     255,     240,
+     238,     249,       4,      12,
+      23,      34,      25,       1,
+     244,     243,     239,     241,
+     252,       1,     254,     248,
+     240,     243,     248,     253,
+       9,      23,      30,      27,
+      15,     250,     236,     237,
+     245,     252,     250,     244,
+     243,     248,     251,     250,
+       0,      18,      27,      25,
+      24,      12,     246,     235,
+     240,     245,     245,     247,
+     245,     241,     243,     243,
+     250,      14,      29,      31,
+      27,      19,       6,     247,
+     237,     238,     247,     254,
+     253,     242,     235,     239,
+     245,       1,      17,      22,
+      20,      17,      11,     254,
+     244,     250,     254,     245,
+     242,     246,     250,     249,
+     251,       8,      13,       7,
+       7,      10,      11,      12,
+      10,     252,     238,     235,
+     239,     240,     248,     255,
+     253,     255,       7,       7,
+       4,      14,      23,      15,
+       3,       1,     253,     241,
+     239,     248,     250,     244,
+     244,     249,     255,       3,
+       5,       6,       8,      10,
+      10,       9,       4,       1,
+     255,     250,     245,     246,
+     250,     250,     249,     252,
+       0,       0,       4,       9,
+       9,       5,       2,       1,
+     254,     250,     252,       2,
+       2,     250,     244,     243,
+     249,       5,      13,      13,
+       7,       1,     252,     251,
+     254,       1,       4,       3,
+     253,     246,     242,     248,
+       4,      10,       7,       1,
+     252,     250,     251,     255,
+       3,       5,       1,     254,
+     254,       1,       2,       0,
+     252,     255,       4,       4,
+     255,     250,     251,     251,
+     251,     254,       2,       3,
+       1,       0,       0,       2,
+       2,     253,     254,       5,
+       6,       2,     253,     251,
+     252,     253,       0,       1,
+     254,     253,     255,     254,
+     253,       1,       5,       4,
+       3,       1,     252,     248,
+     249,     255,       3,       4,
+       4,     255,     252,     252,
+     254,       4,       5,       3,
+       1,     254,     252,     252,
+     253,     252,     254,       3,
+       3,     254,     253,     254,
+     254,       2,       6,       7,
+       5,       0,     252,     252,
+       0,     255,     252,     253,
+     253,     251,     252,     254,
+       0,       1,       5,       7,
+       6,       4,       1,     253,
+     251,     252,     253,     254,
+     255,     255,     254,     253,
+     250,     250,     255,       6,
+       9,       8,       6,       1,
+     251,     248,     252,       2,
+       4,       1,     253,     250,
+     248,     251,     255,       2,
+       5,       7,       6,       0,
+     253,     255,     254,     253,
+     254,     255,       1,       1,
+     254,     253,     253,       0,
+       1,       2,       1,       0,
+       1,       2,       0,     252,
+     251,     253,       0,     255,
+     255,     255,     254,     254,
+       2,       6,       6,       3,
+       1,     255,     252,     253,
+     254,     254,     254,     254,
+     253,     251,     251,     255,
+       3,       3,       1,       2,
+       1,       0,       0,       2,
+       5,       4,       0,     251,
+     250,     252,     253,     254,
+     255,       1,       2,       3,
+       1,     253,     252,     253,
+     254,       0,       2,       3,
+       1,     255,     253,     253,
+     255,       2,       3,       5,
+       4,     254,     251,     254,
+     255,     253,     254,       1,
+       1,     255,     253,     252,
+     253,       0,       3,       4,
+       4,       3,       1,     253,
+     251,     252,     255,       1,
+       2,       0,     253,     251,
+     252,     254,       1,       4,
+       3,       0,     255,       0,
+     255,     253,     255,       0,
+     255,     255,       1,       1,
+       0,       1,       2,       0,
+     254,     254,     255,       0,
+       2,       2,     255,     252,
+     251,     253,     255,       1,
+       2,       2,     255,       0,
+       1,       1,       1,       1,
+     255,     253,     253,       0,
+     255,     255,     255,     254,
+     254,     254,       0,       1,
+       1,       1,       1,       0,
+     255,       0,       0,     254,
+     254,     254,     254,     253,
+     253,     255,       1,       1,
+       0,       1,       1,       0,
+       2,       2,       1,       0,
+     255,     254,     254,     254,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       1,       2,       1,
+     254,     254,     254,     254,
+     254,       1,       1,       0,
+       0,       1,       0,     255,
+       0,       1,       0,     255,
+     255,     255,     253,     252,
+     254,       0,     255,     255,
+       0,       2,       1,       1,
+       0,     255,       0,       2,
+       2,       1,       0,     254,
+     251,     251,     254,       0,
+       0,       2,       1,     254,
+     253,       0,       1,       1,
+       0,       1,       1,       0,
+     255,     254,     253,     254,
+       0,       0,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+       1,     255,     254,     254,
+     254,     255,       0,       2,
+       2,       0,     254,     255,
+       0,       1,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       1,
+       2,       2,       0,     254,
+     254,     255,       0,       0,
+       0,     255,     255,     254,
+     253,     254,     255,       1,
+       2,       0,     255,     254,
+     254,     255,       0,       0,
+       1,       1,       0,     254,
+     254,     255,       0,       0,
+       0,     255,     255,       0,
+     255,     254,     255,       0,
+       0,     255,       0,       0,
+       0,       0,       0,     255,
+     255,       0,       1,       0,
+     254,     254,     255,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+     255,     254,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       1,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+       0,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+     254,     255,       0,       0,
+       0,       1,       0,     255,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,       0,       0,     255,
+       0,     255,     255,       0,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+     255,     255,     255,       0,
+       0,       0,       1,     254,
+       3,       3,     251,     255,
+     254,     254,     255,     255,
+     255,     255,     255,       0,
+       2,       6,       3,     253,
+     253,     252,     254,     255,
+     254,     254,     255,       1,
+     255,       3,       4,       1,
+       2,     255,     252,     254,
+     254,     254,     254,     254,
+     255,       1,       0,     255,
+       2,       1,     254,     255,
+       0,     255,       0,     255,
+     255,       0,       1,     255,
+       0,       0,     255,     255,
+     255,     254,     255,       0,
+     255,     255,     255,     255,
+       0,       0,     255,       0,
+       1,       0,     255,     254,
+     255,     255,     255,       0,
+       0,       1,       0,     255,
+     255,       0,       0,     255,
+     255,       0,     255,     254,
+     255,     255,     255,       0,
+       0,       1,       0,       0,
+       1,     255,       0,       0,
+     254,     254,     255,     255,
+     255,       0,       0,     255,
+       0,       1,       0,       0,
+     255,     255,     254,     254,
+     255,     255,       0,       0,
+       1,       1,       0,       1,
+     255,     255,     255,     254,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,       0,     255,
+     255,       0,       1,       0,
+       0,       0,     255,       0,
+       0,     254,     255,       0,
+     255,       0,       1,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+       0,     255,       0,       0,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+       0,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+       0,       0,     255,     254,
+       1,       0,     254,       0,
+       0,     255,       0,       0,
+     254,     255,       0,     255,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+     254,     255,       0,     255,
+     255,       0,       0,     255,
+       1,     255,     255,       1,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,     255,     254,       0,
+     255,     255,       1,     255,
+     254,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     254,       0,     255,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+     255,     255,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+       0,       0,     255,     255,
+       0,     255,       0,       0,
+       0,     255,       0,     255,
+       0,       0,     255,     255,
+     255,     255,     255,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,     255,     255,
+       0,     255,     255,     255,
+     255,     255,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,     255,
+       0,     255,       0,       0,
+     255,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,       0,     255,
+     255,     255,     255,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,       0,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,       0,
+     255,       0,     255,       0,
+     255,     255,     255,       0,
+     255,     255,       0,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,     255,     255,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,       0,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,       0,       0,     255,
+     255,     255,       0,       0,
+     255,       0,       0,       0,
+       0,     255,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,     255,       0,       0,
+       0,       0,       0,     255,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,       0,       0,
+       0,     255,       0,     255,
+     255,     254,       3,      11,
+     250,     244,       7,       9,
+     243,     243,       4,       4,
+     251,     250,       0,       6,
+     253,     248,       2,       2,
+      18,      18,     233,     222,
+       6,      32,       7,     247,
+     252,       3,       1,     251,
+       6,      11,     250,     247,
+     250,     248,     247,     255,
+     245,     227,      27,      68,
+       9,     187,     211,      29,
+      40,       7,     241,     247,
+     243,     235,       8,      46,
+      29,     241,     232,       0,
+      10,       5,       4,     251,
+     234,     234,     242,     250,
+     246,     238,      32,      60,
+       4,     193,     216,      23,
+      37,      17,     250,     249,
+     241,     232,       7,      43,
+      30,     251,     237,     249,
+       2,       8,       7,     249,
+     233,     224,     247,     240,
+      18,      67,      14,     213,
+     215,     253,      10,      38,
+      19,     230,     235,     246,
+       1,      10,      17,      34,
+      19,     225,     225,      13,
+      18,     248,     242,     244,
+     227,     223,     230,      33,
+      92,      13,     206,     220,
+     249,      17,      43,      33,
+     222,     205,     239,      28,
+      28,       0,      20,      23,
+     231,     226,      13,      25,
+     249,     233,     227,     230,
+     222,     252,      71,      43,
+     250,     224,     213,     238,
+      49,      71,     249,     194,
+     211,      19,      36,     253,
+      10,      38,     253,     218,
+     248,      20,       9,     247,
+     236,     220,     224,     244,
+      19,      61,      28,     235,
+     221,     229,      18,      52,
+      18,     218,     236,       3,
+     238,     252,      42,      42,
+     248,     221,       2,      21,
+     249,     246,       5,     238,
+     207,     229,       3,      27,
+      46,      26,     229,     202,
+     250,      47,      34,     245,
+     230,     243,     247,     255,
+      21,      22,      11,       3,
+     248,     249,     254,       3,
+       0,     240,     224,     228,
+     241,       0,      43,      47,
+     255,     218,     228,       8,
+      28,      20,     254,     243,
+     228,     234,      21,      41,
+       9,     246,       3,       8,
+       2,     249,     250,     249,
+     236,     234,     240,     242,
+     255,      35,      41,     255,
+     221,     236,      20,      33,
+       9,     235,     234,     251,
+       3,       9,      18,      18,
+       3,     241,     255,      16,
+       3,     238,     229,     237,
+     243,     239,     248,      24,
+      36,       8,     228,     230,
+      11,      31,      12,     246,
+     239,     241,     250,       8,
+      19,      17,       8,       1,
+       2,       7,       2,     243,
+     241,     241,     241,     234,
+     238,      17,      36,      21,
+     240,     225,     255,      31,
+      19,     251,     244,     237,
+     243,      10,      25,      15,
+       1,     254,       4,       6,
+       2,     252,     242,     232,
+     238,     241,     235,       7,
+      39,      20,     237,     230,
+     255,      18,      13,       6,
+       0,     238,     236,       7,
+      21,      12,       4,       4,
+       2,       4,       6,     255,
+     238,     232,     240,     246,
+     243,       4,      32,      20,
+     240,     235,     253,       9,
+      19,      13,     254,     241,
+     242,       2,      12,      15,
+      14,       7,     252,     248,
+       3,       7,     246,     227,
+     231,     245,     252,       9,
+      26,      16,     240,     236,
+     253,       8,      15,      16,
+     253,     233,     241,       5,
+      13,      11,      11,       7,
+     254,     253,       6,       3,
+     240,     227,     231,     241,
+     251,      17,      24,      17,
+       0,     244,     240,     245,
+      15,      41,      25,     224,
+     211,     252,      29,      27,
+      10,     254,     247,     253,
+       6,     255,     240,     233,
+     234,     233,     253,      34,
+      34,     248,     221,     244,
+      20,      23,       6,     253,
+     251,     247,     248,       4,
+      10,       6,       3,       1,
+       0,       5,       6,     248,
+     232,     230,     238,     246,
+      16,      33,      12,     238,
+     237,       0,      10,      15,
+      17,       6,     238,     237,
+       9,      20,       8,     251,
+     250,     251,       3,      14,
+       7,     243,     230,     229,
+     233,       0,      36,      36,
+     249,     220,     239,       9,
+      16,      13,      10,     255,
+     238,     241,       9,      24,
+      10,     247,     244,     252,
+       8,       9,     253,     241,
+     236,     235,     237,      10,
+      40,      25,     239,     223,
+     248,      17,      22,      14,
+       2,     241,     232,     252,
+      20,      25,       8,     246,
+     239,     250,       9,       8,
+     251,     235,     231,     237,
+       0,      27,      31,       0,
+     230,     239,       6,      17,
+      16,      12,     254,     231,
+     234,       6,      24,      17,
+       1,     243,     243,     255,
+       7,       1,     242,     233,
+     236,     249,      20,      33,
+       8,     235,     235,     255,
+      17,      24,      16,     251,
+     233,     238,       5,      15,
+      11,       6,     251,     244,
+     253,       6,       2,     247,
+     235,     232,     241,      19,
+      41,      17,     232,     226,
+     252,      15,      21,      18,
+       7,     241,     232,     250,
+      15,      19,       6,     247,
+     240,     250,       5,       3,
+     246,     238,     237,     241,
+      12,      33,      21,     246,
+     234,     243,       2,      18,
+      24,      15,     247,     234,
+     249,      11,      15,       9,
+     249,     236,     244,       3,
+       3,     245,     236,     236,
+     246,      16,      31,      15,
+     243,     237,     250,       5,
+      11,      17,      13,     251,
+     242,     255,      10,       9,
+       5,     254,     245,     243,
+     249,     252,     245,     242,
+     243,     255,      25,      26,
+     252,     234,     250,       8,
+       8,       9,      10,       2,
+     249,       0,      11,      10,
+       1,     255,     249,     244,
+     248,     252,     242,     231,
+     236,     251,      23,      37,
+       8,     230,     233,       3,
+      15,      15,      10,     255,
+     243,     250,      16,      21,
+       5,     255,     255,     246,
+     240,     250,       0,     237,
+     222,     233,      12,      43,
+      26,     241,     228,     248,
+       9,      15,      18,      10,
+     244,     234,       4,      34,
+      22,     249,     246,     255,
+     252,     243,     246,     242,
+     232,     227,     250,      37,
+      37,     248,     222,     244,
+      11,      14,      16,      14,
+     254,     235,     248,      27,
+      32,       8,     248,     248,
+     247,     245,     249,     246,
+     233,     223,     243,      35,
+      39,     250,     223,     243,
+       7,      10,      14,      14,
+       1,     240,     249,      23,
+      31,      11,     251,     251,
+     248,     244,     247,     244,
+     235,     223,     246,      37,
+      31,     238,     226,       1,
+      12,       6,       8,       7,
+     249,     239,       4,      34,
+      30,       6,     248,     249,
+     249,     250,     250,     245,
+     232,     220,       2,      39,
+      13,     226,     232,       9,
+      17,      14,       6,     248,
+     237,     246,      20,      36,
+      23,       2,     249,     247,
+     248,     251,     250,     246,
+     231,     239,      25,      23,
+     233,     221,     255,      14,
+      13,      15,       3,     235,
+     227,       4,      41,      36,
+       9,     252,     248,     242,
+     247,     254,       0,     236,
+     231,      18,      32,     240,
+     209,     244,      16,      17,
+      22,       9,     230,     215,
+     249,      36,      44,      23,
+       4,     245,     236,     247,
+     253,     255,     246,     248,
+      22,      19,     234,     208,
+     236,      10,      25,      34,
+      12,     228,     207,     236,
+      28,      44,      27,       8,
+     249,     241,     244,     246,
+     248,     245,      12,      43,
+      14,     220,     210,     236,
+     253,      22,      42,      17,
+     228,     215,     242,      17,
+      28,      25,      13,     249,
+     245,     251,     251,     234,
+     239,      38,      48,     248,
+     209,     228,     245,     252,
+      29,      28,     239,     216,
+     242,      17,      20,      15,
+       7,     246,     241,       3,
+      18,     254,     225,       8,
+      45,      11,     224,     233,
+     250,     246,      17,      30,
+     246,     212,     232,      15,
+      22,      17,      20,     252,
+     228,     241,      16,      14,
+     239,      12,      40,       2,
+     221,     236,     251,     247,
+      22,      32,     247,     215,
+     228,       2,      12,      14,
+      14,     255,     239,     243,
+       8,       2,       5,      39,
+      26,     233,     224,     251,
+     250,     255,      21,      10,
+     236,     232,     253,       7,
+       6,       4,     249,     235,
+     239,      13,      19,       0,
+      22,      33,     246,     222,
+     252,       5,     255,      18,
+      13,     234,     225,     250,
+      12,      18,      13,     248,
+     224,     219,     246,      17,
+      20,      40,      36,     241,
+     212,     237,       7,      24,
+      34,       3,     222,     225,
+     250,      15,      25,      15,
+     246,     228,     230,     247,
+     252,       4,      43,      37,
+     243,     219,     236,     253,
+      23,      35,      10,     229,
+     217,     243,      24,      34,
+      11,     243,     228,     228,
+     251,      10,      27,      34,
+       1,     235,     228,     243,
+      11,      27,      15,     244,
+     230,     228,       1,      24,
+      16,     255,     244,     237,
+     244,       0,      28,      45,
+       3,     231,     240,     244,
+     243,      12,      31,       2,
+     227,     226,     249,      17,
+      16,       4,     255,     235,
+     228,     255,      48,      55,
+       1,     233,     235,     240,
+     248,      20,      30,     252,
+     228,     229,     244,       0,
+       7,      11,     255,     246,
+     237,       3,      45,      27,
+     252,     243,     243,     237,
+       0,      25,      11,     245,
+     236,     241,     253,       2,
+       4,       0,     244,     237,
+       8,      47,      24,     253,
+     244,     233,     228,       0,
+      26,      11,       3,     247,
+     237,     239,     251,      10,
+      17,       8,     240,       2,
+      38,      15,     250,     253,
+     241,     220,     248,      18,
+     251,     250,       0,     246,
+     239,       1,       6,       1,
+       2,      14,      41,      25,
+     255,     251,     243,     225,
+     241,      13,     246,     241,
+     253,     244,     235,     252,
+      11,       5,       5,       4,
+      23,      41,      22,       9,
+     250,     231,     231,     252,
+       2,     251,     251,     237,
+     228,     242,     255,       3,
+      15,      10,      18,      32,
+      18,       7,     253,     247,
+     237,     245,     253,     247,
+     250,     242,     235,     246,
+     254,       0,       8,      15,
+      30,      32,      15,     249,
+     239,     241,     245,       5,
+       7,     255,     240,     222,
+     233,     250,       4,      18,
+      18,      18,      23,      22,
+       9,     247,     243,     244,
+     252,     254,     249,     240,
+     228,     239,     254,       1,
+       7,      11,      16,      27,
+      34,      17,     247,     235,
+     232,     246,       6,       2,
+     247,     231,     232,     244,
+     249,       9,      18,      26,
+      30,      18,       2,     250,
+     253,     247,     245,     248,
+     247,     242,     233,     243,
+     251,     250,       3,      13,
+      26,      34,      32,      14,
+     250,     235,     235,     249,
+     250,     249,     244,     234,
+     237,     245,       0,       7,
+      11,      20,      27,      23,
+      14,      10,     248,     237,
+     242,     246,     246,     242,
+     243,     240,     242,     252,
+       4,      14,      23,      24,
+      18,      12,       2,     251,
+     250,     246,     245,     243,
+     242,     241,     243,     253,
+       3,       6,       7,       9,
+      15,      17,      10,       2,
+       0,     249,     246,     251,
+     250,     246,     248,     251,
+     253,     255,     255,       2,
+       4,       9,      12,      11,
+       5,     252,     247,     244,
+     250,     254,     252,     254,
+     253,     252,       2,       4,
+       3,       3,       4,       4,
+       1,       1,       2,       1,
+     253,     249,     246,     243,
+     249,       2,       4,       1,
+       1,       1,       4,       7,
+       6,       6,       3,       1,
+       1,     254,     247,     247,
+     252,     252,     255,     254,
+     250,     254,       1,       1,
+       0,       1,       2,       3,
+       5,       5,       4,     255,
+     252,     255,     255,     254,
+       0,     254,     250,     249,
+     252,     253,     254,       1,
+       1,       0,       1,       0,
+       0,       1,       2,       5,
+       8,       7,       1,     250,
+     247,     249,     252,     254,
+       0,     254,     254,       0,
+       1,       1,       1,       0,
+       1,       1,       3,       2,
+     255,     253,     254,     252,
+     251,     252,     255,       1,
+       3,       3,       1,     255,
+       0,       2,       1,     255,
+     255,     255,     253,     251,
+     252,     255,     255,     255,
+     254,       1,       6,       6,
+       5,       2,     255,     253,
+     255,       1,       1,     252,
+     249,     249,     253,     254,
+     255,     254,     252,       2,
+       8,       7,       4,       2,
+       0,     251,     252,       0,
+       0,       0,       0,     253,
+     246,     247,     252,       1,
+       5,       9,       8,       2,
+     254,     254,     254,     254,
+       0,       2,     255,     252,
+     253,     252,     251,     254,
+       1,     255,       1,       6,
+       7,       3,       0,     254,
+     251,     252,     254,       1,
+       1,     255,     251,     251,
+     252,       0,       4,       6,
+       4,       0,       0,     255,
+     253,     253,       0,       0,
+     255,     253,     254,     254,
+     255,     255,     255,       1,
+       1,       1,       3,       4,
+       1,     254,     253,     253,
+     253,     253,     254,       0,
+       0,       0,       1,       0,
+     254,     253,       0,       2,
+       3,       4,       3,     255,
+     252,     253,     253,     253,
+     255,       2,       3,       3,
+       1,     254,     251,     251,
+     253,       1,       2,       2,
+       1,       0,     254,     253,
+     254,     254,       0,       3,
+       4,       2,       0,     254,
+     252,     251,     254,       1,
+       2,       0,       0,     254,
+     250,     251,     255,       3,
+       4,       5,       3,     255,
+     253,     253,     254,     255,
+       0,       0,       0,     255,
+     254,     253,     253,     255,
+       1,       1,       1,       3,
+       3,     255,     253,     252,
+     253,     254,       1,       3,
+       1,     254,     252,     254,
+       0,       1,       2,       1,
+       0,     255,     255,     254,
+     254,     255,     255,     255,
+     254,     255,       1,       1,
+       0,       1,       1,       0,
+       1,       0,     255,     255,
+     255,     254,     254,     254,
+     254,     254,     255,       1,
+       1,       1,       1,       0,
+     255,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     254,
+     255,       1,       1,       1,
+       2,       1,     255,     255,
+     254,     253,     252,     254,
+       1,       1,       0,     254,
+     255,       0,       1,       1,
+       0,       1,       2,       1,
+       0,     254,     252,     252,
+     252,     254,       0,       1,
+       0,       0,     255,       0,
+       1,       2,       2,       3,
+       2,     255,     254,     253,
+     253,     253,     253,     254,
+     255,       0,     255,     255,
+     255,       0,       0,       2,
+       3,       3,       2,       0,
+     255,     253,     251,     252,
+     255,       0,       0,       1,
+     255,     254,     255,       0,
+       1,       2,       2,       2,
+       1,     255,     253,     253,
+     253,     254,     255,       1,
+       1,       0,     255,     254,
+     254,     255,       1,       2,
+       2,       0,     255,     254,
+     253,     253,     254,     255,
+       0,       1,       1,       0,
+     255,     254,     255,       0,
+       2,       1,       0,     255,
+       0,     255,     254,     255,
+     255,     254,     255,       0,
+       1,       0,       0,     255,
+     255,       0,       0,       2,
+     255,       4,       2,     249,
+       1,     252,       0,     255,
+       2,       5,     249,     254,
+     254,       1,       1,     254,
+       1,     254,       0,     254,
+       0,     255,     252,       0,
+     255,     255,       1,       2,
+     255,       0,     255,     255,
+       1,     255,       0,     255,
+     255,       0,       0,       1,
+     255,       0,     255,     255,
+       1,       0,       2,     254,
+     254,       0,     254,       0,
+       1,       2,       0,     254,
+       1,     255,     255,     254,
+     253,       0,     253,     255,
+       1,     255,     255,     255,
+       0,     253,       3,     255,
+     255,       3,     250,     255,
+       1,       0,     254,       2,
+     255,     254,       3,     255,
+       1,       1,     255,     255,
+     255,       0,     255,       2,
+     255,     254,       1,       0,
+       0,     255,       2,     254,
+       1,       0,     255,       1,
+     255,       0,     255,       1,
+     254,       0,       1,     253,
+     255,     254,     254,     255,
+       0,     255,     255,     255,
+     255,     255,       2,       0,
+       0,       0,     255,     254,
+     255,     254,     254,       0,
+     254,     255,       0,     255,
+       1,       2,       0,     255,
+       0,     255,       1,       1,
+       0,     255,     255,     255,
+       0,       0,       1,       1,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,       0,     255,
+     255,       0,     254,     254,
+       0,     254,       0,       1,
+     255,     255,       1,     254,
+     255,       0,     254,       0,
+     255,     255,       0,     255,
+     254,       0,       0,     255,
+       0,       0,       0,       0,
+       1,     255,     255,     255,
+     255,       0,       0,       1,
+       0,     254,     254,       0,
+       0,       0,       1,       0,
+     255,     254,     255,       1,
+     254,       1,       0,     253,
+       0,       0,     254,       0,
+     255,     255,       2,     255,
+     255,       0,     255,     255,
+       1,       0,     255,       0,
+     254,     255,       0,     255,
+       1,       0,     254,       0,
+     255,     254,       2,       0,
+     254,       0,     254,     255,
+       0,     255,       1,       1,
+     254,     255,       1,     253,
+       0,       2,     255,       0,
+     255,     255,       0,     255,
+     255,       1,       0,     255,
+       1,       0,     255,     255,
+       0,     255,     255,       0,
+       0,       0,     254,     255,
+       1,     254,       0,       1,
+     255,       1,     255,     254,
+       0,     255,       0,       1,
+       0,     255,       0,     254,
+     254,       0,     255,       1,
+       1,     255,       0,     255,
+     254,       0,       1,     254,
+       1,       1,     254,       1,
+       0,     254,       0,       0,
+     254,       0,     255,     255,
+       0,       0,     255,     255,
+     255,     254,       1,       0,
+     255,       1,     254,     254,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+     255,       0,     255,       0,
+       1,     254,       0,       0,
+     255,       0,     255,       0,
+       0,       0,       1,       0,
+     254,     254,     254,     254,
+       0,       1,       0,       0,
+     255,     254,       0,     255,
+     255,       0,     255,     255,
+       0,       0,     255,     255,
+       0,     255,     255,       0,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,       0,     255,
+       0,       0,     255,     255,
+     255,       0,       0,       0,
+       0,     255,       0,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,     255,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,       0,
+     255,       0,       0,     255,
+       0,     255,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,       0,
+       0,     255,       0,       0,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+       0,     255,       0,     255,
+     255,       0,       0,     255,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,     255,
+     255,     255,       0,     255,
+     255,     255,     255,       0,
+       0,     255,       0,     255,
+     255,     255,       0,       0,
+       0,       0,     255,       0,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+       0,       0,     255,       0,
+       0,     255,       0,       0,
+     255,       0,     255,     255,
+       0,     255,     255,       0,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+     255,       0,       0,     255,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+     255,       0,       0,     255,
+       0,     255,     255,     255,
+       0,       0,     255,       0,
+     255,     255,     255,     255,
+       0,     255,     255,       0,
+     255,     255,       0,     255,
+     255,       0,     255,       0,
+       0,     255,     255,       0,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+       0,     255,       0,       0,
+       0,     255,     255,     255,
+     255,     255,     255,       0,
+     255,     255,     255,     255,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+       0,       0,     255,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,     255,     255,       0,
+     255,       0,       0,     255,
+     255,     255,     255,     255,
+       0,     255,       0,       0,
+     255,     255,     255,     255,
+       0,     255,     255,     255,
+     255,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+     255,       0,       0,       0,
+       0,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,     255,     255,
+     255,     255,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,       0,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+     255,       0,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,       0,       0,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,     255,       0,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,       0,       0,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,     255,
+     255,     255,     255,       0,
+       0,       0,       0,       0,
+     255,     255,     255,     255,
+     255,     255,       0,       0,
+       0,       0,     255,     255,
+     255,     255,     255,     255,
+       0,       0,       0,       0,
+       0,       0,       0,       0,
+       0,     255,       0,       0,
+     255,     255,       5,     136,
+     136,     136,     136,     136,
+       8,       0,       0,       5,
+       0,       0,     128,     136,
+     136,     136,     136,       0,
+       5,       0,       0,       0,
+       0,       0,     136,     136,
+     136,       6,     204,     204,
+      12,       0,      64,      68,
+      68,       0,       7,     224,
+     206,     204,     202,     204,
+      14,      32,      68,       7,
+      68,      68,       2,     206,
+     170,     136,     136,     202,
+       7,      14,      66,     100,
+      70,      36,       2,     238,
+     204,       7,     170,     170,
+     202,     236,      32,      66,
+      68,      34,       7,      34,
+      34,       0,     224,     172,
+     138,     168,     202,       7,
+      14,      34,      68,      68,
+     100,     102,      38,     192,
+       8,     172,     153,     186,
+     220,      15,      33,      50,
+      67,      38,      77,     130,
+     132,     191,     177,      48,
+      22,      64,       8,     253,
+      49,      51,      51,      83,
+     118,     119,      70,      39,
+     237,      59,      94,      33,
+      34,      32,     224,     254,
+      39,      17,      35,     224,
+     192,     176,     207,      46,
+      18,      55,     154,     218,
+     255,       3,      68,     101,
+      70,     102,      38,     248,
+     171,     201,      19,     113,
+      39,     117,       3,      38,
+     176,      29,      92,     192,
+     241,     232,     138,      45,
+      38,      82,     115,      98,
+      54,     197,     219,      13,
+     196,      39,       0,     254,
+     176,     254,      30,      20,
+       4,      34,      38,      87,
+      11,     233,     211,       0,
+     207,     255,     170,      39,
+     254,      63,      35,      64,
+      50,       2,     223,      31,
+      38,      61,     254,     252,
+     219,     139,      31,      85,
+     113,      38,      97,      71,
+      15,     175,     209,       0,
+     176,     160,      39,     255,
+     205,     241,     247,      34,
+      51,      66,     223,      38,
+     219,       0,     192,     255,
+     254,     155,     205,      80,
+      39,       5,      35,      65,
+     228,     224,     252,       1,
+      14,      39,     255,     240,
+     221,      14,      33,       4,
+      36,     112,      38,      15,
+     173,     220,      15,     254,
+     255,     178,     155,      39,
+      14,      65,     244,      20,
+       6,     212,     191,     223,
+      39,     210,       1,     209,
+     210,     206,      46,      81,
+      17,      38,     119,     115,
+     195,     136,     251,      62,
+     106,     224,      38,     132,
+     249,      72,      54,      55,
+     117,     115,     176,      55,
+     117,     103,       6,      19,
+      31,     190,     139,     138,
+      39,      21,      81,     110,
+      49,     222,     189,      16,
+     240,      39,       1,      18,
+     221,     206,       1,     245,
+      35,      81,      39,      66,
+     236,     235,      46,      47,
+      15,      18,     237,      39,
+     173,      48,       4,      34,
+      36,      51,     175,     221,
+      24,     254,      14,     239,
+      62,     207,     156,     218,
+      70,      24,      99,      53,
+      83,     207,     188,      46,
+      18,     240,      41,       0,
+     239,       0,      95,     213,
+       0,     191,       4,      56,
+      27,     197,     113,     238,
+      19,      28,     140,     234,
+      41,      99,     222,     240,
+      75,     178,      50,      30,
+     211,      57,      16,     255,
+     207,     237,      60,     163,
+      50,      14,      57,     247,
+     109,     239,       5,      47,
+     223,     225,     250,      42,
+      17,     244,      13,     192,
+      82,      27,     212,      63,
+      57,     208,     212,     255,
+     204,     191,      52,      26,
+       3,      25,      24,     227,
+      67,      17,       0,     190,
+     220,     205,      57,     237,
+     109,     191,      50,     238,
+      39,      90,       3,      57,
+      64,     225,      16,     205,
+     221,     252,     215,      74,
+      25,     144,     107,     227,
+      84,     224,     240,     186,
+     224,      58,     238,     239,
+      64,     222,      34,      44,
+     244,      77,      57,     227,
+      95,     147,      50,     156,
+     254,      42,     215,      25,
+     219,     158,     123,     231,
+      84,     191,      16,     203,
+      42,     242,     254,     243,
+     100,     171,      17,      45,
+       5,      25,      32,       3,
+     234,     195,      27,     175,
+       9,     113,      42,     182,
+     251,     225,      82,     240,
+      30,     239,      17,      57,
+     223,     195,     187,     208,
+     114,     158,      64,      29,
+      57,       7,     255,      34,
+       0,       4,      28,     221,
+     250,      58,      31,     213,
+      13,     242,      48,       1,
+      45,     242,      42,      63,
+     209,     241,     255,      33,
+      99,     187,      29,      57,
+     240,      38,     161,      97,
+     254,      51,     251,     207,
+      58,      14,      46,     229,
+     252,       3,      47,      18,
+      12,      42,       3,      30,
+     227,     255,     240,       2,
+      99,     142,      57,     109,
+     196,      51,     133,     125,
+     241,      47,     239,      58,
+     239,      15,     255,       6,
+     236,      50,      15,      49,
+      42,     204,      33,       0,
+      31,     225,      30,      17,
+      97,      57,     144,      91,
+      20,      14,     230,      12,
+      35,     192,      57,      47,
+     190,      59,      47,     246,
+     204,      52,     211,      40,
+      98,     154,      11,      71,
+     185,      39,     153,     119,
+      57,      55,     234,      48,
+      33,     240,       2,       0,
+      32,      57,     178,      15,
+     176,     251,     116,     159,
+      78,     243,      24,     102,
+      39,     240,     189,      30,
+     170,      14,     155,      58,
+      79,     196,      13,       4,
+     240,       2,      31,       1,
+      58,      16,     255,     240,
+     238,      31,       5,     235,
+      51,      40,       0,     127,
+      11,     254,      47,     189,
+      63,     144,      58,      30,
+      36,     220,      49,       1,
+      30,       1,      16,      58,
+      16,     240,      15,     223,
+     253,      37,     206,      32,
+      41,      70,      28,      18,
+     224,      13,     242,      28,
+       1,      58,     236,      68,
+     222,      46,       3,     255,
+      17,       1,      57,     240,
+       4,     192,     223,     172,
+     116,     145,      44,      41,
+      86,     221,      83,     211,
+       9,       0,     241,     255,
+      57,     219,      53,     222,
+      30,      36,     222,     111,
+       5,      57,      28,      19,
+     239,     238,     234,      22,
+     188,      50,      57,     228,
+     253,      79,      39,     252,
+      19,     209,     206,      57,
+      45,     196,     236,      96,
+     228,     249,      82,      36,
+      57,      30,     241,     225,
+     190,     126,     131,      24,
+      84,      26,      37,     189,
+      78,      53,     240,     222,
+     220,     254,      57,      99,
+     159,       8,     117,     177,
+       9,      86,       0,      57,
+      34,     226,     220,      13,
+      55,     139,      43,      70,
+      57,     175,      43,      71,
+     254,      51,     195,     188,
+     126,      57,       5,     168,
+      62,      22,     171,      64,
+       7,      14,      57,      67,
+     209,     170,     116,     165,
+     184,      99,     209,      57,
+     232,     100,     242,      46,
+      51,     207,      10,      71,
+      57,     206,     249,      54,
+     158,      27,      87,     207,
+      64,      57,       3,     204,
+      64,     244,     220,      62,
+      17,     186,      57,      79,
+      22,     223,      50,     210,
+      43,      37,     207,      56,
+      28,      23,     140,     216,
+     119,     243,      29,       3,
+      57,     253,      66,     241,
+     205,      67,     193,     219,
+      48,      57,      18,      14,
+      32,     207,      48,      36,
+     206,      32,      56,       6,
+     139,      41,      51,     225,
+      30,     208,       1,      56,
+      66,     243,      13,      68,
+     190,     235,      33,     209,
+      55,     237,     162,      95,
+     246,      13,     116,       3,
+     220,      55,     222,      30,
+     239,     253,     171,     115,
+     247,     187,       8,     205,
+      95,      22,     154,      11,
+     208,     170,     187,      55,
+      95,      23,     223,      43,
+      85,     189,      92,      36,
+      55,     129,     184,      97,
+       5,     251,      68,       1,
+     203,      56,      46,       2,
+      31,     241,     189,      62,
+      22,     223,      56,      45,
+      20,     159,     253,      21,
+     226,     254,     239,      56,
+      32,      80,     242,     253,
+      20,     176,     251,      35,
+      56,       1,     237,     252,
+      52,      19,      14,      50,
+     224,      56,     237,     238,
+      16,     243,     190,      43,
+      67,       2,      55,     208,
+     102,     195,     152,      29,
+     243,     239,     142,      55,
+     110,      67,      20,      48,
+      36,     163,     201,      14,
+      55,     225,     189,     217,
+     115,      52,      26,     101,
+       3,      55,     203,     254,
+     254,     254,     141,      90,
+     119,     228,      24,     171,
+     251,     240,     206,      47,
+      68,     210,     168,      56,
+      33,      51,       0,      48,
+      32,     224,     236,     240,
+      55,       0,     138,      29,
+     115,     229,      65,     116,
+     225,      55,     202,      12,
+     241,     155,      12,      96,
+       2,      17,      55,      20,
+      53,     224,     172,      60,
+     192,     203,      60,       8,
+      80,      71,       2,      65,
+      21,     173,     185,     254,
+       7,     138,      12,     100,
+      70,       2,     224,     238,
+     224,       8,     189,      13,
+      50,      18,      16,     241,
+     221,      48,      39,     169,
+      62,     115,     210,      63,
+      32,     186,     218,      55,
+      50,     210,     249,     236,
+       0,     253,      99,      66,
+      55,       5,     208,      32,
+     223,     220,     155,     243,
+     241,      55,      20,      36,
+      17,     225,      18,     218,
+     170,     255,      55,     237,
+     115,      85,      31,      29,
+      48,     144,     218,      40,
+      31,       3,      16,      66,
+     223,     202,      62,      34,
+      39,      18,      14,      18,
+      33,       6,     235,     217,
+      33,      39,     227,     219,
+      48,      55,      51,     245,
+     174,     154,      39,      94,
+      19,     192,     223,      80,
+     102,      63,     223,      39,
+     236,     240,     208,     207,
+      15,      99,     100,     210,
+      55,       2,      51,      64,
+      70,     223,     220,     207,
+      46,       8,      98,     119,
+       4,     205,     253,     223,
+     171,      29,      39,     212,
+     202,     223,      16,      99,
+     179,     139,      46,      40,
+     102,       5,     187,     188,
+      32,      83,     224,     236,
+      55,     248,      52,      35,
+      37,      68,      99,     241,
+     141,      40,      12,      99,
+      38,     177,     173,      46,
+      67,       0,      55,     184,
+     184,      49,       3,     240,
+     255,     100,       2,      55,
+     203,     172,      13,      98,
+      82,     239,      79,       3,
+      55,     144,     171,     217,
+     111,     115,      37,      45,
+      34,      39,      54,     206,
+      16,     114,      23,     160,
+     137,     253,      55,     240,
+     185,     205,      33,      53,
+      50,       0,     207,      55,
+     235,      28,      46,      33,
+      52,      33,     238,     219,
+      39,      48,      99,      36,
+     204,     139,      31,      33,
+      51,      55,      11,      17,
+      50,       3,     228,     224,
+     222,      11,       8,      13,
+      83,     119,      54,     207,
+     171,     203,     221,       8,
+     254,      33,      51,       2,
+     205,     253,      67,      36,
+       7,     174,     202,     238,
+     238,     204,      12,     100,
+      70,       7,     192,     170,
+     170,     204,      32,      66,
+      68,       2,       8,     223,
+     204,     220,     254,      49,
+      85,      53,     225,       8,
+     188,     187,     236,      31,
+      50,      52,      18,     224,
+       7,     136,     200,      32,
+       2,     238,      14,      34,
+     224,       8,     189,     236,
+      65,      69,     225,     171,
+     219,      32,       8,      34,
+       1,      16,      34,     241,
+     189,     219,      47,       7,
+     102,      36,     206,     236,
+     238,     204,     236,      32,
+       7,      68,       2,     172,
+     170,     202,      46,      68,
+      68,       7,     226,     204,
+     236,     238,     206,      14,
+      98,      70,       7,     192,
+     136,     202,      14,       0,
+     238,      32,     100,       8,
+     241,     189,     203,      31,
+      34,     241,     238,      15,
+       7,      68,     226,     204,
+      12,      66,       2,     172,
+     202,       7,      32,      36,
+     224,     238,      32,     224,
+     172,     170,       6,      12,
+      68,       4,     192,     204,
+     204,     204,      12,       7,
+      34,      36,     224,     170,
+     170,     236,       0,      32,
+       7,      68,     102,       4,
+     140,     136,     202,      14,
+      32,       7,      34,      34,
+       2,     172,     136,     234,
+      66,      36,       7,     224,
+      14,      32,       2,     206,
+     236,      64,      68,       7,
+     192,     138,     202,      46,
+      34,       0,     238,     238,
+       7,     204,     170,     236,
+      64,     102,       4,     174,
+     202,       7,     238,       0,
+      14,      32,     100,      36,
+     174,     136,       7,      12,
+      66,      36,     224,     238,
+     238,     238,     204,       6,
+     200,      64,      68,     192,
+     136,     136,     200,      12,
+       6,      64,      68,      68,
+     192,     136,     136,      12,
+      64,       6,      68,       0,
+       0,     192,     140,     136,
+     204,      64,       6,      68,
+       0,     140,     136,      12,
+      64,      68,       4,       6,
+     192,     140,     136,     204,
+      12,      64,       4,       0,
+       5,     136,     136,     136,
+       0,       0,       0,     128,
+     136,       6,     204,     204,
+       0,      68,       4,     192,
+     140,     136,       6,     200,
+      12,      64,       4,       0,
+     192,     204,     136,       6,
+     204,       0,      64,       0,
+       0,     204,     204,     204,
+       5,       8,       0,       0,
+       0,     136,     136,     136,
+     136,       5,       8,       0,
+       0,     128,     136,     136,
+       8,       0,       5,       0,
+       0,     136,     136,     136,
+       8,       0,       0,       5,
+       0,       0,     136,     136,
+     136,       0,       0,       0,
+       5,     128,     136,     136,
+     136,       0,       0,       0,
+     128,       5,     136,     136,
+     136,       0,       0,       0,
+       0,     136,       5,     136,
+     136,     136,       8,       0,
+       0,     128,     136,       5,
+     136,       8,       0,       0,
+       0,     136,     136,       8,
+       5,       0,       0,       0,
+       0,       0,       0,     136,
+     136,       5,       8,       0,
+       0,     128,     136,     136,
+     136,     136,       5,       0,
+       0,       0,     136,     136,
+       8,       0,       0,       5,
+       0,       0,       0,     136,
+     136,     136,       0,       0,
+       5,     128,     136,     136,
+     136,     136,       8,       0,
+       0,       5,     128,     136,
+     136,     136,       8,       0,
+       0,       0,       5,     136,
+     136,     136,       8,       0,
+       0,       0,       0,       5,
+     136,     136,     136,       8,
+       0,       0,     136,     136,
+       5,     136,     136,       0,
+       0,       0,       0,     136,
+     136,       5,     136,       0,
+       0,       0,       0,     128,
+       0,       8,       5,       0,
+       0,       0,     128,     136,
+     136,       0,       0,       5,
+     136,       0,       0,     136,
+     136,     136,       8,       0,
+       5,       0,     136,     136,
+       8,       0,       8,       0,
+       0,       5,       0,     136,
+     136,     136,       8,       0,
+       0,       0,       5,       0,
+     136,     136,     136,     136,
+       0,       0,     136,       5,
+     136,     136,     136,       0,
+       0,       0,       0,       0,
+       5,       0,       0,       0,
+       0,       0,     128,     136,
+     136,       5,     136,     136,
+     136,     136,     136,     136,
+       0,       0,       5,       0,
+       0,       0,       0,       0,
+     136,     136,     136,       5,
+       8,       0,       0,       0,
+     136,     136,     136,     136,
+       5,     136,       8,       0,
+       0,       0,     136,     136,
+       0,       5,     136,     136,
+     136,       0,     128,       0,
+       0,       0,       5,       0,
+       0,       0,       0,     128,
+     136,     136,     136,       5,
+       8,       0,     128,     136,
+       0,       0,       0,     128,
+       5,     136,     136,     136,
+       0,       0,       0,       0,
+     136,       5,     136,       0,
+       0,       0,       0,       0,
+       0,     128,       5,     136,
+       8,       0,       0,     136,
+     136,     136,     136,       5,
+     136,     136,     136,     136,
+       0,       0,       0,     128,
+       5,       8,       0,       0,
+       0,       0,     136,     136,
+     136,       5,       8,       0,
+       0,       0,       0,       0,
+       0,       0,
 };
 
 
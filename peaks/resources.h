@@ -95,7 +95,7 @@ extern const int16_t wav_overdrive[];
 #define LUT_OSCILLATOR_INCREMENTS 2
 #define LUT_OSCILLATOR_INCREMENTS_SIZE 97
 #define WAV_DIGITS 0
-#define WAV_DIGITS_SIZE 36824
+#define WAV_DIGITS_SIZE 29154
 #define WAV_SINE 0
 #define WAV_SINE_SIZE 1025
 #define WAV_FOLD_POWER 1
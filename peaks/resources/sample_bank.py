@@ -0,0 +1,321 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2026 Mutable Instruments contributors.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+# 
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+# 
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+# 
+# See http://creativecommons.org/licenses/MIT/ for more information.
+#
+# -----------------------------------------------------------------------------
+#
+# Sample bank packer.
+#
+# Sample banks are read by peaks/number_station/sample_player.h. A bank is:
+#
+#   'S' 'B' version:u8 num_samples:u8
+#   num_samples entries of 24 bytes:
+#     offset:u32         Start of the sample data, from the start of the bank.
+#     length:u32         Length, in samples.
+#     loop_start:u32     Loop points, in samples. loop_end = 0 for no loop.
+#     loop_end:u32
+#     format:u8          FORMAT_ADPCM or FORMAT_PCM.
+#     reserved:u8[3]
+#     loop_history:s16[2]  Last two decoded values before the loop start.
+#
+# FORMAT_ADPCM data is made of blocks of 16 samples, stored in 9 bytes:
+#
+#   filter << 4 | shift
+#   16 4-bit signed codes, low nibble first.
+#
+# Each sample is predicted from the previous two decoded values s1 and s2
+# with the block's filter: p = (k1 * s1 + k2 * s2) >> 6, and decoded as
+# p + (code << shift), clipped to 16 bits. The decoder history starts at 0.
+# Unlike IMA ADPCM, whose step size can only follow the signal a few dB per
+# sample, the encoder picks the best filter and step size for every block.
+#
+# FORMAT_PCM data is signed 8-bit PCM. The packer falls back to it for
+# samples which do not survive the ADPCM encoding well enough: noise-like
+# sounds (fricatives) do not fit in 4 bits per sample, whatever the codec.
+#
+# All values are little-endian.
+#
+# usage:
+#   python peaks/resources/sample_bank.py -o bank.bin a.wav b.wav:1000:2000
+#   python peaks/resources/sample_bank.py -o peaks/data/digits.bank \
+#       --legacy_digits peaks/data/digits.bin
+#
+# The loop points of a WAV file are given in samples after its name. The
+# second form converts the scrambled 8-bit digits of the original firmware.
+
+import math
+import optparse
+import struct
+import sys
+import wave
+
+VERSION = 2
+HEADER_SIZE = 4
+ENTRY_SIZE = 24
+ENTRY_FORMAT = '<IIIIB3xhh'
+
+FORMAT_ADPCM = 0
+FORMAT_PCM = 1
+
+BLOCK_SIZE = 16
+BLOCK_BYTES = 1 + BLOCK_SIZE // 2
+MAX_SHIFT = 12
+
+# Predictor coefficients, in 1/64th.
+FILTERS = [(0, 0), (60, 0), (115, -52), (98, -55)]
+
+# Samples encoded with a lower SNR than this are stored as 8-bit PCM, if it
+# does better. The 8-bit originals of the digits have an SNR of 31 to 35 dB
+# (their own quantization noise).
+DEFAULT_MIN_SNR = 25.0
+
+# Sample boundaries in the original digits.bin.
+LEGACY_DIGITS = [
+    0, 4913, 7830, 11306, 14601, 18651, 22308, 26438, 30495, 33296, 36801]
+
+
+
+def clip(x):
+  return max(-32768, min(32767, x))
+
+
+
+def adpcm_decode_sample(code, filter_index, shift, s1, s2):
+  """Decodes one sample, exactly like the firmware does."""
+  k1, k2 = FILTERS[filter_index]
+  if code & 8:
+    code -= 16
+  return clip(((k1 * s1 + k2 * s2) >> 6) + (code << shift))
+
+
+
+def adpcm_encode_block(block, s1, s2):
+  """Finds the filter, shift and codes minimizing the error on a block.
+
+  Returns the error, the header byte, the codes and the decoded values."""
+  best = None
+  for filter_index, (k1, k2) in enumerate(FILTERS):
+    for shift in range(MAX_SHIFT + 1):
+      error = 0
+      codes = []
+      decoded = []
+      a1, a2 = s1, s2
+      for x in block:
+        prediction = (k1 * a1 + k2 * a2) >> 6
+        code = (x - prediction + (1 << shift >> 1)) >> shift
+        code = max(-8, min(7, code))
+        y = clip(prediction + (code << shift))
+        error += (x - y) ** 2
+        if best and error >= best[0]:
+          break
+        codes.append(code & 0xf)
+        decoded.append(y)
+        a1, a2 = y, a1
+      else:
+        best = (error, filter_index << 4 | shift, codes, decoded)
+  return best
+
+
+
+def adpcm_encode(samples):
+  """Encodes a list of 16-bit samples.
+
+  Returns the encoded data, and the decoded samples - the encoder tracks the
+  state of the decoder rather than the signal, so that errors do not
+  accumulate."""
+  data = bytearray()
+  decoded = []
+  s1, s2 = 0, 0
+  for i in range(0, len(samples), BLOCK_SIZE):
+    block = samples[i:i + BLOCK_SIZE]
+    _, header, codes, values = adpcm_encode_block(block, s1, s2)
+    codes += [0] * (BLOCK_SIZE - len(codes))
+    data.append(header)
+    data += bytearray(
+        codes[j] | (codes[j + 1] << 4) for j in range(0, BLOCK_SIZE, 2))
+    decoded += values
+    s1, s2 = values[-1], values[-2] if len(values) > 1 else s1
+  return data, decoded
+
+
+
+def pcm_encode(samples):
+  """Encodes a list of 16-bit samples as signed 8-bit PCM."""
+  codes = [max(-128, min(127, (x + 128) >> 8)) for x in samples]
+  return bytearray(c & 0xff for c in codes), [c << 8 for c in codes]
+
+
+
+def snr(original, decoded):
+  error = sum((a - b) ** 2 for a, b in zip(original, decoded))
+  signal = sum(a ** 2 for a in original)
+  return 10 * math.log10(max(signal, 1) / float(max(error, 1)))
+
+
+
+def pack(samples, min_snr):
+  """Packs a list of (data, loop_start, loop_end) tuples into a bank.
+
+  Returns the bank, and the format used for each sample."""
+  header = bytearray(b'SB') + bytearray([VERSION, len(samples)])
+  entries = bytearray()
+  data = bytearray()
+  offset = HEADER_SIZE + ENTRY_SIZE * len(samples)
+  formats = []
+  for sample, loop_start, loop_end in samples:
+    format = FORMAT_ADPCM
+    encoded, decoded = adpcm_encode(sample)
+    if snr(sample, decoded) < min_snr:
+      pcm_encoded, pcm_decoded = pcm_encode(sample)
+      if snr(sample, pcm_decoded) > snr(sample, decoded):
+        format = FORMAT_PCM
+        encoded, decoded = pcm_encoded, pcm_decoded
+    formats.append(format)
+    loop_history = [0, 0]
+    if loop_end:
+      loop_history = [decoded[i] if i >= 0 else 0
+                      for i in (loop_start - 1, loop_start - 2)]
+    entries += struct.pack(
+        ENTRY_FORMAT,
+        offset + len(data),
+        len(sample),
+        loop_start,
+        loop_end,
+        format,
+        loop_history[0],
+        loop_history[1])
+    data += encoded
+  return bytes(header + entries + data), formats
+
+
+
+def decode(bank):
+  """Decodes a bank - to check it, or to listen to it."""
+  bank = bytearray(bank)
+  assert bank[:2] == bytearray(b'SB') and bank[2] == VERSION
+  samples = []
+  for i in range(bank[3]):
+    entry = struct.unpack_from(
+        ENTRY_FORMAT, bytes(bank), HEADER_SIZE + ENTRY_SIZE * i)
+    offset, length, _, _, format, _, _ = entry
+    decoded = []
+    s1, s2 = 0, 0
+    for n in range(length):
+      if format == FORMAT_PCM:
+        byte = bank[offset + n]
+        decoded.append((byte - 256 if byte & 0x80 else byte) << 8)
+        continue
+      block = offset + (n // BLOCK_SIZE) * BLOCK_BYTES
+      byte = bank[block + 1 + (n % BLOCK_SIZE >> 1)]
+      code = byte >> 4 if n & 1 else byte & 0xf
+      value = adpcm_decode_sample(
+          code, bank[block] >> 4, bank[block] & 0xf, s1, s2)
+      decoded.append(value)
+      s1, s2 = value, s1
+    samples.append(decoded)
+  return samples
+
+
+
+def read_wav(file_name):
+  f = wave.open(file_name, 'rb')
+  width = f.getsampwidth()
+  channels = f.getnchannels()
+  frames = bytearray(f.readframes(f.getnframes()))
+  f.close()
+  samples = []
+  stride = width * channels
+  for i in range(0, len(frames), stride):
+    # First channel only.
+    if width == 1:
+      samples.append((frames[i] - 128) << 8)
+    elif width == 2:
+      samples.append(struct.unpack_from('<h', bytes(frames[i:i + 2]))[0])
+    else:
+      raise ValueError('Unsupported sample width in %s' % file_name)
+  return samples
+
+
+
+def read_legacy_digits(file_name):
+  data = bytearray(open(file_name, 'rb').read())
+  # The bytes are scrambled by a XOR with their position times 53.
+  samples = [((data[i] ^ ((i * 53) & 0xff)) << 8) - 32768
+             for i in range(len(data))]
+  return [(samples[start:end], 0, 0)
+          for start, end in zip(LEGACY_DIGITS[:-1], LEGACY_DIGITS[1:])]
+
+
+
+if __name__ == '__main__':
+  parser = optparse.OptionParser(
+      usage='usage: %prog -o bank.bin [file.wav[:loop_start:loop_end] ...]')
+  parser.add_option(
+      '-o',
+      '--output',
+      dest='output',
+      help='Write the bank to FILE',
+      metavar='FILE')
+  parser.add_option(
+      '--legacy_digits',
+      dest='legacy_digits',
+      help='Start with the digits from the original digits.bin FILE',
+      metavar='FILE')
+  parser.add_option(
+      '--min_snr',
+      dest='min_snr',
+      type='float',
+      default=DEFAULT_MIN_SNR,
+      help='Store the samples encoded with a lower SNR (in dB) as 8-bit PCM')
+  options, args = parser.parse_args()
+  if not options.output:
+    parser.error('No output file.')
+
+  samples = []
+  if options.legacy_digits:
+    samples += read_legacy_digits(options.legacy_digits)
+  for arg in args:
+    tokens = arg.split(':')
+    data = read_wav(tokens[0])
+    loop_start, loop_end = 0, 0
+    if len(tokens) == 3:
+      loop_start, loop_end = int(tokens[1]), int(tokens[2])
+      if not 0 <= loop_start < loop_end <= len(data):
+        parser.error('Invalid loop points for %s' % tokens[0])
+    samples.append((data, loop_start, loop_end))
+  if not samples or len(samples) > 255:
+    parser.error('A bank holds between 1 and 255 samples.')
+
+  bank, formats = pack(samples, options.min_snr)
+  open(options.output, 'wb').write(bank)
+
+  # Report the size and quality of the compression.
+  decoded = decode(bank)
+  for i, ((original, _, _), d) in enumerate(zip(samples, decoded)):
+    sys.stderr.write('Sample %d: %s, SNR: %.1f dB\n' % (
+        i, ['ADPCM', 'PCM'][formats[i]], snr(original, d)))
+  sys.stderr.write('%d samples, %d bytes (%d bytes of 8-bit PCM). SNR: %.1f dB\n' % (
+      len(samples),
+      len(bank),
+      sum(len(s) for s, _, _ in samples),
+      snr(sum((s for s, _, _ in samples), []), sum(decoded, []))))
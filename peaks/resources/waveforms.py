@@ -68,6 +68,7 @@ waveforms.append(('overdrive', numpy.round(32767 * overdrive).astype(int)))
 Surprise!
 ----------------------------------------------------------------------------"""
 
-digits = file('peaks/data/digits.bin', 'rb').read()
+# Sample bank built by peaks/resources/sample_bank.py.
+digits = file('peaks/data/digits.bank', 'rb').read()
 digits = map(ord, digits)
 waveforms_8 = [('digits', digits)]
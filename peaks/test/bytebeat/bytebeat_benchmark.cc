@@ -0,0 +1,141 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Compares the bytebeat VM with the compiled equations of ByteBeats: checks
+// that both produce the same samples, and measures their throughput.
+//
+// usage: bytebeat_benchmark [num_samples]
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+#include "peaks/test/bytebeat/bytebeat_compiler.h"
+#include "peaks/test/bytebeat/bytebeat_vm.h"
+
+#include "peaks/gate_processor.h"
+#include "peaks/number_station/bytebeats.h"
+
+using namespace peaks;
+
+// The equations of ByteBeats::Render, in the language of the compiler.
+static const char* equation_source[kNumByteBeatsEquations] = {
+  "a = p0 >> 9; b = p1 >> 9;"
+  "((((t * 3) & (t >> 10)) | ((t * a) & (t >> 10)) |"
+  " ((t * 10) & ((t >> 8) * b) & 128)) & 255) << 8",
+  "a = p0 >> 11; b = p1 >> 11;"
+  "((((t * a) & (t >> 4)) | ((t * 5) & (t >> 7)) |"
+  " ((t * b) & (t >> 10))) & 255) << 8",
+  "a = p0 >> 12; b = p1 >> 12;"
+  "((((t >> a) & t) * (t >> b)) & 255) << 8",
+  "a = p0 >> 11; b = p1 >> 9;"
+  "((((((t >> a) | t | (t >> a)) * 10) & ((5 * t) | (t >> 10))) |"
+  " (t ^ (t % b))) & 255) << 8",
+  "a = p0 >> 12; b = p1 >> 12;"
+  "t * (((t >> b) ^ ((t >> b) - 1) ^ 1) % a)",
+  "a = p0 >> 11; b = p1 >> 9;"
+  "p = ((t / (1236 + a)) % 128) & ((t >> (b >> 5)) * b);"
+  "q = (t / (t / ((500 * b) % 5) + 1)) % p;"
+  "(t >> q >> (b >> 5)) + (t / (t >> ((b >> 5) & 12)) >> p)",
+  "a = p0 >> 9; b = p1 >> 10;"
+  "(t >> (b >> 4)) >> ((t / 6988 * t % (a + 1)) + (t << t / (b * 4)))",
+  "a = p0 >> 9;"
+  "((t & a) - t % ((t - 1) % p1)) ^ (t >> 7)",
+};
+
+static const uint16_t parameters[][2] = {
+  { 0, 0 },
+  { 32768, 32768 },
+  { 65535, 65535 },
+  { 12345, 54321 },
+  { 60000, 2000 },
+};
+
+const size_t kNumParameterSets = sizeof(parameters) / sizeof(parameters[0]);
+
+int main(int argc, char** argv) {
+  size_t num_samples = argc > 1 ? strtoul(argv[1], NULL, 0) : 1 << 20;
+  num_samples -= num_samples % kBlockSize;
+
+  // Successive values of t, as played at various pitches.
+  uint32_t* t = new uint32_t[num_samples];
+  for (size_t i = 0; i < num_samples; ++i) {
+    t[i] = i * (1 + (i >> 16) % 4) + (i >> 18) * 0x10000000;
+  }
+  uint32_t* expected = new uint32_t[num_samples];
+  uint32_t* actual = new uint32_t[num_samples];
+
+  BytebeatVm vm;
+  BytebeatCompiler compiler;
+  bool ok = true;
+  double total_hardcoded = 0.0;
+  double total_vm = 0.0;
+
+  printf("equation  instructions  hardcoded (Ms/s)  vm (Ms/s)  ratio\n");
+  for (uint8_t e = 0; e < kNumByteBeatsEquations; ++e) {
+    vm.Init();
+    if (!compiler.Compile(
+            equation_source[e], vm.mutable_program())) {
+      fprintf(stderr, "equation %d: %s at %d\n", e, compiler.error(),
+              static_cast<int>(compiler.error_position()));
+      return 1;
+    }
+
+    double hardcoded_time = 0.0;
+    double vm_time = 0.0;
+    for (size_t k = 0; k < kNumParameterSets; ++k) {
+      uint32_t p0 = parameters[k][0];
+      uint32_t p1 = parameters[k][1];
+      clock_t start = clock();
+      for (size_t i = 0; i < num_samples; i += kBlockSize) {
+        ByteBeats::Render(e, &t[i], &expected[i], kBlockSize, p0, p1);
+      }
+      hardcoded_time += static_cast<double>(clock() - start);
+
+      start = clock();
+      vm.set_parameter(0, p0);
+      vm.set_parameter(1, p1);
+      for (size_t i = 0; i < num_samples; i += kBlockSize) {
+        vm.Render(&t[i], &actual[i], kBlockSize);
+      }
+      vm_time += static_cast<double>(clock() - start);
+
+      for (size_t i = 0; i < num_samples; ++i) {
+        if (expected[i] != actual[i]) {
+          fprintf(stderr, "equation %d, p0=%d, p1=%d, t=%u: %u != %u\n",
+                  e, p0, p1, t[i], expected[i], actual[i]);
+          ok = false;
+          break;
+        }
+      }
+    }
+
+    double n = static_cast<double>(num_samples * kNumParameterSets);
+    double hardcoded_rate = n / hardcoded_time * CLOCKS_PER_SEC * 1e-6;
+    double vm_rate = n / vm_time * CLOCKS_PER_SEC * 1e-6;
+    total_hardcoded += hardcoded_time;
+    total_vm += vm_time;
+    printf("%8d  %12d  %16.1f  %9.1f  %5.2f\n",
+           e, vm.program().num_instructions, hardcoded_rate, vm_rate,
+           hardcoded_rate / vm_rate);
+  }
+  printf("overall: the VM is %.2f times slower than the compiled equations\n",
+         total_vm / total_hardcoded);
+
+  delete[] t;
+  delete[] expected;
+  delete[] actual;
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,569 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bytebeat compiler. Turns an expression into a program for the bytebeat VM.
+//
+// Syntax: C expressions on unsigned 32-bit integers, with the operators
+// | ^ & << >> + - * / % (binary) and - ~ (unary), with the C precedence.
+// Operands are decimal or hexadecimal numbers, t, p0, p1, p2, and variables.
+// An expression can be preceded by variable assignments:
+//
+//   a = p1 >> 9; b = t >> a; (b * 3) & (b >> 10)
+//
+// Constant sub-expressions are folded, operations with a neutral element are
+// removed. Sub-expressions which do not depend on t are computed once per
+// block, in scalar registers reserved for the whole program; the others use
+// vector registers, recycled as soon as their value is consumed.
+//
+// Everything happens in a fixed amount of memory, as it would have to if
+// programs were ever compiled on the module.
+
+#ifndef PEAKS_TEST_BYTEBEAT_BYTEBEAT_COMPILER_H_
+#define PEAKS_TEST_BYTEBEAT_BYTEBEAT_COMPILER_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cstring>
+
+#include "peaks/test/bytebeat/bytebeat_vm.h"
+
+namespace peaks {
+
+const uint8_t kBytebeatMaxVariables = 8;
+const uint8_t kBytebeatMaxVariableNameLength = 8;
+
+class BytebeatCompiler {
+ public:
+  BytebeatCompiler() { }
+  ~BytebeatCompiler() { }
+
+  // Returns false if the source could not be compiled. In this case, the
+  // program outputs 0, and error() and error_position() tell why.
+  bool Compile(const char* source, BytebeatProgram* program) {
+    source_ = source;
+    position_ = 0;
+    error_ = NULL;
+    program_ = program;
+    memset(program, 0, sizeof(BytebeatProgram));
+    num_varying_instructions_ = 0;
+    num_variables_ = 0;
+    temporary_registers_ = 0;
+    next_reserved_register_ = BYTEBEAT_REGISTER_FIRST_FREE_SCALAR;
+
+    Operand result;
+    while (true) {
+      result = ParseStatement();
+      SkipSpaces();
+      if (error_ || !source_[position_]) {
+        break;
+      }
+      if (source_[position_] != ';') {
+        Fail("; expected");
+        break;
+      }
+      ++position_;
+      SkipSpaces();
+      if (!source_[position_]) {
+        break;
+      }
+    }
+
+    if (!error_) {
+      result = Materialize(result);
+    }
+    if (!error_) {
+      program->result = result.reg;
+      program->uniform_result = result.type == OPERAND_UNIFORM;
+      // Varying instructions go after the uniform instructions.
+      uint8_t n = program->num_instructions;
+      if (n + num_varying_instructions_ > kBytebeatMaxInstructions) {
+        Fail("program too long");
+      } else {
+        memcpy(
+            &program->instruction[n],
+            varying_instruction_,
+            num_varying_instructions_ * sizeof(BytebeatInstruction));
+        program->num_uniform_instructions = n;
+        program->num_instructions = n + num_varying_instructions_;
+      }
+    }
+    if (error_) {
+      BytebeatVm::Clear(program);
+      return false;
+    }
+    return true;
+  }
+
+  inline const char* error() const { return error_; }
+  inline size_t error_position() const { return position_; }
+
+ private:
+  enum OperandType {
+    OPERAND_CONSTANT,
+    OPERAND_UNIFORM,
+    OPERAND_VARYING,
+    OPERAND_TEMPORARY  // Varying, and its register can be recycled.
+  };
+
+  struct Operand {
+    uint8_t type;
+    uint8_t reg;
+    uint32_t value;
+  };
+
+  struct Variable {
+    char name[kBytebeatMaxVariableNameLength + 1];
+    Operand operand;
+  };
+
+  static inline Operand Constant(uint32_t value) {
+    Operand o;
+    o.type = OPERAND_CONSTANT;
+    o.reg = 0;
+    o.value = value;
+    return o;
+  }
+
+  static inline Operand Register(uint8_t type, uint8_t reg) {
+    Operand o;
+    o.type = type;
+    o.reg = reg;
+    o.value = 0;
+    return o;
+  }
+
+  static inline bool IsAlpha(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+  }
+
+  static inline bool IsDigit(char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  inline void Fail(const char* error) {
+    if (!error_) {
+      error_ = error;
+    }
+  }
+
+  inline void SkipSpaces() {
+    while (source_[position_] == ' ' || source_[position_] == '\t' ||
+           source_[position_] == '\n' || source_[position_] == '\r') {
+      ++position_;
+    }
+  }
+
+  // Consumes the operator op if it is next in the source.
+  bool Accept(const char* op) {
+    SkipSpaces();
+    size_t i = 0;
+    while (op[i] && source_[position_ + i] == op[i]) {
+      ++i;
+    }
+    if (op[i]) {
+      return false;
+    }
+    position_ += i;
+    return true;
+  }
+
+  // Reads an identifier into name. Returns false if there is none.
+  bool ReadIdentifier(char* name) {
+    SkipSpaces();
+    if (!IsAlpha(source_[position_])) {
+      return false;
+    }
+    uint8_t length = 0;
+    while (IsAlpha(source_[position_]) || IsDigit(source_[position_])) {
+      if (length == kBytebeatMaxVariableNameLength) {
+        Fail("name too long");
+        return false;
+      }
+      name[length++] = source_[position_++];
+    }
+    name[length] = '\0';
+    return true;
+  }
+
+  Operand ParseStatement() {
+    // Assignment: identifier followed by "=".
+    size_t start = position_;
+    char name[kBytebeatMaxVariableNameLength + 1];
+    if (ReadIdentifier(name) && Accept("=")) {
+      Operand value = ParseExpression();
+      if (!error_) {
+        Assign(name, value);
+      }
+      return value;
+    }
+    if (error_) {
+      return Constant(0);
+    }
+    position_ = start;
+    return ParseExpression();
+  }
+
+  Operand ParseExpression() {
+    return ParseBinary(0);
+  }
+
+  // Precedence climbing, from | (level 0) to * / % (level 5).
+  Operand ParseBinary(uint8_t level) {
+    static const char* const operators[] = {
+      "|", "^", "&", "<<", ">>", "+", "-", "*", "/", "%"
+    };
+    static const uint8_t opcodes[] = {
+      BYTEBEAT_OP_OR, BYTEBEAT_OP_XOR, BYTEBEAT_OP_AND,
+      BYTEBEAT_OP_SHL, BYTEBEAT_OP_SHR, BYTEBEAT_OP_ADD, BYTEBEAT_OP_SUB,
+      BYTEBEAT_OP_MUL, BYTEBEAT_OP_DIV, BYTEBEAT_OP_MOD
+    };
+    // Index of the first operator at each level, and of the last + 1.
+    static const uint8_t level_start[] = { 0, 1, 2, 3, 5, 7, 10 };
+    if (level == 6) {
+      return ParseUnary();
+    }
+    Operand a = ParseBinary(level + 1);
+    while (!error_) {
+      uint8_t op = level_start[level];
+      while (op < level_start[level + 1] && !Accept(operators[op])) {
+        ++op;
+      }
+      if (op == level_start[level + 1]) {
+        break;
+      }
+      Operand b = ParseBinary(level + 1);
+      if (!error_) {
+        a = Emit(opcodes[op], a, b);
+      }
+    }
+    return a;
+  }
+
+  Operand ParseUnary() {
+    if (Accept("-")) {
+      return Emit(BYTEBEAT_OP_SUB, Constant(0), ParseUnary());
+    } else if (Accept("~")) {
+      return Emit(BYTEBEAT_OP_XOR, ParseUnary(), Constant(0xffffffff));
+    } else if (Accept("+")) {
+      return ParseUnary();
+    }
+    return ParsePrimary();
+  }
+
+  Operand ParsePrimary() {
+    SkipSpaces();
+    char c = source_[position_];
+    if (c == '(') {
+      ++position_;
+      Operand o = ParseExpression();
+      if (!Accept(")")) {
+        Fail(") expected");
+      }
+      return o;
+    } else if (IsDigit(c)) {
+      return ParseNumber();
+    }
+
+    char name[kBytebeatMaxVariableNameLength + 1];
+    if (!ReadIdentifier(name)) {
+      Fail("operand expected");
+      return Constant(0);
+    }
+    if (!strcmp(name, "t")) {
+      return Register(OPERAND_VARYING, BYTEBEAT_REGISTER_T);
+    } else if (name[0] == 'p' && name[1] >= '0' && name[1] <= '2' &&
+               !name[2]) {
+      return Register(OPERAND_UNIFORM, BYTEBEAT_REGISTER_P0 + name[1] - '0');
+    }
+    for (uint8_t i = 0; i < num_variables_; ++i) {
+      if (!strcmp(name, variable_[i].name)) {
+        return variable_[i].operand;
+      }
+    }
+    Fail("unknown variable");
+    return Constant(0);
+  }
+
+  Operand ParseNumber() {
+    uint32_t value = 0;
+    uint32_t base = 10;
+    if (source_[position_] == '0' &&
+        (source_[position_ + 1] == 'x' || source_[position_ + 1] == 'X')) {
+      base = 16;
+      position_ += 2;
+    }
+    while (true) {
+      char c = source_[position_];
+      uint32_t digit;
+      if (IsDigit(c)) {
+        digit = c - '0';
+      } else if (base == 16 && c >= 'a' && c <= 'f') {
+        digit = c - 'a' + 10;
+      } else if (base == 16 && c >= 'A' && c <= 'F') {
+        digit = c - 'A' + 10;
+      } else {
+        break;
+      }
+      value = value * base + digit;
+      ++position_;
+    }
+    return Constant(value);
+  }
+
+  void Assign(const char* name, Operand value) {
+    if (!strcmp(name, "t") ||
+        (name[0] == 'p' && name[1] >= '0' && name[1] <= '2' && !name[2])) {
+      Fail("read-only variable");
+      return;
+    }
+    // A temporary becomes a variable: its register is kept until the end.
+    if (value.type == OPERAND_TEMPORARY) {
+      value.type = OPERAND_VARYING;
+    }
+    for (uint8_t i = 0; i < num_variables_; ++i) {
+      if (!strcmp(name, variable_[i].name)) {
+        variable_[i].operand = value;
+        return;
+      }
+    }
+    if (num_variables_ == kBytebeatMaxVariables) {
+      Fail("too many variables");
+      return;
+    }
+    strcpy(variable_[num_variables_].name, name);
+    variable_[num_variables_].operand = value;
+    ++num_variables_;
+  }
+
+  // Folds the operation, or removes it when one of the operands is a neutral
+  // element. Returns false if an instruction is needed.
+  bool Simplify(uint8_t opcode, Operand a, Operand b, Operand* result) {
+    bool a_constant = a.type == OPERAND_CONSTANT;
+    bool b_constant = b.type == OPERAND_CONSTANT;
+    if (a_constant && b_constant) {
+      *result = Constant(BytebeatVm::Evaluate(opcode, a.value, b.value));
+      return true;
+    }
+    if (b_constant) {
+      uint32_t v = b.value;
+      switch (opcode) {
+        case BYTEBEAT_OP_ADD:
+        case BYTEBEAT_OP_SUB:
+        case BYTEBEAT_OP_OR:
+        case BYTEBEAT_OP_XOR:
+        case BYTEBEAT_OP_SHL:
+        case BYTEBEAT_OP_SHR:
+          if (v == 0) {
+            *result = a;
+            return true;
+          }
+          break;
+        case BYTEBEAT_OP_MUL:
+          if (v == 1) {
+            *result = a;
+            return true;
+          }
+          // Fall through.
+        case BYTEBEAT_OP_AND:
+          if (v == 0) {
+            Release(a);
+            *result = Constant(0);
+            return true;
+          }
+          break;
+        case BYTEBEAT_OP_DIV:
+          if (v == 1) {
+            *result = a;
+            return true;
+          } else if (v == 0) {
+            Release(a);
+            *result = Constant(0);
+            return true;
+          }
+          break;
+        case BYTEBEAT_OP_MOD:
+          if (v == 0) {
+            *result = a;
+            return true;
+          } else if (v == 1) {
+            Release(a);
+            *result = Constant(0);
+            return true;
+          }
+          break;
+      }
+    } else if (a_constant) {
+      uint32_t v = a.value;
+      switch (opcode) {
+        case BYTEBEAT_OP_ADD:
+        case BYTEBEAT_OP_OR:
+        case BYTEBEAT_OP_XOR:
+          if (v == 0) {
+            *result = b;
+            return true;
+          }
+          break;
+        case BYTEBEAT_OP_MUL:
+          if (v == 1) {
+            *result = b;
+            return true;
+          }
+          // Fall through.
+        case BYTEBEAT_OP_AND:
+        case BYTEBEAT_OP_DIV:
+        case BYTEBEAT_OP_MOD:
+        case BYTEBEAT_OP_SHL:
+        case BYTEBEAT_OP_SHR:
+          if (v == 0) {
+            Release(b);
+            *result = Constant(0);
+            return true;
+          }
+          break;
+      }
+    }
+    return false;
+  }
+
+  Operand Emit(uint8_t opcode, Operand a, Operand b) {
+    if (error_) {
+      return Constant(0);
+    }
+    Operand result;
+    if (Simplify(opcode, a, b, &result)) {
+      return result;
+    }
+    a = Materialize(a);
+    b = Materialize(b);
+    Release(a);
+    Release(b);
+    bool uniform = a.type == OPERAND_UNIFORM && b.type == OPERAND_UNIFORM;
+    uint8_t destination = uniform ? Reserve() : AllocateTemporary();
+    if (error_) {
+      return Constant(0);
+    }
+    BytebeatInstruction insn;
+    insn.opcode = opcode;
+    if (!uniform) {
+      insn.opcode |= a.type == OPERAND_UNIFORM
+          ? BYTEBEAT_OPERANDS_SCALAR_VECTOR
+          : (b.type == OPERAND_UNIFORM
+              ? BYTEBEAT_OPERANDS_VECTOR_SCALAR
+              : BYTEBEAT_OPERANDS_VECTOR_VECTOR);
+    }
+    insn.destination = destination;
+    insn.a = a.reg;
+    insn.b = b.reg;
+    // Uniform instructions go straight to the program; varying instructions
+    // are appended after them at the end of the compilation.
+    uint8_t* n = uniform
+        ? &program_->num_instructions
+        : &num_varying_instructions_;
+    BytebeatInstruction* list = uniform
+        ? program_->instruction
+        : varying_instruction_;
+    if (*n == kBytebeatMaxInstructions) {
+      Fail("program too long");
+      return Constant(0);
+    }
+    list[(*n)++] = insn;
+    return Register(uniform ? OPERAND_UNIFORM : OPERAND_TEMPORARY, destination);
+  }
+
+  // Loads a constant into a register, reusing the register of an identical
+  // constant.
+  Operand Materialize(Operand o) {
+    if (o.type != OPERAND_CONSTANT) {
+      return o;
+    }
+    for (uint8_t i = 0; i < program_->num_constants; ++i) {
+      if (program_->constant[i] == o.value) {
+        return Register(OPERAND_UNIFORM, program_->constant_register[i]);
+      }
+    }
+    if (program_->num_constants == kBytebeatMaxConstants) {
+      Fail("too many constants");
+      return o;
+    }
+    uint8_t reg = Reserve();
+    if (error_) {
+      return o;
+    }
+    program_->constant_register[program_->num_constants] = reg;
+    program_->constant[program_->num_constants] = o.value;
+    ++program_->num_constants;
+    return Register(OPERAND_UNIFORM, reg);
+  }
+
+  // Scalar registers hold the values shared by the whole block. They are
+  // never recycled: once written at the beginning of the block, they must
+  // keep their value until the end.
+  uint8_t Reserve() {
+    if (next_reserved_register_ == kBytebeatNumScalarRegisters) {
+      Fail("out of registers");
+      return 0;
+    }
+    return next_reserved_register_++;
+  }
+
+  uint8_t AllocateTemporary() {
+    for (uint8_t i = BYTEBEAT_REGISTER_FIRST_FREE_VECTOR;
+         i < kBytebeatNumVectorRegisters;
+         ++i) {
+      if (!(temporary_registers_ & (1 << i))) {
+        temporary_registers_ |= 1 << i;
+        return i;
+      }
+    }
+    Fail("out of registers");
+    return 0;
+  }
+
+  inline void Release(Operand o) {
+    if (o.type == OPERAND_TEMPORARY) {
+      temporary_registers_ &= ~(1 << o.reg);
+    }
+  }
+
+  const char* source_;
+  size_t position_;
+  const char* error_;
+
+  BytebeatProgram* program_;
+  BytebeatInstruction varying_instruction_[kBytebeatMaxInstructions];
+  uint8_t num_varying_instructions_;
+
+  Variable variable_[kBytebeatMaxVariables];
+  uint8_t num_variables_;
+
+  // Bitmask of the vector registers in use.
+  uint8_t temporary_registers_;
+  uint8_t next_reserved_register_;
+
+  DISALLOW_COPY_AND_ASSIGN(BytebeatCompiler);
+};
+
+}  // namespace peaks
+
+#endif  // PEAKS_TEST_BYTEBEAT_BYTEBEAT_COMPILER_H_
@@ -0,0 +1,307 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Bytebeat virtual machine, for the host only. Nothing in the firmware links
+// it: bytebeat_benchmark uses it to check the equations compiled in
+// peaks/number_station/bytebeats.cc, and to measure what running them as
+// programs would cost.
+//
+// A program is a list of three-address instructions on two register files.
+// Scalar registers hold the values shared by all the samples of a block: the
+// parameters p0 to p2, the constants, and the results of the instructions
+// which do not depend on t. These instructions come first, and are evaluated
+// once per block. Vector registers hold kBytebeatChunkSize values: t, and
+// everything which depends on it. The other instructions are evaluated on
+// chunks of t, one instruction at a time - the dispatch cost is paid once per
+// chunk rather than once per sample. Their opcode tells which of their
+// operands are scalars, so constants are never copied to all the samples of
+// a chunk.
+//
+// Arithmetic follows the Cortex-M3: a division by zero yields 0 (and x % 0 is
+// x), a shift by 32 or more yields 0. Programs thus compute the same values
+// as the equations compiled for the module.
+
+#ifndef PEAKS_TEST_BYTEBEAT_BYTEBEAT_VM_H_
+#define PEAKS_TEST_BYTEBEAT_BYTEBEAT_VM_H_
+
+#include "stmlib/stmlib.h"
+
+#include <cstring>
+
+namespace peaks {
+
+enum BytebeatOpcode {
+  BYTEBEAT_OP_ADD,
+  BYTEBEAT_OP_SUB,
+  BYTEBEAT_OP_MUL,
+  BYTEBEAT_OP_DIV,
+  BYTEBEAT_OP_MOD,
+  BYTEBEAT_OP_AND,
+  BYTEBEAT_OP_OR,
+  BYTEBEAT_OP_XOR,
+  BYTEBEAT_OP_SHL,
+  BYTEBEAT_OP_SHR
+};
+
+// Added to the opcode of the instructions which depend on t.
+enum BytebeatOperands {
+  BYTEBEAT_OPERANDS_VECTOR_VECTOR = 0x10,
+  BYTEBEAT_OPERANDS_VECTOR_SCALAR = 0x20,
+  BYTEBEAT_OPERANDS_SCALAR_VECTOR = 0x30
+};
+
+const uint8_t kBytebeatOpcodeMask = 0x0f;
+
+enum BytebeatScalarRegister {
+  BYTEBEAT_REGISTER_P0,
+  BYTEBEAT_REGISTER_P1,
+  BYTEBEAT_REGISTER_P2,
+  BYTEBEAT_REGISTER_FIRST_FREE_SCALAR
+};
+
+enum BytebeatVectorRegister {
+  BYTEBEAT_REGISTER_T,
+  BYTEBEAT_REGISTER_FIRST_FREE_VECTOR
+};
+
+const uint8_t kBytebeatNumParameters = 3;
+const uint8_t kBytebeatNumScalarRegisters = 24;
+const uint8_t kBytebeatNumVectorRegisters = 8;
+const uint8_t kBytebeatMaxConstants = 12;
+const uint8_t kBytebeatMaxInstructions = 40;
+const uint8_t kBytebeatChunkSize = 8;
+
+struct BytebeatInstruction {
+  uint8_t opcode;
+  uint8_t destination;
+  uint8_t a;
+  uint8_t b;
+};
+
+struct BytebeatProgram {
+  uint8_t num_instructions;
+  uint8_t num_uniform_instructions;
+  uint8_t num_constants;
+  uint8_t result;
+  // The result is a scalar register when the program does not depend on t.
+  bool uniform_result;
+  uint8_t constant_register[kBytebeatMaxConstants];
+  uint32_t constant[kBytebeatMaxConstants];
+  BytebeatInstruction instruction[kBytebeatMaxInstructions];
+};
+
+struct BytebeatAdd {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) { return a + b; }
+};
+
+struct BytebeatSub {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) { return a - b; }
+};
+
+struct BytebeatMul {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) { return a * b; }
+};
+
+struct BytebeatDiv {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) {
+    return b ? a / b : 0;
+  }
+};
+
+struct BytebeatMod {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) {
+    return b ? a % b : a;
+  }
+};
+
+struct BytebeatAnd {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) { return a & b; }
+};
+
+struct BytebeatOr {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) { return a | b; }
+};
+
+struct BytebeatXor {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) { return a ^ b; }
+};
+
+// Register-specified shifts only use the bottom byte of the shift amount.
+struct BytebeatShl {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) {
+    b &= 0xff;
+    return b >= 32 ? 0 : a << b;
+  }
+};
+
+struct BytebeatShr {
+  static inline uint32_t Apply(uint32_t a, uint32_t b) {
+    b &= 0xff;
+    return b >= 32 ? 0 : a >> b;
+  }
+};
+
+// The three variants of a varying instruction, for BytebeatVm::Render().
+#define BYTEBEAT_VM_CASES(opcode, Op) \
+  case opcode | BYTEBEAT_OPERANDS_VECTOR_VECTOR: \
+    Map<Op>(d, vector_[insn.a], vector_[insn.b]); \
+    break; \
+  case opcode | BYTEBEAT_OPERANDS_VECTOR_SCALAR: \
+    Map<Op>(d, vector_[insn.a], s[insn.b]); \
+    break; \
+  case opcode | BYTEBEAT_OPERANDS_SCALAR_VECTOR: \
+    Map<Op>(d, s[insn.a], vector_[insn.b]); \
+    break;
+
+class BytebeatVm {
+ public:
+  BytebeatVm() { }
+  ~BytebeatVm() { }
+
+  void Init() {
+    memset(scalar_, 0, sizeof(scalar_));
+    memset(vector_, 0, sizeof(vector_));
+    Clear(&program_);
+  }
+
+  // An empty program outputs 0.
+  static void Clear(BytebeatProgram* program) {
+    memset(program, 0, sizeof(BytebeatProgram));
+    program->num_constants = 1;
+    program->constant_register[0] = BYTEBEAT_REGISTER_FIRST_FREE_SCALAR;
+    program->result = BYTEBEAT_REGISTER_FIRST_FREE_SCALAR;
+    program->uniform_result = true;
+  }
+
+  static inline uint32_t Evaluate(uint8_t opcode, uint32_t a, uint32_t b) {
+    switch (opcode & kBytebeatOpcodeMask) {
+      case BYTEBEAT_OP_ADD: return BytebeatAdd::Apply(a, b);
+      case BYTEBEAT_OP_SUB: return BytebeatSub::Apply(a, b);
+      case BYTEBEAT_OP_MUL: return BytebeatMul::Apply(a, b);
+      case BYTEBEAT_OP_DIV: return BytebeatDiv::Apply(a, b);
+      case BYTEBEAT_OP_MOD: return BytebeatMod::Apply(a, b);
+      case BYTEBEAT_OP_AND: return BytebeatAnd::Apply(a, b);
+      case BYTEBEAT_OP_OR: return BytebeatOr::Apply(a, b);
+      case BYTEBEAT_OP_XOR: return BytebeatXor::Apply(a, b);
+      case BYTEBEAT_OP_SHL: return BytebeatShl::Apply(a, b);
+      case BYTEBEAT_OP_SHR: return BytebeatShr::Apply(a, b);
+    }
+    return 0;
+  }
+
+  // Evaluates the program for each of the size values of t.
+  void Render(const uint32_t* t, uint32_t* out, size_t size) {
+    const BytebeatProgram& p = program_;
+    uint32_t* s = scalar_;
+    for (uint8_t i = 0; i < kBytebeatNumParameters; ++i) {
+      s[BYTEBEAT_REGISTER_P0 + i] = parameter_[i];
+    }
+    for (uint8_t i = 0; i < p.num_constants; ++i) {
+      s[p.constant_register[i]] = p.constant[i];
+    }
+    for (uint8_t i = 0; i < p.num_uniform_instructions; ++i) {
+      const BytebeatInstruction& insn = p.instruction[i];
+      s[insn.destination] = Evaluate(insn.opcode, s[insn.a], s[insn.b]);
+    }
+    if (p.uniform_result) {
+      while (size--) {
+        *out++ = s[p.result];
+      }
+      return;
+    }
+
+    while (size) {
+      size_t n = size < kBytebeatChunkSize ? size : kBytebeatChunkSize;
+      // The last values of a partial chunk are left over from the previous
+      // one: they are computed, but not returned.
+      memcpy(vector_[BYTEBEAT_REGISTER_T], t, n * sizeof(uint32_t));
+      for (uint8_t i = p.num_uniform_instructions;
+           i < p.num_instructions;
+           ++i) {
+        const BytebeatInstruction& insn = p.instruction[i];
+        uint32_t* d = vector_[insn.destination];
+        switch (insn.opcode) {
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_ADD, BytebeatAdd)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_SUB, BytebeatSub)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_MUL, BytebeatMul)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_DIV, BytebeatDiv)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_MOD, BytebeatMod)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_AND, BytebeatAnd)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_OR, BytebeatOr)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_XOR, BytebeatXor)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_SHL, BytebeatShl)
+          BYTEBEAT_VM_CASES(BYTEBEAT_OP_SHR, BytebeatShr)
+        }
+      }
+      memcpy(out, vector_[p.result], n * sizeof(uint32_t));
+      t += n;
+      out += n;
+      size -= n;
+    }
+  }
+
+  inline void set_parameter(uint8_t index, uint32_t value) {
+    parameter_[index] = value;
+  }
+
+  inline BytebeatProgram* mutable_program() { return &program_; }
+  inline const BytebeatProgram& program() const { return program_; }
+
+ private:
+  // The loops have a fixed length, so that the compiler can unroll them. The
+  // destination can be one of the operands.
+  template<typename Op>
+  static inline void Map(uint32_t* d, const uint32_t* a, const uint32_t* b) {
+    for (uint8_t i = 0; i < kBytebeatChunkSize; ++i) {
+      d[i] = Op::Apply(a[i], b[i]);
+    }
+  }
+
+  template<typename Op>
+  static inline void Map(uint32_t* d, const uint32_t* a, uint32_t b) {
+    for (uint8_t i = 0; i < kBytebeatChunkSize; ++i) {
+      d[i] = Op::Apply(a[i], b);
+    }
+  }
+
+  template<typename Op>
+  static inline void Map(uint32_t* d, uint32_t a, const uint32_t* b) {
+    for (uint8_t i = 0; i < kBytebeatChunkSize; ++i) {
+      d[i] = Op::Apply(a, b[i]);
+    }
+  }
+
+  BytebeatProgram program_;
+  uint32_t parameter_[kBytebeatNumParameters];
+  uint32_t scalar_[kBytebeatNumScalarRegisters];
+  uint32_t vector_[kBytebeatNumVectorRegisters][kBytebeatChunkSize];
+
+  DISALLOW_COPY_AND_ASSIGN(BytebeatVm);
+};
+
+#undef BYTEBEAT_VM_CASES
+
+}  // namespace peaks
+
+#endif  // PEAKS_TEST_BYTEBEAT_BYTEBEAT_VM_H_
@@ -0,0 +1,381 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host rendering engine.
+
+#include "peaks/test/engine/engine.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "stmlib/utils/random.h"
+
+namespace peaks {
+
+using namespace std;
+using namespace stmlib;
+
+static const char* function_names[PROCESSOR_FUNCTION_LAST] = {
+  "envelope",
+  "lfo",
+  "tap_lfo",
+  "bass_drum",
+  "snare_drum",
+  "high_hat",
+  "fm_drum",
+  "pulse_shaper",
+  "pulse_randomizer",
+  "mini_sequencer",
+  "number_station",
+  "bytebeats",
+  "dual_attack_envelope",
+  "repeating_attack_envelope",
+  "looping_envelope",
+  "randomised_envelope",
+  "bouncing_ball",
+  "randomised_bass_drum",
+  "randomised_snare_drum",
+  "turing_machine",
+  "mod_sequencer",
+  "fmlfo",
+  "rfmlfo",
+  "wsmlfo",
+  "rwsmlfo",
+  "plo"
+};
+
+bool CompareGateEvents(const GateEvent& a, const GateEvent& b) {
+  return a.time < b.time;
+}
+
+bool CompareParameterEvents(const ParameterEvent& a, const ParameterEvent& b) {
+  return a.start < b.start;
+}
+
+Engine::~Engine() {
+  DeleteProcessors();
+}
+
+void Engine::DeleteProcessors() {
+  for (size_t i = 0; i < processors_.size(); ++i) {
+    processors_[i]->~Processors();
+    free(processors_[i]);
+  }
+  processors_.clear();
+}
+
+/* static */
+const char* Engine::function_name(ProcessorFunction function) {
+  return function_names[function];
+}
+
+bool Engine::ParseTime(const string& token, uint32_t* time) {
+  char* end;
+  double value = strtod(token.c_str(), &end);
+  string unit(end);
+  if (end == token.c_str() || value < 0.0) {
+    error_ = "invalid time: " + token;
+    return false;
+  }
+  if (unit == "s") {
+    value *= kSampleRate;
+  } else if (unit == "ms") {
+    value *= kSampleRate / 1000.0;
+  } else if (!unit.empty()) {
+    error_ = "invalid time unit: " + token;
+    return false;
+  }
+  *time = static_cast<uint32_t>(value + 0.5);
+  return true;
+}
+
+bool Engine::FindVoices(const string& name, vector<Voice*>* voices) {
+  voices->clear();
+  for (size_t i = 0; i < voices_.size(); ++i) {
+    if (name == "*" || voices_[i].name == name) {
+      voices->push_back(&voices_[i]);
+    }
+  }
+  if (voices->empty()) {
+    error_ = "unknown voice: " + name;
+    return false;
+  }
+  return true;
+}
+
+void Engine::AddVoice(const string& name, ProcessorFunction function) {
+  Voice v;
+  v.name = name;
+  v.function = function;
+  v.control_mode = CONTROL_MODE_FULL;
+  v.channel = 0;
+  fill(&v.parameter[0], &v.parameter[kNumParameters], 32768);
+  voices_.push_back(v);
+}
+
+bool Engine::ParseLine(const vector<string>& t) {
+  const string& command = t[0];
+  if (command == "seed" && t.size() == 2) {
+    seed_ = strtoul(t[1].c_str(), NULL, 0);
+  } else if (command == "length" && t.size() == 2) {
+    return ParseTime(t[1], &length_);
+  } else if (command == "voices") {
+    for (uint8_t i = 0; i < PROCESSOR_FUNCTION_LAST; ++i) {
+      AddVoice(function_names[i], static_cast<ProcessorFunction>(i));
+      if (t.size() > 1 && t[1] == "half") {
+        voices_.back().control_mode = CONTROL_MODE_HALF;
+      }
+    }
+  } else if (command == "voice" && t.size() >= 3) {
+    int32_t function = -1;
+    for (uint8_t i = 0; i < PROCESSOR_FUNCTION_LAST; ++i) {
+      if (t[2] == function_names[i]) {
+        function = i;
+      }
+    }
+    if (function == -1) {
+      error_ = "unknown function: " + t[2];
+      return false;
+    }
+    AddVoice(t[1], static_cast<ProcessorFunction>(function));
+    Voice* v = &voices_.back();
+    size_t num_parameters = 0;
+    for (size_t i = 3; i < t.size(); ++i) {
+      if (t[i] == "half") {
+        v->control_mode = CONTROL_MODE_HALF;
+      } else if (t[i] == "channel" && i + 1 < t.size()) {
+        v->channel = atoi(t[++i].c_str()) == 2 ? 1 : 0;
+      } else if (num_parameters < kNumParameters) {
+        v->parameter[num_parameters++] = atoi(t[i].c_str());
+      } else {
+        error_ = "too many parameters";
+        return false;
+      }
+    }
+  } else if (command == "param" && t.size() == 5) {
+    vector<Voice*> voices;
+    ParameterEvent e;
+    if (!ParseTime(t[1], &e.start) || !FindVoices(t[2], &voices)) {
+      return false;
+    }
+    e.end = e.start;
+    e.index = atoi(t[3].c_str());
+    e.from = e.to = atoi(t[4].c_str());
+    if (e.index >= kNumParameters) {
+      error_ = "invalid parameter index";
+      return false;
+    }
+    for (size_t i = 0; i < voices.size(); ++i) {
+      voices[i]->parameters.push_back(e);
+    }
+  } else if (command == "ramp" && t.size() == 7) {
+    vector<Voice*> voices;
+    ParameterEvent e;
+    if (!ParseTime(t[1], &e.start) || !ParseTime(t[2], &e.end) ||
+        !FindVoices(t[3], &voices)) {
+      return false;
+    }
+    e.index = atoi(t[4].c_str());
+    e.from = atoi(t[5].c_str());
+    e.to = atoi(t[6].c_str());
+    if (e.index >= kNumParameters || e.end < e.start) {
+      error_ = "invalid ramp";
+      return false;
+    }
+    for (size_t i = 0; i < voices.size(); ++i) {
+      voices[i]->parameters.push_back(e);
+    }
+  } else if (command == "gate" && (t.size() == 4 || t.size() == 5)) {
+    vector<Voice*> voices;
+    GateEvent e;
+    if (!ParseTime(t[1], &e.time) || !FindVoices(t[2], &voices)) {
+      return false;
+    }
+    e.state = t[3] == "on";
+    e.mask = t.size() == 5 && t[4] == "aux"
+        ? CONTROL_GATE_AUXILIARY
+        : CONTROL_GATE;
+    for (size_t i = 0; i < voices.size(); ++i) {
+      voices[i]->gates.push_back(e);
+    }
+  } else if (command == "clock" && t.size() >= 5) {
+    vector<Voice*> voices;
+    uint32_t start, period, width;
+    if (!ParseTime(t[1], &start) || !ParseTime(t[2], &period) ||
+        !ParseTime(t[3], &width) || !FindVoices(t[4], &voices)) {
+      return false;
+    }
+    if (period == 0 || width == 0 || width >= period) {
+      error_ = "invalid clock";
+      return false;
+    }
+    Clock c;
+    c.start = start;
+    c.period = period;
+    c.width = width;
+    c.count = 0xffffffff;
+    c.mask = CONTROL_GATE;
+    for (size_t i = 5; i < t.size(); ++i) {
+      if (t[i] == "aux") {
+        c.mask = CONTROL_GATE_AUXILIARY;
+      } else {
+        c.count = strtoul(t[i].c_str(), NULL, 0);
+      }
+    }
+    for (size_t i = 0; i < voices.size(); ++i) {
+      c.voice = voices[i] - &voices_[0];
+      clocks_.push_back(c);
+    }
+  } else {
+    error_ = "invalid command: " + command;
+    return false;
+  }
+  return true;
+}
+
+bool Engine::Load(FILE* script) {
+  voices_.clear();
+  clocks_.clear();
+  length_ = kSampleRate;
+  seed_ = 0;
+
+  char line[1024];
+  uint32_t line_number = 0;
+  while (fgets(line, sizeof(line), script)) {
+    ++line_number;
+    char* comment = strchr(line, '#');
+    if (comment) {
+      *comment = '\0';
+    }
+    vector<string> tokens;
+    for (char* token = strtok(line, " \t\r\n");
+         token;
+         token = strtok(NULL, " \t\r\n")) {
+      tokens.push_back(token);
+    }
+    if (tokens.empty()) {
+      continue;
+    }
+    if (!ParseLine(tokens)) {
+      fprintf(stderr, "line %d: %s\n", line_number, error_.c_str());
+      return false;
+    }
+  }
+  if (voices_.empty()) {
+    fprintf(stderr, "no voice defined\n");
+    return false;
+  }
+
+  // Clocks are expanded once the length of the rendering is known.
+  for (size_t i = 0; i < clocks_.size(); ++i) {
+    const Clock& c = clocks_[i];
+    GateEvent e;
+    e.mask = c.mask;
+    e.time = c.start;
+    for (uint32_t n = 0; n < c.count && e.time < length_; ++n) {
+      e.state = true;
+      voices_[c.voice].gates.push_back(e);
+      e.time += c.width;
+      e.state = false;
+      voices_[c.voice].gates.push_back(e);
+      e.time += c.period - c.width;
+    }
+  }
+
+  for (size_t i = 0; i < voices_.size(); ++i) {
+    Voice* v = &voices_[i];
+    stable_sort(v->gates.begin(), v->gates.end(), CompareGateEvents);
+    stable_sort(
+        v->parameters.begin(), v->parameters.end(), CompareParameterEvents);
+  }
+  return true;
+}
+
+void Engine::Render(vector<int16_t>* out) {
+  DeleteProcessors();
+
+  Random::Seed(seed_);
+  size_t num_voices = voices_.size();
+  for (size_t i = 0; i < num_voices; ++i) {
+    const Voice& v = voices_[i];
+    // On the module, processors live in zero-initialized static memory.
+    Processors* p = new(calloc(1, sizeof(Processors))) Processors;
+    p->Init(v.channel);
+    p->set_control_mode(v.control_mode);
+    p->set_function(v.function);
+    for (uint8_t j = 0; j < kNumParameters; ++j) {
+      p->set_parameter(j, v.parameter[j]);
+    }
+    processors_.push_back(p);
+  }
+
+  out->resize(static_cast<size_t>(length_) * num_voices);
+  vector<size_t> next_gate(num_voices, 0);
+  vector<uint8_t> gate_state(num_voices, 0);
+
+  for (uint32_t block_start = 0; block_start < length_;
+       block_start += kBlockSize) {
+    for (size_t i = 0; i < num_voices; ++i) {
+      const Voice& v = voices_[i];
+      Processors* p = processors_[i];
+
+      // Parameter changes and ramps, evaluated at the beginning of the block.
+      for (size_t j = 0; j < v.parameters.size(); ++j) {
+        const ParameterEvent& e = v.parameters[j];
+        if (e.start > block_start) {
+          break;
+        }
+        // Steps are applied at the first block boundary after their time,
+        // ramps at each block until the first boundary after their end.
+        if (e.end + kBlockSize > block_start) {
+          int32_t value = e.to;
+          if (e.end > block_start) {
+            value = e.from + static_cast<int32_t>(
+                static_cast<int64_t>(e.to - e.from) * \
+                    (block_start - e.start) / (e.end - e.start));
+          }
+          CONSTRAIN(value, 0, 65535);
+          p->set_parameter(e.index, value);
+        }
+      }
+
+      for (uint32_t j = 0; j < kBlockSize; ++j) {
+        uint32_t t = block_start + j;
+        uint8_t previous = gate_state[i];
+        uint8_t state = previous;
+        while (next_gate[i] < v.gates.size() &&
+               v.gates[next_gate[i]].time <= t) {
+          const GateEvent& e = v.gates[next_gate[i]];
+          state = e.state ? (state | e.mask) : (state & ~e.mask);
+          ++next_gate[i];
+        }
+        gate_state[i] = state;
+        uint8_t rising = state & ~previous;
+        uint8_t falling = previous & ~state;
+        // Rising/falling bits are the gate bit shifted by 1 and 2.
+        uint8_t control = state | (rising << 1) | (falling << 2);
+        int16_t sample = p->Process(control);
+        if (t < length_) {
+          (*out)[t * num_voices + i] = sample;
+        }
+      }
+      p->Buffer();
+    }
+  }
+}
+
+}  // namespace peaks
@@ -0,0 +1,117 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host rendering engine: any number of Peaks processors, driven by a script of
+// gates and parameter changes.
+//
+// Script syntax - one command per line, # starts a comment. Times are in
+// samples, or in seconds / milliseconds with a "s" / "ms" suffix. "*" targets
+// all voices.
+//
+//   seed <n>                         Seed of the random number generator.
+//   length <time>                    Duration of the rendering.
+//   voice <name> <function> [half] [channel 1|2] [p0 p1 p2 p3]
+//   voices [half]                    One voice per processor function.
+//   param <time> <voice> <index> <value>
+//   ramp <start> <end> <voice> <index> <from> <to>
+//   gate <time> <voice> on|off [aux]
+//   clock <start> <period> <width> <voice> [count] [aux]
+//
+// Gates are sample-accurate. Parameter changes and ramps are applied at block
+// boundaries, like pot changes on the module.
+
+#ifndef PEAKS_TEST_ENGINE_ENGINE_H_
+#define PEAKS_TEST_ENGINE_ENGINE_H_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "peaks/processors.h"
+
+namespace peaks {
+
+const uint32_t kSampleRate = 48000;
+
+struct GateEvent {
+  uint32_t time;
+  uint8_t mask;  // CONTROL_GATE or CONTROL_GATE_AUXILIARY.
+  bool state;
+};
+
+struct ParameterEvent {
+  uint32_t start;
+  uint32_t end;  // Equal to start for a step.
+  uint8_t index;
+  int32_t from;
+  int32_t to;
+};
+
+struct Clock {
+  size_t voice;
+  uint32_t start;
+  uint32_t period;
+  uint32_t width;
+  uint32_t count;
+  uint8_t mask;
+};
+
+struct Voice {
+  std::string name;
+  ProcessorFunction function;
+  ControlMode control_mode;
+  uint8_t channel;
+  uint16_t parameter[kNumParameters];
+  std::vector<GateEvent> gates;
+  std::vector<ParameterEvent> parameters;
+};
+
+class Engine {
+ public:
+  Engine() { }
+  ~Engine();
+
+  // Returns false, with a message on stderr, if the script is invalid.
+  bool Load(FILE* script);
+
+  // Renders all voices. out is interleaved, num_voices() x length() samples.
+  void Render(std::vector<int16_t>* out);
+
+  inline size_t num_voices() const { return voices_.size(); }
+  inline uint32_t length() const { return length_; }
+  inline const Voice& voice(size_t index) const { return voices_[index]; }
+
+  static const char* function_name(ProcessorFunction function);
+
+ private:
+  bool ParseLine(const std::vector<std::string>& tokens);
+  bool ParseTime(const std::string& token, uint32_t* time);
+  bool FindVoices(const std::string& name, std::vector<Voice*>* voices);
+  void AddVoice(const std::string& name, ProcessorFunction function);
+  void DeleteProcessors();
+
+  std::vector<Voice> voices_;
+  std::vector<Clock> clocks_;
+  std::vector<Processors*> processors_;
+  uint32_t length_;
+  uint32_t seed_;
+  std::string error_;
+
+  DISALLOW_COPY_AND_ASSIGN(Engine);
+};
+
+}  // namespace peaks
+
+#endif  // PEAKS_TEST_ENGINE_ENGINE_H_
@@ -0,0 +1,147 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Renders a script with the host engine.
+//
+// usage: peaks_engine script.txt [-w out.wav] [-c out.csv] [-d decimation]
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+#include "peaks/test/engine/engine.h"
+
+using namespace peaks;
+using namespace std;
+
+void WriteWav(
+    FILE* fp,
+    const vector<int16_t>& samples,
+    uint16_t num_channels) {
+  uint32_t l;
+  uint16_t s;
+  uint32_t data_size = samples.size() * 2;
+
+  fwrite("RIFF", 4, 1, fp);
+  l = 36 + data_size;
+  fwrite(&l, 4, 1, fp);
+  fwrite("WAVE", 4, 1, fp);
+
+  fwrite("fmt ", 4, 1, fp);
+  l = 16;
+  fwrite(&l, 4, 1, fp);
+  s = 1;
+  fwrite(&s, 2, 1, fp);
+  s = num_channels;
+  fwrite(&s, 2, 1, fp);
+  l = kSampleRate;
+  fwrite(&l, 4, 1, fp);
+  l = static_cast<uint32_t>(kSampleRate) * 2 * num_channels;
+  fwrite(&l, 4, 1, fp);
+  s = 2 * num_channels;
+  fwrite(&s, 2, 1, fp);
+  s = 16;
+  fwrite(&s, 2, 1, fp);
+
+  fwrite("data", 4, 1, fp);
+  fwrite(&data_size, 4, 1, fp);
+  fwrite(&samples[0], 2, samples.size(), fp);
+}
+
+void WriteCsv(
+    FILE* fp,
+    const Engine& engine,
+    const vector<int16_t>& samples,
+    uint32_t decimation) {
+  size_t num_voices = engine.num_voices();
+  fprintf(fp, "time");
+  for (size_t i = 0; i < num_voices; ++i) {
+    fprintf(fp, ",%s", engine.voice(i).name.c_str());
+  }
+  fprintf(fp, "\n");
+  for (uint32_t t = 0; t < engine.length(); t += decimation) {
+    fprintf(fp, "%.6f", static_cast<double>(t) / kSampleRate);
+    for (size_t i = 0; i < num_voices; ++i) {
+      fprintf(fp, ",%d", samples[t * num_voices + i]);
+    }
+    fprintf(fp, "\n");
+  }
+}
+
+int main(int argc, char** argv) {
+  const char* script_file_name = NULL;
+  const char* wav_file_name = NULL;
+  const char* csv_file_name = NULL;
+  uint32_t decimation = 1;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-w") && i + 1 < argc) {
+      wav_file_name = argv[++i];
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      csv_file_name = argv[++i];
+    } else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+      decimation = atoi(argv[++i]);
+    } else {
+      script_file_name = argv[i];
+    }
+  }
+  if (!script_file_name || decimation == 0) {
+    fprintf(stderr, "usage: %s script.txt [-w out.wav] [-c out.csv] "
+            "[-d decimation]\n", argv[0]);
+    return 1;
+  }
+
+  FILE* script = fopen(script_file_name, "r");
+  if (!script) {
+    fprintf(stderr, "cannot open %s\n", script_file_name);
+    return 1;
+  }
+  Engine engine;
+  bool valid = engine.Load(script);
+  fclose(script);
+  if (!valid) {
+    return 1;
+  }
+
+  vector<int16_t> samples;
+  clock_t start = clock();
+  engine.Render(&samples);
+  double elapsed = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+  double rendered = static_cast<double>(engine.length()) * \
+      engine.num_voices() / kSampleRate;
+  fprintf(stderr, "%d voices, %.2fs: %.3fs CPU, %.0fx real time per voice\n",
+          static_cast<int>(engine.num_voices()),
+          static_cast<double>(engine.length()) / kSampleRate,
+          elapsed,
+          elapsed > 0.0 ? rendered / elapsed : 0.0);
+
+  if (wav_file_name) {
+    FILE* fp = fopen(wav_file_name, "wb");
+    if (fp) {
+      WriteWav(fp, samples, engine.num_voices());
+      fclose(fp);
+    }
+  }
+  if (csv_file_name) {
+    FILE* fp = fopen(csv_file_name, "w");
+    if (fp) {
+      WriteCsv(fp, engine, samples, decimation);
+      fclose(fp);
+    }
+  }
+  return 0;
+}
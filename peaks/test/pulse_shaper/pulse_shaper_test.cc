@@ -0,0 +1,307 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Checks the event queue of the pulse shaper against the original
+// implementation, which kept a set of counters per pulse train and updated
+// all of them at every tick. Both must output the same gate, for all the
+// combinations of pre-delay, duration (shorter and longer than the delay),
+// delay and number of repetitions, with the parameters changed while trains
+// are running.
+//
+// Also checks that the 16-bit times of the pulse randomizer queue wrap
+// around correctly.
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "stmlib/utils/dsp.h"
+
+#include "peaks/pulse_processor/pulse_queue.h"
+#include "peaks/pulse_processor/pulse_randomizer.h"
+#include "peaks/pulse_processor/pulse_shaper.h"
+#include "peaks/resources.h"
+
+using namespace peaks;
+using namespace stmlib;
+using namespace std;
+
+const uint32_t kNumTicks = 8000;
+
+uint32_t rng_state = 1;
+
+uint32_t NextRandom() {
+  rng_state = rng_state * 1664525L + 1013904223L;
+  return rng_state >> 8;
+}
+
+// The original pulse shaper, with as many slots as the queue.
+class CounterPulseShaper {
+ public:
+  CounterPulseShaper() { }
+  ~CounterPulseShaper() { }
+
+  void Init(
+      uint16_t initial_delay,
+      uint16_t duration,
+      uint16_t delay,
+      uint16_t num_repetitions) {
+    Configure(initial_delay, duration, delay, num_repetitions);
+    for (uint8_t i = 0; i < kMaxPulseTrains; ++i) {
+      pulse_[i].initial_delay_counter = 0;
+      pulse_[i].duration_counter = 0;
+      pulse_[i].delay_counter = 0;
+      pulse_[i].repetition_counter = 0;
+    }
+    previous_num_pulses_ = 0;
+    retrig_counter_ = 0;
+  }
+
+  void Configure(
+      uint16_t initial_delay,
+      uint16_t duration,
+      uint16_t delay,
+      uint16_t num_repetitions) {
+    initial_delay_ = initial_delay;
+    duration_ = duration;
+    delay_ = delay;
+    num_repetitions_ = num_repetitions >> 13;
+  }
+
+  uint16_t Process(bool new_pulse) {
+    uint8_t num_pulses = 0;
+    for (uint8_t i = 0; i < kMaxPulseTrains; ++i) {
+      Pulse& p = pulse_[i];
+      if (p.repetition_counter) {
+        if (p.delay_counter < p.duration_counter && p.repetition_counter > 1) {
+          p.duration_counter = p.delay_counter;
+        }
+        if (p.initial_delay_counter == 0) {
+          if (p.duration_counter) {
+            --p.duration_counter;
+            ++num_pulses;
+          }
+          if (p.delay_counter) {
+            --p.delay_counter;
+          } else {
+            --p.repetition_counter;
+            p.duration_counter = duration();
+            p.delay_counter = delay();
+          }
+        } else {
+          --p.initial_delay_counter;
+        }
+      } else if (new_pulse) {
+        p.repetition_counter = num_repetitions_ + 1;
+        p.initial_delay_counter = initial_delay();
+        p.duration_counter = duration();
+        p.delay_counter = delay();
+        new_pulse = false;
+        num_pulses += p.initial_delay_counter ? 0 : 1;
+      }
+    }
+    if (previous_num_pulses_ && num_pulses > previous_num_pulses_) {
+      retrig_counter_ = 6;
+    }
+    previous_num_pulses_ = num_pulses;
+    if (retrig_counter_) {
+      --retrig_counter_;
+    }
+    return num_pulses > 0 && !retrig_counter_ ? 20480 : 0;
+  }
+
+ private:
+  struct Pulse {
+    uint16_t initial_delay_counter;
+    uint16_t duration_counter;
+    uint16_t delay_counter;
+    uint16_t repetition_counter;
+  };
+
+  uint16_t delay() const {
+    return Interpolate88(lut_delay_times, delay_) - 1;
+  }
+
+  uint16_t duration() const {
+    return Interpolate88(lut_delay_times, duration_);
+  }
+
+  uint16_t initial_delay() const {
+    return Interpolate88(lut_delay_times, initial_delay_);
+  }
+
+  uint16_t initial_delay_;
+  uint16_t duration_;
+  uint16_t delay_;
+  uint16_t num_repetitions_;
+
+  uint16_t previous_num_pulses_;
+  uint16_t retrig_counter_;
+
+  Pulse pulse_[kMaxPulseTrains];
+
+  DISALLOW_COPY_AND_ASSIGN(CounterPulseShaper);
+};
+
+const uint16_t kInitialDelays[] = { 0x0000, 0x0600, 0x1c00 };
+const uint16_t kDurations[] = { 0x0000, 0x0380, 0x0a40, 0x1400, 0x2000 };
+const uint16_t kDelays[] = { 0x0000, 0x0500, 0x0c80, 0x1a00, 0x2800 };
+
+const uint8_t kNumDurations = sizeof(kDurations) / sizeof(uint16_t);
+const uint8_t kNumDelays = sizeof(kDelays) / sizeof(uint16_t);
+
+CounterPulseShaper reference;
+PulseShaper shaper;
+
+// Runs both shapers for kNumTicks ticks, with triggers spaced randomly by
+// 1 to 2 * spacing ticks. Halfway through, the duration and delay are changed
+// to the next ones in the lists. Returns the number of ticks with a high gate,
+// or -1 if the outputs differ.
+int32_t Run(
+    uint8_t initial_delay,
+    uint8_t duration,
+    uint8_t delay,
+    uint8_t num_repetitions,
+    uint32_t spacing) {
+  uint16_t parameter[4] = {
+    kInitialDelays[initial_delay],
+    static_cast<uint16_t>(kDurations[duration] << 1),
+    static_cast<uint16_t>(kDelays[delay] << 1),
+    static_cast<uint16_t>(num_repetitions << 13)
+  };
+  InputBuffer input;
+  OutputBuffer output;
+  input.Init();
+  output.Init();
+  shaper.Init();
+  shaper.Configure(parameter, CONTROL_MODE_FULL);
+  reference.Init(
+      parameter[0], parameter[1] >> 1, parameter[2] >> 1, parameter[3]);
+
+  int32_t num_high = 0;
+  uint32_t next_trigger = 0;
+  for (uint32_t t = 0; t < kNumTicks; ++t) {
+    if (t == kNumTicks / 2) {
+      parameter[1] = kDurations[(duration + 1) % kNumDurations] << 1;
+      parameter[2] = kDelays[(delay + 1) % kNumDelays] << 1;
+      shaper.Configure(parameter, CONTROL_MODE_FULL);
+      reference.Configure(
+          parameter[0], parameter[1] >> 1, parameter[2] >> 1, parameter[3]);
+    }
+    bool trigger = t == next_trigger;
+    if (trigger) {
+      next_trigger += 1 + NextRandom() % (2 * spacing);
+    }
+    for (uint8_t i = 0; i < kBlockSize; ++i) {
+      input.Overwrite(trigger && i == 0 ? CONTROL_GATE_RISING : 0);
+    }
+    shaper.FillBuffer(&input, &output);
+    uint16_t expected = reference.Process(trigger);
+    for (uint8_t i = 0; i < kBlockSize; ++i) {
+      uint16_t value = output.ImmediateRead();
+      if (value != expected) {
+        printf("pulse shaper: output %d instead of %d at tick %d ",
+               value, expected, t);
+        printf("(pre-delay %04x, duration %04x, delay %04x, %d repetitions, "
+               "spacing %d)\n",
+               parameter[0], parameter[1] >> 1, parameter[2] >> 1,
+               num_repetitions + 1, spacing);
+        return -1;
+      }
+    }
+    num_high += expected ? 1 : 0;
+  }
+  return num_high;
+}
+
+bool CheckPulseShaper() {
+  uint32_t num_runs = 0;
+  uint32_t num_high = 0;
+  for (uint8_t i = 0; i < sizeof(kInitialDelays) / sizeof(uint16_t); ++i) {
+    for (uint8_t d = 0; d < kNumDurations; ++d) {
+      for (uint8_t l = 0; l < kNumDelays; ++l) {
+        for (uint8_t r = 0; r < 8; ++r) {
+          // Keep about 24 trains running at once, well below the capacity
+          // of the queue, so that neither implementation drops triggers.
+          uint16_t delay = std::max(
+              Interpolate88(lut_delay_times, kDelays[l]),
+              Interpolate88(lut_delay_times, kDelays[(l + 1) % kNumDelays]));
+          uint32_t length = Interpolate88(
+              lut_delay_times, kInitialDelays[i]) + (r + 1) * delay;
+          uint32_t spacing = length / 24 + 1;
+          int32_t high = Run(i, d, l, r, spacing);
+          if (high < 0) {
+            return false;
+          }
+          ++num_runs;
+          num_high += high;
+        }
+      }
+    }
+  }
+  printf("pulse shaper: %d runs of %d ticks, %d high ticks, as expected\n",
+         num_runs, kNumTicks, num_high);
+  return true;
+}
+
+// Schedules pulses at random delays, up to the longest delay of the
+// randomizer, for long enough for the 16-bit times to wrap around many
+// times, and checks that each one is popped exactly when it is due.
+bool CheckQueueWrapAround() {
+  PulseQueue<TriggerPulse, kMaxTriggerPulses, kTriggerPulseTimeBits> queue;
+  vector<uint32_t> due;
+  queue.Init();
+  uint32_t num_popped = 0;
+  for (uint32_t now = 0; now < 1000000; ++now) {
+    TriggerPulse pulse = { 0 };
+    uint32_t num_due = 0;
+    for (size_t i = 0; i < due.size(); ) {
+      if (due[i] == now) {
+        due[i] = due.back();
+        due.pop_back();
+        ++num_due;
+      } else {
+        ++i;
+      }
+    }
+    while (queue.PopDue(&pulse)) {
+      if (!num_due) {
+        printf("queue: pulse popped too early at tick %d\n", now);
+        return false;
+      }
+      --num_due;
+      ++num_popped;
+    }
+    if (num_due) {
+      printf("queue: %d pulses not popped at tick %d\n", num_due, now);
+      return false;
+    }
+    if (NextRandom() % 256 == 0) {
+      uint32_t delay = 1 + NextRandom() % 60001;
+      if (queue.Schedule(pulse, delay)) {
+        due.push_back(now + delay);
+      }
+    }
+    queue.Tick();
+  }
+  printf("queue: %d pulses popped on time\n", num_popped);
+  return true;
+}
+
+int main(int argc, char** argv) {
+  bool success = CheckPulseShaper();
+  success = CheckQueueWrapAround() && success;
+  return success ? 0 : 1;
+}
@@ -0,0 +1,172 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// See http://creativecommons.org/licenses/MIT/ for more information.
+//
+// -----------------------------------------------------------------------------
+//
+// Stroke font for the plotter, characters 32 to 90 (lower case letters are
+// drawn as upper case). Each byte is a point on a 5x7 grid: bit 7 is set when
+// the beam draws a line to the point rather than jumping to it, bits 6..4 are
+// the x coordinate and bits 3..0 the y coordinate. 0xff ends a glyph.
+
+#ifndef TIDES_EASTER_EGG_PLOTTER_FONT_H_
+#define TIDES_EASTER_EGG_PLOTTER_FONT_H_
+
+#include "stmlib/stmlib.h"
+
+namespace tides {
+
+const uint8_t kFontFirstCharacter = 32;
+const uint8_t kFontLastCharacter = 90;
+const uint8_t kFontAdvance = 6;
+const uint8_t kFontEndOfGlyph = 0xff;
+
+const uint8_t font_glyphs[] = {
+  // 0x20
+  0xff,
+  // '!'
+  0x26, 0xa2, 0x20, 0xa0, 0xff,
+  // '"'
+  0xff,
+  // '#'
+  0xff,
+  // '$'
+  0xff,
+  // '%'
+  0xff,
+  // '&'
+  0xff,
+  // 0x27
+  0xff,
+  // '('
+  0xff,
+  // ')'
+  0xff,
+  // '*'
+  0xff,
+  // '+'
+  0x25, 0xa1, 0x03, 0xc3, 0xff,
+  // ','
+  0xff,
+  // '-'
+  0x13, 0xb3, 0xff,
+  // '.'
+  0x20, 0xa0, 0xff,
+  // '/'
+  0x00, 0xc6, 0xff,
+  // '0'
+  0x00, 0xc0, 0xc6, 0x86, 0x80, 0xc6, 0xff,
+  // '1'
+  0x15, 0xa6, 0xa0, 0x10, 0xb0, 0xff,
+  // '2'
+  0x06, 0xc6, 0xc3, 0x83, 0x80, 0xc0, 0xff,
+  // '3'
+  0x06, 0xc6, 0xc0, 0x80, 0x03, 0xc3, 0xff,
+  // '4'
+  0x06, 0x83, 0xc3, 0x46, 0xc0, 0xff,
+  // '5'
+  0x46, 0x86, 0x84, 0xb4, 0xc3, 0xc1, 0xb0, 0x80, 0xff,
+  // '6'
+  0x46, 0x86, 0x80, 0xc0, 0xc3, 0x83, 0xff,
+  // '7'
+  0x06, 0xc6, 0x90, 0xff,
+  // '8'
+  0x00, 0xc0, 0xc6, 0x86, 0x80, 0x03, 0xc3, 0xff,
+  // '9'
+  0x43, 0x83, 0x86, 0xc6, 0xc0, 0x80, 0xff,
+  // ':'
+  0x21, 0xa1, 0x25, 0xa5, 0xff,
+  // ';'
+  0xff,
+  // '<'
+  0x46, 0x83, 0xc0, 0xff,
+  // '='
+  0x02, 0xc2, 0x04, 0xc4, 0xff,
+  // '>'
+  0x06, 0xc3, 0x80, 0xff,
+  // '?'
+  0x05, 0x96, 0xb6, 0xc5, 0xc4, 0xa3, 0xa2, 0x20, 0xa0, 0xff,
+  // '@'
+  0xff,
+  // 'A'
+  0x00, 0x84, 0xa6, 0xc4, 0xc0, 0x03, 0xc3, 0xff,
+  // 'B'
+  0x00, 0x86, 0xb6, 0xc5, 0xc4, 0xb3, 0x83, 0x33, 0xc2, 0xc1, 0xb0, 0x80, 0xff,
+  // 'C'
+  0x46, 0x86, 0x80, 0xc0, 0xff,
+  // 'D'
+  0x00, 0x86, 0xa6, 0xc4, 0xc2, 0xa0, 0x80, 0xff,
+  // 'E'
+  0x46, 0x86, 0x80, 0xc0, 0x03, 0xb3, 0xff,
+  // 'F'
+  0x46, 0x86, 0x80, 0x03, 0xb3, 0xff,
+  // 'G'
+  0x46, 0x86, 0x80, 0xc0, 0xc3, 0xa3, 0xff,
+  // 'H'
+  0x06, 0x80, 0x46, 0xc0, 0x03, 0xc3, 0xff,
+  // 'I'
+  0x16, 0xb6, 0x26, 0xa0, 0x10, 0xb0, 0xff,
+  // 'J'
+  0x46, 0xc0, 0x80, 0x82, 0xff,
+  // 'K'
+  0x06, 0x80, 0x46, 0x83, 0xc0, 0xff,
+  // 'L'
+  0x06, 0x80, 0xc0, 0xff,
+  // 'M'
+  0x00, 0x86, 0xa3, 0xc6, 0xc0, 0xff,
+  // 'N'
+  0x00, 0x86, 0xc0, 0xc6, 0xff,
+  // 'O'
+  0x00, 0x86, 0xc6, 0xc0, 0x80, 0xff,
+  // 'P'
+  0x00, 0x86, 0xc6, 0xc3, 0x83, 0xff,
+  // 'Q'
+  0x00, 0x86, 0xc6, 0xc0, 0x80, 0x22, 0xc0, 0xff,
+  // 'R'
+  0x00, 0x86, 0xc6, 0xc3, 0x83, 0xc0, 0xff,
+  // 'S'
+  0x46, 0x86, 0x83, 0xc3, 0xc0, 0x80, 0xff,
+  // 'T'
+  0x06, 0xc6, 0x26, 0xa0, 0xff,
+  // 'U'
+  0x06, 0x80, 0xc0, 0xc6, 0xff,
+  // 'V'
+  0x06, 0xa0, 0xc6, 0xff,
+  // 'W'
+  0x06, 0x90, 0xa3, 0xb0, 0xc6, 0xff,
+  // 'X'
+  0x06, 0xc0, 0x46, 0x80, 0xff,
+  // 'Y'
+  0x06, 0xa3, 0xc6, 0x23, 0xa0, 0xff,
+  // 'Z'
+  0x06, 0xc6, 0x80, 0xc0, 0xff,
+};
+
+const uint16_t font_offsets[] = {
+  0, 1, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 20, 21, 24, 27, 30, 37, 43, 50, 57,
+  63, 72, 79, 83, 91, 98, 103, 104, 108, 113, 117, 127, 128, 136, 149, 154,
+  162, 169, 175, 182, 189, 196, 201, 207, 211, 217, 222, 228, 234, 242, 249,
+  256, 261, 266, 270, 276, 281, 287,
+};
+
+}  // namespace tides
+
+#endif  // TIDES_EASTER_EGG_PLOTTER_FONT_H_
@@ -1,205 +1,195 @@
-PlotInstruction plotter_program[] = {  { PLOT_MOVE_TO, 0, 32768, 9363 },
-  { PLOT_LINE_TO, 11, 29258, 12874 },
-  { PLOT_LINE_TO, 15, 22236, 12874 },
-  { PLOT_LINE_TO, 5, 23406, 14044 },
-  { PLOT_LINE_TO, 6, 21066, 14044 },
-  { PLOT_LINE_TO, 5, 22236, 15214 },
-  { PLOT_LINE_TO, 4, 21066, 15214 },
-  { PLOT_LINE_TO, 5, 22236, 16385 },
-  { PLOT_LINE_TO, 13, 16385, 16385 },
-  { PLOT_LINE_TO, 10, 19896, 18725 },
-  { PLOT_LINE_TO, 6, 22236, 18725 },
-  { PLOT_LINE_TO, 10, 25747, 21066 },
-  { PLOT_LINE_TO, 6, 28087, 21066 },
-  { PLOT_LINE_TO, 10, 31598, 23406 },
-  { PLOT_LINE_TO, 29, 31598, 37449 },
-  { PLOT_LINE_TO, 20, 22236, 37449 },
-  { PLOT_LINE_TO, 4, 22236, 36278 },
-  { PLOT_LINE_TO, 8, 24577, 33938 },
-  { PLOT_LINE_TO, 11, 24577, 29258 },
-  { PLOT_LINE_TO, 7, 23406, 26917 },
-  { PLOT_LINE_TO, 7, 21066, 25747 },
-  { PLOT_LINE_TO, 5, 22236, 24577 },
-  { PLOT_LINE_TO, 11, 17555, 24577 },
-  { PLOT_LINE_TO, 7, 19896, 25747 },
-  { PLOT_LINE_TO, 4, 21066, 25747 },
-  { PLOT_MOVE_TO, 0, 19896, 25747 },
-  { PLOT_LINE_TO, 7, 17555, 26917 },
-  { PLOT_MOVE_TO, 0, 18790, 27047 },
-  { PLOT_LINE_TO, 3, 19505, 27047 },
-  { PLOT_LINE_TO, 3, 19505, 27762 },
-  { PLOT_LINE_TO, 3, 18790, 27762 },
-  { PLOT_LINE_TO, 3, 18790, 27047 },
-  { PLOT_MOVE_TO, 0, 17555, 26917 },
-  { PLOT_LINE_TO, 9, 14044, 28087 },
-  { PLOT_LINE_TO, 8, 17555, 28087 },
-  { PLOT_LINE_TO, 4, 17555, 26917 },
-  { PLOT_MOVE_TO, 0, 17555, 28087 },
-  { PLOT_LINE_TO, 5, 18725, 29258 },
-  { PLOT_LINE_TO, 6, 21066, 29258 },
-  { PLOT_LINE_TO, 5, 22236, 30428 },
-  { PLOT_LINE_TO, 4, 22236, 31598 },
-  { PLOT_LINE_TO, 6, 19896, 31598 },
-  { PLOT_LINE_TO, 5, 21066, 32768 },
-  { PLOT_LINE_TO, 4, 21066, 33938 },
-  { PLOT_LINE_TO, 5, 19896, 35108 },
-  { PLOT_LINE_TO, 4, 18725, 35108 },
-  { PLOT_LINE_TO, 8, 15214, 35108 },
-  { PLOT_LINE_TO, 4, 14044, 35108 },
-  { PLOT_LINE_TO, 4, 14044, 33938 },
-  { PLOT_LINE_TO, 12, 18725, 31598 },
-  { PLOT_LINE_TO, 4, 19896, 31598 },
-  { PLOT_MOVE_TO, 0, 21066, 32768 },
-  { PLOT_MOVE_TO, 0, 21066, 33938 },
-  { PLOT_MOVE_TO, 0, 19896, 35108 },
-  { PLOT_MOVE_TO, 0, 18725, 35108 },
-  { PLOT_LINE_TO, 5, 17555, 36278 },
-  { PLOT_LINE_TO, 11, 14044, 39789 },
-  { PLOT_LINE_TO, 10, 10533, 42130 },
-  { PLOT_LINE_TO, 9, 7023, 43300 },
-  { PLOT_LINE_TO, 8, 3512, 43300 },
-  { PLOT_LINE_TO, 7, 1171, 42130 },
-  { PLOT_LINE_TO, 5, 1, 40959 },
-  { PLOT_LINE_TO, 5, 1171, 39789 },
-  { PLOT_LINE_TO, 12, 5852, 37449 },
-  { PLOT_LINE_TO, 20, 15214, 35108 },
-  { PLOT_MOVE_TO, 0, 18725, 35108 },
-  { PLOT_MOVE_TO, 0, 17555, 36278 },
-  { PLOT_LINE_TO, 4, 18725, 36278 },
-  { PLOT_LINE_TO, 4, 18725, 37449 },
-  { PLOT_LINE_TO, 4, 19896, 37449 },
-  { PLOT_LINE_TO, 4, 19896, 36278 },
-  { PLOT_LINE_TO, 4, 21066, 36278 },
-  { PLOT_LINE_TO, 4, 21066, 37449 },
-  { PLOT_LINE_TO, 4, 22236, 37449 },
-  { PLOT_MOVE_TO, 0, 21066, 37449 },
-  { PLOT_LINE_TO, 4, 19896, 37449 },
-  { PLOT_MOVE_TO, 0, 18725, 37449 },
-  { PLOT_LINE_TO, 4, 17555, 37449 },
-  { PLOT_LINE_TO, 6, 17555, 39789 },
-  { PLOT_LINE_TO, 8, 21066, 39789 },
-  { PLOT_LINE_TO, 6, 21066, 42130 },
-  { PLOT_LINE_TO, 8, 24577, 42130 },
-  { PLOT_LINE_TO, 6, 24577, 44470 },
-  { PLOT_LINE_TO, 15, 31598, 44470 },
-  { PLOT_LINE_TO, 6, 31598, 46811 },
-  { PLOT_LINE_TO, 15, 24577, 46811 },
-  { PLOT_LINE_TO, 8, 26917, 49151 },
-  { PLOT_LINE_TO, 8, 24577, 51492 },
-  { PLOT_LINE_TO, 6, 24577, 53832 },
-  { PLOT_LINE_TO, 8, 26917, 56173 },
-  { PLOT_LINE_TO, 24, 38619, 56173 },
-  { PLOT_LINE_TO, 8, 40959, 53832 },
-  { PLOT_LINE_TO, 33, 24577, 53832 },
-  { PLOT_MOVE_TO, 0, 40959, 53832 },
-  { PLOT_LINE_TO, 6, 40959, 51492 },
-  { PLOT_LINE_TO, 33, 24577, 51492 },
-  { PLOT_MOVE_TO, 0, 40959, 51492 },
-  { PLOT_LINE_TO, 8, 38619, 49151 },
-  { PLOT_LINE_TO, 24, 26917, 49151 },
-  { PLOT_MOVE_TO, 0, 38619, 49151 },
-  { PLOT_LINE_TO, 8, 40959, 46811 },
-  { PLOT_LINE_TO, 15, 33938, 46811 },
-  { PLOT_LINE_TO, 6, 31598, 46811 },
-  { PLOT_MOVE_TO, 0, 33938, 46811 },
-  { PLOT_LINE_TO, 6, 33938, 44470 },
-  { PLOT_LINE_TO, 6, 31598, 44470 },
-  { PLOT_MOVE_TO, 0, 33938, 44470 },
-  { PLOT_LINE_TO, 15, 40959, 44470 },
-  { PLOT_LINE_TO, 6, 40959, 42130 },
-  { PLOT_LINE_TO, 33, 24577, 42130 },
-  { PLOT_MOVE_TO, 0, 40959, 42130 },
-  { PLOT_LINE_TO, 8, 44470, 42130 },
-  { PLOT_LINE_TO, 6, 44470, 39789 },
-  { PLOT_LINE_TO, 47, 21066, 39789 },
-  { PLOT_MOVE_TO, 0, 44470, 39789 },
-  { PLOT_LINE_TO, 8, 47981, 39789 },
-  { PLOT_LINE_TO, 6, 47981, 37449 },
-  { PLOT_LINE_TO, 4, 46811, 37449 },
-  { PLOT_LINE_TO, 4, 46811, 36278 },
-  { PLOT_LINE_TO, 4, 47981, 36278 },
-  { PLOT_LINE_TO, 11, 51492, 39789 },
-  { PLOT_LINE_TO, 10, 55003, 42130 },
-  { PLOT_LINE_TO, 9, 58513, 43300 },
-  { PLOT_LINE_TO, 8, 62024, 43300 },
-  { PLOT_LINE_TO, 7, 64365, 42130 },
-  { PLOT_LINE_TO, 5, 65535, 40959 },
-  { PLOT_LINE_TO, 5, 64365, 39789 },
-  { PLOT_LINE_TO, 12, 59684, 37449 },
-  { PLOT_LINE_TO, 20, 50322, 35108 },
-  { PLOT_LINE_TO, 8, 46811, 35108 },
-  { PLOT_MOVE_TO, 0, 50322, 35108 },
-  { PLOT_LINE_TO, 4, 51492, 35108 },
-  { PLOT_LINE_TO, 4, 51492, 33938 },
-  { PLOT_LINE_TO, 12, 46811, 31598 },
-  { PLOT_LINE_TO, 4, 45640, 31598 },
-  { PLOT_LINE_TO, 5, 44470, 32768 },
-  { PLOT_LINE_TO, 4, 44470, 33938 },
-  { PLOT_LINE_TO, 5, 45640, 35108 },
-  { PLOT_LINE_TO, 4, 46811, 35108 },
-  { PLOT_LINE_TO, 5, 47981, 36278 },
-  { PLOT_MOVE_TO, 0, 46811, 35108 },
-  { PLOT_MOVE_TO, 0, 45640, 35108 },
-  { PLOT_MOVE_TO, 0, 44470, 33938 },
-  { PLOT_MOVE_TO, 0, 44470, 32768 },
-  { PLOT_MOVE_TO, 0, 45640, 31598 },
-  { PLOT_LINE_TO, 6, 43300, 31598 },
-  { PLOT_LINE_TO, 4, 43300, 30428 },
-  { PLOT_LINE_TO, 5, 44470, 29258 },
-  { PLOT_LINE_TO, 6, 46811, 29258 },
-  { PLOT_LINE_TO, 5, 47981, 28087 },
-  { PLOT_LINE_TO, 8, 51492, 28087 },
-  { PLOT_LINE_TO, 9, 47981, 26917 },
-  { PLOT_LINE_TO, 4, 47981, 28087 },
-  { PLOT_MOVE_TO, 0, 47981, 26917 },
-  { PLOT_LINE_TO, 7, 45640, 25747 },
-  { PLOT_MOVE_TO, 0, 46031, 27047 },
-  { PLOT_LINE_TO, 3, 46746, 27047 },
-  { PLOT_LINE_TO, 3, 46746, 27762 },
-  { PLOT_LINE_TO, 3, 46031, 27762 },
-  { PLOT_LINE_TO, 3, 46031, 27047 },
-  { PLOT_MOVE_TO, 0, 45640, 25747 },
-  { PLOT_LINE_TO, 7, 47981, 24577 },
-  { PLOT_LINE_TO, 11, 43300, 24577 },
-  { PLOT_LINE_TO, 5, 44470, 25747 },
-  { PLOT_LINE_TO, 4, 45640, 25747 },
-  { PLOT_MOVE_TO, 0, 44470, 25747 },
-  { PLOT_LINE_TO, 7, 42130, 26917 },
-  { PLOT_LINE_TO, 7, 40959, 29258 },
-  { PLOT_LINE_TO, 11, 40959, 33938 },
-  { PLOT_LINE_TO, 8, 43300, 36278 },
-  { PLOT_LINE_TO, 4, 43300, 37449 },
-  { PLOT_LINE_TO, 4, 44470, 37449 },
-  { PLOT_LINE_TO, 4, 44470, 36278 },
-  { PLOT_LINE_TO, 4, 45640, 36278 },
-  { PLOT_LINE_TO, 4, 45640, 37449 },
-  { PLOT_LINE_TO, 4, 46811, 37449 },
-  { PLOT_MOVE_TO, 0, 45640, 37449 },
-  { PLOT_LINE_TO, 4, 44470, 37449 },
-  { PLOT_MOVE_TO, 0, 43300, 37449 },
-  { PLOT_LINE_TO, 20, 33938, 37449 },
-  { PLOT_LINE_TO, 6, 31598, 37449 },
-  { PLOT_MOVE_TO, 0, 33938, 37449 },
-  { PLOT_LINE_TO, 29, 33938, 23406 },
-  { PLOT_LINE_TO, 6, 31598, 23406 },
-  { PLOT_MOVE_TO, 0, 33938, 23406 },
-  { PLOT_LINE_TO, 10, 37449, 21066 },
-  { PLOT_LINE_TO, 20, 28087, 21066 },
-  { PLOT_MOVE_TO, 0, 37449, 21066 },
-  { PLOT_LINE_TO, 6, 39789, 21066 },
-  { PLOT_LINE_TO, 10, 43300, 18725 },
-  { PLOT_LINE_TO, 43, 22236, 18725 },
-  { PLOT_MOVE_TO, 0, 43300, 18725 },
-  { PLOT_LINE_TO, 6, 45640, 18725 },
-  { PLOT_LINE_TO, 10, 49151, 16385 },
-  { PLOT_LINE_TO, 13, 43300, 16385 },
-  { PLOT_LINE_TO, 43, 22236, 16385 },
-  { PLOT_MOVE_TO, 0, 43300, 16385 },
-  { PLOT_LINE_TO, 5, 44470, 15214 },
-  { PLOT_LINE_TO, 6, 42130, 15214 },
-  { PLOT_LINE_TO, 5, 43300, 14044 },
-  { PLOT_LINE_TO, 6, 40959, 14044 },
-  { PLOT_LINE_TO, 5, 42130, 12874 },
-  { PLOT_LINE_TO, 13, 36278, 12874 },
-  { PLOT_LINE_TO, 11, 32768, 9363 },
-};
\ No newline at end of file
+// Generated by tides/easter_egg/svg2plot.py --legacy from plotter_program.h.
+// 982 bytes, 1390 samples per frame (34.5 frames/s), beam travel 81005.
+
+const uint8_t plotter_program[] = {
+  PLOT_MOVE_TO, 0x70, 0x7b, 0x50, 0x92,
+  PLOT_LINE_TO, 0x1a, 0x20, 0xa9, 0x50, 0x92,
+  PLOT_MOVE_TO, 0xb0, 0xad, 0x50, 0x92,
+  PLOT_LINE_REL, 0x03, 0x49, 0x00,
+  PLOT_MOVE_TO, 0xe0, 0xb6, 0x50, 0x92,
+  PLOT_LINE_REL, 0x03, 0xb6, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb6,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0x4a,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb6,
+  PLOT_LINE_TO, 0x07, 0x00, 0xa0, 0x90, 0x84,
+  PLOT_LINE_TO, 0x0a, 0x00, 0xa0, 0x50, 0x72,
+  PLOT_LINE_TO, 0x06, 0x90, 0xa4, 0x20, 0x69,
+  PLOT_LINE_TO, 0x06, 0xb0, 0xad, 0x90, 0x64,
+  PLOT_MOVE_TO, 0x40, 0xb2, 0x90, 0x64,
+  PLOT_LINE_TO, 0x06, 0x70, 0xbb, 0x20, 0x69,
+  PLOT_MOVE_TO, 0x40, 0xb2, 0x90, 0x64,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_REL, 0x04, 0xb7, 0xb7,
+  PLOT_LINE_TO, 0x0a, 0x70, 0xbb, 0x00, 0x60,
+  PLOT_LINE_TO, 0x06, 0x40, 0xb2, 0x90, 0x64,
+  PLOT_MOVE_TO, 0xd0, 0xb3, 0xa0, 0x69,
+  PLOT_LINE_REL, 0x02, 0x00, 0x2d,
+  PLOT_LINE_REL, 0x02, 0x2d, 0x00,
+  PLOT_LINE_REL, 0x02, 0x00, 0xd3,
+  PLOT_LINE_REL, 0x02, 0xd3, 0x00,
+  PLOT_MOVE_TO, 0x40, 0xb2, 0x70, 0x7b,
+  PLOT_LINE_TO, 0x05, 0x20, 0xa9, 0x70, 0x7b,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb7,
+  PLOT_LINE_REL, 0x04, 0x49, 0xb7,
+  PLOT_LINE_TO, 0x05, 0xe0, 0xb6, 0x50, 0x72,
+  PLOT_LINE_REL, 0x04, 0x49, 0xb6,
+  PLOT_LINE_TO, 0x08, 0x20, 0xc9, 0xb0, 0x6d,
+  PLOT_LINE_TO, 0x08, 0x70, 0xbb, 0x20, 0x69,
+  PLOT_LINE_REL, 0x03, 0x00, 0x49,
+  PLOT_MOVE_TO, 0x90, 0xc4, 0x20, 0x89,
+  PLOT_LINE_REL, 0x03, 0x49, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb7,
+  PLOT_LINE_TO, 0x0c, 0xe0, 0xb6, 0x70, 0x7b,
+  PLOT_LINE_REL, 0x03, 0xb6, 0x00,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_LINE_REL, 0x03, 0x00, 0x49,
+  PLOT_LINE_REL, 0x04, 0x49, 0x49,
+  PLOT_LINE_REL, 0x03, 0x4a, 0x00,
+  PLOT_LINE_REL, 0x04, 0x49, 0x49,
+  PLOT_MOVE_TO, 0xe0, 0xb6, 0x20, 0x89,
+  PLOT_LINE_TO, 0x08, 0x90, 0xc4, 0x20, 0x89,
+  PLOT_LINE_TO, 0x15, 0x20, 0xe9, 0x50, 0x92,
+  PLOT_LINE_TO, 0x0c, 0x70, 0xfb, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x04, 0xff, 0xff, 0x00, 0xa0,
+  PLOT_LINE_TO, 0x04, 0x70, 0xfb, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x06, 0x40, 0xf2, 0x20, 0xa9,
+  PLOT_LINE_TO, 0x08, 0x90, 0xe4, 0x20, 0xa9,
+  PLOT_LINE_TO, 0x08, 0xe0, 0xd6, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x09, 0x20, 0xc9, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x0b, 0x70, 0xbb, 0xb0, 0x8d,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0x4a,
+  PLOT_LINE_REL, 0x03, 0x49, 0x00,
+  PLOT_LINE_TO, 0x05, 0x70, 0xbb, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x08, 0xb0, 0xad, 0x70, 0x9b,
+  PLOT_MOVE_TO, 0x00, 0xa0, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x08, 0xb0, 0xad, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x05, 0xb0, 0xad, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x34, 0x50, 0x52, 0x70, 0x9b,
+  PLOT_MOVE_TO, 0x00, 0x60, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x24, 0x00, 0xa0, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x05, 0x00, 0xa0, 0xb0, 0xad,
+  PLOT_LINE_TO, 0x10, 0x90, 0x84, 0xb0, 0xad,
+  PLOT_MOVE_TO, 0x70, 0x7b, 0xb0, 0xad,
+  PLOT_LINE_TO, 0x05, 0x90, 0x84, 0xb0, 0xad,
+  PLOT_LINE_TO, 0x05, 0x90, 0x84, 0xe0, 0xb6,
+  PLOT_MOVE_TO, 0xe0, 0x96, 0x00, 0xc0,
+  PLOT_LINE_TO, 0x07, 0x00, 0xa0, 0xe0, 0xb6,
+  PLOT_LINE_TO, 0x15, 0x70, 0x7b, 0xe0, 0xb6,
+  PLOT_MOVE_TO, 0x20, 0x69, 0x00, 0xc0,
+  PLOT_LINE_TO, 0x1a, 0xe0, 0x96, 0x00, 0xc0,
+  PLOT_LINE_TO, 0x07, 0x00, 0xa0, 0x20, 0xc9,
+  PLOT_MOVE_TO, 0x00, 0xa0, 0x40, 0xd2,
+  PLOT_LINE_TO, 0x05, 0x00, 0xa0, 0x20, 0xc9,
+  PLOT_LINE_TO, 0x24, 0x00, 0x60, 0x20, 0xc9,
+  PLOT_MOVE_TO, 0x00, 0x60, 0x40, 0xd2,
+  PLOT_LINE_TO, 0x24, 0x00, 0xa0, 0x40, 0xd2,
+  PLOT_LINE_TO, 0x07, 0xe0, 0x96, 0x70, 0xdb,
+  PLOT_LINE_TO, 0x1a, 0x20, 0x69, 0x70, 0xdb,
+  PLOT_LINE_TO, 0x07, 0x00, 0x60, 0x40, 0xd2,
+  PLOT_LINE_TO, 0x05, 0x00, 0x60, 0x20, 0xc9,
+  PLOT_LINE_TO, 0x07, 0x20, 0x69, 0x00, 0xc0,
+  PLOT_LINE_TO, 0x07, 0x00, 0x60, 0xe0, 0xb6,
+  PLOT_LINE_TO, 0x10, 0x70, 0x7b, 0xe0, 0xb6,
+  PLOT_LINE_TO, 0x05, 0x70, 0x7b, 0xb0, 0xad,
+  PLOT_LINE_TO, 0x10, 0x00, 0x60, 0xb0, 0xad,
+  PLOT_LINE_TO, 0x05, 0x00, 0x60, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x08, 0x50, 0x52, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x05, 0x50, 0x52, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x08, 0x90, 0x44, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x05, 0x90, 0x44, 0x50, 0x92,
+  PLOT_LINE_REL, 0x03, 0x49, 0x00,
+  PLOT_MOVE_TO, 0xc0, 0x4d, 0x50, 0x92,
+  PLOT_LINE_REL, 0x03, 0x49, 0x00,
+  PLOT_MOVE_TO, 0xe0, 0x56, 0x50, 0x92,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb6,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0x4a,
+  PLOT_LINE_REL, 0x03, 0xb6, 0x00,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb6,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_MOVE_TO, 0x20, 0x49, 0x20, 0x89,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_LINE_TO, 0x0b, 0xe0, 0x36, 0x70, 0x9b,
+  PLOT_LINE_TO, 0x09, 0x20, 0x29, 0x90, 0xa4,
+  PLOT_LINE_TO, 0x08, 0x70, 0x1b, 0x20, 0xa9,
+  PLOT_LINE_TO, 0x08, 0xc0, 0x0d, 0x20, 0xa9,
+  PLOT_LINE_TO, 0x06, 0x90, 0x04, 0x90, 0xa4,
+  PLOT_LINE_REL, 0x04, 0xb7, 0xb7,
+  PLOT_LINE_REL, 0x04, 0x49, 0xb7,
+  PLOT_LINE_TO, 0x0c, 0xe0, 0x16, 0x50, 0x92,
+  PLOT_LINE_TO, 0x15, 0x70, 0x3b, 0x20, 0x89,
+  PLOT_MOVE_TO, 0x90, 0x44, 0xb0, 0x6d,
+  PLOT_LINE_REL, 0x04, 0x49, 0x4a,
+  PLOT_LINE_TO, 0x05, 0x50, 0x52, 0x50, 0x72,
+  PLOT_LINE_REL, 0x04, 0x49, 0x49,
+  PLOT_LINE_REL, 0x03, 0x00, 0x49,
+  PLOT_LINE_TO, 0x05, 0xc0, 0x4d, 0x70, 0x7b,
+  PLOT_LINE_REL, 0x04, 0x49, 0x49,
+  PLOT_LINE_REL, 0x03, 0x00, 0x49,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_LINE_TO, 0x0d, 0xe0, 0x36, 0x20, 0x89,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb7,
+  PLOT_LINE_TO, 0x0c, 0x20, 0x49, 0x70, 0x7b,
+  PLOT_LINE_REL, 0x03, 0x4a, 0x00,
+  PLOT_MOVE_TO, 0x60, 0x49, 0xa0, 0x69,
+  PLOT_LINE_REL, 0x02, 0x2d, 0x00,
+  PLOT_LINE_REL, 0x02, 0x00, 0x2d,
+  PLOT_LINE_REL, 0x02, 0xd3, 0x00,
+  PLOT_LINE_REL, 0x02, 0x00, 0xd3,
+  PLOT_MOVE_TO, 0x90, 0x44, 0x20, 0x69,
+  PLOT_LINE_TO, 0x08, 0xe0, 0x36, 0xb0, 0x6d,
+  PLOT_LINE_TO, 0x08, 0x90, 0x44, 0xb0, 0x6d,
+  PLOT_LINE_REL, 0x03, 0x00, 0xb7,
+  PLOT_LINE_TO, 0x06, 0xc0, 0x4d, 0x90, 0x64,
+  PLOT_MOVE_TO, 0x50, 0x52, 0x90, 0x64,
+  PLOT_LINE_REL, 0x03, 0xb7, 0x00,
+  PLOT_LINE_TO, 0x06, 0x90, 0x44, 0x00, 0x60,
+  PLOT_LINE_TO, 0x0a, 0xe0, 0x56, 0x00, 0x60,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_LINE_TO, 0x06, 0x70, 0x5b, 0x20, 0x69,
+  PLOT_LINE_TO, 0x06, 0x00, 0x60, 0x50, 0x72,
+  PLOT_LINE_TO, 0x0a, 0x00, 0x60, 0x90, 0x84,
+  PLOT_LINE_TO, 0x07, 0xe0, 0x56, 0xb0, 0x8d,
+  PLOT_LINE_REL, 0x03, 0x00, 0x4a,
+  PLOT_LINE_TO, 0x15, 0x70, 0x7b, 0x50, 0x92,
+  PLOT_LINE_TO, 0x1f, 0x70, 0x7b, 0x70, 0x5b,
+  PLOT_LINE_TO, 0x09, 0xb0, 0x6d, 0x50, 0x52,
+  PLOT_LINE_TO, 0x05, 0x90, 0x64, 0x50, 0x52,
+  PLOT_LINE_TO, 0x09, 0xe0, 0x56, 0x20, 0x49,
+  PLOT_LINE_TO, 0x05, 0xc0, 0x4d, 0x20, 0x49,
+  PLOT_LINE_TO, 0x09, 0x00, 0x40, 0x00, 0x40,
+  PLOT_LINE_TO, 0x0d, 0xe0, 0x56, 0x00, 0x40,
+  PLOT_LINE_REL, 0x04, 0xb7, 0xb7,
+  PLOT_LINE_REL, 0x03, 0x49, 0x00,
+  PLOT_LINE_REL, 0x04, 0xb7, 0xb7,
+  PLOT_LINE_TO, 0x05, 0x70, 0x5b, 0xe0, 0x36,
+  PLOT_LINE_REL, 0x04, 0xb7, 0xb7,
+  PLOT_LINE_TO, 0x10, 0x50, 0x72, 0x50, 0x32,
+  PLOT_LINE_TO, 0x0b, 0x00, 0x80, 0x90, 0x24,
+  PLOT_LINE_TO, 0x0b, 0xb0, 0x8d, 0x50, 0x32,
+  PLOT_LINE_TO, 0x0d, 0x90, 0xa4, 0x50, 0x32,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_LINE_TO, 0x05, 0x20, 0xa9, 0xe0, 0x36,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_LINE_TO, 0x05, 0xb0, 0xad, 0x70, 0x3b,
+  PLOT_LINE_REL, 0x04, 0xb7, 0x49,
+  PLOT_MOVE_TO, 0x20, 0xa9, 0x20, 0x49,
+  PLOT_LINE_TO, 0x05, 0x40, 0xb2, 0x20, 0x49,
+  PLOT_LINE_TO, 0x09, 0x00, 0xc0, 0x00, 0x40,
+  PLOT_LINE_TO, 0x3c, 0xe0, 0x56, 0x00, 0x40,
+  PLOT_MOVE_TO, 0xe0, 0x56, 0x20, 0x49,
+  PLOT_LINE_TO, 0x2f, 0x20, 0xa9, 0x20, 0x49,
+  PLOT_LINE_TO, 0x09, 0x70, 0x9b, 0x50, 0x52,
+  PLOT_LINE_TO, 0x05, 0x50, 0x92, 0x50, 0x52,
+  PLOT_MOVE_TO, 0x90, 0x84, 0x70, 0x5b,
+  PLOT_LINE_TO, 0x09, 0x50, 0x92, 0x50, 0x52,
+  PLOT_LINE_TO, 0x15, 0xb0, 0x6d, 0x50, 0x52,
+  PLOT_MOVE_TO, 0x70, 0x7b, 0x70, 0x5b,
+  PLOT_LINE_TO, 0x05, 0x90, 0x84, 0x70, 0x5b,
+  PLOT_LINE_TO, 0x1f, 0x90, 0x84, 0x50, 0x92,
+  PLOT_END,
+};
@@ -0,0 +1,997 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2026 Mutable Instruments contributors.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -----------------------------------------------------------------------------
+#
+# Compiles SVG drawings into programs for the X/Y plotter (tides/plotter.h).
+
+"""SVG to plotter program compiler.
+
+usage:
+  python tides/easter_egg/svg2plot.py \
+    [--speed 450] \
+    [--tolerance 64] \
+    [--margin 2048] \
+    [--grid 16] \
+    [--no_optimization] \
+    [--legacy] \
+    [--output_file tides/easter_egg/plotter_program.h] \
+    drawing.svg
+
+Supported elements: path (all commands), line, polyline, polygon, rect, circle,
+ellipse and text (rendered with the built-in stroke font), with nested
+transforms. The drawing is scaled to fit the DAC range. Curves are flattened,
+except circular arcs, which are drawn natively by the plotter.
+
+The optimizer removes degenerate segments, merges collinear ones, and reorders
+(and reverses) the paths to minimize the distance the beam travels between
+them - since the outputs cannot be blanked, these jumps are visible.
+
+With --legacy, the input is a plotter_program.h file in the older
+{ PLOT_*, steps, x, y } format, already in DAC coordinates.
+"""
+
+import logging
+import math
+import optparse
+import os
+import re
+import sys
+import xml.etree.ElementTree as ElementTree
+
+
+PLOT_END = 0
+PLOT_MOVE_TO = 1
+PLOT_LINE_TO = 2
+PLOT_LINE_REL = 3
+PLOT_ARC = 4
+PLOT_TEXT = 5
+
+OPCODE_NAMES = [
+    'PLOT_END', 'PLOT_MOVE_TO', 'PLOT_LINE_TO', 'PLOT_LINE_REL', 'PLOT_ARC',
+    'PLOT_TEXT']
+
+SAMPLE_RATE = 48000
+DAC_MAX = 65535
+RELATIVE_UNIT = 16
+POSITION_SHIFT = 15
+
+FONT_FIRST_CHARACTER = 32
+FONT_LAST_CHARACTER = 90
+FONT_ADVANCE = 6
+FONT_HEIGHT = 6
+
+# Minimum number of steps for a full circle, so that Minsky's algorithm stays
+# close to a true circle.
+MIN_STEPS_PER_TURN = 32
+
+IDENTITY = (1.0, 0.0, 0.0, 1.0, 0.0, 0.0)
+
+
+
+# -----------------------------------------------------------------------------
+# Geometry
+#
+# A path is a starting point and a list of segments:
+#   ('L', end)
+#   ('C', control_1, control_2, end)  - cubic Bezier curve.
+#   ('A', center, sweep, end)  - circular arc, sweep in radians, positive from
+#                                the x axis towards the y axis.
+# A text is a (position, size, string) tuple.
+# Transforms are (a, b, c, d, e, f) tuples, as in SVG.
+
+
+class Path(object):
+
+  def __init__(self, start):
+    self.start = start
+    self.segments = []
+
+  @property
+  def end(self):
+    return self.segments[-1][-1] if self.segments else self.start
+
+  def Reversed(self):
+    reversed_path = Path(self.end)
+    previous = self.start
+    for segment in self.segments:
+      if segment[0] == 'L':
+        reversed_path.segments.append(('L', previous))
+      elif segment[0] == 'C':
+        reversed_path.segments.append(
+            ('C', segment[2], segment[1], previous))
+      else:
+        reversed_path.segments.append(('A', segment[1], -segment[2], previous))
+      previous = segment[-1]
+    reversed_path.segments.reverse()
+    return reversed_path
+
+
+class Text(object):
+
+  def __init__(self, position, size, string):
+    self.start = position
+    self.size = size
+    self.string = string
+
+  @property
+  def end(self):
+    x, y = self.start
+    return (x + (len(self.string) * FONT_ADVANCE - 2) * self.size, y)
+
+
+def Distance(a, b):
+  return math.hypot(a[0] - b[0], a[1] - b[1])
+
+
+def Compose(m, n):
+  """Returns the transform applying n, then m."""
+  a, b, c, d, e, f = m
+  a2, b2, c2, d2, e2, f2 = n
+  return (
+      a * a2 + c * b2,
+      b * a2 + d * b2,
+      a * c2 + c * d2,
+      b * c2 + d * d2,
+      a * e2 + c * f2 + e,
+      b * e2 + d * f2 + f)
+
+
+def Apply(m, point):
+  a, b, c, d, e, f = m
+  x, y = point
+  return (a * x + c * y + e, b * x + d * y + f)
+
+
+def Determinant(m):
+  return m[0] * m[3] - m[1] * m[2]
+
+
+def IsSimilarity(m):
+  a, b, c, d = m[:4]
+  scale = a * a + b * b
+  return abs(scale - (c * c + d * d)) < 1e-6 * scale and \
+      abs(a * c + b * d) < 1e-6 * scale
+
+
+def ArcToBeziers(center, rx, ry, phi, theta, sweep):
+  """Approximates an elliptical arc by cubic Bezier curves."""
+  num_pieces = max(1, int(math.ceil(abs(sweep) / (math.pi / 2) - 1e-9)))
+  delta = sweep / num_pieces
+  alpha = 4.0 / 3.0 * math.tan(delta / 4)
+  cos_phi, sin_phi = math.cos(phi), math.sin(phi)
+
+  def Point(t, dx=0.0, dy=0.0):
+    x = rx * (math.cos(t) + dx)
+    y = ry * (math.sin(t) + dy)
+    return (
+        center[0] + x * cos_phi - y * sin_phi,
+        center[1] + x * sin_phi + y * cos_phi)
+
+  segments = []
+  for i in range(num_pieces):
+    t1 = theta + i * delta
+    t2 = t1 + delta
+    segments.append((
+        'C',
+        Point(t1, -alpha * math.sin(t1), alpha * math.cos(t1)),
+        Point(t2, alpha * math.sin(t2), -alpha * math.cos(t2)),
+        Point(t2)))
+  return segments
+
+
+def EndpointToCenter(start, end, rx, ry, phi, large_arc, sweep_flag):
+  """Converts SVG endpoint arc parameters (SVG spec, appendix F.6.5)."""
+  cos_phi, sin_phi = math.cos(phi), math.sin(phi)
+  hx = (start[0] - end[0]) / 2.0
+  hy = (start[1] - end[1]) / 2.0
+  x1 = cos_phi * hx + sin_phi * hy
+  y1 = -sin_phi * hx + cos_phi * hy
+  rx, ry = abs(rx), abs(ry)
+  scale = (x1 * x1) / (rx * rx) + (y1 * y1) / (ry * ry)
+  if scale > 1.0:
+    rx *= math.sqrt(scale)
+    ry *= math.sqrt(scale)
+  numerator = rx * rx * ry * ry - rx * rx * y1 * y1 - ry * ry * x1 * x1
+  denominator = rx * rx * y1 * y1 + ry * ry * x1 * x1
+  factor = math.sqrt(max(0.0, numerator / denominator))
+  if large_arc == sweep_flag:
+    factor = -factor
+  cx1 = factor * rx * y1 / ry
+  cy1 = -factor * ry * x1 / rx
+  center = (
+      cos_phi * cx1 - sin_phi * cy1 + (start[0] + end[0]) / 2.0,
+      sin_phi * cx1 + cos_phi * cy1 + (start[1] + end[1]) / 2.0)
+  theta = math.atan2((y1 - cy1) / ry, (x1 - cx1) / rx)
+  theta_end = math.atan2((-y1 - cy1) / ry, (-x1 - cx1) / rx)
+  sweep = theta_end - theta
+  if sweep_flag and sweep < 0:
+    sweep += 2 * math.pi
+  elif not sweep_flag and sweep > 0:
+    sweep -= 2 * math.pi
+  return center, rx, ry, theta, sweep
+
+
+def EllipticalArc(m, start, end, rx, ry, phi, large_arc, sweep_flag):
+  """Returns the transformed segments for an elliptical arc."""
+  if rx == 0 or ry == 0 or start == end:
+    return [('L', Apply(m, end))] if start != end else []
+  center, rx, ry, theta, sweep = EndpointToCenter(
+      start, end, rx, ry, phi, large_arc, sweep_flag)
+  return EllipseSegments(m, center, rx, ry, phi, theta, sweep, end)
+
+
+def EllipseSegments(m, center, rx, ry, phi, theta, sweep, end):
+  if abs(rx - ry) < 1e-6 * max(rx, ry) and IsSimilarity(m):
+    if Determinant(m) < 0:
+      sweep = -sweep
+    return [('A', Apply(m, center), sweep, Apply(m, end))]
+  segments = ArcToBeziers(center, rx, ry, phi, theta, sweep)
+  return [TransformSegment(m, segment) for segment in segments]
+
+
+def TransformSegment(m, segment):
+  if segment[0] == 'A':
+    sweep = segment[2] if Determinant(m) > 0 else -segment[2]
+    return ('A', Apply(m, segment[1]), sweep, Apply(m, segment[3]))
+  return (segment[0], ) + tuple(Apply(m, point) for point in segment[1:])
+
+
+def TransformPath(m, path):
+  transformed = Path(Apply(m, path.start))
+  transformed.segments = [TransformSegment(m, s) for s in path.segments]
+  return transformed
+
+
+def TransformText(m, text):
+  scale = math.sqrt(abs(Determinant(m)))
+  return Text(Apply(m, text.start), text.size * scale, text.string)
+
+
+
+# -----------------------------------------------------------------------------
+# SVG parsing
+
+
+NUMBER = r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?'
+
+
+def ParseNumbers(string):
+  return [float(x) for x in re.findall(NUMBER, string or '')]
+
+
+def ParseLength(string, default=0.0):
+  values = ParseNumbers(string)
+  return values[0] if values else default
+
+
+def ParseTransform(string):
+  m = IDENTITY
+  for name, arguments in re.findall(r'(\w+)\s*\(([^)]*)\)', string or ''):
+    v = ParseNumbers(arguments)
+    if name == 'matrix' and len(v) == 6:
+      t = tuple(v)
+    elif name == 'translate' and v:
+      t = (1.0, 0.0, 0.0, 1.0, v[0], v[1] if len(v) > 1 else 0.0)
+    elif name == 'scale' and v:
+      t = (v[0], 0.0, 0.0, v[1] if len(v) > 1 else v[0], 0.0, 0.0)
+    elif name == 'rotate' and v:
+      angle = math.radians(v[0])
+      cos_a, sin_a = math.cos(angle), math.sin(angle)
+      t = (cos_a, sin_a, -sin_a, cos_a, 0.0, 0.0)
+      if len(v) == 3:
+        t = Compose(
+            Compose((1.0, 0.0, 0.0, 1.0, v[1], v[2]), t),
+            (1.0, 0.0, 0.0, 1.0, -v[1], -v[2]))
+    elif name == 'skewX' and v:
+      t = (1.0, 0.0, math.tan(math.radians(v[0])), 1.0, 0.0, 0.0)
+    elif name == 'skewY' and v:
+      t = (1.0, math.tan(math.radians(v[0])), 0.0, 1.0, 0.0, 0.0)
+    else:
+      logging.warning('Ignoring transform %s(%s)' % (name, arguments))
+      continue
+    m = Compose(m, t)
+  return m
+
+
+def ParsePathData(m, data):
+  tokens = re.findall(r'[MmLlHhVvCcSsQqTtAaZz]|' + NUMBER, data)
+  paths = []
+  path = None
+  position = (0.0, 0.0)
+  subpath_start = (0.0, 0.0)
+  last_control = None
+  command = None
+  i = 0
+
+  def Arguments(n):
+    values = [float(x) for x in tokens[i:i + n]]
+    if len(values) != n:
+      raise ValueError('Truncated path data')
+    return values
+
+  while i < len(tokens):
+    if tokens[i].isalpha():
+      command = tokens[i]
+      i += 1
+      if command in 'Zz':
+        if path and position != subpath_start:
+          path.segments.append(('L', Apply(m, subpath_start)))
+        position = subpath_start
+        last_control = None
+        path = None
+        continue
+    if command is None:
+      raise ValueError('Path data must start with a command')
+    relative = command.islower()
+    origin = position if relative else (0.0, 0.0)
+
+    def Point(x, y):
+      return (x + origin[0], y + origin[1])
+
+    upper = command.upper()
+    if path is None and upper != 'M':
+      path = Path(Apply(m, position))
+      paths.append(path)
+
+    control = None
+    if upper == 'M':
+      x, y = Arguments(2)
+      i += 2
+      position = subpath_start = Point(x, y)
+      path = Path(Apply(m, position))
+      paths.append(path)
+      # Subsequent coordinate pairs are implicit line-to commands.
+      command = 'l' if relative else 'L'
+    elif upper in 'LHV':
+      if upper == 'L':
+        x, y = Arguments(2)
+        i += 2
+        end = Point(x, y)
+      elif upper == 'H':
+        x, = Arguments(1)
+        i += 1
+        end = (x + origin[0], position[1])
+      else:
+        y, = Arguments(1)
+        i += 1
+        end = (position[0], y + origin[1])
+      path.segments.append(('L', Apply(m, end)))
+      position = end
+    elif upper in 'CS':
+      if upper == 'C':
+        x1, y1, x2, y2, x, y = Arguments(6)
+        i += 6
+        c1 = Point(x1, y1)
+      else:
+        x2, y2, x, y = Arguments(4)
+        i += 4
+        c1 = position
+        if last_control and last_control[0] == 'C':
+          c1 = (2 * position[0] - last_control[1][0],
+                2 * position[1] - last_control[1][1])
+      c2 = Point(x2, y2)
+      end = Point(x, y)
+      path.segments.append(
+          ('C', Apply(m, c1), Apply(m, c2), Apply(m, end)))
+      control = ('C', c2)
+      position = end
+    elif upper in 'QT':
+      if upper == 'Q':
+        x1, y1, x, y = Arguments(4)
+        i += 4
+        q = Point(x1, y1)
+      else:
+        x, y = Arguments(2)
+        i += 2
+        q = position
+        if last_control and last_control[0] == 'Q':
+          q = (2 * position[0] - last_control[1][0],
+               2 * position[1] - last_control[1][1])
+      end = Point(x, y)
+      # Degree elevation to a cubic curve.
+      c1 = (position[0] + 2.0 / 3 * (q[0] - position[0]),
+            position[1] + 2.0 / 3 * (q[1] - position[1]))
+      c2 = (end[0] + 2.0 / 3 * (q[0] - end[0]),
+            end[1] + 2.0 / 3 * (q[1] - end[1]))
+      path.segments.append(
+          ('C', Apply(m, c1), Apply(m, c2), Apply(m, end)))
+      control = ('Q', q)
+      position = end
+    elif upper == 'A':
+      rx, ry, angle, large_arc, sweep_flag, x, y = Arguments(7)
+      i += 7
+      end = Point(x, y)
+      path.segments.extend(EllipticalArc(
+          m, position, end, rx, ry, math.radians(angle),
+          bool(large_arc), bool(sweep_flag)))
+      position = end
+    else:
+      raise ValueError('Unsupported path command %s' % command)
+    last_control = control
+  return paths
+
+
+def ParseStyle(element):
+  style = {}
+  for item in (element.get('style') or '').split(';'):
+    if ':' in item:
+      key, value = item.split(':', 1)
+      style[key.strip()] = value.strip()
+  return style
+
+
+def Polyline(m, points, closed):
+  points = [Apply(m, p) for p in points]
+  if not points:
+    return []
+  path = Path(points[0])
+  for point in points[1:]:
+    path.segments.append(('L', point))
+  if closed and len(points) > 1:
+    path.segments.append(('L', points[0]))
+  return [path]
+
+
+def ParseElement(element, m, paths, texts, font_size):
+  tag = element.tag.split('}')[-1]
+  style = ParseStyle(element)
+  if tag in ['defs', 'title', 'desc', 'metadata', 'clipPath', 'mask',
+             'symbol', 'style'] or \
+      style.get('display') == 'none' or element.get('display') == 'none':
+    return
+  m = Compose(m, ParseTransform(element.get('transform')))
+  font_size = ParseLength(
+      style.get('font-size', element.get('font-size')), font_size)
+  Length = lambda name: ParseLength(element.get(name))
+
+  if tag == 'path':
+    paths.extend(ParsePathData(m, element.get('d') or ''))
+  elif tag == 'line':
+    paths.extend(Polyline(
+        m, [(Length('x1'), Length('y1')), (Length('x2'), Length('y2'))],
+        False))
+  elif tag in ['polyline', 'polygon']:
+    v = ParseNumbers(element.get('points'))
+    paths.extend(Polyline(m, list(zip(v[0::2], v[1::2])), tag == 'polygon'))
+  elif tag == 'rect':
+    x, y, w, h = Length('x'), Length('y'), Length('width'), Length('height')
+    paths.extend(Polyline(
+        m, [(x, y), (x + w, y), (x + w, y + h), (x, y + h)], True))
+  elif tag in ['circle', 'ellipse']:
+    cx, cy = Length('cx'), Length('cy')
+    if tag == 'circle':
+      rx = ry = Length('r')
+    else:
+      rx, ry = Length('rx'), Length('ry')
+    if rx > 0 and ry > 0:
+      path = Path(Apply(m, (cx + rx, cy)))
+      path.segments = EllipseSegments(
+          m, (cx, cy), rx, ry, 0.0, 0.0, 2 * math.pi, (cx + rx, cy))
+      paths.append(path)
+  elif tag == 'text':
+    string = ''.join(element.itertext()).strip()
+    if string:
+      # Glyphs are 6 units high (capital letters), about 3/4 of the em box.
+      size = font_size * 0.75 / FONT_HEIGHT
+      position = (Length('x'), Length('y'))
+      # Glyph coordinates go upwards, SVG coordinates downwards.
+      flip = Compose(
+          m, (1.0, 0.0, 0.0, -1.0, position[0], position[1]))
+      texts.append(TransformText(flip, Text((0.0, 0.0), size, string)))
+    return
+
+  for child in element:
+    ParseElement(child, m, paths, texts, font_size)
+
+
+def LoadSvg(file_name):
+  root = ElementTree.parse(file_name).getroot()
+  m = IDENTITY
+  view_box = ParseNumbers(root.get('viewBox'))
+  if len(view_box) == 4:
+    m = (1.0, 0.0, 0.0, 1.0, -view_box[0], -view_box[1])
+  paths = []
+  texts = []
+  ParseElement(root, m, paths, texts, 16.0)
+  return paths, texts
+
+
+def LoadLegacyProgram(file_name):
+  paths = []
+  path = None
+  pattern = r'\{\s*(PLOT_MOVE_TO|PLOT_LINE_TO)\s*,\s*(\d+)\s*,\s*(\d+)\s*,' \
+      r'\s*(\d+)\s*\}'
+  for command, _, x, y in re.findall(pattern, open(file_name).read()):
+    point = (float(x), float(y))
+    if command == 'PLOT_MOVE_TO' or path is None:
+      path = Path(point)
+      paths.append(path)
+    else:
+      path.segments.append(('L', point))
+  return paths, []
+
+
+
+# -----------------------------------------------------------------------------
+# Fitting, flattening and clean-up
+
+
+def BoundingBox(paths, texts):
+  points = []
+  for path in paths:
+    points.append(path.start)
+    for segment in path.segments:
+      if segment[0] == 'A':
+        center = segment[1]
+        start = points[-1]
+        radius = Distance(center, start)
+        points.append((center[0] - radius, center[1] - radius))
+        points.append((center[0] + radius, center[1] + radius))
+      points.extend(segment[1:] if segment[0] != 'A' else segment[3:])
+  for text in texts:
+    x, y = text.start
+    points.append(text.start)
+    points.append((text.end[0], y - FONT_HEIGHT * text.size))
+  if not points:
+    return None
+  xs = [p[0] for p in points]
+  ys = [p[1] for p in points]
+  return min(xs), min(ys), max(xs), max(ys)
+
+
+def FitTransform(bounding_box, margin):
+  """Maps the drawing to the DAC range, with the y axis pointing up."""
+  x_min, y_min, x_max, y_max = bounding_box
+  width = max(x_max - x_min, 1e-9)
+  height = max(y_max - y_min, 1e-9)
+  span = DAC_MAX - 2 * margin
+  scale = span / max(width, height)
+  x_offset = margin + (span - width * scale) / 2.0
+  y_offset = margin + (span - height * scale) / 2.0
+  return (scale, 0.0, 0.0, -scale,
+          x_offset - x_min * scale,
+          y_offset + y_max * scale)
+
+
+def FlattenCubic(start, c1, c2, end, tolerance, segments, depth=0):
+  # Distance of the control points from the chord.
+  dx, dy = end[0] - start[0], end[1] - start[1]
+  length = math.hypot(dx, dy)
+  if length > 1e-9:
+    d1 = abs((c1[0] - start[0]) * dy - (c1[1] - start[1]) * dx) / length
+    d2 = abs((c2[0] - start[0]) * dy - (c2[1] - start[1]) * dx) / length
+  else:
+    d1 = Distance(c1, start)
+    d2 = Distance(c2, start)
+  if max(d1, d2) <= tolerance or depth >= 16:
+    segments.append(('L', end))
+    return
+  Mid = lambda a, b: ((a[0] + b[0]) / 2.0, (a[1] + b[1]) / 2.0)
+  p01, p12, p23 = Mid(start, c1), Mid(c1, c2), Mid(c2, end)
+  p012, p123 = Mid(p01, p12), Mid(p12, p23)
+  middle = Mid(p012, p123)
+  FlattenCubic(start, p01, p012, middle, tolerance, segments, depth + 1)
+  FlattenCubic(middle, p123, p23, end, tolerance, segments, depth + 1)
+
+
+def FlattenArc(start, center, sweep, end, tolerance, segments):
+  radius = Distance(start, center)
+  angle = math.atan2(start[1] - center[1], start[0] - center[0])
+  # The sagitta of each chord must stay below the tolerance.
+  max_step = 2 * math.acos(max(-1.0, 1.0 - tolerance / max(radius, 1e-9)))
+  n = max(1, int(math.ceil(abs(sweep) / max(max_step, 1e-3))))
+  for i in range(1, n):
+    a = angle + sweep * i / n
+    segments.append(('L', (center[0] + radius * math.cos(a),
+                           center[1] + radius * math.sin(a))))
+  segments.append(('L', end))
+
+
+def Round(x):
+  """Rounds to the nearest integer, ties to even.
+
+  The built-in round() breaks ties away from zero in python 2 and to even in
+  python 3; the grid and step counts are full of ties, so the rounding is done
+  explicitly for both versions to produce the same program."""
+  floor = math.floor(x)
+  remainder = x - floor
+  if remainder > 0.5 or (remainder == 0.5 and floor % 2 == 1):
+    floor += 1
+  return int(floor)
+
+
+def Clamp(x):
+  return min(max(x, 0), DAC_MAX)
+
+
+def Snap(point, grid):
+  return tuple(Clamp(Round(x / float(grid)) * grid) for x in point)
+
+
+def Flatten(path, tolerance, grid):
+  """Flattens curves, and snaps coordinates to the DAC grid."""
+  flat = Path(Snap(path.start, grid))
+  previous = path.start
+  for segment in path.segments:
+    if segment[0] == 'C':
+      lines = []
+      FlattenCubic(previous, segment[1], segment[2], segment[3], tolerance,
+                   lines)
+      flat.segments.extend(('L', Snap(line[1], grid)) for line in lines)
+    elif segment[0] == 'A':
+      center = tuple(Round(x) for x in segment[1])
+      if 0 <= center[0] <= DAC_MAX and 0 <= center[1] <= DAC_MAX:
+        flat.segments.append(
+            ('A', center, segment[2], Snap(segment[3], grid)))
+      else:
+        # The center of the arc cannot be encoded.
+        lines = []
+        FlattenArc(previous, segment[1], segment[2], segment[3], tolerance,
+                   lines)
+        flat.segments.extend(('L', Snap(line[1], grid)) for line in lines)
+    else:
+      flat.segments.append(('L', Snap(segment[1], grid)))
+    previous = segment[-1]
+  return flat
+
+
+def Simplify(path):
+  """Removes zero-length segments and merges collinear lines."""
+  simplified = Path(path.start)
+  segments = simplified.segments
+  for segment in path.segments:
+    previous = simplified.end
+    if segment[0] == 'L':
+      end = segment[1]
+      if end == previous:
+        continue
+      if segments and segments[-1][0] == 'L':
+        origin = simplified.start if len(segments) == 1 else \
+            segments[-2][-1]
+        ax, ay = previous[0] - origin[0], previous[1] - origin[1]
+        bx, by = end[0] - previous[0], end[1] - previous[1]
+        if ax * by - ay * bx == 0 and ax * bx + ay * by > 0:
+          segments[-1] = ('L', end)
+          continue
+    elif segment[0] == 'A':
+      if abs(segment[2]) < 1e-6:
+        if segment[3] != previous:
+          segments.append(('L', segment[3]))
+        continue
+    segments.append(segment)
+  return simplified
+
+
+
+# -----------------------------------------------------------------------------
+# Optimization of the drawing order
+
+
+def Travel(items):
+  """Total length of the jumps between items, the program being looped."""
+  if not items:
+    return 0.0
+  travel = 0.0
+  for i, item in enumerate(items):
+    travel += Distance(item.end, items[(i + 1) % len(items)].start)
+  return travel
+
+
+def Reverse(item):
+  return item.Reversed() if isinstance(item, Path) else item
+
+
+def NearestNeighbourOrder(items, start):
+  remaining = list(items)
+  ordered = []
+  position = start
+  while remaining:
+    best = None
+    best_distance = None
+    for index, item in enumerate(remaining):
+      candidates = [(item.start, False)]
+      if isinstance(item, Path):
+        candidates.append((item.end, True))
+      for point, reverse in candidates:
+        distance = Distance(position, point)
+        if best_distance is None or distance < best_distance:
+          best, best_distance = (index, reverse), distance
+      if best_distance == 0:
+        break
+    index, reverse = best
+    item = remaining.pop(index)
+    if reverse:
+      item = item.Reversed()
+    ordered.append(item)
+    position = item.end
+  return ordered
+
+
+def TwoOpt(items, max_passes=50):
+  """Reverses runs of paths as long as it shortens the jumps."""
+  n = len(items)
+  items = list(items)
+  for _ in range(max_passes):
+    improved = False
+    for i in range(1, n - 1):
+      for j in range(i + 1, n):
+        run = items[i:j + 1]
+        if any(isinstance(item, Text) for item in run):
+          continue
+        before = items[i - 1].end
+        after = items[(j + 1) % n].start
+        old = Distance(before, items[i].start) + Distance(items[j].end, after)
+        new = Distance(before, items[j].end) + Distance(items[i].start, after)
+        if new < old - 1e-6:
+          items[i:j + 1] = [Reverse(item) for item in reversed(run)]
+          improved = True
+    if not improved:
+      break
+  return items
+
+
+
+# -----------------------------------------------------------------------------
+# Code generation
+
+
+class Assembler(object):
+  """Emits instructions, tracking the beam position exactly as the firmware
+  computes it."""
+
+  def __init__(self, speed):
+    self.speed = speed
+    self.instructions = []
+    self.x = None
+    self.y = None
+    self.num_samples = 0
+
+  def Emit(self, opcode, *operands):
+    data = [opcode]
+    for value, size in operands:
+      if size == 1:
+        data.append(value & 0xff)
+      else:
+        data.extend([value & 0xff, (value >> 8) & 0xff])
+    self.instructions.append(data)
+
+  def Position(self):
+    return (self.x >> POSITION_SHIFT, self.y >> POSITION_SHIFT)
+
+  def Steps(self, length):
+    return max(1, Round(length / self.speed))
+
+  def MoveTo(self, point):
+    if self.x is not None and self.Position() == point:
+      return
+    self.Emit(PLOT_MOVE_TO, (point[0], 2), (point[1], 2))
+    self.x = point[0] << POSITION_SHIFT
+    self.y = point[1] << POSITION_SHIFT
+    self.num_samples += 1
+
+  def LineTo(self, point):
+    start = self.Position()
+    if start == point:
+      return
+    steps = self.Steps(Distance(start, point))
+    num_pieces = (steps + 254) // 255
+    for i in range(1, num_pieces + 1):
+      target = (
+          start[0] + (point[0] - start[0]) * i // num_pieces,
+          start[1] + (point[1] - start[1]) * i // num_pieces)
+      self.Line(target, (steps * i // num_pieces) - \
+          (steps * (i - 1) // num_pieces))
+
+  def Line(self, point, steps):
+    x, y = self.Position()
+    dx, dy = point[0] - x, point[1] - y
+    if dx % RELATIVE_UNIT == 0 and dy % RELATIVE_UNIT == 0 and \
+        -128 <= dx // RELATIVE_UNIT <= 127 and \
+        -128 <= dy // RELATIVE_UNIT <= 127:
+      self.Emit(PLOT_LINE_REL, (steps, 1),
+                (dx // RELATIVE_UNIT, 1), (dy // RELATIVE_UNIT, 1))
+    else:
+      self.Emit(PLOT_LINE_TO, (steps, 1), (point[0], 2), (point[1], 2))
+    self.x = point[0] << POSITION_SHIFT
+    self.y = point[1] << POSITION_SHIFT
+    self.num_samples += steps
+
+  def Arc(self, center, sweep, end, grid):
+    x, y = self.x, self.y
+    cx, cy = center[0] << POSITION_SHIFT, center[1] << POSITION_SHIFT
+    radius = math.hypot(x - cx, y - cy) / (1 << POSITION_SHIFT)
+    steps = max(
+        self.Steps(radius * abs(sweep)),
+        int(math.ceil(abs(sweep) / (2 * math.pi) * MIN_STEPS_PER_TURN)))
+    steps = min(steps, 65535)
+    k = Round(2 * math.sin(sweep / steps / 2) * 65536)
+    if k == 0:
+      self.LineTo(end)
+      return
+    self.Emit(PLOT_ARC, (steps, 2), (center[0], 2), (center[1], 2), (k, 2))
+    # Minsky's algorithm, with the same integer arithmetic as the firmware.
+    u, v = x - cx, y - cy
+    for _ in range(steps):
+      u -= (v * k) >> 16
+      v += (u * k) >> 16
+    self.x, self.y = cx + u, cy + v
+    self.num_samples += steps
+    if Distance(self.Position(), end) > grid / 2.0:
+      # Correct the accumulated error.
+      self.LineTo(end)
+
+  def Text(self, text):
+    size = max(1, min(255, Round(text.size / RELATIVE_UNIT)))
+    steps = max(1, min(255, self.Steps(size * RELATIVE_UNIT)))
+    x, y = [Clamp(Round(v)) for v in text.start]
+    string = text.string.upper()
+    width = (len(string) * FONT_ADVANCE - 1) * size * RELATIVE_UNIT
+    if x + width > DAC_MAX or y + FONT_HEIGHT * size * RELATIVE_UNIT > DAC_MAX:
+      logging.warning('Text "%s" does not fit in the DAC range' % string)
+    for c in string:
+      if not FONT_FIRST_CHARACTER <= ord(c) <= FONT_LAST_CHARACTER:
+        logging.warning('Character "%s" is not in the font' % c)
+    for offset in range(0, len(string), 255):
+      chunk = string[offset:offset + 255]
+      self.Emit(PLOT_TEXT, (x, 2), (y, 2), (size, 1), (steps, 1),
+                (len(chunk), 1), *[(ord(c), 1) for c in chunk])
+      x += len(chunk) * FONT_ADVANCE * size * RELATIVE_UNIT
+    # The position at the end of the text is not tracked - force the next
+    # instruction to be absolute.
+    self.x = self.y = None
+    self.num_samples += sum(
+        FONT_HEIGHT * steps * 2 for c in string if c != ' ')
+
+  def Path(self, path, grid):
+    self.MoveTo(path.start)
+    for segment in path.segments:
+      if segment[0] == 'L':
+        self.LineTo(segment[1])
+      else:
+        self.Arc(segment[1], segment[2], segment[3], grid)
+
+  def End(self):
+    self.Emit(PLOT_END)
+
+  def size(self):
+    return sum(len(instruction) for instruction in self.instructions)
+
+
+def WriteHeader(f, assembler, source_file_name, legacy, travel):
+  f.write('// Generated by tides/easter_egg/svg2plot.py %sfrom %s.\n' % (
+      '--legacy ' if legacy else '',
+      os.path.basename(source_file_name)))
+  f.write('// %d bytes, %d samples per frame (%.1f frames/s), beam travel '
+          '%d.\n\n' % (
+      assembler.size(),
+      assembler.num_samples,
+      SAMPLE_RATE / float(max(assembler.num_samples, 1)),
+      travel))
+  f.write('const uint8_t plotter_program[] = {\n')
+  for instruction in assembler.instructions:
+    line = '  ' + OPCODE_NAMES[instruction[0]] + ','
+    for value in instruction[1:]:
+      item = ' 0x%02x,' % value
+      if len(line) + len(item) > 80:
+        f.write(line + '\n')
+        line = '   '
+      line += item
+    f.write(line + '\n')
+  f.write('};\n')
+
+
+def Compile(paths, texts, options, source_file_name):
+  if not options.legacy:
+    bounding_box = BoundingBox(paths, texts)
+    if bounding_box is None:
+      logging.fatal('Nothing to draw')
+      sys.exit(1)
+    m = FitTransform(bounding_box, options.margin)
+    paths = [TransformPath(m, path) for path in paths]
+    texts = [TransformText(m, text) for text in texts]
+
+  grid = options.grid
+  paths = [Simplify(Flatten(path, options.tolerance, grid)) for path in paths]
+  paths = [path for path in paths if path.segments]
+  items = paths + texts
+  travel_before = Travel(items)
+  if options.optimize:
+    items = TwoOpt(NearestNeighbourOrder(items, (32768, 32768)))
+  travel_after = Travel(items)
+  logging.info('%d paths, %d texts' % (len(paths), len(texts)))
+  logging.info('Beam travel: %d -> %d' % (travel_before, travel_after))
+
+  assembler = Assembler(options.speed)
+  for item in items:
+    if isinstance(item, Text):
+      assembler.Text(item)
+    else:
+      assembler.Path(item, grid)
+  assembler.End()
+  logging.info('%d bytes, %d samples per frame' % (
+      assembler.size(), assembler.num_samples))
+  return assembler, travel_after
+
+
+if __name__ == '__main__':
+  parser = optparse.OptionParser()
+  parser.add_option(
+      '-s',
+      '--speed',
+      dest='speed',
+      type='float',
+      default=450.0,
+      help='Beam speed, in DAC codes per sample')
+  parser.add_option(
+      '-t',
+      '--tolerance',
+      dest='tolerance',
+      type='float',
+      default=64.0,
+      help='Maximum error when flattening curves, in DAC codes')
+  parser.add_option(
+      '-m',
+      '--margin',
+      dest='margin',
+      type='int',
+      default=2048,
+      help='Margin around the drawing, in DAC codes')
+  parser.add_option(
+      '-g',
+      '--grid',
+      dest='grid',
+      type='int',
+      default=RELATIVE_UNIT,
+      help='Snap coordinates to this grid (16 allows relative lines)')
+  parser.add_option(
+      '-n',
+      '--no_optimization',
+      dest='optimize',
+      action='store_false',
+      default=True,
+      help='Keep the drawing order of the source file')
+  parser.add_option(
+      '-l',
+      '--legacy',
+      dest='legacy',
+      action='store_true',
+      default=False,
+      help='Read a program in the older { PLOT_*, steps, x, y } format')
+  parser.add_option(
+      '-o',
+      '--output_file',
+      dest='output_file',
+      default=None,
+      help='Write output file to FILE',
+      metavar='FILE')
+
+  options, args = parser.parse_args()
+  if len(args) != 1:
+    logging.fatal('Specify one, and only one input file!')
+    sys.exit(1)
+
+  logging.basicConfig(level=logging.INFO, format='%(message)s')
+  if options.legacy:
+    paths, texts = LoadLegacyProgram(args[0])
+  else:
+    paths, texts = LoadSvg(args[0])
+
+  assembler, travel = Compile(paths, texts, options, args[0])
+  if options.output_file:
+    f = open(options.output_file, 'w')
+  else:
+    f = sys.stdout
+  WriteHeader(f, assembler, args[0], options.legacy, travel)
@@ -74,16 +74,20 @@ void Generator::Init() {
   phase_ = 0;
   set_pitch(60 << 7);
   output_buffer_.Init();
-  input_buffer_.Init();
-  pattern_predictor_.Init();
+  event_queue_.Init();
+  clock_follower_.Init(kSyncCounterMaxTime);
   for (uint16_t i = 0; i < kBlockSize; ++i) {
     GeneratorSample s;
     s.flags = 0;
     s.unipolar = 0;
     s.bipolar = 0;
     output_buffer_.Overwrite(s);
-    input_buffer_.Overwrite(0);
   }
+  input_time_ = kBlockSize;
+  render_time_ = 0;
+  previous_control_ = 0;
+  control_ = 0;
+  has_pending_event_ = false;
   
   antialiasing_ = true;
   shape_ = 0;
@@ -96,13 +100,10 @@ void Generator::Init() {
   
   ClearFilterState();
   
-  sync_counter_ = kSyncCounterMaxTime;
   frequency_ratio_.p = 1;
   frequency_ratio_.q = 1;
   sync_ = false;
   phase_increment_ = 9448928;
-  local_osc_phase_increment_ = phase_increment_;
-  target_phase_increment_ = phase_increment_;
 }
 
 void Generator::ComputeFrequencyRatio(int16_t pitch) {
@@ -233,6 +234,31 @@ int32_t Generator::ComputeAntialiasAttenuation(
   return p;
 }
 
+void Generator::FillBuffer() {
+  // Collect the events falling within this block. An event belonging to a
+  // future block is kept aside until its time comes.
+  ControlEvent events[kMaxNumControlEvents];
+  size_t num_events = 0;
+  while (num_events < kMaxNumControlEvents) {
+    if (!has_pending_event_) {
+      if (!event_queue_.readable()) {
+        break;
+      }
+      pending_event_ = event_queue_.ImmediateRead();
+      has_pending_event_ = true;
+    }
+    int32_t offset = pending_event_.timestamp - render_time_;
+    if (offset >= static_cast<int32_t>(kBlockSize)) {
+      break;
+    }
+    events[num_events].timestamp = offset < 0 ? 0 : offset;
+    events[num_events].control = pending_event_.control;
+    ++num_events;
+    has_pending_event_ = false;
+  }
+  FillBuffer(events, num_events);
+}
+
 // There are to our knowledge three ways of generating an "asymmetric" ramp:
 //
 // 1. Use the difference between two parabolic waves.
@@ -266,16 +292,14 @@ int32_t Generator::ComputeAntialiasAttenuation(
 // 2. has a terrible behaviour in the audio range, because it causes audible FM
 // when the slope parameter is modulated by a LFO.
 
-void Generator::FillBufferAudioRate() {
-  uint8_t size = kBlockSize;
-  
+void Generator::FillBufferAudioRate(
+    const ControlEvent* events,
+    size_t num_events) {
   GeneratorSample sample = previous_sample_;
   if (sync_) {
     pitch_ = ComputePitch(phase_increment_);
   } else {
     phase_increment_ = ComputePhaseIncrement(pitch_);
-    local_osc_phase_increment_ = phase_increment_;
-    target_phase_increment_ = phase_increment_;
   }
   if (pitch_ < 0) {
     pitch_ = 0;
@@ -350,130 +374,142 @@ void Generator::FillBufferAudioRate() {
     end_of_attack = phase_increment;
   }
   
-  while (size--) {
-    ++sync_counter_;
-    uint8_t control = input_buffer_.ImmediateRead();
-
+  const ControlEvent* last_event = events + num_events;
+  uint8_t control = control_;
+  size_t position = 0;
+  while (position < kBlockSize) {
+    size_t size = NextControlRun(&events, last_event, position, &control);
+    position += size;
+    
+    // The edge bits only apply to the first sample of the run, and the level
+    // bits to all of them: both are dealt with here, once per run.
+    bool freeze = control & CONTROL_FREEZE;
+    bool sustain = mode_ == GENERATOR_MODE_AR && (control & CONTROL_GATE);
+    if (sync_ && (control & CONTROL_CLOCK_RISING)) {
+      clock_follower_.Edge();
+    }
     // When freeze is high, discard any start/reset command.
-    if (!(control & CONTROL_FREEZE)) {
-      if (control & CONTROL_GATE_RISING) {
-        phase = 0;
-        running_ = true;
-      } else if (mode_ != GENERATOR_MODE_LOOPING && wrap) {
+    if (!freeze && (control & CONTROL_GATE_RISING)) {
+      phase = 0;
+      running_ = true;
+      // The start command wins over the end of cycle reached by the
+      // previous sample.
+      wrap = wrap && mode_ == GENERATOR_MODE_LOOPING;
+    }
+    control &= kControlLevelMask;
+    
+    if (freeze) {
+      // The output is held, but the local oscillator keeps on following the
+      // clock.
+      if (sync_) {
+        clock_follower_.Tick(size);
+        if (clock_follower_.has_period()) {
+          int32_t phase_error = clock_follower_.phase() - phase;
+          phase_increment = clock_follower_.phase_increment() + \
+              (phase_error >> 13);
+        }
+      }
+      while (size--) {
+        output_buffer_.Overwrite(sample);
+      }
+      continue;
+    }
+    
+    while (size--) {
+      if (mode_ != GENERATOR_MODE_LOOPING && wrap) {
         phase = 0;
         running_ = false;
       }
-    }
     
-    if (sync_) {
-      if (control & CONTROL_CLOCK_RISING) {
-        ++sync_edges_counter_;
-        if (sync_edges_counter_ >= frequency_ratio_.q) {
-          sync_edges_counter_ = 0;
-          if (sync_counter_ < kSyncCounterMaxTime && sync_counter_) {
-            uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
-                0xffffffff / sync_counter_);
-            if (increment > 0x80000000) {
-              increment = 0x80000000;
-            }
-            target_phase_increment_ = static_cast<uint32_t>(increment);
-            local_osc_phase_ = 0;
-          }
-          sync_counter_ = 0;
+      if (sync_) {
+        clock_follower_.Tick();
+        if (clock_follower_.has_period()) {
+          // Slow phase realignment between the master oscillator and the
+          // local oscillator locked to the external clock.
+          int32_t phase_error = clock_follower_.phase() - phase;
+          phase_increment = clock_follower_.phase_increment() + \
+              (phase_error >> 13);
         }
       }
-      // Fast tracking of the local oscillator to the external oscillator.
-      local_osc_phase_increment_ += static_cast<int32_t>(
-          target_phase_increment_ - local_osc_phase_increment_) >> 8;
-      local_osc_phase_ += local_osc_phase_increment_;
-      
-      // Slow phase realignment between the master oscillator and the local
-      // oscillator.
-      int32_t phase_error = local_osc_phase_ - phase;
-      phase_increment = local_osc_phase_increment_ + (phase_error >> 13);
-    }
     
-    if (control & CONTROL_FREEZE) {
-      output_buffer_.Overwrite(sample);
-      continue;
-    }
-    
-    bool sustained = mode_ == GENERATOR_MODE_AR
-        && phase >= (1UL << 31)
-        && control & CONTROL_GATE;
+      bool sustained = sustain && phase >= (1UL << 31);
 
-    if (sustained) {
-      phase = 1L << 31;
-    }
+      if (sustained) {
+        phase = 1L << 31;
+      }
 
 #ifndef CORE_ONLY
-    // Bipolar version ---------------------------------------------------------
-    int32_t ramp_a, ramp_b, saw;
-    int32_t original, folded;
-    ramp_a = Crossfade1022(wave_1, wave_2, phase + phase_offset_a_bi, xfade);
-    ramp_b = Crossfade1022(wave_1, wave_2, phase + phase_offset_b_bi, xfade);
-    saw = (ramp_b - ramp_a) * gain >> 10;
-    CLIP(saw);
+      // Bipolar version -------------------------------------------------------
+      int32_t ramp_a, ramp_b, saw;
+      int32_t original, folded;
+      ramp_a = Crossfade1022(wave_1, wave_2, phase + phase_offset_a_bi, xfade);
+      ramp_b = Crossfade1022(wave_1, wave_2, phase + phase_offset_b_bi, xfade);
+      saw = (ramp_b - ramp_a) * gain >> 10;
+      CLIP(saw);
     
-    // Appy shape waveshaper.
-    saw = Crossfade115(shape_1, shape_2, saw + 32768, shape_xfade);
-    if (!running_ && !sustained) {
-      saw = 0;
-    }
+      // Appy shape waveshaper.
+      saw = Crossfade115(shape_1, shape_2, saw + 32768, shape_xfade);
+      if (!running_ && !sustained) {
+        saw = 0;
+      }
 
-    // Run through LPF.
-    bi_lp_state_0 += f * (saw - bi_lp_state_0) >> 15;
-    bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 15;
+      // Run through LPF.
+      bi_lp_state_0 += f * (saw - bi_lp_state_0) >> 15;
+      bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 15;
     
-    // Fold.
-    original = bi_lp_state_1;
-    folded = Interpolate1022(wav_bipolar_fold, original * wf_gain + (1UL << 31));
-    sample.bipolar = original + ((folded - original) * wf_balance >> 15);
-
-    // Unipolar version --------------------------------------------------------
-    ramp_a = Crossfade1022(wave_1, wave_2, phase + phase_offset_a_uni, xfade);
-    ramp_b = Crossfade1022(wave_1, wave_2, phase + phase_offset_b_uni, xfade);
-    saw = (ramp_b - ramp_a) * gain >> 10;
-    CLIP(saw)
+      // Fold.
+      original = bi_lp_state_1;
+      folded = Interpolate1022(
+          wav_bipolar_fold,
+          original * wf_gain + (1UL << 31));
+      sample.bipolar = original + ((folded - original) * wf_balance >> 15);
+
+      // Unipolar version ------------------------------------------------------
+      ramp_a = Crossfade1022(wave_1, wave_2, phase + phase_offset_a_uni, xfade);
+      ramp_b = Crossfade1022(wave_1, wave_2, phase + phase_offset_b_uni, xfade);
+      saw = (ramp_b - ramp_a) * gain >> 10;
+      CLIP(saw)
     
-    // Appy shape waveshaper.
-    saw = Crossfade115(shape_1, shape_2, (saw >> 1) + 32768 + 16384,
-                       shape_xfade);
-    if (!running_ && !sustained) {
-      saw = 0;
-    }
-    // Run through LPF.
-    uni_lp_state_0 += f * (saw - uni_lp_state_0) >> 15;
-    uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 15;
+      // Appy shape waveshaper.
+      saw = Crossfade115(shape_1, shape_2, (saw >> 1) + 32768 + 16384,
+                         shape_xfade);
+      if (!running_ && !sustained) {
+        saw = 0;
+      }
+      // Run through LPF.
+      uni_lp_state_0 += f * (saw - uni_lp_state_0) >> 15;
+      uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 15;
     
-    // Fold.
-    original = uni_lp_state_1 << 1;
-    folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
-    sample.unipolar = original + ((folded - original) * wf_balance >> 15);
+      // Fold.
+      original = uni_lp_state_1 << 1;
+      folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
+      sample.unipolar = original + ((folded - original) * wf_balance >> 15);
 #else    
-    sample.bipolar = (phase >> 16) - 32768;
-    sample.unipolar = phase >> 16;
+      sample.bipolar = (phase >> 16) - 32768;
+      sample.unipolar = phase >> 16;
 #endif  // CORE_ONLY
     
-    sample.flags = 0;
-    bool looped = mode_ == GENERATOR_MODE_LOOPING && wrap;
-    if (phase >= end_of_attack || !running_) {
-      sample.flags |= FLAG_END_OF_ATTACK;
-    }
-    if (!running_ || looped) {
-       eor_counter_ = phase_increment < 44739242 ? 48 : 1;
-    }
-    if (eor_counter_) {
-       sample.flags |= FLAG_END_OF_RELEASE;
-       --eor_counter_;
-    }
-    output_buffer_.Overwrite(sample);
+      sample.flags = 0;
+      bool looped = mode_ == GENERATOR_MODE_LOOPING && wrap;
+      if (phase >= end_of_attack || !running_) {
+        sample.flags |= FLAG_END_OF_ATTACK;
+      }
+      if (!running_ || looped) {
+         eor_counter_ = phase_increment < 44739242 ? 48 : 1;
+      }
+      if (eor_counter_) {
+         sample.flags |= FLAG_END_OF_RELEASE;
+         --eor_counter_;
+      }
+      output_buffer_.Overwrite(sample);
     
-    if (running_ && !sustained) {
-      phase += phase_increment;
-      wrap = phase < phase_increment;
+      if (running_ && !sustained) {
+        phase += phase_increment;
+        wrap = phase < phase_increment;
+      }
     }
   }
+  control_ = control;
   
   uni_lp_state_[0] = uni_lp_state_0;
   uni_lp_state_[1] = uni_lp_state_1;
@@ -486,15 +522,13 @@ void Generator::FillBufferAudioRate() {
   wrap_ = wrap;
 }
 
-void Generator::FillBufferControlRate() {
-  uint8_t size = kBlockSize;
-  
+void Generator::FillBufferControlRate(
+    const ControlEvent* events,
+    size_t num_events) {
   if (sync_) {
     pitch_ = ComputePitch(phase_increment_);
   } else {
     phase_increment_ = ComputePhaseIncrement(pitch_);
-    local_osc_phase_increment_ = phase_increment_;
-    target_phase_increment_ = phase_increment_;
   }
   
   GeneratorSample sample = previous_sample_;
@@ -534,147 +568,180 @@ void Generator::FillBufferControlRate() {
   uint32_t attack_factor = 1 << kSlopeBits;
   uint32_t decay_factor = 1 << kSlopeBits;
   
-  while (size--) {
-    sync_counter_++;
-    // Low-pass filter the slope parameter.
-    smoothed_slope += (slope_ - smoothed_slope) >> 4;
+  const ControlEvent* last_event = events + num_events;
+  uint8_t control = control_;
+  size_t position = 0;
+  while (position < kBlockSize) {
+    size_t size = NextControlRun(&events, last_event, position, &control);
+    position += size;
     
-    uint8_t control = input_buffer_.ImmediateRead();
-
+    // The edge bits only apply to the first sample of the run, and the level
+    // bits to all of them: both are dealt with here, once per run.
+    bool freeze = control & CONTROL_FREEZE;
+    bool sustain = mode_ == GENERATOR_MODE_AR && (control & CONTROL_GATE);
+    bool triggered = control & CONTROL_GATE_RISING;
+    if (sync_ && (control & CONTROL_CLOCK_RISING)) {
+      clock_follower_.Edge();
+    }
     // When freeze is high, discard any start/reset command.
-    if (!(control & CONTROL_FREEZE)) {
-      if (control & CONTROL_GATE_RISING) {
-        phase = 0;
-        running_ = true;
-      } else if (mode_ != GENERATOR_MODE_LOOPING && wrap) {
-        running_ = false;
-        phase = 0;
+    if (!freeze && triggered) {
+      phase = 0;
+      running_ = true;
+      // The start command wins over the end of cycle reached by the
+      // previous sample.
+      wrap = wrap && mode_ == GENERATOR_MODE_LOOPING;
+    }
+    control &= kControlLevelMask;
+    
+    if (freeze) {
+      // The output is held, but the slope parameter is still smoothed, and
+      // the local oscillator keeps on following the clock.
+      if (sync_) {
+        clock_follower_.Tick(size);
+        if (clock_follower_.has_period()) {
+          phase_increment = clock_follower_.phase_increment();
+          if (mode_ == GENERATOR_MODE_LOOPING) {
+            int32_t phase_error = clock_follower_.phase() - phase;
+            phase_increment += static_cast<int64_t>(phase_error) * \
+                phase_increment >> 33;
+          }
+        }
+      }
+      while (size--) {
+        smoothed_slope += (slope_ - smoothed_slope) >> 4;
+        output_buffer_.Overwrite(sample);
       }
+      continue;
     }
     
-    if ((control & CONTROL_CLOCK_RISING) && sync_ && sync_counter_) {
-      if (sync_counter_ >= kSyncCounterMaxTime) {
+    while (size--) {
+      // Low-pass filter the slope parameter.
+      smoothed_slope += (slope_ - smoothed_slope) >> 4;
+    
+      if (mode_ != GENERATOR_MODE_LOOPING && wrap) {
+        running_ = false;
         phase = 0;
-      } else {
-        uint32_t predicted_period = pattern_predictor_.Predict(sync_counter_);
-        uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
-            0xffffffff / (predicted_period * frequency_ratio_.q));
-        if (increment > 0x80000000) {
-          increment = 0x80000000;
+      }
+    
+      if (sync_) {
+        clock_follower_.Tick();
+        if (clock_follower_.has_period()) {
+          phase_increment = clock_follower_.phase_increment();
+          // In looping mode, the phase is gently pulled towards the phase of
+          // the local oscillator - by at most 25% of the frequency.
+          if (mode_ == GENERATOR_MODE_LOOPING) {
+            int32_t phase_error = clock_follower_.phase() - phase;
+            phase_increment += static_cast<int64_t>(phase_error) * \
+                phase_increment >> 33;
+          }
         }
-        phase_increment = static_cast<uint32_t>(increment);
       }
-      sync_counter_ = 0;
-    }
     
-    if (control & CONTROL_FREEZE) {
-      output_buffer_.Overwrite(sample);
-      continue;
-    }
+      // Recompute the waveshaping parameters only when the slope has changed.
+      if (smoothed_slope != previous_smoothed_slope) {
+         uint32_t slope_offset = Interpolate88(
+              lut_slope_compression, smoothed_slope + 32768);
+        if (slope_offset <= 1) {
+          decay_factor = 32768 << kSlopeBits;
+          attack_factor = 1 << (kSlopeBits - 1);
+        } else {
+          decay_factor = (32768 << kSlopeBits) / slope_offset;
+          attack_factor = (32768 << kSlopeBits) / (65536 - slope_offset);
+        }
+        previous_smoothed_slope = smoothed_slope;
+        end_of_attack = slope_offset << 16;
+      }
     
-    // Recompute the waveshaping parameters only when the slope has changed.
-    if (smoothed_slope != previous_smoothed_slope) {
-       uint32_t slope_offset = Interpolate88(
-            lut_slope_compression, smoothed_slope + 32768);
-      if (slope_offset <= 1) {
-        decay_factor = 32768 << kSlopeBits;
-        attack_factor = 1 << (kSlopeBits - 1);
+      uint32_t skewed_phase = phase;
+      if (phase <= end_of_attack) {
+        skewed_phase = (phase >> kSlopeBits) * decay_factor;
       } else {
-        decay_factor = (32768 << kSlopeBits) / slope_offset;
-        attack_factor = (32768 << kSlopeBits) / (65536 - slope_offset);
+        skewed_phase = ((phase - end_of_attack) >> kSlopeBits) * attack_factor;
+        skewed_phase += 1L << 31;
       }
-      previous_smoothed_slope = smoothed_slope;
-      end_of_attack = slope_offset << 16;
-    }
-    
-    uint32_t skewed_phase = phase;
-    if (phase <= end_of_attack) {
-      skewed_phase = (phase >> kSlopeBits) * decay_factor;
-    } else {
-      skewed_phase = ((phase - end_of_attack) >> kSlopeBits) * attack_factor;
-      skewed_phase += 1L << 31;
-    }
 
-    bool sustained = mode_ == GENERATOR_MODE_AR
-        && phase >= end_of_attack
-        && control & CONTROL_GATE;
+      bool sustained = sustain && phase >= end_of_attack;
 
-    if (sustained) {
-      skewed_phase = 1L << 31;
-      phase = end_of_attack + 1;
-    }
+      if (sustained) {
+        skewed_phase = 1L << 31;
+        phase = end_of_attack + 1;
+      }
 
 #ifndef CORE_ONLY  
-    int32_t original, folded;
-    int32_t unipolar = Crossfade115(
-        shape_1,
-        shape_2,
-        skewed_phase >> 16, shape_xfade);
-    uni_lp_state_0 += f * ((unipolar << 16) - uni_lp_state_0) >> 31;
-    uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 31;
+      int32_t original, folded;
+      int32_t unipolar = Crossfade115(
+          shape_1,
+          shape_2,
+          skewed_phase >> 16, shape_xfade);
+      uni_lp_state_0 += f * ((unipolar << 16) - uni_lp_state_0) >> 31;
+      uni_lp_state_1 += f * (uni_lp_state_0 - uni_lp_state_1) >> 31;
     
-    original = uni_lp_state_1 >> 15;
-    folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
-    sample.unipolar = original + ((folded - original) * wf_balance >> 15);
+      original = uni_lp_state_1 >> 15;
+      folded = Interpolate1022(wav_unipolar_fold, original * wf_gain) << 1;
+      sample.unipolar = original + ((folded - original) * wf_balance >> 15);
     
-    int32_t bipolar = Crossfade115(
-        shape_1,
-        shape_2,
-        skewed_phase >> 15, shape_xfade);
-    if (skewed_phase >= (1UL << 31)) {
-      bipolar = -bipolar;
-    }
+      int32_t bipolar = Crossfade115(
+          shape_1,
+          shape_2,
+          skewed_phase >> 15, shape_xfade);
+      if (skewed_phase >= (1UL << 31)) {
+        bipolar = -bipolar;
+      }
     
-    bi_lp_state_0 += f * ((bipolar << 16) - bi_lp_state_0) >> 31;
-    bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 31;
+      bi_lp_state_0 += f * ((bipolar << 16) - bi_lp_state_0) >> 31;
+      bi_lp_state_1 += f * (bi_lp_state_0 - bi_lp_state_1) >> 31;
     
-    original = bi_lp_state_1 >> 16;
-    folded = Interpolate1022(wav_bipolar_fold, original * wf_gain + (1UL << 31));
-    sample.bipolar = original + ((folded - original) * wf_balance >> 15);
+      original = bi_lp_state_1 >> 16;
+      folded = Interpolate1022(
+          wav_bipolar_fold,
+          original * wf_gain + (1UL << 31));
+      sample.bipolar = original + ((folded - original) * wf_balance >> 15);
 
 #else    
-    sample.bipolar = (skewed_phase >> 16) - 32768;
-    sample.unipolar = skewed_phase >> 16;
+      sample.bipolar = (skewed_phase >> 16) - 32768;
+      sample.unipolar = skewed_phase >> 16;
 #endif  // CORE_ONLY
 
-    uint32_t adjusted_end_of_attack = end_of_attack;
-    if (adjusted_end_of_attack >= phase_increment) {
-      adjusted_end_of_attack -= phase_increment;
-    }
-    if (adjusted_end_of_attack < phase_increment) {
-      adjusted_end_of_attack = phase_increment;
-    }
+      uint32_t adjusted_end_of_attack = end_of_attack;
+      if (adjusted_end_of_attack >= phase_increment) {
+        adjusted_end_of_attack -= phase_increment;
+      }
+      if (adjusted_end_of_attack < phase_increment) {
+        adjusted_end_of_attack = phase_increment;
+      }
 
-    sample.flags = 0;
-    bool looped = mode_ == GENERATOR_MODE_LOOPING && wrap;
-    if (phase >= adjusted_end_of_attack || !running_ || sustained) {
-      sample.flags |= FLAG_END_OF_ATTACK;
-    }
-    if (!running_ || looped) {
-       eor_counter_ = phase_increment < 44739242 ? 48 : 1;
-    }
-    if (eor_counter_) {
-       sample.flags |= FLAG_END_OF_RELEASE;
-       --eor_counter_;
-    }
-    // Two special cases for the "pure decay" scenario:
-    // END_OF_ATTACK is always true except at the initial trigger.
-    if (end_of_attack == 0) {
-      sample.flags |= FLAG_END_OF_ATTACK;
-    }
-    bool triggered = control & CONTROL_GATE_RISING;
-    if ((sustained || end_of_attack == 0) && (triggered || looped)) {
-      sample.flags &= ~FLAG_END_OF_ATTACK;
-    }
+      sample.flags = 0;
+      bool looped = mode_ == GENERATOR_MODE_LOOPING && wrap;
+      if (phase >= adjusted_end_of_attack || !running_ || sustained) {
+        sample.flags |= FLAG_END_OF_ATTACK;
+      }
+      if (!running_ || looped) {
+         eor_counter_ = phase_increment < 44739242 ? 48 : 1;
+      }
+      if (eor_counter_) {
+         sample.flags |= FLAG_END_OF_RELEASE;
+         --eor_counter_;
+      }
+      // Two special cases for the "pure decay" scenario:
+      // END_OF_ATTACK is always true except at the initial trigger.
+      if (end_of_attack == 0) {
+        sample.flags |= FLAG_END_OF_ATTACK;
+      }
+      if ((sustained || end_of_attack == 0) && (triggered || looped)) {
+        sample.flags &= ~FLAG_END_OF_ATTACK;
+      }
+      triggered = false;
     
-    output_buffer_.Overwrite(sample);
-    if (running_ && !sustained) {
-      phase += phase_increment;
-      wrap = phase < phase_increment;
-    } else {
-      wrap = false;
+      output_buffer_.Overwrite(sample);
+      if (running_ && !sustained) {
+        phase += phase_increment;
+        wrap = phase < phase_increment;
+      } else {
+        wrap = false;
+      }
     }
   }
+  control_ = control;
 
   uni_lp_state_[0] = uni_lp_state_0;
   uni_lp_state_[1] = uni_lp_state_1;
@@ -689,9 +756,9 @@ void Generator::FillBufferControlRate() {
 }
 
 
-void Generator::FillBufferWavetable() {
-  uint8_t size = kBlockSize;
-  
+void Generator::FillBufferWavetable(
+    const ControlEvent* events,
+    size_t num_events) {
   GeneratorSample sample = previous_sample_;
   if (sync_) {
     pitch_ = ComputePitch(phase_increment_);
@@ -707,12 +774,12 @@ void Generator::FillBufferWavetable() {
   uint16_t target_x = static_cast<uint16_t>(slope_ + 32768);
   target_x = target_x * 57344 >> 16;
   uint16_t x = x_;
-  uint16_t x_increment = (target_x - x) / size;
+  uint16_t x_increment = (target_x - x) / kBlockSize;
 
   uint16_t target_y = static_cast<uint16_t>(shape_ + 32768);
   target_y = target_y * 57344 >> 16;
   uint16_t y = y_;
-  uint16_t y_increment = (target_y - y) / size;
+  uint16_t y_increment = (target_y - y) / kBlockSize;
 
   int32_t wf_gain = smoothness_ > 0 ? smoothness_ : 0;
   wf_gain = wf_gain * wf_gain >> 15;
@@ -725,51 +792,24 @@ void Generator::FillBufferWavetable() {
   int32_t lp_state_1 = bi_lp_state_[1];
   
   const int16_t* bank = wt_waves + mode_ * 64 * 257 - (mode_ & 2) * 4 * 257;
-  while (size--) {
-    ++sync_counter_;
-    uint8_t control = input_buffer_.ImmediateRead();
+  const ControlEvent* last_event = events + num_events;
+  uint8_t control = control_;
+  size_t position = 0;
+  while (position < kBlockSize) {
+    size_t size = NextControlRun(&events, last_event, position, &control);
+    position += size;
     
+    // The edge bits only apply to the first sample of the run, and the level
+    // bits to all of them: both are dealt with here, once per run.
+    bool freeze = control & CONTROL_FREEZE;
     // When freeze is high, discard any start/reset command.
-    if (!(control & CONTROL_FREEZE)) {
-      if (control & CONTROL_GATE_RISING) {
-        phase = 0;
-        sub_phase = 0;
-      }
+    if (!freeze && (control & CONTROL_GATE_RISING)) {
+      phase = 0;
+      sub_phase = 0;
     }
-    
     if (control & CONTROL_CLOCK_RISING) {
       if (sync_) {
-        if (range_ == GENERATOR_RANGE_HIGH) {
-          ++sync_edges_counter_;
-          if (sync_edges_counter_ >= frequency_ratio_.q) {
-            sync_edges_counter_ = 0;
-            if (sync_counter_ < kSyncCounterMaxTime && sync_counter_) {
-              uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
-                  0xffffffff / sync_counter_);
-              if (increment > 0x80000000) {
-                increment = 0x80000000;
-              }
-              target_phase_increment_ = static_cast<uint32_t>(increment);
-              local_osc_phase_ = 0;
-            }
-            sync_counter_ = 0;
-          }
-        } else {
-          if (sync_counter_ >= kSyncCounterMaxTime) {
-            phase = 0;
-          } else if (sync_counter_) {
-            uint32_t predicted_period = sync_counter_ < 480
-                ? sync_counter_
-                : pattern_predictor_.Predict(sync_counter_);
-            uint64_t increment = frequency_ratio_.p * static_cast<uint64_t>(
-                0xffffffff / (predicted_period * frequency_ratio_.q));
-            if (increment > 0x80000000) {
-              increment = 0x80000000;
-            }
-            phase_increment = static_cast<uint32_t>(increment);
-          }
-          sync_counter_ = 0;
-        }
+        clock_follower_.Edge();
       } else {
         // Normal behaviour: switch banks.
         uint8_t bank_index = mode_ + 1;
@@ -780,62 +820,80 @@ void Generator::FillBufferWavetable() {
         bank = wt_waves + mode_ * 64 * 257 - (mode_ & 2) * 4 * 257;
       }
     }
+    control &= kControlLevelMask;
     
-    // PLL stuff
-    if (sync_ && range_ == GENERATOR_RANGE_HIGH) {
-      // Fast tracking of the local oscillator to the external oscillator.
-      local_osc_phase_increment_ += static_cast<int32_t>(
-          target_phase_increment_ - local_osc_phase_increment_) >> 8;
-      local_osc_phase_ += local_osc_phase_increment_;
-    
-      // Slow phase realignment between the master oscillator and the local
-      // oscillator.
-      int32_t phase_error = local_osc_phase_ - phase;
-      phase_increment = local_osc_phase_increment_ + (phase_error >> 13);
-    }
-    
-    x += x_increment;
-    y += y_increment;
-  
-    if (control & CONTROL_FREEZE) {
-      output_buffer_.Overwrite(sample);
+    if (freeze) {
+      // The output is held, but x and y keep on moving, and the local
+      // oscillator keeps on following the clock.
+      if (sync_) {
+        clock_follower_.Tick(size);
+        if (clock_follower_.has_period()) {
+          phase_increment = clock_follower_.phase_increment();
+          if (range_ == GENERATOR_RANGE_HIGH) {
+            int32_t phase_error = clock_follower_.phase() - phase;
+            phase_increment += phase_error >> 13;
+          }
+        }
+      }
+      x += x_increment * size;
+      y += y_increment * size;
+      while (size--) {
+        output_buffer_.Overwrite(sample);
+      }
       continue;
     }
     
-    uint16_t x_integral = x >> 13;
-    uint16_t y_integral = y >> 13;
-    const int16_t* wave_1 = &bank[(x_integral + y_integral * 8) * 257];
-    const int16_t* wave_2 = wave_1 + 257 * 8;
-    uint16_t x_fractional = x << 3;
-    int32_t y_fractional = (y << 2) & 0x7fff;
-
-    int32_t s = 0;
-    for (int32_t subsample = 0; subsample < 4; ++subsample) {
-      int32_t y_1 = Crossfade(wave_1, wave_1 + 257, phase, x_fractional);
-      int32_t y_2 = Crossfade(wave_2, wave_2 + 257, phase, x_fractional);
-      int32_t y_mix = y_1 + ((y_2 - y_1) * y_fractional >> 15);
-      int32_t folded = Interpolate1022(
-          ws_smooth_bipolar_fold, (y_mix + 32768) << 16);
-      y_mix = y_mix + ((folded - y_mix) * wf_gain >> 15);
-      s += y_mix * kDownsampleCoefficient[subsample];
-      phase += (phase_increment >> 2);
-    }
+    while (size--) {
+      if (sync_) {
+        clock_follower_.Tick();
+        if (clock_follower_.has_period()) {
+          phase_increment = clock_follower_.phase_increment();
+          if (range_ == GENERATOR_RANGE_HIGH) {
+            int32_t phase_error = clock_follower_.phase() - phase;
+            phase_increment += phase_error >> 13;
+          }
+        }
+      }
     
-    lp_state_0 += f * ((s >> 16) - lp_state_0) >> 15;
-    lp_state_1 += f * (lp_state_0 - lp_state_1) >> 15;
+      x += x_increment;
+      y += y_increment;
     
-    sample.bipolar = lp_state_1;
-    sample.unipolar = sample.bipolar + 32768;
-    sample.flags = 0;
-    if (sample.unipolar & 0x8000) {
-      sample.flags |= FLAG_END_OF_ATTACK;
-    }
-    if (sub_phase & 0x80000000) {
-      sample.flags |= FLAG_END_OF_RELEASE;
+      uint16_t x_integral = x >> 13;
+      uint16_t y_integral = y >> 13;
+      const int16_t* wave_1 = &bank[(x_integral + y_integral * 8) * 257];
+      const int16_t* wave_2 = wave_1 + 257 * 8;
+      uint16_t x_fractional = x << 3;
+      int32_t y_fractional = (y << 2) & 0x7fff;
+
+      int32_t s = 0;
+      for (int32_t subsample = 0; subsample < 4; ++subsample) {
+        int32_t y_1 = Crossfade(wave_1, wave_1 + 257, phase, x_fractional);
+        int32_t y_2 = Crossfade(wave_2, wave_2 + 257, phase, x_fractional);
+        int32_t y_mix = y_1 + ((y_2 - y_1) * y_fractional >> 15);
+        int32_t folded = Interpolate1022(
+            ws_smooth_bipolar_fold, (y_mix + 32768) << 16);
+        y_mix = y_mix + ((folded - y_mix) * wf_gain >> 15);
+        s += y_mix * kDownsampleCoefficient[subsample];
+        phase += (phase_increment >> 2);
+      }
+    
+      lp_state_0 += f * ((s >> 16) - lp_state_0) >> 15;
+      lp_state_1 += f * (lp_state_0 - lp_state_1) >> 15;
+    
+      sample.bipolar = lp_state_1;
+      sample.unipolar = sample.bipolar + 32768;
+      sample.flags = 0;
+      if (sample.unipolar & 0x8000) {
+        sample.flags |= FLAG_END_OF_ATTACK;
+      }
+      if (sub_phase & 0x80000000) {
+        sample.flags |= FLAG_END_OF_RELEASE;
+      }
+      output_buffer_.Overwrite(sample);
+      sub_phase += phase_increment >> 1;
     }
-    output_buffer_.Overwrite(sample);
-    sub_phase += phase_increment >> 1;
   }
+  control_ = control;
   previous_sample_ = sample;
   phase_ = phase;
   sub_phase_ = sub_phase;
@@ -31,7 +31,7 @@
 
 #include "stmlib/stmlib.h"
 
-#include "stmlib/algorithms/pattern_predictor.h"
+#include "common/clock_follower.h"
 #include "stmlib/utils/ring_buffer.h"
 
 // #define WAVETABLE_HACK
@@ -59,6 +59,10 @@ enum ControlBitMask {
   CONTROL_GATE_FALLING = 32
 };
 
+// Bits of the control byte describing a level rather than an edge. A change
+// of any of these bits is what constitutes a control event.
+const uint8_t kControlLevelMask = CONTROL_FREEZE | CONTROL_GATE | CONTROL_CLOCK;
+
 enum FlagBitMask {
   FLAG_END_OF_ATTACK = 1,
   FLAG_END_OF_RELEASE = 2
@@ -71,6 +75,15 @@ struct GeneratorSample {
 };
 
 const uint16_t kBlockSize = 16;
+const uint16_t kMaxNumControlEvents = kBlockSize * 4;
+
+// A change in the state of the gate, clock or freeze inputs. The control byte
+// (edge bits included) applies to the sample at "timestamp", and its level bits
+// to all subsequent samples, until the next event.
+struct ControlEvent {
+  uint32_t timestamp;
+  uint8_t control;
+};
 
 struct FrequencyRatio {
   uint32_t p;
@@ -135,18 +148,34 @@ class Generator {
   
   void set_sync(bool sync) {
     if (!sync_ && sync) {
-      pattern_predictor_.Init();
+      clock_follower_.Reset();
     }
     sync_ = sync;
-    sync_edges_counter_ = 0;
   }
   
   inline GeneratorMode mode() const { return mode_; }
   inline GeneratorRange range() const { return range_; }
   inline bool sync() const { return sync_; }
   
+  // Per-sample control API: the control byte is only compared with the
+  // previous one, and forwarded to the renderer when it has changed.
   inline GeneratorSample Process(uint8_t control) {
-    input_buffer_.Overwrite(control);
+    if ((control ^ previous_control_) & kControlLevelMask) {
+      if (event_queue_.writable()) {
+        ControlEvent e;
+        e.timestamp = input_time_;
+        e.control = control;
+        event_queue_.Overwrite(e);
+      }
+      previous_control_ = control;
+    }
+    ++input_time_;
+    return output_buffer_.ImmediateRead();
+  }
+  
+  // Event-driven control API: the control events are passed to FillBuffer, and
+  // samples are just popped from the output buffer.
+  inline GeneratorSample Process() {
     return output_buffer_.ImmediateRead();
   }
   
@@ -163,16 +192,25 @@ class Generator {
     }
   }
   
-  inline void FillBuffer() {
+  // Renders a block, using the events received through Process(control).
+  void FillBuffer();
+  
+  // Renders a block, using the events passed as arguments. Timestamps are
+  // sample offsets within the block, in increasing order.
+  inline void FillBuffer(const ControlEvent* events, size_t num_events) {
+    if (sync_) {
+      clock_follower_.set_ratio(frequency_ratio_.p, frequency_ratio_.q);
+    }
 #ifndef WAVETABLE_HACK
     if (range_ == GENERATOR_RANGE_HIGH) {
-      FillBufferAudioRate();
+      FillBufferAudioRate(events, num_events);
     } else {
-      FillBufferControlRate();
+      FillBufferControlRate(events, num_events);
     }
 #else
-    FillBufferWavetable();
+    FillBufferWavetable(events, num_events);
 #endif
+    render_time_ += kBlockSize;
   }
   
   uint32_t clock_divider() const {
@@ -182,9 +220,9 @@ class Generator {
  private:
   // There are two versions of the rendering code, one optimized for audio, with
   // band-limiting.
-  void FillBufferAudioRate();
-  void FillBufferControlRate();
-  void FillBufferWavetable();
+  void FillBufferAudioRate(const ControlEvent* events, size_t num_events);
+  void FillBufferControlRate(const ControlEvent* events, size_t num_events);
+  void FillBufferWavetable(const ControlEvent* events, size_t num_events);
   int32_t ComputeAntialiasAttenuation(
         int16_t pitch,
         int16_t slope,
@@ -201,8 +239,36 @@ class Generator {
   int32_t ComputeCutoffFrequency(int16_t pitch, int16_t smoothness);
   void ComputeFrequencyRatio(int16_t pitch);
   
-  stmlib::RingBuffer<uint8_t, kBlockSize * 2> input_buffer_;
+  // Splits the block at the next event. Returns the number of samples during
+  // which "control" holds.
+  inline size_t NextControlRun(
+      const ControlEvent** events,
+      const ControlEvent* last_event,
+      size_t position,
+      uint8_t* control) const {
+    const ControlEvent* e = *events;
+    while (e != last_event && e->timestamp <= position) {
+      *control = e->control;
+      ++e;
+    }
+    *events = e;
+    size_t end = e != last_event && e->timestamp < kBlockSize
+        ? e->timestamp
+        : kBlockSize;
+    return end - position;
+  }
+  
+  stmlib::RingBuffer<ControlEvent, kMaxNumControlEvents> event_queue_;
   stmlib::RingBuffer<GeneratorSample, kBlockSize * 2> output_buffer_;
+  
+  // The input time is ahead of the render time by one block, to account for
+  // the block of samples already sitting in the output buffer.
+  uint32_t input_time_;
+  uint32_t render_time_;
+  uint8_t previous_control_;
+  uint8_t control_;
+  ControlEvent pending_event_;
+  bool has_pending_event_;
    
   GeneratorMode mode_;
   GeneratorRange range_;
@@ -230,16 +296,10 @@ class Generator {
   bool sync_;
   FrequencyRatio frequency_ratio_;
   
-  // Time measurement and clock divider for PLL mode.
-  uint32_t sync_counter_;
-  uint32_t sync_edges_counter_;
-  uint32_t local_osc_phase_;
-  uint32_t local_osc_phase_increment_;
-  uint32_t target_phase_increment_;  
+  // Local oscillator locked to the external clock, for PLL mode.
+  common::ClockFollower clock_follower_;
   uint32_t eor_counter_;
   
-  stmlib::PatternPredictor<32, 8> pattern_predictor_;
-  
   int64_t uni_lp_state_[2];
   int64_t bi_lp_state_[2];
   
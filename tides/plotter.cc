@@ -28,39 +28,171 @@
 
 #include "tides/plotter.h"
 
-#include "stmlib/utils/dsp.h"
-
-#include "tides/resources.h"
+#include "tides/easter_egg/plotter_font.h"
 
 namespace tides {
 
-using namespace stmlib;
-
 void Plotter::Run() {
-  const PlotInstruction& instruction = program_[pc_];
-  if (instruction.command == PLOT_MOVE_TO) {
-    x_ = instruction.x;
-    y_ = instruction.y;
+  if (!counter_) {
     NextInstruction();
+    if (!counter_) {
+      // The instruction was a jump.
+      return;
+    }
+  }
+  --counter_;
+  if (segment_ == SEGMENT_LINE) {
+    if (counter_) {
+      x_ += dx_;
+      y_ += dy_;
+    } else {
+      x_ = target_x_;
+      y_ = target_y_;
+    }
   } else {
-    x_ = start_x_ + ((instruction.x - start_x_) * counter_) / instruction.steps;
-    y_ = start_y_ + ((instruction.y - start_y_) * counter_) / instruction.steps;
-    ++counter_;
-    if (counter_ > instruction.steps) {
-      x_ = instruction.x;
-      y_ = instruction.y;
-      NextInstruction();
+    u_ -= static_cast<int64_t>(v_) * k_ >> 16;
+    v_ += static_cast<int64_t>(u_) * k_ >> 16;
+    x_ = center_x_ + u_;
+    y_ = center_y_ + v_;
+  }
+}
+
+void Plotter::MoveTo(int32_t x, int32_t y) {
+  x_ = x << kPositionShift;
+  y_ = y << kPositionShift;
+  counter_ = 0;
+}
+
+void Plotter::LineTo(int32_t x, int32_t y, uint16_t steps) {
+  if (!steps) {
+    steps = 1;
+  }
+  segment_ = SEGMENT_LINE;
+  target_x_ = x << kPositionShift;
+  target_y_ = y << kPositionShift;
+  dx_ = (target_x_ - x_) / steps;
+  dy_ = (target_y_ - y_) / steps;
+  counter_ = steps;
+}
+
+bool Plotter::NextStroke() {
+  while (true) {
+    if (!glyph_) {
+      if (!text_length_) {
+        return false;
+      }
+      uint8_t character = ReadByte();
+      --text_length_;
+      if (character >= 'a' && character <= 'z') {
+        character -= 'a' - 'A';
+      }
+      if (character < kFontFirstCharacter || character > kFontLastCharacter) {
+        character = ' ';
+      }
+      glyph_ = font_glyphs + font_offsets[character - kFontFirstCharacter];
     }
+
+    uint8_t point = *glyph_++;
+    if (point == kFontEndOfGlyph) {
+      glyph_ = NULL;
+      text_x_ += kFontAdvance * text_size_;
+      continue;
+    }
+
+    uint8_t glyph_x = (point >> 4) & 0x7;
+    uint8_t glyph_y = point & 0xf;
+    int32_t x = text_x_ + glyph_x * text_size_;
+    int32_t y = text_y_ + glyph_y * text_size_;
+    if (point & 0x80) {
+      uint8_t dx = glyph_x > glyph_x_ ? glyph_x - glyph_x_ : glyph_x_ - glyph_x;
+      uint8_t dy = glyph_y > glyph_y_ ? glyph_y - glyph_y_ : glyph_y_ - glyph_y;
+      LineTo(x, y, (dx > dy ? dx : dy) * text_steps_);
+    } else {
+      MoveTo(x, y);
+    }
+    glyph_x_ = glyph_x;
+    glyph_y_ = glyph_y;
+    return true;
   }
 }
 
 void Plotter::NextInstruction() {
-  counter_ = 0;
-  start_x_ = x_;
-  start_y_ = y_;
-  pc_++;
-  if (pc_ >= program_size_) {
-    pc_ = 0;
+  if ((glyph_ || text_length_) && NextStroke()) {
+    return;
+  }
+
+  // Give up after two rewinds, in case the program does not draw anything.
+  uint8_t num_rewinds = 0;
+  while (num_rewinds < 2) {
+    switch (ReadByte()) {
+      case PLOT_END:
+        pc_ = 0;
+        ++num_rewinds;
+        break;
+
+      case PLOT_MOVE_TO:
+        {
+          int32_t x = ReadWord();
+          int32_t y = ReadWord();
+          MoveTo(x, y);
+        }
+        return;
+
+      case PLOT_LINE_TO:
+        {
+          uint8_t steps = ReadByte();
+          int32_t x = ReadWord();
+          int32_t y = ReadWord();
+          LineTo(x, y, steps);
+        }
+        return;
+
+      case PLOT_LINE_REL:
+        {
+          uint8_t steps = ReadByte();
+          int32_t dx = static_cast<int8_t>(ReadByte()) * kPlotRelativeUnit;
+          int32_t dy = static_cast<int8_t>(ReadByte()) * kPlotRelativeUnit;
+          LineTo(x() + dx, y() + dy, steps);
+        }
+        return;
+
+      case PLOT_ARC:
+        {
+          uint16_t steps = ReadWord();
+          center_x_ = static_cast<int32_t>(ReadWord()) << kPositionShift;
+          center_y_ = static_cast<int32_t>(ReadWord()) << kPositionShift;
+          k_ = static_cast<int16_t>(ReadWord());
+          u_ = x_ - center_x_;
+          v_ = y_ - center_y_;
+          segment_ = SEGMENT_ARC;
+          counter_ = steps;
+          if (counter_) {
+            return;
+          }
+        }
+        break;
+
+      case PLOT_TEXT:
+        {
+          text_x_ = ReadWord();
+          text_y_ = ReadWord();
+          text_size_ = ReadByte() * kPlotRelativeUnit;
+          text_steps_ = ReadByte();
+          text_length_ = ReadByte();
+          glyph_ = NULL;
+          glyph_x_ = glyph_y_ = 0;
+          if (NextStroke()) {
+            return;
+          }
+        }
+        break;
+
+      default:
+        // Corrupted program.
+        pc_ = 0;
+        ++num_rewinds;
+        break;
+    }
   }
 }
 
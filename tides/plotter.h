@@ -24,7 +24,29 @@
 //
 // -----------------------------------------------------------------------------
 //
-// Plotter.
+// Plotter - X/Y vector display engine.
+//
+// A program is a stream of bytes, decoded one instruction at a time while the
+// beam moves, so it can be read straight from flash. All multi-byte operands
+// are little-endian. Programs are compiled from SVG files by
+// tides/easter_egg/svg2plot.py.
+//
+// PLOT_END       Restart from the beginning of the program.
+// PLOT_MOVE_TO   x:u16 y:u16
+//                Jump to (x, y). Takes one sample.
+// PLOT_LINE_TO   steps:u8 x:u16 y:u16
+//                Draw a line to (x, y) in "steps" samples.
+// PLOT_LINE_REL  steps:u8 dx:s8 dy:s8
+//                Same, relative to the current position, in units of 16.
+// PLOT_ARC       steps:u16 cx:u16 cy:u16 k:s16
+//                Draw an arc around (cx, cy), starting at the current
+//                position. At each step, the radius vector is rotated by
+//                about k / 65536 radians (Minsky's circle algorithm: no table
+//                or trigonometric function needed - k = 2 sin(angle / 2)).
+// PLOT_TEXT      x:u16 y:u16 size:u8 steps:u8 length:u8 chars:u8[length]
+//                Draw a string with the built-in stroke font, with glyph cells
+//                of 5x7 units of 16 * size DAC codes; "steps" is the number of
+//                samples per font unit.
 
 #ifndef TIDES_PLOTTER_H_
 #define TIDES_PLOTTER_H_
@@ -34,48 +56,95 @@
 namespace tides {
 
 enum PlotCommand {
+  PLOT_END,
   PLOT_MOVE_TO,
-  PLOT_LINE_TO
+  PLOT_LINE_TO,
+  PLOT_LINE_REL,
+  PLOT_ARC,
+  PLOT_TEXT
 };
 
-struct PlotInstruction {
-  PlotCommand command;
-  uint8_t steps;
-  uint16_t x;
-  uint16_t y;
-};
+const int32_t kPlotRelativeUnit = 16;
+
+// Positions are stored as 17.15 fixed point numbers.
+const uint8_t kPositionShift = 15;
 
 class Plotter {
  public:
   Plotter() { }
   ~Plotter() { }
-  
-  void Init(const PlotInstruction* program, size_t program_size) {
+
+  void Init(const uint8_t* program, size_t program_size) {
     program_ = program;
     program_size_ = program_size;
     pc_ = 0;
     counter_ = 0;
+    text_length_ = 0;
+    glyph_ = NULL;
+    x_ = y_ = 32768 << kPositionShift;
   }
-  
+
   void Run();
-  
-  inline int32_t x() const { return x_; }
-  inline int32_t y() const { return y_; }
+
+  inline int32_t x() const { return x_ >> kPositionShift; }
+  inline int32_t y() const { return y_ >> kPositionShift; }
 
  private:
+  enum Segment {
+    SEGMENT_LINE,
+    SEGMENT_ARC
+  };
+
+  inline uint8_t ReadByte() {
+    uint8_t value = program_[pc_];
+    if (++pc_ >= program_size_) {
+      pc_ = 0;
+    }
+    return value;
+  }
+
+  inline uint16_t ReadWord() {
+    uint16_t lsb = ReadByte();
+    return lsb | (static_cast<uint16_t>(ReadByte()) << 8);
+  }
+
   void NextInstruction();
-  void Move();
-   
-  const PlotInstruction* program_;
+  bool NextStroke();
+  void MoveTo(int32_t x, int32_t y);
+  void LineTo(int32_t x, int32_t y, uint16_t steps);
+
+  const uint8_t* program_;
   size_t program_size_;
   size_t pc_;
 
-  int32_t start_x_;
-  int32_t start_y_;
+  Segment segment_;
+  uint16_t counter_;
+
+  // Current position and increment.
   int32_t x_;
   int32_t y_;
-  int32_t counter_;
-  
+  int32_t dx_;
+  int32_t dy_;
+  int32_t target_x_;
+  int32_t target_y_;
+
+  // Arc: center, radius vector, and rotation coefficient (16.16).
+  int32_t center_x_;
+  int32_t center_y_;
+  int32_t u_;
+  int32_t v_;
+  int32_t k_;
+
+  // Text.
+  const uint8_t* glyph_;
+  uint8_t text_length_;
+  int32_t text_x_;
+  int32_t text_y_;
+  int32_t text_size_;
+  uint8_t text_steps_;
+  uint8_t glyph_x_;
+  uint8_t glyph_y_;
+
   DISALLOW_COPY_AND_ASSIGN(Plotter);
 };
 
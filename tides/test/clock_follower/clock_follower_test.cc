@@ -0,0 +1,202 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "common/clock_follower.h"
+
+using namespace common;
+
+const uint32_t kSampleRate = 48000;
+const uint32_t kNumEdges = 512;
+
+// The follower has settled once it stays locked, with a phase error below the
+// tolerance of the stream, for kSettledEdges consecutive edges.
+const uint32_t kSettledEdges = 8;
+
+struct ClockStream {
+  const char* name;
+  double period;  // In samples.
+  double jitter;  // Standard deviation, in samples.
+  double swing;  // 0.5 = straight.
+  double tempo_change;  // Period multiplier applied halfway through.
+  double drop_probability;  // Probability of a missing pulse.
+  uint32_t p;
+  uint32_t q;
+  // Pass criteria, in edges and cycles, applied before and after the tempo
+  // change.
+  double tolerance;
+  uint32_t max_settling_edges;
+  double max_rms_error;
+};
+
+const ClockStream streams[] = {
+  { "straight 120bpm 16th", 6000.0, 0.0, 0.5, 1.0, 0.0, 1, 1,
+    0.02, 16, 0.001 },
+  { "jitter 1ms", 6000.0, 48.0, 0.5, 1.0, 0.0, 1, 1,
+    0.04, 24, 0.015 },
+  { "jitter 4ms", 6000.0, 192.0, 0.5, 1.0, 0.0, 1, 1,
+    0.12, 32, 0.06 },
+  { "swing 58%", 6000.0, 0.0, 0.58, 1.0, 0.0, 1, 1,
+    0.10, 32, 0.1 },
+  { "swing 66% + jitter 1ms", 6000.0, 48.0, 0.66, 1.0, 0.0, 1, 1,
+    0.20, 32, 0.2 },
+  { "tempo jump x0.75", 6000.0, 24.0, 0.5, 0.75, 0.0, 1, 1,
+    0.02, 48, 0.01 },
+  { "tempo jump x1.5", 6000.0, 24.0, 0.5, 1.5, 0.0, 1, 1,
+    0.02, 48, 0.01 },
+  { "5% dropped pulses", 6000.0, 24.0, 0.5, 1.0, 0.05, 1, 1,
+    0.02, 24, 0.025 },
+  { "ratio 3/2", 6000.0, 24.0, 0.5, 1.0, 0.0, 3, 2,
+    0.04, 24, 0.015 },
+  { "ratio 1/4", 6000.0, 24.0, 0.5, 1.0, 0.0, 1, 4,
+    0.02, 24, 0.005 },
+  { "audio rate 440Hz", 109.09, 0.5, 0.5, 1.0, 0.0, 1, 1,
+    0.04, 24, 0.015 },
+};
+
+double Gaussian() {
+  double u = (rand() + 1.0) / (RAND_MAX + 2.0);
+  double v = (rand() + 1.0) / (RAND_MAX + 2.0);
+  return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * v);
+}
+
+// Phase error statistics over one half of the stream: before or after the
+// tempo change.
+struct Segment {
+  uint32_t first_edge;
+  int32_t settled_edge;
+  uint32_t num_good_edges;
+  uint32_t num_lock_losses;
+  double error_sum;
+  double error_max;
+  uint32_t num_errors;
+
+  void Init(uint32_t edge) {
+    first_edge = edge;
+    settled_edge = -1;
+    num_good_edges = 0;
+    num_lock_losses = 0;
+    error_sum = 0.0;
+    error_max = 0.0;
+    num_errors = 0;
+  }
+
+  void Measure(
+      uint32_t edge,
+      bool locked,
+      double error,
+      double tolerance) {
+    if (settled_edge == -1) {
+      num_good_edges = locked && fabs(error) < tolerance
+          ? num_good_edges + 1
+          : 0;
+      if (num_good_edges == kSettledEdges) {
+        settled_edge = edge - first_edge;
+      }
+      return;
+    }
+    if (!locked) {
+      ++num_lock_losses;
+    }
+    error_sum += error * error;
+    if (fabs(error) > error_max) {
+      error_max = fabs(error);
+    }
+    ++num_errors;
+  }
+
+  double rms() const {
+    return num_errors ? sqrt(error_sum / num_errors) : 0.0;
+  }
+
+  bool Check(const ClockStream& stream, const char* name) const {
+    printf("  %-6s settled after %3d edges  unlocked edges: %2d  "
+           "phase error: rms %5.2f%%  max %5.2f%%\n",
+           name,
+           settled_edge,
+           num_lock_losses,
+           rms() * 100.0,
+           error_max * 100.0);
+    bool ok = settled_edge != -1 &&
+        static_cast<uint32_t>(settled_edge) <= stream.max_settling_edges &&
+        rms() <= stream.max_rms_error;
+    if (!ok) {
+      printf("  FAILED: settling %d > %d edges or rms %.2f%% > %.2f%%\n",
+             settled_edge, stream.max_settling_edges,
+             rms() * 100.0, stream.max_rms_error * 100.0);
+    }
+    return ok;
+  }
+};
+
+bool Run(const ClockStream& stream) {
+  ClockFollower follower;
+  follower.Init(8 * kSampleRate);
+  follower.set_ratio(stream.p, stream.q);
+
+  srand(0x5eed);
+
+  // Ideal edge times, with swing, jitter and drops applied.
+  double t = 0.0;
+  double next_edge = 1000.0;
+  uint32_t edge = 0;
+  Segment segments[2];
+  segments[0].Init(0);
+  segments[1].Init(kNumEdges / 2);
+
+  uint32_t sample = 0;
+  while (edge < kNumEdges) {
+    bool rising = false;
+    if (sample >= next_edge) {
+      rising = rand() >= stream.drop_probability * RAND_MAX;
+      double period = stream.period;
+      if (edge >= kNumEdges / 2) {
+        period *= stream.tempo_change;
+      }
+      double length = 2.0 * period * ((edge & 1) ? 1.0 - stream.swing :
+          stream.swing);
+      t += length;
+      next_edge = 1000.0 + t + Gaussian() * stream.jitter;
+      ++edge;
+    }
+    follower.Process(rising);
+    if (rising) {
+      double error = follower.phase_error() / 4294967296.0;
+      segments[edge > kNumEdges / 2 ? 1 : 0].Measure(
+          edge, follower.locked(), error, stream.tolerance);
+    }
+    ++sample;
+  }
+
+  printf("%s\n", stream.name);
+  bool ok = segments[0].Check(stream, "before");
+  ok = segments[1].Check(stream, "after") && ok;
+  return ok;
+}
+
+int main(void) {
+  uint32_t num_failures = 0;
+  for (size_t i = 0; i < sizeof(streams) / sizeof(ClockStream); ++i) {
+    if (!Run(streams[i])) {
+      ++num_failures;
+    }
+  }
+  if (num_failures) {
+    printf("%d streams failed\n", num_failures);
+    return 1;
+  }
+  return 0;
+}
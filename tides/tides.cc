@@ -141,7 +141,7 @@ void Init() {
   gate_output.Init();
   gate_input.Init();
   generator.Init();
-  plotter.Init(plotter_program, sizeof(plotter_program) / sizeof(PlotInstruction));
+  plotter.Init(plotter_program, sizeof(plotter_program));
   ui.Init(&generator, &cv_scaler);
   sys.StartTimers();
 }
@@ -21,6 +21,7 @@
 
 import numpy
 import random
+import sys
 
 
 class SOM(object):
@@ -28,7 +29,7 @@ class SOM(object):
   def __init__(self, grid_size, radius, learning_rate):
     self._grid_size = grid_size
     self._grid_x = numpy.arange(0, grid_size * grid_size) % grid_size
-    self._grid_y = numpy.arange(0, grid_size * grid_size) / grid_size
+    self._grid_y = numpy.arange(0, grid_size * grid_size) // grid_size
     self._radius = radius
     self._learning_rate = learning_rate
     self._codewords = None
@@ -40,9 +41,28 @@ class SOM(object):
     std = x.std(axis=axis) ** std_power + regularization
     return (x - mean) / std
     
+  @property
+  def codewords(self):
+    return self._codewords
+
   def classify(self, data):
     distances = ((self._codewords - data) ** 2).sum(axis=1)
     return distances.argmin(), distances
+
+  def classify_batch(self, data, chunk_size=4096):
+    """Best matching unit of each row of data, and its distance."""
+    n, d = data.shape
+    norms = (self._codewords ** 2).sum(axis=1)
+    bmu = numpy.zeros(n, dtype=int)
+    errors = numpy.zeros(n)
+    for start in range(0, n, chunk_size):
+      x = data[start:start + chunk_size]
+      distances = (x ** 2).sum(axis=1)[:, numpy.newaxis] - \
+          2 * numpy.dot(x, self._codewords.T) + norms
+      best = distances.argmin(axis=1)
+      bmu[start:start + len(x)] = best
+      errors[start:start + len(x)] = distances[numpy.arange(len(x)), best]
+    return bmu, errors
     
   def train(self, data, iterations=10000, seed=42):
     n, d = data.shape
@@ -52,10 +72,10 @@ class SOM(object):
     self._codewords = numpy.random.randn(nodes * nodes, d)
     self._error_history = []
     milestone = 2
-    for i in xrange(iterations):
+    for i in range(iterations):
       if i == milestone:
-        print 'iteration', i, 'of', iterations, '\t', \
-            round(1000.0 * i / iterations) * 0.1, '%'
+        sys.stdout.write('iteration %d of %d\t%.1f %%\n' % (
+            i, iterations, 100.0 * i / iterations))
         milestone <<= 1
       radius = self._radius * 2 ** (-2 * float(i) / iterations)
       learning_rate = self._learning_rate * 2 ** (-7 * float(i) / iterations)
@@ -76,6 +96,41 @@ class SOM(object):
       self._codewords += learning_rate * update
     return self._error_history
     
+  def train_batch(self, data, epochs=50, seed=42):
+    """Batch version of train.
+
+    At each epoch, all the codewords move at once to the mean of the vectors
+    matched by them and by their neighbours. Each epoch costs a few matrix
+    products over the whole data set instead of one python iteration per
+    vector, so this is the method to use for large data sets.
+    """
+    n, d = data.shape
+    nodes = self._grid_size * self._grid_size
+    numpy.random.seed(seed)
+    self._codewords = data[numpy.random.randint(0, n, nodes)].astype(float)
+    delta_x = self._grid_x[:, numpy.newaxis] - self._grid_x
+    delta_y = self._grid_y[:, numpy.newaxis] - self._grid_y
+    grid_distances = (delta_x ** 2 + delta_y ** 2).astype(float)
+    self._error_history = []
+    for i in range(epochs):
+      radius = self._radius * 2 ** (-2 * float(i) / epochs)
+      bmu, errors = self.classify_batch(data)
+      self._error_history.append(errors.mean())
+      
+      # Sum and number of the vectors matched by each codeword.
+      counts = numpy.bincount(bmu, minlength=nodes).astype(float)
+      sums = numpy.zeros((nodes, d))
+      for node in numpy.unique(bmu):
+        sums[node] = data[bmu == node].sum(axis=0)
+
+      # Neighborhood-weighted means. A codeword too far from any matching unit
+      # to be moved keeps its previous value.
+      rbf = numpy.exp(-grid_distances / (radius * radius))
+      epsilon = 1e-9
+      self._codewords = (numpy.dot(rbf, sums) + epsilon * self._codewords) / \
+          (numpy.dot(rbf, counts) + epsilon)[:, numpy.newaxis]
+    return self._error_history
+
   def checkpoint(self):
     numpy.save('weights', self._codewords)
 
@@ -85,7 +140,7 @@ class SOM(object):
   def plot(self, x):
     import pylab
 
-    for i in xrange(x.shape[0]):
+    for i in range(x.shape[0]):
       _, d = self.classify(x[i, :])
       d = numpy.exp(-d)
       pylab.figure()
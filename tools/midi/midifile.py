@@ -25,6 +25,7 @@
 import bisect
 import math
 import struct
+import sys
 
 
 def PackInteger(value, size=4):
@@ -379,7 +380,7 @@ class Reader(object):
     self._previous_status = 0
     
   def Read(self, f):
-    assert f.read(4) == 'MThd'
+    assert f.read(4) == b'MThd'
     assert struct.unpack('>i', f.read(4))[0] == 6
     self.format = struct.unpack('>h', f.read(2))[0]
     assert self.format <= 2
@@ -387,13 +388,13 @@ class Reader(object):
     self.ppq = struct.unpack('>h', f.read(2))[0]
     self._tempo_map = []
     
-    for i in xrange(num_tracks):
+    for i in range(num_tracks):
       self.tracks.append(self._ReadTrack(f))
     self._CreateCumulativeTempoMap()
     
       
   def _ReadTrack(self, f):
-    assert f.read(4) == 'MTrk'
+    assert f.read(4) == b'MTrk'
     size = struct.unpack('>i', f.read(4))[0]
     t = 0
     events = []
@@ -454,33 +455,33 @@ class Reader(object):
     channel = event_byte & 0xf
     channel += 1
     if event_type == 0x80:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       note = ord(f.read(1))
       velo = ord(f.read(1))
       event = NoteOffEvent(channel, note, velo)
       size += 2
     elif event_type == 0x90:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       event = NoteOnEvent(channel, ord(f.read(1)), ord(f.read(1)))
       size += 2
     elif event_type == 0xa0:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       event = KeyAftertouchEvent(channel, ord(f.read(1)), ord(f.read(1)))
       size += 2
     elif event_type == 0xb0:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       event = ControlChangeEvent(channel, ord(f.read(1)), ord(f.read(1)))
       size += 2
     elif event_type == 0xc0:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       event = ProgramChangeEvent(channel, ord(f.read(1)))
       size += 1
     elif event_type == 0xd0:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       event = ChannelAftertouchEvent(channel, ord(f.read(1)))
       size += 1
     elif event_type == 0xe0:
-      self._previous_status = event_type
+      self._previous_status = event_byte
       event = PitchBendEvent(channel, (ord(f.read(1)) << 7) | ord(f.read(1)))
       size += 2
     elif event_byte == 0xff:
@@ -505,19 +506,19 @@ class Reader(object):
       elif event_type == 0x07:
         event = CuePointEvent(bytes)
       elif event_type == 0x20:
-        current_channel = ord(bytes[0])
+        current_channel = ord(bytes[0:1])
         event = None
       elif event_type == 0x2f:
         event = EndOfTrackEvent()
       elif event_type == 0x51:
-        value = UnpackInteger('\x00' + bytes, size=4)
+        value = UnpackInteger(b'\x00' + bytes, size=4)
         event = TempoEvent(60000000.0 / value)
       elif event_type == 0x54:
-        event = SMPTEOffsetEvent(*map(ord, bytes))
+        event = SMPTEOffsetEvent(*struct.unpack('%dB' % len(bytes), bytes))
       elif event_type == 0x58:
-        event = TimeSignatureEvent(ord(bytes[0]), 2 ** ord(bytes[1]))
+        event = TimeSignatureEvent(ord(bytes[0:1]), 2 ** ord(bytes[1:2]))
       elif event_type == 0x59:
-        event = KeyEvent(ord(bytes[0]), ord(bytes[1]))
+        event = KeyEvent(ord(bytes[0:1]), ord(bytes[1:2]))
       elif event_type == 0x7f:
         event = BlobEvent(bytes)
     elif event_byte == 0xf0:
@@ -527,7 +528,7 @@ class Reader(object):
       size += event_size
       event = SysExEvent(bytes[0:3], bytes[3:5], bytes[5:-1])
     else:
-      print event_byte, '!!'
+      sys.stderr.write('%d !!\n' % event_byte)
       event = None
     return delta_t, event, size
     
@@ -0,0 +1,74 @@
+#!/usr/bin/python2.5
+#
+# Copyright 2026 Mutable Instruments contributors.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+# -----------------------------------------------------------------------------
+#
+# Tests of the Midifile reader.
+#
+# usage, from the root of the repository:
+#   python -m tools.midi.midifile_test
+
+import io
+import struct
+import unittest
+
+from tools.midi import midifile
+
+
+def MakeFile(track_data):
+  header = b'MThd' + struct.pack('>ihhh', 6, 0, 1, 96)
+  track = b'MTrk' + struct.pack('>i', len(track_data)) + track_data
+  return io.BytesIO(header + track)
+
+
+class ReaderTest(unittest.TestCase):
+
+  def testRunningStatusKeepsChannel(self):
+    # 4 hits on channel 10: a note on, then 3 more with running status.
+    f = MakeFile(
+        b'\x00\x99\x24\x64'
+        b'\x18\x26\x64'
+        b'\x18\x24\x64'
+        b'\x18\x26\x64'
+        b'\x00\xff\x2f\x00')
+    reader = midifile.Reader()
+    reader.Read(f)
+    notes = [e for _, e in reader.tracks[0]
+             if isinstance(e, midifile.NoteOnEvent)]
+    self.assertEqual([10, 10, 10, 10], [e.channel for e in notes])
+    self.assertEqual([0x24, 0x26, 0x24, 0x26], [e.note for e in notes])
+
+  def testRunningStatusFollowsLastStatus(self):
+    # A controller on channel 2 replaces the running status of the notes on
+    # channel 1.
+    f = MakeFile(
+        b'\x00\x90\x3c\x64'
+        b'\x00\x3e\x64'
+        b'\x00\xb1\x07\x7f'
+        b'\x00\x0a\x40'
+        b'\x00\xff\x2f\x00')
+    reader = midifile.Reader()
+    reader.Read(f)
+    events = [e for _, e in reader.tracks[0]
+              if isinstance(e, midifile.ChannelEvent)]
+    self.assertEqual(
+        [midifile.NoteOnEvent, midifile.NoteOnEvent,
+         midifile.ControlChangeEvent, midifile.ControlChangeEvent],
+        [type(e) for e in events])
+    self.assertEqual([1, 1, 2, 2], [e.channel for e in events])
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -81,6 +81,12 @@ uint8_t MidiHandler::calibration_note_;
 /* static */
 bool MidiHandler::factory_testing_requested_;
 
+/* static */
+MidiHandler::DeferredMessage MidiHandler::deferred_[kMaxDeferredMessages];
+
+/* static */
+uint8_t MidiHandler::num_deferred_;
+
 /* static */
 void MidiHandler::Init() {
   input_buffer_.Init();
@@ -91,6 +97,64 @@ void MidiHandler::Init() {
   calibration_voice_ = 0xff;
   calibration_note_ = 0xff;
   factory_testing_requested_ = false;
+  num_deferred_ = 0;
+}
+
+/* static */
+void MidiHandler::Defer(uint8_t status, uint8_t data_1, uint8_t data_2) {
+  DeferredMessage message;
+  message.status = status;
+  message.data[0] = data_1;
+  message.data[1] = data_2;
+  
+  if (multi.recording()) {
+    // The sequencer records a slide for any large enough pitch bend.
+    FlushDeferredMessages();
+    ApplyDeferredMessage(message);
+    return;
+  }
+  
+  bool is_control_change = (status & 0xf0) == 0xb0;
+  uint8_t i = 0;
+  while (i < num_deferred_ && (deferred_[i].status != status ||
+         (is_control_change && deferred_[i].data[0] != data_1))) {
+    ++i;
+  }
+  if (i == num_deferred_ && num_deferred_ == kMaxDeferredMessages) {
+    ApplyDeferredMessage(deferred_[0]);
+    i = 0;
+  }
+  if (i != num_deferred_) {
+    --num_deferred_;
+    copy(&deferred_[i + 1], &deferred_[num_deferred_ + 1], &deferred_[i]);
+  }
+  deferred_[num_deferred_++] = message;
+}
+
+/* static */
+void MidiHandler::FlushDeferredMessages() {
+  for (uint8_t i = 0; i < num_deferred_; ++i) {
+    ApplyDeferredMessage(deferred_[i]);
+  }
+  num_deferred_ = 0;
+}
+
+/* static */
+void MidiHandler::ApplyDeferredMessage(const DeferredMessage& message) {
+  uint8_t channel = message.status & 0x0f;
+  switch (message.status & 0xf0) {
+    case 0xb0:
+      ApplyControlChange(channel, message.data[0], message.data[1]);
+      break;
+      
+    case 0xd0:
+      ApplyAftertouch(channel, message.data[0]);
+      break;
+      
+    case 0xe0:
+      ApplyPitchBend(channel, message.data[0] | (message.data[1] << 7));
+      break;
+  }
 }
 
 /* static */
@@ -40,6 +40,7 @@ namespace yarns {
 
 const size_t kSysexMaxChunkSize = 64;
 const size_t kSysexRxBufferSize = kSysexMaxChunkSize * 2 + 16;
+const uint8_t kMaxDeferredMessages = 16;
 
 class MidiHandler {
  public:
@@ -52,69 +53,78 @@ class MidiHandler {
   static void Init();
   
   static void NoteOn(uint8_t channel, uint8_t note, uint8_t velocity) {
+    FlushDeferredMessages();
     if (multi.NoteOn(channel, note, velocity) && !multi.direct_thru()) {
       Send3(0x90 | channel, note, velocity);
     }
   }
   
   static void NoteOff(uint8_t channel, uint8_t note, uint8_t velocity) {
+    FlushDeferredMessages();
     if (multi.NoteOff(channel, note, velocity) && !multi.direct_thru()) {
       Send3(0x80 | channel, note, 0);
     }
   }
   
   static void Aftertouch(uint8_t channel, uint8_t note, uint8_t velocity) {
+    FlushDeferredMessages();
     if (multi.Aftertouch(channel, note, velocity) && !multi.direct_thru()) {
       Send3(0xa0 | channel, note, velocity);
     }
   }
   
   static void Aftertouch(uint8_t channel, uint8_t velocity) {
-    if (multi.Aftertouch(channel, velocity) && !multi.direct_thru()) {
-      Send2(0xd0 | channel, velocity);
-    }
+    Defer(0xd0 | channel, velocity, 0);
   }
   
+  // Controllers 0 to 63 are continuous: only their last value matters.
+  // Controllers 64 and above (switches, mode messages) are applied in order.
   static void ControlChange(
       uint8_t channel,
       uint8_t controller,
       uint8_t value) {
-    if (multi.ControlChange(channel, controller, value) && !multi.direct_thru()) {
-      Send3(0xb0 | channel, controller, value);
+    if (controller < stmlib_midi::kCCHoldPedal) {
+      Defer(0xb0 | channel, controller, value);
+    } else {
+      FlushDeferredMessages();
+      ApplyControlChange(channel, controller, value);
     }
   }
   
   static void ProgramChange(uint8_t channel, uint8_t program) {
+    FlushDeferredMessages();
     if (!multi.direct_thru()) {
       Send2(0xc0 | channel, program);
     }
   }
   
   static void PitchBend(uint8_t channel, uint16_t pitch_bend) {
-    if (multi.PitchBend(channel, pitch_bend) && !multi.direct_thru()) {
-      Send3(0xe0 | channel, pitch_bend >> 7, pitch_bend & 0x7f);
-    }
+    Defer(0xe0 | channel, pitch_bend & 0x7f, pitch_bend >> 7);
   }
 
   static void AllSoundOff(uint8_t channel) {
+    FlushDeferredMessages();
     if (multi.AllSoundOff(channel) && !multi.direct_thru()) {
       Send3(0xb0 | channel, 0x78, 0x00);
     }
   }
   
   static void ResetAllControllers(uint8_t channel) {
+    FlushDeferredMessages();
     if (multi.ResetAllControllers(channel) && !multi.direct_thru()) {
       Send3(0xb0 | channel, 0x79, 0x00);
     }
   }
   
   static void AllNotesOff(uint8_t channel) {
+    FlushDeferredMessages();
     if (multi.AllNotesOff(channel) && !multi.direct_thru()) {
       Send3(0xb0 | channel, 0x7b, 0x00);
     }
   }
   
   static void SysExStart() {
+    FlushDeferredMessages();
     sysex_rx_write_ptr_ = 0;
     ProcessSysExByte(0xf0);
   }
@@ -131,30 +141,35 @@ class MidiHandler {
   static void BozoByte(uint8_t bozo_byte) { }
 
   static void Clock() {
+    FlushDeferredMessages();
     if (!multi.internal_clock()) {
       multi.Clock();
     }
   }
   
   static void Start() {
+    FlushDeferredMessages();
     if (!multi.internal_clock()) {
       multi.Start(false);
     }
   }
   
   static void Continue() {
+    FlushDeferredMessages();
     if (!multi.internal_clock()) {
       multi.Continue();
     }
   }
   
   static void Stop() {
+    FlushDeferredMessages();
     if (!multi.internal_clock()) {
       multi.Stop();
     }
   }
   
   static void Reset() {
+    FlushDeferredMessages();
     multi.Reset();
   }
   
@@ -203,10 +218,15 @@ class MidiHandler {
     input_buffer_.Overwrite(byte);
   }
   
+  // Parses all the bytes received since the previous call. Within this batch,
+  // the continuous controllers, channel pressure and pitch bend messages are
+  // coalesced: when a dense stream of them queues up, only the last value of
+  // each one is applied and sent to the MIDI output.
   static void ProcessInput() {
     while (input_buffer_.readable()) {
       parser_.PushByte(input_buffer_.ImmediateRead());
     }
+    FlushDeferredMessages();
   }
   
   static inline MidiBuffer* mutable_output_buffer() { return &output_buffer_; }
@@ -269,6 +289,41 @@ class MidiHandler {
       const uint8_t* data,
       size_t size);
   static void DecodeSysExMessage();
+  
+  struct DeferredMessage {
+    uint8_t status;
+    uint8_t data[2];
+  };
+  
+  // A message replaces the deferred message with the same status (and
+  // controller number) and moves to the end of the list, so that the
+  // messages are applied in the order in which their last values arrived.
+  // Messages of all other types flush the list before being applied.
+  static void Defer(uint8_t status, uint8_t data_1, uint8_t data_2);
+  static void FlushDeferredMessages();
+  static void ApplyDeferredMessage(const DeferredMessage& message);
+  
+  static void ApplyAftertouch(uint8_t channel, uint8_t velocity) {
+    if (multi.Aftertouch(channel, velocity) && !multi.direct_thru()) {
+      Send2(0xd0 | channel, velocity);
+    }
+  }
+  
+  static void ApplyControlChange(
+      uint8_t channel,
+      uint8_t controller,
+      uint8_t value) {
+    if (multi.ControlChange(channel, controller, value) && !multi.direct_thru()) {
+      Send3(0xb0 | channel, controller, value);
+    }
+  }
+  
+  static void ApplyPitchBend(uint8_t channel, uint16_t pitch_bend) {
+    if (multi.PitchBend(channel, pitch_bend) && !multi.direct_thru()) {
+      Send3(0xe0 | channel, pitch_bend >> 7, pitch_bend & 0x7f);
+    }
+  }
+  
   inline static void ProcessSysExByte(uint8_t sysex_byte) {
     if (!multi.direct_thru()) {
       Send1(sysex_byte);
@@ -290,6 +345,9 @@ class MidiHandler {
   static uint8_t sysex_rx_buffer_[kSysexRxBufferSize];
   static uint8_t sysex_rx_write_ptr_;
   
+  static DeferredMessage deferred_[kMaxDeferredMessages];
+  static uint8_t num_deferred_;
+  
   static uint8_t previous_packet_index_;
   
   static uint8_t calibration_voice_;
@@ -401,7 +401,7 @@ class Multi {
   void DeserializeCalibration(T* stream_buffer) {
     for (uint8_t i = 0; i < kNumVoices; ++i) {
       for (uint8_t j = 0; j < kNumOctaves; ++j) {
-        uint16_t v;
+        uint16_t v = 0;
         stream_buffer->Read(&v);
         voice_[i].set_calibration_dac_code(j, v);
       }
@@ -0,0 +1,65 @@
+// Copyright 2013 Olivier Gillet.
+//
+// Author: Olivier Gillet (ol.gillet@gmail.com)
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host replacement for stmlib/system/storage.h: the blocks are kept in memory,
+// and start empty - as on a module with an erased flash.
+
+#ifndef YARNS_TEST_HOST_STMLIB_SYSTEM_STORAGE_H_
+#define YARNS_TEST_HOST_STMLIB_SYSTEM_STORAGE_H_
+
+#include <cstring>
+
+#include "stmlib/stmlib.h"
+
+namespace stmlib {
+
+const size_t kHostStorageBlockSize = 1024;
+
+template<uint32_t last_address, uint16_t num_blocks>
+class Storage {
+ public:
+  Storage() {
+    memset(size_, 0, sizeof(size_));
+  }
+  ~Storage() { }
+
+  void Save(const void* data, size_t data_size, uint16_t block_index) {
+    if (block_index >= num_blocks || data_size > kHostStorageBlockSize) {
+      return;
+    }
+    memcpy(block_[block_index], data, data_size);
+    size_[block_index] = data_size;
+  }
+
+  bool Load(void* data, size_t data_size, uint16_t block_index) {
+    if (block_index >= num_blocks || size_[block_index] != data_size) {
+      return false;
+    }
+    memcpy(data, block_[block_index], data_size);
+    return true;
+  }
+
+ private:
+  uint8_t block_[num_blocks][kHostStorageBlockSize];
+  size_t size_[num_blocks];
+
+  DISALLOW_COPY_AND_ASSIGN(Storage);
+};
+
+}  // namespace stmlib
+
+#endif  // YARNS_TEST_HOST_STMLIB_SYSTEM_STORAGE_H_
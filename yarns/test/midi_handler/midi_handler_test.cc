@@ -0,0 +1,160 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Checks the coalescing of continuous messages by MidiHandler::ProcessInput.
+//
+// A batch of interleaved pitch bends and controllers on two channels, with a
+// note in the middle, must leave the multi in the same state, and send the
+// same bytes to the MIDI output, as the last value of each message before and
+// after the note, played one by one. A controller queued before a MIDI clock
+// must be applied before the clock.
+
+#include <cstdio>
+#include <vector>
+
+#include "yarns/midi_handler.h"
+#include "yarns/multi.h"
+#include "yarns/settings.h"
+
+using namespace yarns;
+using namespace std;
+
+const uint8_t kBatch[] = {
+  0xe0, 0x00, 0x40,
+  0xb0, 0x01, 0x10,
+  0xe1, 0x00, 0x20,
+  0xe0, 0x00, 0x41,
+  0xb0, 0x01, 0x11,
+  0x90, 0x3c, 0x64,
+  0xe0, 0x00, 0x42,
+  0xe1, 0x00, 0x21,
+  0xb0, 0x01, 0x12,
+  0xe0, 0x00, 0x43,
+};
+
+// The messages which survive, in the order in which their last values
+// arrived.
+const uint8_t kCoalescedBatch[] = {
+  0xe1, 0x00, 0x20,
+  0xe0, 0x00, 0x41,
+  0xb0, 0x01, 0x11,
+  0x90, 0x3c, 0x64,
+  0xe1, 0x00, 0x21,
+  0xb0, 0x01, 0x12,
+  0xe0, 0x00, 0x43,
+};
+
+// Part 0 listens to all channels; channel 16 is the remote control channel,
+// on which CC 2 sets the tempo.
+void Reset() {
+  settings.Init();
+  multi.Init();
+  multi.mutable_part(0)->mutable_midi_settings()->channel = 0x10;
+  multi.Set(MULTI_REMOTE_CONTROL_CHANNEL, 16);
+  multi.Set(MULTI_CLOCK_TEMPO, 39);
+  midi_handler.Init();
+}
+
+// CV and gate outputs, once the portamento and the modulations have settled.
+void GetCvGate(uint16_t* cv, bool* gate) {
+  for (uint16_t i = 0; i < 8000; ++i) {
+    multi.Refresh();
+  }
+  multi.GetCvGate(cv, gate);
+}
+
+template<typename Buffer>
+void Drain(Buffer* buffer, vector<uint8_t>* bytes) {
+  while (buffer->readable()) {
+    bytes->push_back(buffer->ImmediateRead());
+  }
+}
+
+// Pushes size bytes, and parses them at once or messages_per_batch messages
+// (of 3 bytes) at a time.
+void Play(
+    const uint8_t* data,
+    size_t size,
+    size_t messages_per_batch,
+    vector<uint8_t>* output) {
+  size_t batch_size = messages_per_batch ? messages_per_batch * 3 : size;
+  for (size_t i = 0; i < size; i += batch_size) {
+    for (size_t j = i; j < i + batch_size && j < size; ++j) {
+      midi_handler.PushByte(data[j]);
+    }
+    midi_handler.ProcessInput();
+    Drain(midi_handler.mutable_output_buffer(), output);
+  }
+}
+
+bool CheckCoalescing() {
+  vector<uint8_t> coalesced;
+  uint16_t cv[kNumVoices];
+  bool gate[kNumVoices];
+  Reset();
+  Play(kBatch, sizeof(kBatch), 0, &coalesced);
+  GetCvGate(cv, gate);
+
+  vector<uint8_t> expected;
+  uint16_t expected_cv[kNumVoices];
+  bool expected_gate[kNumVoices];
+  Reset();
+  Play(kCoalescedBatch, sizeof(kCoalescedBatch), 1, &expected);
+  GetCvGate(expected_cv, expected_gate);
+
+  if (coalesced != expected) {
+    printf("coalescing: the MIDI output differs (%d bytes, %d expected)\n",
+           static_cast<int>(coalesced.size()),
+           static_cast<int>(expected.size()));
+    return false;
+  }
+  for (uint8_t i = 0; i < kNumVoices; ++i) {
+    if (cv[i] != expected_cv[i] || gate[i] != expected_gate[i]) {
+      printf("coalescing: the output of voice %d differs\n", i);
+      return false;
+    }
+  }
+  printf("coalescing: %d bytes in, %d bytes out, as expected\n",
+         static_cast<int>(sizeof(kBatch)),
+         static_cast<int>(coalesced.size()));
+  return true;
+}
+
+bool CheckClock() {
+  const uint8_t start[] = { 0xfa };
+  // Switches to the internal clock, then sends an external clock tick - which
+  // must be ignored.
+  const uint8_t batch[] = { 0xbf, 0x02, 0x7f, 0xf8 };
+  vector<uint8_t> output;
+  vector<uint8_t> clock_output;
+
+  Reset();
+  Play(start, sizeof(start), 0, &output);
+  midi_handler.mutable_high_priority_output_buffer()->Init();
+  Play(batch, sizeof(batch), 0, &output);
+  Drain(midi_handler.mutable_high_priority_output_buffer(), &clock_output);
+  if (!multi.internal_clock() || !clock_output.empty()) {
+    printf("clock: the tick was processed before the tempo change\n");
+    return false;
+  }
+  printf("clock: the tempo change was applied before the tick\n");
+  return true;
+}
+
+int main(int argc, char** argv) {
+  bool success = CheckCoalescing();
+  success = CheckClock() && success;
+  return success ? 0 : 1;
+}
@@ -0,0 +1,578 @@
+// Copyright 2026 Mutable Instruments contributors.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// -----------------------------------------------------------------------------
+//
+// Host simulator: plays Standard MIDI Files through Multi/Part/Voice, and
+// writes the timelines of the CV and gate outputs.
+//
+// The 8kHz interrupt of the module is simulated tick by tick, in the same
+// order as yarns.cc: one byte of MIDI input pushed, MidiHandler::PushByte,
+// Multi::Refresh, Multi::GetCvGate; then 6 refreshes of the 48kHz internal
+// clock, and what the main loop does between two interrupts. MIDI bytes
+// arrive at the rate of the serial link (31250 bauds). The gate outputs are
+// written one tick after the CV outputs, as on the module.
+//
+// Each file is simulated by its own process, from the same initial state:
+// the results do not depend on the order of the files or on the number of
+// processes.
+//
+// usage: yarns_simulator [options] file.mid...
+//   -s [part:]XX=value  sets the setting with the short name XX (as shown
+//                       on the display) to value. Repeatable, applied in
+//                       order. Example: -s LA=4 -s 1:AR=2
+//   -f csv|wav          csv (default): one line per change of the outputs.
+//                       wav: 8 channels (4 CV, 4 gates) at 8kHz.
+//   -o directory        where to write the timelines (default: next to the
+//                       MIDI files).
+//   -t seconds          time simulated after the end of the file (default 2).
+//   -j processes        number of files simulated in parallel (default: 1).
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "yarns/midi_handler.h"
+#include "yarns/multi.h"
+#include "yarns/settings.h"
+#include "yarns/storage_manager.h"
+
+using namespace yarns;
+using namespace std;
+
+const uint32_t kTickRate = 8000;
+const uint8_t kInternalClockRefreshPerTick = 6;  // 48kHz.
+const double kMidiBytePeriod = 10.0 / 31250.0;
+const uint8_t kNumChannels = 4;
+
+// The events of all the tracks of a Standard MIDI File, merged and converted
+// to a stream of bytes timestamped in seconds.
+class MidiFileReader {
+ public:
+  MidiFileReader() : duration_(0.0), error_("") { }
+
+  struct TimedByte {
+    double time;
+    uint8_t value;
+  };
+
+  bool Read(const char* path) {
+    FILE* fp = fopen(path, "rb");
+    if (!fp) {
+      error_ = "cannot open file";
+      return false;
+    }
+    data_.clear();
+    uint8_t buffer[4096];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+      data_.insert(data_.end(), buffer, buffer + size);
+    }
+    fclose(fp);
+    return Parse();
+  }
+
+  const vector<TimedByte>& bytes() const { return bytes_; }
+  double duration() const { return duration_; }
+  const char* error() const { return error_; }
+
+ private:
+  // The bytes of an event are in payload_, from offset to offset + size.
+  struct Event {
+    uint32_t tick;
+    uint32_t order;  // Position in the file, to sort events in a stable way.
+    uint32_t tempo;  // In us per quarter note, for tempo changes. 0 otherwise.
+    size_t offset;
+    size_t size;
+  };
+
+  static bool EventBefore(const Event& a, const Event& b) {
+    return a.tick != b.tick ? a.tick < b.tick : a.order < b.order;
+  }
+
+  uint32_t ReadBigEndian(size_t offset, uint8_t size) const {
+    uint32_t value = 0;
+    while (size--) {
+      value = (value << 8) | data_[offset++];
+    }
+    return value;
+  }
+
+  bool ReadVariableLength(size_t* position, size_t end, uint32_t* value) {
+    *value = 0;
+    for (uint8_t i = 0; i < 4; ++i) {
+      if (*position >= end) {
+        return false;
+      }
+      uint8_t byte = data_[(*position)++];
+      *value = (*value << 7) | (byte & 0x7f);
+      if (!(byte & 0x80)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Parse() {
+    if (data_.size() < 14 || memcmp(&data_[0], "MThd", 4)) {
+      error_ = "not a MIDI file";
+      return false;
+    }
+    uint32_t header_size = ReadBigEndian(4, 4);
+    uint16_t num_tracks = ReadBigEndian(10, 2);
+    uint16_t division = ReadBigEndian(12, 2);
+    if (division & 0x8000) {
+      error_ = "SMPTE time division not supported";
+      return false;
+    }
+
+    vector<Event> events;
+    payload_.clear();
+    size_t chunk = 8 + header_size;
+    uint32_t order = 0;
+    for (uint16_t track = 0;
+         track < num_tracks && chunk + 8 <= data_.size();
+         ++track) {
+      uint32_t chunk_size = ReadBigEndian(chunk + 4, 4);
+      size_t position = chunk + 8;
+      size_t end = min(position + chunk_size, data_.size());
+      bool is_track = !memcmp(&data_[chunk], "MTrk", 4);
+      chunk = position + chunk_size;
+      if (!is_track) {
+        continue;
+      }
+
+      uint32_t tick = 0;
+      uint8_t running_status = 0;
+      while (position < end) {
+        uint32_t delta;
+        if (!ReadVariableLength(&position, end, &delta) || position >= end) {
+          break;
+        }
+        tick += delta;
+        Event e;
+        e.tick = tick;
+        e.order = order++;
+        e.tempo = 0;
+        e.offset = payload_.size();
+        e.size = 0;
+        uint8_t status = data_[position];
+        if (status == 0xff) {
+          // Meta event. Only tempo changes are kept.
+          if (position + 2 > end) {
+            break;
+          }
+          uint8_t type = data_[position + 1];
+          position += 2;
+          uint32_t size;
+          if (!ReadVariableLength(&position, end, &size) ||
+              position + size > end) {
+            break;
+          }
+          if (type == 0x51 && size == 3) {
+            e.tempo = ReadBigEndian(position, 3);
+            events.push_back(e);
+          } else if (type == 0x2f) {
+            position = end;
+          }
+          position += size;
+        } else if (status == 0xf0 || status == 0xf7) {
+          // SysEx, or escaped bytes sent as is.
+          ++position;
+          uint32_t size;
+          if (!ReadVariableLength(&position, end, &size) ||
+              position + size > end) {
+            break;
+          }
+          if (status == 0xf0) {
+            if (IsDumpRequest(&data_[position], size)) {
+              // Answering it would wait for the output buffer to drain,
+              // which only happens in the interrupt.
+              position += size;
+              continue;
+            }
+            payload_.push_back(0xf0);
+          }
+          payload_.insert(
+              payload_.end(),
+              &data_[position],
+              &data_[position] + size);
+          e.size = payload_.size() - e.offset;
+          events.push_back(e);
+          position += size;
+          running_status = 0;
+        } else {
+          if (status & 0x80) {
+            running_status = status;
+            ++position;
+          } else if (!running_status) {
+            break;
+          }
+          uint8_t type = running_status & 0xf0;
+          uint8_t size = (type == 0xc0 || type == 0xd0) ? 1 : 2;
+          if (position + size > end) {
+            break;
+          }
+          // Running status is not used on the way to the module.
+          payload_.push_back(running_status);
+          payload_.insert(
+              payload_.end(),
+              &data_[position],
+              &data_[position] + size);
+          e.size = size + 1;
+          events.push_back(e);
+          position += size;
+        }
+      }
+    }
+    stable_sort(events.begin(), events.end(), EventBefore);
+
+    // Ticks to seconds, following the tempo changes.
+    bytes_.clear();
+    double seconds_per_tick = 0.5 / division;
+    double time = 0.0;
+    uint32_t tick = 0;
+    for (size_t i = 0; i < events.size(); ++i) {
+      const Event& e = events[i];
+      time += (e.tick - tick) * seconds_per_tick;
+      tick = e.tick;
+      if (e.tempo) {
+        seconds_per_tick = e.tempo * 1e-6 / division;
+        continue;
+      }
+      for (size_t j = 0; j < e.size; ++j) {
+        TimedByte b;
+        b.time = time;
+        b.value = payload_[e.offset + j];
+        bytes_.push_back(b);
+      }
+    }
+    duration_ = time;
+    return true;
+  }
+
+  static bool IsDumpRequest(const uint8_t* data, size_t size) {
+    const uint8_t prefix[] = { 0x00, 0x21, 0x02, 0x00, 0x0b, 0x11 };
+    return size >= sizeof(prefix) && !memcmp(data, prefix, sizeof(prefix));
+  }
+
+  vector<uint8_t> data_;
+  vector<uint8_t> payload_;
+  vector<TimedByte> bytes_;
+  double duration_;
+  const char* error_;
+};
+
+class TimelineWriter {
+ public:
+  TimelineWriter() : fp_(NULL), wav_(false), num_samples_(0) { }
+
+  bool Open(const string& path, bool wav) {
+    fp_ = fopen(path.c_str(), "wb");
+    if (!fp_) {
+      return false;
+    }
+    wav_ = wav;
+    num_samples_ = 0;
+    if (wav_) {
+      WriteWavHeader();
+    } else {
+      fprintf(fp_, "tick,time");
+      for (uint8_t i = 0; i < kNumChannels; ++i) {
+        fprintf(fp_, ",cv_%d", i + 1);
+      }
+      for (uint8_t i = 0; i < kNumChannels; ++i) {
+        fprintf(fp_, ",gate_%d", i + 1);
+      }
+      fprintf(fp_, "\n");
+    }
+    return true;
+  }
+
+  void Write(uint32_t tick, const uint16_t* cv, const bool* gate) {
+    if (wav_) {
+      int16_t frame[kNumChannels * 2];
+      for (uint8_t i = 0; i < kNumChannels; ++i) {
+        frame[i] = static_cast<int16_t>(cv[i] ^ 0x8000);
+        frame[kNumChannels + i] = gate[i] ? 32767 : 0;
+      }
+      fwrite(frame, sizeof(frame), 1, fp_);
+      ++num_samples_;
+      return;
+    }
+    if (tick && !memcmp(cv, previous_cv_, sizeof(previous_cv_)) &&
+        !memcmp(gate, previous_gate_, sizeof(previous_gate_))) {
+      return;
+    }
+    memcpy(previous_cv_, cv, sizeof(previous_cv_));
+    memcpy(previous_gate_, gate, sizeof(previous_gate_));
+    fprintf(fp_, "%u,%.6f", tick, static_cast<double>(tick) / kTickRate);
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+      fprintf(fp_, ",%d", cv[i]);
+    }
+    for (uint8_t i = 0; i < kNumChannels; ++i) {
+      fprintf(fp_, ",%d", gate[i] ? 1 : 0);
+    }
+    fprintf(fp_, "\n");
+  }
+
+  void Close() {
+    if (wav_) {
+      fseek(fp_, 0, SEEK_SET);
+      WriteWavHeader();
+    }
+    fclose(fp_);
+    fp_ = NULL;
+  }
+
+ private:
+  void WriteWavHeader() {
+    uint32_t l;
+    uint16_t s;
+    uint16_t num_channels = kNumChannels * 2;
+    uint32_t data_size = num_samples_ * 2 * num_channels;
+
+    fwrite("RIFF", 4, 1, fp_);
+    l = 36 + data_size;
+    fwrite(&l, 4, 1, fp_);
+    fwrite("WAVE", 4, 1, fp_);
+
+    fwrite("fmt ", 4, 1, fp_);
+    l = 16;
+    fwrite(&l, 4, 1, fp_);
+    s = 1;
+    fwrite(&s, 2, 1, fp_);
+    s = num_channels;
+    fwrite(&s, 2, 1, fp_);
+    l = kTickRate;
+    fwrite(&l, 4, 1, fp_);
+    l = kTickRate * 2 * num_channels;
+    fwrite(&l, 4, 1, fp_);
+    s = 2 * num_channels;
+    fwrite(&s, 2, 1, fp_);
+    s = 16;
+    fwrite(&s, 2, 1, fp_);
+
+    fwrite("data", 4, 1, fp_);
+    l = data_size;
+    fwrite(&l, 4, 1, fp_);
+  }
+
+  FILE* fp_;
+  bool wav_;
+  uint32_t num_samples_;
+  uint16_t previous_cv_[kNumChannels];
+  bool previous_gate_[kNumChannels];
+};
+
+struct Options {
+  vector<string> settings;
+  bool wav;
+  string output_directory;
+  double tail;
+  int num_processes;
+};
+
+bool ApplySetting(const string& assignment) {
+  uint8_t part = 0;
+  string name = assignment;
+  size_t colon = name.find(':');
+  if (colon != string::npos) {
+    part = atoi(name.substr(0, colon).c_str()) - 1;
+    name = name.substr(colon + 1);
+  }
+  size_t equal = name.find('=');
+  if (equal == string::npos) {
+    return false;
+  }
+  uint8_t value = atoi(name.substr(equal + 1).c_str());
+  name = name.substr(0, equal);
+  for (uint8_t i = 0; i < SETTING_LAST; ++i) {
+    const Setting& setting = settings.setting(i);
+    if (name == setting.short_name) {
+      if (part >= multi.num_active_parts()) {
+        return false;
+      }
+      settings.Set(setting, &part, value);
+      return true;
+    }
+  }
+  return false;
+}
+
+string OutputPath(const string& path, const Options& options) {
+  string base = path;
+  size_t dot = base.rfind('.');
+  size_t slash = base.rfind('/');
+  if (dot != string::npos && (slash == string::npos || dot > slash)) {
+    base = base.substr(0, dot);
+  }
+  if (!options.output_directory.empty()) {
+    slash = base.rfind('/');
+    base = options.output_directory + "/" + \
+        (slash == string::npos ? base : base.substr(slash + 1));
+  }
+  return base + (options.wav ? ".wav" : ".csv");
+}
+
+// Simulates the module playing a file. Returns the exit code of the process.
+int Simulate(const string& path, const Options& options) {
+  MidiFileReader reader;
+  if (!reader.Read(path.c_str())) {
+    fprintf(stderr, "%s: %s\n", path.c_str(), reader.error());
+    return 1;
+  }
+
+  // Same as the initialization of the module, with an erased flash.
+  settings.Init();
+  multi.Init();
+  storage_manager.LoadMulti(0);
+  storage_manager.LoadCalibration();
+  midi_handler.Init();
+  for (size_t i = 0; i < options.settings.size(); ++i) {
+    if (!ApplySetting(options.settings[i])) {
+      fprintf(stderr, "invalid setting: %s\n", options.settings[i].c_str());
+      return 1;
+    }
+  }
+
+  TimelineWriter writer;
+  string output_path = OutputPath(path, options);
+  if (!writer.Open(output_path, options.wav)) {
+    fprintf(stderr, "%s: cannot write file\n", output_path.c_str());
+    return 1;
+  }
+
+  const vector<MidiFileReader::TimedByte>& bytes = reader.bytes();
+  uint32_t num_ticks = static_cast<uint32_t>(
+      (reader.duration() + options.tail) * kTickRate);
+  size_t next_byte = 0;
+  double next_byte_time = 0.0;  // When the next byte is fully received.
+  if (!bytes.empty()) {
+    next_byte_time = bytes[0].time + kMidiBytePeriod;
+  }
+
+  uint16_t cv[kNumChannels] = { 0, 0, 0, 0 };
+  bool gate[kNumChannels] = { false, false, false, false };
+  bool gate_output[kNumChannels] = { false, false, false, false };
+  clock_t start = clock();
+  for (uint32_t tick = 0; tick < num_ticks || next_byte < bytes.size();
+       ++tick) {
+    double now = static_cast<double>(tick) / kTickRate;
+    if (next_byte < bytes.size() && next_byte_time <= now) {
+      midi_handler.PushByte(bytes[next_byte].value);
+      ++next_byte;
+      if (next_byte < bytes.size()) {
+        next_byte_time = max(bytes[next_byte].time, next_byte_time) + \
+            kMidiBytePeriod;
+      }
+    }
+
+    // Nothing is connected to the MIDI output.
+    midi_handler.mutable_high_priority_output_buffer()->Init();
+    midi_handler.mutable_output_buffer()->Init();
+
+    copy(&gate[0], &gate[kNumChannels], &gate_output[0]);
+    multi.Refresh();
+    multi.GetCvGate(cv, gate);
+    writer.Write(tick, cv, gate_output);
+
+    for (uint8_t i = 0; i < kInternalClockRefreshPerTick; ++i) {
+      multi.RefreshInternalClock();
+    }
+    midi_handler.ProcessInput();
+    multi.ProcessInternalClockEvents();
+  }
+  writer.Close();
+
+  double elapsed = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+  double simulated = static_cast<double>(num_ticks) / kTickRate;
+  fprintf(stderr, "%s: %.1f s in %.3f s (%.0fx real time)\n",
+          output_path.c_str(), simulated, elapsed,
+          elapsed > 0.0 ? simulated / elapsed : 0.0);
+  return 0;
+}
+
+void Usage(const char* program) {
+  fprintf(stderr, "usage: %s [-s [part:]XX=value] [-f csv|wav] "
+          "[-o directory] [-t seconds] [-j processes] file.mid...\n",
+          program);
+}
+
+int main(int argc, char** argv) {
+  Options options;
+  options.wav = false;
+  options.tail = 2.0;
+  options.num_processes = 1;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "s:f:o:t:j:")) != -1) {
+    switch (opt) {
+      case 's':
+        options.settings.push_back(optarg);
+        break;
+      case 'f':
+        options.wav = !strcmp(optarg, "wav");
+        break;
+      case 'o':
+        options.output_directory = optarg;
+        break;
+      case 't':
+        options.tail = atof(optarg);
+        break;
+      case 'j':
+        options.num_processes = max(1, atoi(optarg));
+        break;
+      default:
+        Usage(argv[0]);
+        return 1;
+    }
+  }
+  if (optind == argc) {
+    Usage(argv[0]);
+    return 1;
+  }
+
+  int num_failures = 0;
+  int num_running = 0;
+  for (int i = optind; i < argc || num_running; ) {
+    if (i < argc && num_running < options.num_processes) {
+      pid_t pid = fork();
+      if (pid == 0) {
+        _exit(Simulate(argv[i], options));
+      } else if (pid < 0) {
+        perror("fork");
+        return 1;
+      }
+      ++num_running;
+      ++i;
+      continue;
+    }
+    int status;
+    if (wait(&status) > 0) {
+      --num_running;
+      if (!WIFEXITED(status) || WEXITSTATUS(status)) {
+        ++num_failures;
+      }
+    }
+  }
+  return num_failures ? 1 : 0;
+}